@@ -0,0 +1,437 @@
+/*
+ * ports.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CONTAINER_BENCH_PORTS_H_
+#define CONTAINER_BENCH_PORTS_H_
+
+namespace lsp
+{
+    class BenchPort: public IPort
+    {
+        protected:
+            BenchWrapper       *pWrapper;
+
+        public:
+            explicit BenchPort(const port_t *meta, BenchWrapper *w): IPort(meta)
+            {
+                pWrapper        = w;
+            }
+
+            virtual ~BenchPort()
+            {
+                pWrapper        = NULL;
+            }
+
+        public:
+            virtual int init()
+            {
+                return STATUS_OK;
+            }
+
+            virtual void destroy()
+            {
+            }
+    };
+
+    class BenchPortGroup: public BenchPort
+    {
+        private:
+            float                   nCurrRow;
+            size_t                  nCols;
+            size_t                  nRows;
+
+        public:
+            explicit BenchPortGroup(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+                nCurrRow            = meta->start;
+                nCols               = port_list_size(meta->members);
+                nRows               = list_size(meta->items);
+            }
+
+            virtual ~BenchPortGroup()
+            {
+                nCurrRow            = 0;
+                nCols               = 0;
+                nRows               = 0;
+            }
+
+        public:
+            virtual void setValue(float value)
+            {
+                int32_t v = value;
+                if ((v >= 0) && (v < ssize_t(nRows)))
+                    nCurrRow        = v;
+            }
+
+            virtual float getValue()
+            {
+                return nCurrRow;
+            }
+
+        public:
+            inline size_t rows() const      { return nRows; }
+            inline size_t cols() const      { return nCols; }
+    };
+
+    /**
+     * Audio port: input ports are fed with the deterministic signal generated
+     * by the wrapper, output ports just provide the buffer to the plugin
+     */
+    class BenchAudioPort: public BenchPort
+    {
+        private:
+            float          *pBuffer;            // Data buffer
+            size_t          nIndex;             // Index of the input port
+
+        public:
+            explicit BenchAudioPort(const port_t *meta, BenchWrapper *w, size_t index) : BenchPort(meta, w)
+            {
+                pBuffer     = NULL;
+                nIndex      = index;
+            }
+
+            virtual ~BenchAudioPort()
+            {
+                pBuffer     = NULL;
+            };
+
+        public:
+            virtual void *getBuffer()
+            {
+                return pBuffer;
+            };
+
+            virtual int init()
+            {
+                pBuffer     = reinterpret_cast<float *>(::malloc(sizeof(float) * pWrapper->block_size()));
+                if (pBuffer == NULL)
+                    return STATUS_NO_MEM;
+                dsp::fill_zero(pBuffer, pWrapper->block_size());
+                return STATUS_OK;
+            }
+
+            virtual void destroy()
+            {
+                if (pBuffer != NULL)
+                {
+                    ::free(pBuffer);
+                    pBuffer     = NULL;
+                }
+            }
+
+            virtual bool pre_process(size_t samples)
+            {
+                if (IS_IN_PORT(pMetadata))
+                    pWrapper->read_signal(pBuffer, nIndex, samples);
+                return false;
+            }
+    };
+
+    /**
+     * MIDI port: input ports receive the deterministic sequence of notes
+     * generated by the wrapper, output ports are cleared after processing
+     */
+    class BenchMidiPort: public BenchPort
+    {
+        private:
+            midi_t          sMidi;
+
+        public:
+            explicit BenchMidiPort(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+                sMidi.clear();
+            }
+
+            virtual ~BenchMidiPort()
+            {
+            };
+
+        public:
+            virtual void *getBuffer()
+            {
+                return &sMidi;
+            };
+
+            virtual bool pre_process(size_t samples)
+            {
+                if (IS_IN_PORT(pMetadata))
+                {
+                    sMidi.clear();
+                    pWrapper->read_midi(&sMidi, samples);
+                }
+                return false;
+            }
+
+            virtual void post_process(size_t samples)
+            {
+                if (IS_OUT_PORT(pMetadata))
+                    sMidi.clear();
+            }
+    };
+
+    /**
+     * Control port: continuous input controls are automated by the wrapper
+     * with triangle-shaped sweep over the whole range of values
+     */
+    class BenchControlPort: public BenchPort
+    {
+        private:
+            float       fNewValue;
+            float       fCurrValue;
+            float       fPhase;
+            bool        bAutomated;
+
+        public:
+            explicit BenchControlPort(const port_t *meta, BenchWrapper *w, float phase) : BenchPort(meta, w)
+            {
+                fNewValue   = meta->start;
+                fCurrValue  = meta->start;
+                fPhase      = phase;
+                bAutomated  = (meta->role == R_CONTROL) &&
+                              ((meta->flags & (F_LOWER | F_UPPER)) == (F_LOWER | F_UPPER)) &&
+                              (!(meta->flags & (F_INT | F_TRG))) &&
+                              (meta->unit != U_BOOL) &&
+                              (meta->unit != U_ENUM) &&
+                              (meta->unit != U_SAMPLES);
+            }
+
+            virtual ~BenchControlPort()
+            {
+                fNewValue   = pMetadata->start;
+                fCurrValue  = pMetadata->start;
+            };
+
+        public:
+            virtual bool pre_process(size_t samples)
+            {
+                if (fNewValue == fCurrValue)
+                    return false;
+
+                fCurrValue   = fNewValue;
+                return true;
+            }
+
+            virtual float getValue()
+            {
+                return fCurrValue;
+            }
+
+            inline bool automated() const   { return bAutomated; }
+
+            void automate(float phase)
+            {
+                float k     = phase + fPhase;
+                k          -= int32_t(k);
+                k           = (k < 0.5f) ? 2.0f * k : 2.0f - 2.0f * k;
+                fNewValue   = limit_value(pMetadata, pMetadata->min + (pMetadata->max - pMetadata->min) * k);
+            }
+    };
+
+    class BenchMeterPort: public BenchPort
+    {
+        private:
+            float       fValue;
+
+        public:
+            explicit BenchMeterPort(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+                fValue      = meta->start;
+            }
+
+            virtual ~BenchMeterPort()
+            {
+                fValue      = pMetadata->start;
+            };
+
+        public:
+            virtual float getValue()
+            {
+                return fValue;
+            }
+
+            virtual void setValue(float value)
+            {
+                fValue      = value;
+            }
+    };
+
+    /**
+     * Mesh port: the wrapper emulates the UI which consumes the mesh
+     * data at the MESH_REFRESH_RATE
+     */
+    class BenchMeshPort: public BenchPort
+    {
+        private:
+            mesh_t     *pMesh;
+            size_t      nCounter;
+
+        public:
+            explicit BenchMeshPort(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+                pMesh       = NULL;
+                nCounter    = 0;
+            }
+
+            virtual ~BenchMeshPort()
+            {
+                pMesh       = NULL;
+            }
+
+        public:
+            virtual void *getBuffer()
+            {
+                return pMesh;
+            }
+
+            virtual int init()
+            {
+                size_t buffers      = size_t(pMetadata->step);
+                size_t buf_size     = ALIGN_SIZE(size_t(pMetadata->start) * sizeof(float), 0x40);
+                size_t mesh_size    = ALIGN_SIZE(sizeof(mesh_t) + sizeof(float *) * buffers, 0x40);
+
+                uint8_t *ptr        = reinterpret_cast<uint8_t *>(lsp_malloc(mesh_size + buf_size * buffers));
+                if (ptr == NULL)
+                    return STATUS_NO_MEM;
+
+                pMesh               = reinterpret_cast<mesh_t *>(ptr);
+                pMesh->nState       = M_EMPTY;
+                pMesh->nBuffers     = 0;
+                pMesh->nItems       = 0;
+                ptr                += mesh_size;
+                for (size_t i=0; i<buffers; ++i)
+                {
+                    pMesh->pvData[i]    = reinterpret_cast<float *>(ptr);
+                    ptr                += buf_size;
+                }
+
+                return STATUS_OK;
+            }
+
+            virtual void destroy()
+            {
+                if (pMesh != NULL)
+                {
+                    lsp_free(pMesh);
+                    pMesh       = NULL;
+                }
+            }
+
+            virtual void post_process(size_t samples)
+            {
+                if ((pMesh == NULL) || (!pWrapper->ui_active()))
+                    return;
+
+                nCounter       += samples;
+                size_t period   = pWrapper->sample_rate() / MESH_REFRESH_RATE;
+                if (nCounter < period)
+                    return;
+
+                nCounter       %= period;
+                if (pMesh->containsData())
+                    pMesh->cleanup();
+            }
+    };
+
+    class BenchFrameBufferPort: public BenchPort
+    {
+        private:
+            frame_buffer_t      sFB;
+
+        public:
+            explicit BenchFrameBufferPort(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+            }
+
+            virtual ~BenchFrameBufferPort()
+            {
+            }
+
+        public:
+            virtual void *getBuffer()
+            {
+                return &sFB;
+            }
+
+            virtual int init()
+            {
+                return sFB.init(pMetadata->start, pMetadata->step);
+            }
+
+            virtual void destroy()
+            {
+                sFB.destroy();
+            }
+    };
+
+    class BenchOscPort: public BenchPort
+    {
+        private:
+            osc_buffer_t     *pFB;
+
+        public:
+            explicit BenchOscPort(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+                pFB     = NULL;
+            }
+
+            virtual ~BenchOscPort()
+            {
+            }
+
+        public:
+            virtual void *getBuffer()
+            {
+                return pFB;
+            }
+
+            virtual int init()
+            {
+                pFB = osc_buffer_t::create(OSC_BUFFER_MAX);
+                return (pFB == NULL) ? STATUS_NO_MEM : STATUS_OK;
+            }
+
+            virtual void destroy()
+            {
+                if (pFB != NULL)
+                {
+                    osc_buffer_t::destroy(pFB);
+                    pFB     = NULL;
+                }
+            }
+
+            virtual void post_process(size_t samples)
+            {
+                // There is no UI that consumes messages
+                if ((pFB != NULL) && (IS_OUT_PORT(pMetadata)))
+                    pFB->clear();
+            }
+    };
+
+    class BenchPathPort: public BenchPort
+    {
+        private:
+            path_t          sPath;
+
+        public:
+            explicit BenchPathPort(const port_t *meta, BenchWrapper *w) : BenchPort(meta, w)
+            {
+                sPath.init();
+            }
+
+            virtual ~BenchPathPort()
+            {
+            }
+
+        public:
+            virtual void *getBuffer()
+            {
+                return &sPath;
+            }
+    };
+}
+
+#endif /* CONTAINER_BENCH_PORTS_H_ */
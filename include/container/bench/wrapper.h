@@ -0,0 +1,464 @@
+/*
+ * wrapper.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CONTAINER_BENCH_WRAPPER_H_
+#define CONTAINER_BENCH_WRAPPER_H_
+
+#include <core/types.h>
+#include <core/debug.h>
+#include <core/alloc.h>
+#include <core/IWrapper.h>
+#include <core/IPort.h>
+#include <core/plugin.h>
+#include <core/ipc/ThreadPoolExecutor.h>
+#include <core/protocol/midi.h>
+#include <container/const.h>
+
+#include <data/cvector.h>
+
+#define BENCH_SIGNAL_SHIFT          7919        /* Shift of the signal between input ports          */
+#define BENCH_AUTOMATION_STEPS      64          /* Number of automation steps per sweep             */
+#define BENCH_MIDI_NOTE_MIN         36          /* Minimum generated MIDI note                      */
+#define BENCH_MIDI_NOTE_RANGE       48          /* Range of generated MIDI notes                    */
+
+namespace lsp
+{
+    class BenchPort;
+    class BenchControlPort;
+
+    /**
+     * Settings of the synthetic host environment
+     */
+    typedef struct bench_settings_t
+    {
+        size_t              sample_rate;    // Sample rate
+        size_t              block_size;     // Number of samples passed to each process() call
+        size_t              automation;     // Number of blocks between automation steps, 0 disables automation
+        size_t              midi_period;    // Number of samples between MIDI notes, 0 disables MIDI events
+        bool                ui;             // Emulate active UI
+    } bench_settings_t;
+
+    /**
+     * Headless wrapper that hosts the plugin without any audio subsystem.
+     * All input data is synthetic and deterministic: the same settings
+     * always give the same sequence of audio samples, MIDI events and
+     * control changes passed to the plugin.
+     */
+    class BenchWrapper: public IWrapper
+    {
+        private:
+            plugin_t                   *pPlugin;
+            ipc::IExecutor             *pExecutor;
+            bench_settings_t            sSettings;
+            position_t                  sPosition;
+            bool                        bUpdateSettings;
+
+            float                      *vSignal;        // Generated input signal
+            size_t                      nSignalLen;     // Length of the signal
+            wsize_t                     nPosition;      // Current position in samples
+            wsize_t                     nBlocks;        // Number of processed blocks
+            size_t                      nInputs;        // Number of audio inputs
+
+            cvector<BenchPort>          vPorts;
+            cvector<BenchControlPort>   vControls;      // Automated controls
+            cvector<port_t>             vGenMetadata;   // Generated metadata
+
+        protected:
+            void            create_port(const port_t *port, const char *postfix);
+            status_t        generate_signal();
+            void            automate();
+
+        public:
+            explicit BenchWrapper(plugin_t *plugin);
+            virtual ~BenchWrapper();
+
+        public:
+            virtual ipc::IExecutor *get_executor();
+
+            virtual const position_t *position()
+            {
+                return &sPosition;
+            }
+
+        public:
+            /**
+             * Create ports, initialize and activate the plugin
+             * @param settings settings of the environment
+             * @return status of operation
+             */
+            status_t        init(const bench_settings_t *settings);
+
+            /**
+             * Deactivate the plugin and destroy all ports, the plugin
+             * should be destroyed by the caller
+             */
+            void            destroy();
+
+            /**
+             * Process one block of data
+             */
+            void            run();
+
+            /**
+             * Fill the buffer with the generated signal for the audio input
+             * @param dst destination buffer
+             * @param index index of the audio input
+             * @param samples number of samples to read
+             */
+            void            read_signal(float *dst, size_t index, size_t samples);
+
+            /**
+             * Emit MIDI events for the current block
+             * @param dst MIDI buffer
+             * @param samples number of samples in block
+             */
+            void            read_midi(midi_t *dst, size_t samples);
+
+        public:
+            inline size_t   sample_rate() const     { return sSettings.sample_rate;     }
+            inline size_t   block_size() const      { return sSettings.block_size;      }
+            inline bool     ui_active() const       { return sSettings.ui;              }
+            inline size_t   automated() const       { return vControls.size();          }
+    };
+}
+
+#include <container/bench/ports.h>
+
+namespace lsp
+{
+    BenchWrapper::BenchWrapper(plugin_t *plugin)
+    {
+        pPlugin         = plugin;
+        pExecutor       = NULL;
+        bUpdateSettings = true;
+        vSignal         = NULL;
+        nSignalLen      = 0;
+        nPosition       = 0;
+        nBlocks         = 0;
+        nInputs         = 0;
+
+        sSettings.sample_rate   = 48000;
+        sSettings.block_size    = 512;
+        sSettings.automation    = 0;
+        sSettings.midi_period   = 0;
+        sSettings.ui            = false;
+
+        position_t::init(&sPosition);
+    }
+
+    BenchWrapper::~BenchWrapper()
+    {
+        destroy();
+    }
+
+    status_t BenchWrapper::generate_signal()
+    {
+        // One second of the signal: all components have integer number of periods
+        // so the signal can be looped without any discontinuities
+        nSignalLen      = sSettings.sample_rate;
+        vSignal         = reinterpret_cast<float *>(::malloc(sizeof(float) * nSignalLen));
+        if (vSignal == NULL)
+            return STATUS_NO_MEM;
+
+        uint32_t seed   = 0x1234567;
+        float k         = 2.0f * M_PI / nSignalLen;
+        for (size_t i=0; i<nSignalLen; ++i)
+        {
+            seed            = seed * 1664525 + 1013904223;
+            float noise     = int32_t(seed) * (1.0f / 0x80000000U);
+            float env       = 0.55f - 0.45f * cosf(k * 2 * i);
+
+            vSignal[i]      = env * (0.25f * sinf(k * 220 * i) + 0.125f * sinf(k * 1761 * i) + 0.0625f * noise);
+        }
+
+        return STATUS_OK;
+    }
+
+    void BenchWrapper::read_signal(float *dst, size_t index, size_t samples)
+    {
+        size_t pos      = (nPosition + index * BENCH_SIGNAL_SHIFT) % nSignalLen;
+        while (samples > 0)
+        {
+            size_t n        = nSignalLen - pos;
+            if (n > samples)
+                n               = samples;
+
+            dsp::copy(dst, &vSignal[pos], n);
+            dst            += n;
+            samples        -= n;
+            pos             = 0;
+        }
+    }
+
+    void BenchWrapper::read_midi(midi_t *dst, size_t samples)
+    {
+        size_t period   = sSettings.midi_period;
+        if (period <= 0)
+            return;
+
+        // Notes are switched on at the start of each period and switched off at the middle
+        size_t half     = period >> 1;
+        wsize_t end     = nPosition + samples;
+        wsize_t note    = nPosition / period;
+        midi::event_t ev;
+
+        ev.channel      = 0;
+        for (wsize_t t = note * period; t < end; t += period, ++note)
+        {
+            ev.note.pitch       = BENCH_MIDI_NOTE_MIN + (note * 7) % BENCH_MIDI_NOTE_RANGE;
+
+            if (t >= nPosition)
+            {
+                ev.timestamp        = t - nPosition;
+                ev.type             = midi::MIDI_MSG_NOTE_ON;
+                ev.note.velocity    = 64 + (note * 13) % 64;
+                dst->push(ev);
+            }
+            if (((t + half) >= nPosition) && ((t + half) < end))
+            {
+                ev.timestamp        = t + half - nPosition;
+                ev.type             = midi::MIDI_MSG_NOTE_OFF;
+                ev.note.velocity    = 0;
+                dst->push(ev);
+            }
+        }
+    }
+
+    void BenchWrapper::automate()
+    {
+        size_t period   = sSettings.automation;
+        if ((period <= 0) || ((nBlocks % period) != 0))
+            return;
+
+        float phase     = float((nBlocks / period) % BENCH_AUTOMATION_STEPS) / BENCH_AUTOMATION_STEPS;
+        for (size_t i=0, n=vControls.size(); i<n; ++i)
+            vControls.at(i)->automate(phase);
+    }
+
+    void BenchWrapper::create_port(const port_t *port, const char *postfix)
+    {
+        BenchPort *bp   = NULL;
+
+        switch (port->role)
+        {
+            case R_MESH:
+                bp      = new BenchMeshPort(port, this);
+                break;
+
+            case R_FBUFFER:
+                bp      = new BenchFrameBufferPort(port, this);
+                break;
+
+            case R_AUDIO:
+                bp      = new BenchAudioPort(port, this, (IS_IN_PORT(port)) ? nInputs++ : 0);
+                break;
+
+            case R_MIDI:
+                bp      = new BenchMidiPort(port, this);
+                break;
+
+            case R_OSC:
+                bp      = new BenchOscPort(port, this);
+                break;
+
+            case R_PATH:
+                bp      = new BenchPathPort(port, this);
+                break;
+
+            case R_CONTROL:
+            case R_BYPASS:
+            {
+                // Each control gets it's own phase of automation
+                float phase             = float((vPorts.size() * 5) % BENCH_AUTOMATION_STEPS) / BENCH_AUTOMATION_STEPS;
+                BenchControlPort *cp    = new BenchControlPort(port, this, phase);
+                if ((cp != NULL) && (IS_IN_PORT(port)) && (cp->automated()))
+                    vControls.add(cp);
+                bp      = cp;
+                break;
+            }
+
+            case R_METER:
+                bp      = new BenchMeterPort(port, this);
+                break;
+
+            case R_PORT_SET:
+            {
+                char postfix_buf[LSP_MAX_PARAM_ID_BYTES];
+                BenchPortGroup *pg      = new BenchPortGroup(port, this);
+                vPorts.add(pg);
+                pPlugin->add_port(pg);
+
+                for (size_t row=0; row<pg->rows(); ++row)
+                {
+                    // Generate postfix
+                    snprintf(postfix_buf, sizeof(postfix_buf)-1, "%s_%d", (postfix != NULL) ? postfix : "", int(row));
+
+                    // Clone port metadata
+                    port_t *cm          = clone_port_metadata(port->members, postfix_buf);
+                    if (cm != NULL)
+                    {
+                        vGenMetadata.add(cm);
+
+                        for (; cm->id != NULL; ++cm)
+                        {
+                            if (IS_GROWING_PORT(cm))
+                                cm->start    = cm->min + ((cm->max - cm->min) * row) / float(pg->rows());
+                            else if (IS_LOWERING_PORT(cm))
+                                cm->start    = cm->max - ((cm->max - cm->min) * row) / float(pg->rows());
+
+                            create_port(cm, postfix_buf);
+                        }
+                    }
+                }
+
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        if (bp != NULL)
+        {
+            vPorts.add(bp);
+            pPlugin->add_port(bp);
+        }
+    }
+
+    status_t BenchWrapper::init(const bench_settings_t *settings)
+    {
+        sSettings       = *settings;
+        if ((sSettings.sample_rate <= 0) || (sSettings.block_size <= 0))
+            return STATUS_BAD_ARGUMENTS;
+
+        status_t res    = generate_signal();
+        if (res != STATUS_OK)
+            return res;
+
+        // Create ports
+        for (const port_t *meta = pPlugin->get_metadata()->ports ; meta->id != NULL; ++meta)
+            create_port(meta, NULL);
+
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *p    = vPorts.at(i);
+            if ((p != NULL) && ((res = p->init()) != STATUS_OK))
+                return res;
+        }
+
+        // Initialize and activate the plugin
+        sPosition.sampleRate    = sSettings.sample_rate;
+        sPosition.speed         = 1.0;
+
+        pPlugin->init(this);
+        pPlugin->set_sample_rate(sSettings.sample_rate);
+        pPlugin->set_position(&sPosition);
+        pPlugin->activate();
+        if (sSettings.ui)
+            pPlugin->activate_ui();
+
+        lsp_trace("Initialized plugin %s: %d ports, %d automated",
+                pPlugin->get_metadata()->lv2_uid, int(vPorts.size()), int(vControls.size()));
+
+        return STATUS_OK;
+    }
+
+    void BenchWrapper::run()
+    {
+        size_t samples      = sSettings.block_size;
+
+        // Prepare ports
+        automate();
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *port     = vPorts.at(i);
+            if ((port != NULL) && (port->pre_process(samples)))
+                bUpdateSettings     = true;
+        }
+
+        // Check that input parameters have changed
+        if (bUpdateSettings)
+        {
+            pPlugin->update_settings();
+            bUpdateSettings     = false;
+        }
+
+        // Call the main processing unit
+        pPlugin->process(samples);
+
+        // Post-process ALL ports
+        for (size_t i=0, n=vPorts.size(); i<n; ++i)
+        {
+            BenchPort *port     = vPorts.at(i);
+            if (port != NULL)
+                port->post_process(samples);
+        }
+
+        // Update position
+        nPosition          += samples;
+        sPosition.frame    += samples;
+        ++nBlocks;
+    }
+
+    void BenchWrapper::destroy()
+    {
+        if (pPlugin != NULL)
+        {
+            pPlugin->deactivate_ui();
+            pPlugin->deactivate();
+        }
+
+        // Destroy ports
+        for (size_t i=0; i<vPorts.size(); ++i)
+        {
+            vPorts[i]->destroy();
+            delete vPorts[i];
+        }
+        vPorts.flush();
+        vControls.flush();
+
+        // Cleanup generated metadata
+        for (size_t i=0; i<vGenMetadata.size(); ++i)
+            drop_port_metadata(vGenMetadata[i]);
+        vGenMetadata.flush();
+
+        // Destroy executor service
+        if (pExecutor != NULL)
+        {
+            pExecutor->shutdown();
+            delete pExecutor;
+            pExecutor   = NULL;
+        }
+
+        if (vSignal != NULL)
+        {
+            ::free(vSignal);
+            vSignal     = NULL;
+        }
+
+        // Forget plugin
+        pPlugin     = NULL;
+    }
+
+    ipc::IExecutor *BenchWrapper::get_executor()
+    {
+        if (pExecutor != NULL)
+            return pExecutor;
+
+        ipc::ThreadPoolExecutor *exec = new ipc::ThreadPoolExecutor();
+        if (exec == NULL)
+            return NULL;
+        if (exec->start() != STATUS_OK)
+        {
+            delete exec;
+            return NULL;
+        }
+        return pExecutor = exec;
+    }
+}
+
+#endif /* CONTAINER_BENCH_WRAPPER_H_ */
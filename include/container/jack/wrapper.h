@@ -14,7 +14,7 @@
 #include <core/IWrapper.h>
 #include <core/IPort.h>
 #include <core/ICanvas.h>
-#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/ThreadPoolExecutor.h>
 #include <core/ipc/Mutex.h>
 #include <container/CairoCanvas.h>
 
@@ -845,8 +845,8 @@ namespace lsp
         if (pExecutor != NULL)
             return pExecutor;
 
-        lsp_trace("Creating native executor service");
-        ipc::NativeExecutor *exec = new ipc::NativeExecutor();
+        lsp_trace("Creating thread pool executor service");
+        ipc::ThreadPoolExecutor *exec = new ipc::ThreadPoolExecutor();
         if (exec == NULL)
             return NULL;
         if (exec->start() != STATUS_OK)
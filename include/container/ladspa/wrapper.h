@@ -236,12 +236,19 @@ namespace lsp
 
             virtual ipc::IExecutor *get_executor()
             {
-                if (pExecutor == NULL)
+                if (pExecutor != NULL)
+                    return pExecutor;
+
+                lsp_trace("Creating thread pool executor service");
+                ipc::ThreadPoolExecutor *exec = new ipc::ThreadPoolExecutor();
+                if (exec == NULL)
+                    return NULL;
+                if (exec->start() != STATUS_OK)
                 {
-                    lsp_trace("Creating native executor service");
-                    pExecutor       = new ipc::NativeExecutor();
+                    delete exec;
+                    return NULL;
                 }
-                return pExecutor;
+                return pExecutor = exec;
             }
 
             virtual const position_t *position()
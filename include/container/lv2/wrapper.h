@@ -13,7 +13,7 @@
 
 #include <dsp/endian.h>
 #include <core/IWrapper.h>
-#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/ThreadPoolExecutor.h>
 #include <core/KVTDispatcher.h>
 #include <container/lv2/lv2_sink.h>
 
@@ -1457,8 +1457,8 @@ namespace lsp
         }
         else
         {
-            lsp_trace("Creating native executor service");
-            ipc::NativeExecutor *exec = new ipc::NativeExecutor();
+            lsp_trace("Creating thread pool executor service");
+            ipc::ThreadPoolExecutor *exec = new ipc::ThreadPoolExecutor();
             if (exec == NULL)
                 return NULL;
             status_t res = exec->start();
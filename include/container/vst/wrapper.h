@@ -10,7 +10,7 @@
 
 #include <container/vst/defs.h>
 #include <container/vst/chunk.h>
-#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/ThreadPoolExecutor.h>
 
 #ifndef LSP_NO_VST_UI
     #define IF_VST_UI_ON(...)       __VA_ARGS__
@@ -170,8 +170,8 @@ namespace lsp
                 if (pExecutor != NULL)
                     return pExecutor;
 
-                lsp_trace("Creating native executor service");
-                ipc::NativeExecutor *exec = new ipc::NativeExecutor();
+                lsp_trace("Creating thread pool executor service");
+                ipc::ThreadPoolExecutor *exec = new ipc::ThreadPoolExecutor();
                 if (exec == NULL)
                     return NULL;
                 if (exec->start() != STATUS_OK)
@@ -11,11 +11,13 @@
 #include <dsp/dsp.h>
 #include <data/cvector.h>
 #include <data/cstorage.h>
+#include <data/cdeque.h>
 #include <core/sampling/Sample.h>
 #include <core/3d/common.h>
 #include <core/3d/raytrace.h>
 #include <core/3d/rt_mesh.h>
 #include <core/3d/rt_context.h>
+#include <core/3d/rt_bvh.h>
 #include <core/ipc/Thread.h>
 #include <core/ipc/Mutex.h>
 
@@ -53,12 +55,16 @@ namespace lsp
                 bound_box3d_t               bbox;
                 cstorage<rtx_triangle_t>    mesh;
                 cstorage<rtx_edge_t>        plan;
+                rt_bvh_t                    bvh;            // Bounding volume hierarchy of the mesh
             } rt_object_t;
 
             typedef struct stats_t
             {
                 uint64_t            root_tasks;
                 uint64_t            local_tasks;
+                uint64_t            stolen_tasks;
+                uint64_t            steal_contended;
+                uint64_t            idle_loops;
                 uint64_t            calls_scan;
                 uint64_t            calls_cull;
                 uint64_t            calls_split;
@@ -72,11 +78,13 @@ namespace lsp
             {
                 private:
                     RayTrace3D             *trace;
+                    size_t                  id;             // Index of thread in the list
+                    size_t                  victim;         // Index of the last thread we have stolen task from
                     stats_t                 stats;
-                    cvector<rt_context_t>   tasks;
+                    cdeque<rt_context_t>    tasks;          // Work-stealing task queue
                     cvector<rt_binding_t>   bindings;       // Bindings
                     cvector<rt_object_t>    objects;
-                    ssize_t                 heavy_state;
+                    ssize_t                 scan_tag;       // Unique tag of the object scan to mark edges
 
                 protected:
                     status_t    main_loop();
@@ -101,9 +109,11 @@ namespace lsp
                     status_t    check_object(rt_context_t *ctx, Object3D *obj, const matrix3d_t *m);
 
                     status_t    submit_task(rt_context_t *ctx);
+                    rt_context_t   *fetch_root_task();
+                    rt_context_t   *steal_task();
 
                 public:
-                    explicit TaskThread(RayTrace3D *trace);
+                    explicit TaskThread(RayTrace3D *trace, size_t id);
                     virtual ~TaskThread();
 
                 public:
@@ -135,14 +145,17 @@ namespace lsp
 
             rt_debug_t                 *pDebug;
 
-            cvector<rt_context_t>       vTasks;
-            size_t                      nQueueSize;
+            cvector<rt_context_t>       vTasks;         // Root tasks
+            cvector<TaskThread>         vThreads;       // Threads that perform the ray tracing
+            volatile uatomic_t          nRootTask;      // Index of the next root task to fetch
+            volatile atomic_t           nPending;       // Number of submitted but not yet processed tasks
             size_t                      nProgressPoints;
             size_t                      nProgressMax;
-            ipc::Mutex                  lkTasks;
+            ipc::Mutex                  lkProgress;
 
         protected:
             static void destroy_tasks(cvector<rt_context_t> *tasks);
+            static void destroy_tasks(cdeque<rt_context_t> *tasks);
             static void destroy_objects(cvector<rt_object_t> *objects);
             static void clear_stats(stats_t *stats);
             static void dump_stats(const char *label, const stats_t *stats);
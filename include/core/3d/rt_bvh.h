@@ -0,0 +1,113 @@
+/*
+ * rt_bvh.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef INCLUDE_CORE_3D_RT_BVH_H_
+#define INCLUDE_CORE_3D_RT_BVH_H_
+
+#include <core/3d/common.h>
+#include <data/cstorage.h>
+
+#define RT_BVH_LEAF_SIZE        4       /* Maximum number of triangles in the leaf node     */
+#define RT_BVH_DEPTH_MAX        64      /* Maximum depth of the hierarchy                   */
+
+namespace lsp
+{
+    /**
+     * Node of the bounding volume hierarchy, nodes are stored in the depth-first
+     * order, so the left child of the inner node always follows the node
+     */
+    typedef struct rt_bvh_node_t
+    {
+        point3d_t           min;        // Minimum corner of the axis-aligned bounding box
+        point3d_t           max;        // Maximum corner of the axis-aligned bounding box
+        size_t              first;      // Leaf: first element of the triangle index, inner node: index of the right child
+        size_t              count;      // Leaf: number of triangles, inner node: zero
+        __IF_32(uint32_t    __pad[2];)  // Alignment to be sizeof() multiple of 16
+    } rt_bvh_node_t;
+
+    /**
+     * Bounding volume hierarchy of the ray tracing object's triangles.
+     * The hierarchy is built once when preparing the scene and then copied
+     * together with the object's mesh. The mesh itself is not modified: the
+     * triangles of each leaf occupy the continuous range of the triangle index
+     * which is sorted according to the hierarchy while building it.
+     */
+    typedef struct rt_bvh_t
+    {
+        private:
+            rt_bvh_t & operator = (const rt_bvh_t &);
+
+        public:
+            cstorage<rt_bvh_node_t>     nodes;
+            cstorage<size_t>            index;
+
+        protected:
+            status_t        build_node(const rtx_triangle_t *vt, size_t first, size_t count, size_t depth);
+            static void     select(const rtx_triangle_t *vt, size_t *idx, size_t count, size_t k, size_t axis);
+
+        public:
+            explicit rt_bvh_t();
+            ~rt_bvh_t();
+
+        public:
+            /**
+             * Flush hierarchy: release all nodes
+             */
+            inline void     flush()
+            {
+                nodes.flush();
+                index.flush();
+            };
+
+            /**
+             * Check that the hierarchy is empty
+             * @return true if the hierarchy is empty
+             */
+            inline bool     is_empty() const { return nodes.size() == 0; }
+
+            /**
+             * Copy the hierarchy
+             * @param src hierarchy to copy
+             * @return status of operation
+             */
+            status_t        copy(const rt_bvh_t *src);
+
+            /**
+             * Build the hierarchy, the order of triangles is not changed
+             * @param vt array of triangles
+             * @param n number of triangles
+             * @return status of operation
+             */
+            status_t        build(const rtx_triangle_t *vt, size_t n);
+
+            /**
+             * Check that the bounding box of the node is not completely above any
+             * of the culling planes of the view. The check is conservative: it may
+             * accept some nodes that do not intersect the view but never rejects
+             * nodes that do
+             * @param node node to check
+             * @param pl four culling planes of the view
+             * @return true if the node potentially intersects the view
+             */
+            static inline bool  visible(const rt_bvh_node_t *node, const vector3d_t *pl)
+            {
+                for (size_t i=0; i<4; ++i, ++pl)
+                {
+                    // Take the corner with the minimum distance to the plane
+                    float k     = pl->dx * ((pl->dx >= 0.0f) ? node->min.x : node->max.x) +
+                                  pl->dy * ((pl->dy >= 0.0f) ? node->min.y : node->max.y) +
+                                  pl->dz * ((pl->dz >= 0.0f) ? node->min.z : node->max.z) +
+                                  pl->dw;
+                    if (k > DSP_3D_TOLERANCE)
+                        return false;
+                }
+                return true;
+            }
+    } rt_bvh_t;
+}
+
+#endif /* INCLUDE_CORE_3D_RT_BVH_H_ */
@@ -14,6 +14,7 @@
 #include <core/3d/View3D.h>
 #include <core/3d/rt_plan.h>
 #include <core/3d/rt_mesh.h>
+#include <core/3d/rt_bvh.h>
 #include <data/cstorage.h>
 
 namespace lsp
@@ -152,6 +153,18 @@ namespace lsp
              */
             status_t        add_object(rtx_triangle_t *vt, rtx_edge_t *ve, size_t nt, size_t ne);
 
+            /**
+             * Add object for capturing data using the bounding volume hierarchy.
+             * Only triangles of the hierarchy leafs that potentially intersect
+             * the view are processed. Edges that are added to the plan are marked with the
+             * tag to prevent duplicates, so the tag should be unique for each call
+             * @param vt array of raw triangles the hierarchy has been built for
+             * @param bvh bounding volume hierarchy
+             * @param tag unique tag to mark processed edges
+             * @return status of operation
+             */
+            status_t        add_object(rtx_triangle_t *vt, const rt_bvh_t *bvh, ssize_t tag);
+
             /**
              * Cull view with the view planes
              * @return status of operation
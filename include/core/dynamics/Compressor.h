@@ -201,6 +201,18 @@ namespace lsp
              */
             void process(float *out, float *env, const float *in, size_t samples);
 
+            /** Process sidechain signals of several compressors at once. The envelopes
+             * are computed simultaneously in interleaved SIMD lanes.
+             *
+             * @param p array of n compressors
+             * @param out array of n buffers to store output signal gain to VCA
+             * @param env array of n buffers to store envelope signal, may be NULL, as well as any of its elements
+             * @param in array of n sidechain signals
+             * @param n number of compressors
+             * @param samples number of samples to process
+             */
+            static void process(Compressor **p, float **out, float **env, const float **in, size_t n, size_t samples);
+
             /** Process one sample of sidechain signal
              *
              * @param in sidechain signal
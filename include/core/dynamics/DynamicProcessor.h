@@ -292,6 +292,19 @@ namespace lsp
              */
             void process(float *out, float *env, const float *in, size_t samples);
 
+            /** Process sidechain signals of several processors at once. The envelopes
+             * are computed simultaneously in interleaved SIMD lanes.
+             * Processors with level-dependent attack or release times are processed separately.
+             *
+             * @param p array of n processors
+             * @param out array of n buffers to store output signal gain to VCA
+             * @param env array of n buffers to store envelope signal, may be NULL, as well as any of its elements
+             * @param in array of n sidechain signals
+             * @param n number of processors
+             * @param samples number of samples to process
+             */
+            static void process(DynamicProcessor **p, float **out, float **env, const float **in, size_t n, size_t samples);
+
             /** Process one sample of sidechain signal
              *
              * @param in sidechain signal
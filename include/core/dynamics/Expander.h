@@ -187,6 +187,18 @@ namespace lsp
              */
             void process(float *out, float *env, const float *in, size_t samples);
 
+            /** Process sidechain signals of several expanders at once. The envelopes
+             * are computed simultaneously in interleaved SIMD lanes.
+             *
+             * @param p array of n expanders
+             * @param out array of n buffers to store output signal gain to VCA
+             * @param env array of n buffers to store envelope signal, may be NULL, as well as any of its elements
+             * @param in array of n sidechain signals
+             * @param n number of expanders
+             * @param samples number of samples to process
+             */
+            static void process(Expander **p, float **out, float **env, const float **in, size_t n, size_t samples);
+
             /** Process one sample of sidechain signal
              *
              * @param s sidechain signal
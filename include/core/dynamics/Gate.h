@@ -44,6 +44,9 @@ namespace lsp
             size_t      nCurve;
             bool        bUpdate;
 
+        protected:
+            void        process_gain(float *out, const float *env, size_t samples);
+
         public:
             explicit Gate();
             ~Gate();
@@ -164,6 +167,18 @@ namespace lsp
              */
             void process(float *out, float *env, const float *in, size_t samples);
 
+            /** Process sidechain signals of several gates at once. The envelopes
+             * are computed simultaneously in interleaved SIMD lanes.
+             *
+             * @param p array of n gates
+             * @param out array of n buffers to store output signal gain to VCA
+             * @param env array of n buffers to store envelope signal, may be NULL, as well as any of its elements
+             * @param in array of n sidechain signals
+             * @param n number of gates
+             * @param samples number of samples to process
+             */
+            static void process(Gate **p, float **out, float **env, const float **in, size_t n, size_t samples);
+
             /** Process one sample of sidechain signal
              *
              * @param s sidechain signal
@@ -125,6 +125,38 @@ namespace lsp
                 };
             } mixed_t;
 
+            typedef struct slide_t
+            {
+                float      *vValue;         // Sliding window maximum deque: values
+                uint32_t   *vTime;          // Sliding window maximum deque: timestamps
+                float      *vRise;          // Ring buffer of rises of the held value over the attack
+                float      *vRelease;       // Release curve
+                size_t      nCapacity;      // Capacity of the deque
+                size_t      nKernelCap;     // Capacity of the ring buffer of rises
+                size_t      nHead;          // Head of the deque
+                size_t      nTail;          // Tail of the deque
+                uint32_t    nTime;          // Current timestamp
+                size_t      nWindow;        // Size of the sliding window
+                size_t      nMiddle;        // Delay of the gain envelope relative to the sidechain
+                size_t      nAttack;        // Length of the attack shaping kernel
+                size_t      nRisePos;       // Position of the oldest rise in the ring buffer
+                size_t      nRiseCount;     // Number of non-zero rises in the ring buffer
+                size_t      nRiseTime;      // Time elapsed since the origin of moments
+                float       fHold;          // Last held gain reduction
+                size_t      nRelease;       // Length of the release curve
+                size_t      nRelTime;       // Current position on the release curve
+                float       fRelPeak;       // Gain reduction at the start of the release
+
+                double      vKernel[4];     // Polynomial part of the attack shaping kernel
+                double      fExpGain;       // Gain of the exponential part of the attack shaping kernel
+                double      fExpUp;         // Exponent step forward
+                double      fExpDown;       // Exponent step backward
+                double      fExpWindow;     // Exponent of the attack length
+                double      fExpPos;        // Exponent of the time elapsed since the origin of moments
+                double      fExpNeg;        // Inverse exponent of the time elapsed since the origin of moments
+                double      vMoment[5];     // Polynomial and exponential moments of rises
+            } slide_t;
+
         protected:
             float       fThreshold;
             float       fLookahead;
@@ -139,6 +171,7 @@ namespace lsp
             size_t      nUpdate;
             size_t      nMode;
             size_t      nThresh;
+            bool        bSliding;
 
             // Pre-calculated parameters
             float      *vGainBuf;
@@ -154,6 +187,7 @@ namespace lsp
                 line_t      sLine;              // Line mode
                 mixed_t     sMixed;             // Mixed mode
             };
+            slide_t     sSlide;             // Sliding window peak detector
 
         protected:
             inline float    reduction(comp_t *comp);
@@ -173,6 +207,10 @@ namespace lsp
             void            init_exp(exp_t *exp);
             void            init_line(line_t *line);
             void            init_comp(comp_t *comp);
+            void            init_slide(bool reset);
+            static void     rebase_slide(slide_t *sl);
+
+            void            apply_comp_reduction(comp_t *comp, float *dst, const float *env, size_t samples);
 
             void            process_compressor(float *dst, float *gain, const float *src, const float *sc, size_t samples);
 //            void            process_hermite(float *dst, float *gain, const float *src, const float *sc, size_t samples);
@@ -181,6 +219,87 @@ namespace lsp
 
             void            process_patch(float *dst, float *gain, const float *src, const float *sc, size_t samples);
             void            process_mixed(float *dst, float *gain, const float *src, const float *sc, size_t samples);
+            void            process_slide(float *dst, float *gain, const float *src, const float *sc, size_t samples);
+
+            /** Compute the part of rises of the held value that is not yet reached by the attack curve.
+             * The part is the sum of rise[j] * K(t - t[j]) over rises within the attack. The kernel K(x)
+             * is expanded into polynomial of (t - t0) and moments of rises relative to the origin t0,
+             * so each sample costs constant time
+             *
+             * @param sl sliding window peak detector
+             * @param rise rise of the held value at the current sample
+             * @return pending part of rises at the current sample
+             */
+            static inline float pending_slide(slide_t *sl, float rise)
+            {
+                if ((sl->nRiseCount <= 0) && (rise <= 0.0f))
+                    return 0.0f;
+
+                size_t len          = sl->nAttack;
+                if (len <= 0)
+                    return 0.0f;
+                if (sl->nRiseTime >= len)
+                    rebase_slide(sl); // Keep moments small, the cost is amortized over the attack
+
+                double *m           = sl->vMoment;
+                double u            = sl->nRiseTime;
+                size_t pos          = sl->nRisePos;
+
+                // Remove the rise that leaves the attack
+                double d            = sl->vRise[pos];
+                if (d > 0.0)
+                {
+                    double x            = u - len;
+                    m[4]               -= d * sl->fExpNeg * sl->fExpWindow;
+                    m[0]               -= d;
+                    d                  *= x;
+                    m[1]               -= d;
+                    d                  *= x;
+                    m[2]               -= d;
+                    d                  *= x;
+                    m[3]               -= d;
+                    --sl->nRiseCount;
+                }
+
+                // Add the new rise
+                sl->vRise[pos]      = rise;
+                sl->nRisePos        = ((++pos) < len) ? pos : 0;
+                if (rise > 0.0f)
+                {
+                    d                   = rise;
+                    m[4]               += d * sl->fExpNeg;
+                    m[0]               += d;
+                    d                  *= u;
+                    m[1]               += d;
+                    d                  *= u;
+                    m[2]               += d;
+                    d                  *= u;
+                    m[3]               += d;
+                    ++sl->nRiseCount;
+                }
+                else if (sl->nRiseCount <= 0)
+                {
+                    // All rises have been reached by the attack, drop the rounding errors
+                    for (size_t i=0; i<5; ++i)
+                        m[i]                = 0.0;
+                    sl->nRiseTime       = 0;
+                    sl->fExpPos         = 1.0;
+                    sl->fExpNeg         = 1.0;
+                    return 0.0f;
+                }
+
+                const double *k     = sl->vKernel;
+                double p1           = u*m[0] - m[1];
+                double p2           = u*(u*m[0] - 2.0*m[1]) + m[2];
+                double p3           = u*(u*(u*m[0] - 3.0*m[1]) + 3.0*m[2]) - m[3];
+                double pending      = k[0]*m[0] + k[1]*p1 + k[2]*p2 + k[3]*p3 + sl->fExpGain * sl->fExpPos * m[4];
+
+                ++sl->nRiseTime;
+                sl->fExpPos        *= sl->fExpUp;
+                sl->fExpNeg        *= sl->fExpDown;
+
+                return pending;
+            }
 
         public:
             explicit Limiter();
@@ -226,6 +345,32 @@ namespace lsp
                 nUpdate |= UP_MODE;
             }
 
+            /** Select peak detector for patch and mixed modes.
+             * The sliding window peak detector computes the gain envelope
+             * in a single pass with bounded cost per sample, the iterative
+             * peak patching searches peaks and applies gain patches until
+             * there are no peaks above threshold. The iterative peak patching
+             * is used by default.
+             *
+             * @param sliding use sliding window peak detector
+             */
+            inline void set_sliding(bool sliding)
+            {
+                if (bSliding == sliding)
+                    return;
+                bSliding    = sliding;
+                nUpdate    |= UP_MODE;
+            }
+
+            /** Check that sliding window peak detector is used
+             *
+             * @return true if sliding window peak detector is used
+             */
+            inline bool get_sliding() const
+            {
+                return bSliding;
+            }
+
             /** Change current sample rate of processor
              *
              * @param sr sample rate to set
@@ -0,0 +1,44 @@
+/*
+ * follower.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_DYNAMICS_FOLLOWER_H_
+#define CORE_DYNAMICS_FOLLOWER_H_
+
+#include <core/types.h>
+
+// Maximum number of envelope followers processed at once
+#define FOLLOWER_LANES_MAX          8
+// Number of samples processed per one interleaved block
+#define FOLLOWER_BUF_SIZE           128
+
+namespace lsp
+{
+    /** Envelope follower of the dynamic processor
+     *
+     */
+    typedef struct follower_t
+    {
+        float      *pEnvelope;      // Pointer to the envelope state of the dynamic processor
+        float       fAttack;        // Attack time constant
+        float       fRelease;       // Release time constant
+        float       fThresh;        // Release threshold
+    } follower_t;
+
+    /** Compute envelopes of several independent followers at once.
+     * Followers are processed simultaneously in interleaved lanes of SIMD
+     * envelope follower banks
+     *
+     * @param out array of n destination buffers to store envelopes, may match buffers of in
+     * @param in array of n source sidechain buffers
+     * @param f array of n envelope followers, the envelope state is updated after the call
+     * @param n number of followers, should not be greater than FOLLOWER_LANES_MAX
+     * @param samples number of samples to process
+     */
+    void follow_envelopes(float **out, const float **in, const follower_t *f, size_t n, size_t samples);
+}
+
+#endif /* CORE_DYNAMICS_FOLLOWER_H_ */
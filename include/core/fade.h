@@ -29,6 +29,29 @@ namespace lsp
      * @param buf_len length of the buffer
      */
     void fade_out(float *dst, const float *src, size_t fade_len, size_t buf_len);
+
+    /** Fade-in the part of the buffer, gives the same result as fade_in()
+     * applied to the whole buffer
+     *
+     * @param dst destination part of the buffer
+     * @param src source part of the buffer
+     * @param fade_len length of fade (in elements)
+     * @param offset offset of the part from the beginning of the buffer
+     * @param count number of elements in the part
+     */
+    void fade_in(float *dst, const float *src, size_t fade_len, size_t offset, size_t count);
+
+    /** Fade-out the part of the buffer, gives the same result as fade_out()
+     * applied to the whole buffer
+     *
+     * @param dst destination part of the buffer
+     * @param src source part of the buffer
+     * @param fade_len length of fade (in elements)
+     * @param buf_len length of the whole buffer
+     * @param offset offset of the part from the beginning of the buffer
+     * @param count number of elements in the part
+     */
+    void fade_out(float *dst, const float *src, size_t fade_len, size_t buf_len, size_t offset, size_t count);
 }
 
 #endif /* CORE_FADE_H_ */
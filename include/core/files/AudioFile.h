@@ -9,21 +9,43 @@
 #define CORE_FILES_AUDIOFILE_H_
 
 #include <core/types.h>
+#include <dsp/atomic.h>
 #include <core/sampling/Sample.h>
 #include <core/LSPString.h>
 #include <core/io/Path.h>
+#include <core/ipc/IExecutor.h>
+#include <core/ipc/ITask.h>
 
 namespace lsp
 {
+    class LSPCFile;
+    class LSPCAudioReader;
+
     class AudioFile
     {
         private:
+            typedef struct file_extent_t
+            {
+                const uint8_t  *pData;      // Pointer to the mapped data
+                size_t          nSize;      // Size of the data in bytes
+            } file_extent_t;
+
+            typedef struct file_mapping_t
+            {
+                uint8_t        *pAddr;      // Address of the mapped file
+                size_t          nSize;      // Size of the mapped file
+                size_t          nFrameSize; // Size of interleaved frame in bytes
+                size_t          nExtents;   // Number of extents
+                file_extent_t   vExtents[]; // Contiguous extents of interleaved frames
+            } file_mapping_t;
+
             typedef struct file_content_t
             {
-                size_t      nChannels;
-                size_t      nSamples;       // Actual number of samples
-                size_t      nSampleRate;
-                float      *vChannels[];
+                size_t          nChannels;
+                size_t          nSamples;   // Actual number of samples
+                size_t          nSampleRate;
+                file_mapping_t *pMapping;   // Memory-mapped file, NULL if content is not mapped
+                float          *vChannels[];
             } file_content_t;
 
             typedef struct temporary_buffer_t
@@ -36,6 +58,34 @@ namespace lsp
                 float      *vChannels[];    // Pointer to deploy samples to channels
             } temporary_buffer_t;
 
+            typedef struct resampler_t
+            {
+                const float    *vKernel;    // Kernel table: nPhases rows of nTaps samples each
+                size_t          nTaps;      // Number of taps per phase, multiple of 4
+                size_t          nPhases;    // Number of phases stored in kernel table
+                size_t          nSrcStep;   // Source period of the resampling ratio
+                size_t          nDstStep;   // Destination period of the resampling ratio
+                size_t          nSamples;   // Number of output samples per channel
+                size_t          nBlocks;    // Number of output blocks per channel
+                size_t          nItems;     // Overall number of blocks to process
+                volatile uatomic_t nNext;   // Next block to process
+                float         **vSrc;       // Zero-padded source channels
+                float         **vDst;       // Destination channels
+            } resampler_t;
+
+            class ResampleTask: public ipc::ITask
+            {
+                private:
+                    resampler_t    *pResampler;
+
+                public:
+                    explicit ResampleTask(resampler_t *r);
+                    virtual ~ResampleTask();
+
+                public:
+                    virtual status_t run();
+            };
+
             file_content_t *pData;
 
         private:
@@ -45,19 +95,31 @@ namespace lsp
             static file_content_t *create_file_content(size_t channels, size_t samples);
             static file_content_t *grow_file_content(file_content_t *src, size_t samples);
             static void destroy_file_content(file_content_t *content);
+            static file_content_t *create_mapped_content(file_mapping_t *mapping, size_t channels, size_t samples);
+            static bool is_mapped(const file_content_t *content, const float *ptr);
+            static float *unpack_channel(file_content_t *content, size_t channel);
 
             static temporary_buffer_t *create_temporary_buffer(file_content_t *content, size_t from = 0);
             static void flush_temporary_buffer(temporary_buffer_t *buffer);
             static size_t fill_temporary_buffer(temporary_buffer_t *buffer, size_t max_samples);
             static void destroy_temporary_buffer(temporary_buffer_t *buffer);
 
-            status_t fast_downsample(size_t new_sample_rate);
-            status_t fast_upsample(size_t new_sample_rate);
-            status_t complex_upsample(size_t new_sample_rate);
-            status_t complex_downsample(size_t new_sample_rate);
+            status_t polyphase_resample(size_t new_sample_rate, ipc::IExecutor *executor);
+
+            static void resample_block(resampler_t *r, size_t item);
+            static void resample_blocks(resampler_t *r);
+
+            status_t unpack_channels();
 
+            status_t open_lspc(LSPCFile *fd, LSPCAudioReader *ar, size_t *skip);
             status_t load_lspc(const LSPString *path, float max_duration);
 
+        #ifndef PLATFORM_WINDOWS
+            static status_t map_file(const LSPString *path, uint8_t **addr, size_t *size);
+            status_t map_lspc(const LSPString *path, float max_duration);
+            status_t map_wav(const LSPString *path, float max_duration);
+        #endif /* PLATFORM_WINDOWS */
+
         #ifdef PLATFORM_WINDOWS
             status_t load_mfapi(const LSPString *path, float max_duration);
             status_t save_mfapi(const LSPString *path, size_t from, size_t max_count);
@@ -123,6 +185,41 @@ namespace lsp
              */
             status_t load(const io::Path *path, float max_duration = -1);
 
+            /** Map file into memory. The audio data that is stored in the file as
+             * native 32-bit floating-point samples is accessed directly from the
+             * mapped file: single-channel data is used without copying, channels of
+             * multi-channel data are de-interleaved on the first access to the channel.
+             * Other files are loaded as with load(). Unlike load(), samples() returns
+             * the exact number of frames for the mapped file.
+             *
+             * @param path path to the file
+             * @param max_duration maximum duration of the file to map (in seconds)
+             * @return status of operation
+             */
+            status_t map(const char *path, float max_duration = -1);
+
+            /** Map file into memory
+             *
+             * @param path path to the file
+             * @param max_duration maximum duration of the file to map (in seconds)
+             * @return status of operation
+             */
+            status_t map(const LSPString *path, float max_duration = -1);
+
+            /** Map file into memory
+             *
+             * @param path path to the file
+             * @param max_duration maximum duration of the file to map (in seconds)
+             * @return status of operation
+             */
+            status_t map(const io::Path *path, float max_duration = -1);
+
+            /** Check that file contents are memory-mapped
+             *
+             * @return true if file contents are memory-mapped
+             */
+            bool mapped() const;
+
             /** Save file
              *
              * @param path path to the file
@@ -241,9 +338,13 @@ namespace lsp
             /** Resample file
              *
              * @param new_sample_rate new sample rate
+             * @param executor executor service to process resampling blocks in parallel
+             *   with the caller, should be able to cancel tasks (see IExecutor::cancel()),
+             *   NULL value means to perform resampling in the caller's thread only.
+             *   The caller may be one of the executor's threads
              * @return status of operation
              */
-            status_t resample(size_t new_sample_rate);
+            status_t resample(size_t new_sample_rate, ipc::IExecutor *executor = NULL);
 
             /** Destroy all previously allocated file data
              *
@@ -32,6 +32,8 @@ namespace lsp
 
         protected:
             LSPCResource       *create_resource(lsp_fhandle_t fd);
+            status_t            load_toc(wsize_t offset);
+            status_t            write_toc();
 
         public:
             explicit LSPCFile();
@@ -80,12 +82,20 @@ namespace lsp
              */
             status_t    create(const io::Path *path);
 
-            /** Close the file
+            /** Close the file. If the file was opened for writing and all chunk writers
+             * are closed, the table of contents is written at the end of the file
              *
              * @return status of operation
              */
             status_t    close();
 
+            /** Check that the file has table of contents which allows to locate
+             * any chunk without scanning the file
+             *
+             * @return true if the file has table of contents
+             */
+            inline bool indexed() const         { return (pFile != NULL) && (pFile->toc_valid); }
+
         public:
             /** Write chunk
              *
@@ -38,6 +38,14 @@ namespace lsp
                 size_t                      nOff;       // Offset to the beginning of non-read data
             } buffer_t;
 
+            typedef struct block_t
+            {
+                int32_t                    *vSamples;   // Planar integer or floating-point samples of decoded block
+                size_t                      nFrames;    // Number of frames in decoded block
+                size_t                      nOff;       // Number of frames already read from block
+                float                       fRange;     // Integer sample range, zero for floating-point samples
+            } block_t;
+
             typedef void (*decode_func_t)(float *vp, const void *src, size_t ns);
 
         private:
@@ -51,6 +59,11 @@ namespace lsp
             buffer_t                    sBuf;
             decode_func_t               pDecode;
             float                      *pFBuffer;       // frame buffer
+            block_t                     sBlock;         // Block of lossless codec
+            uint32_t                    nIndexId;       // Identifier of the block index chunk
+            lspc_audio_index_entry_t   *vIndex;         // Block index
+            size_t                      nIndexItems;    // Number of entries in block index
+            wsize_t                     nFramePos;      // Current frame position of lossless codec
 
         protected:
             static void     decode_u8(float *vp, const void *src, size_t ns);
@@ -70,6 +83,12 @@ namespace lsp
             status_t    read_audio_header(LSPCChunkReader *rd);
             status_t    apply_params(const lspc_audio_parameters_t *p);
             status_t    fill_buffer();
+            status_t    read_block_header(lspc_audio_block_header_t *hdr);
+            status_t    read_block(const lspc_audio_block_header_t *hdr);
+            ssize_t     read_lossless_frames(float *data, size_t frames);
+            ssize_t     skip_lossless_frames(size_t frames);
+            status_t    load_index(LSPCFile *lspc, uint32_t chunk_id);
+            const lspc_audio_index_entry_t *find_block(wsize_t frame) const;
 
         public:
             explicit LSPCAudioReader();
@@ -10,6 +10,7 @@
 
 #include <core/files/lspc/lspc.h>
 #include <core/files/LSPCFile.h>
+#include <core/util/Dither.h>
 
 namespace lsp
 {
@@ -35,6 +36,15 @@ namespace lsp
 
             typedef void (*encode_func_t)(void *dst, const float *src, size_t ns);
 
+            typedef struct block_t
+            {
+                int32_t                    *vSamples;   // Planar integer or floating-point samples of the block
+                size_t                      nFrames;    // Number of frames stored in block
+                uint8_t                    *vData;      // Compressed block data
+                uint8_t                    *vTmp;       // Temporary buffer for encoder
+                float                       fRange;     // Integer sample range, zero for floating-point samples
+            } block_t;
+
         protected:
             lspc_audio_parameters_t     sParams;
             LSPCFile                   *pFD;
@@ -45,6 +55,11 @@ namespace lsp
             encode_func_t               pEncode;
             float                      *pBuffer;
             uint8_t                    *pFBuffer;       // frame buffer
+            bool                        bDither;        // Apply dither to integer samples
+            Dither                      sDither;        // Dither
+            block_t                     sBlock;         // Block of lossless codec
+            LSPCChunkWriter            *pIndex;         // Writer of the block index
+            wsize_t                     nBlockFrame;    // Number of the first frame of the block
 
         protected:
             static void     encode_u8(void *vp, const float *src, size_t ns);
@@ -64,6 +79,9 @@ namespace lsp
             status_t parse_parameters(const lspc_audio_parameters_t *p);
             status_t free_resources();
             status_t write_header(LSPCChunkWriter *wr);
+            status_t create_index(LSPCFile *lspc);
+            status_t write_index_header(LSPCChunkWriter *wr);
+            status_t flush_block();
 
         public:
             explicit LSPCAudioWriter();
@@ -180,6 +198,19 @@ namespace lsp
              */
             status_t get_parameters(lspc_audio_parameters_t *dst) const;
 
+            /**
+             * Enable or disable dither of the samples stored in integer formats,
+             * dither is disabled by default
+             * @param dither dither flag
+             */
+            inline void set_dither(bool dither)     { bDither = dither; }
+
+            /**
+             * Check that dither is enabled
+             * @return true if dither is enabled
+             */
+            inline bool dither() const              { return bDither; }
+
             /**
              * Get current chunk identifier
              * @return current chunk identifier
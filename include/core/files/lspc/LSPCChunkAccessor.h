@@ -10,6 +10,7 @@
 
 #include <core/types.h>
 #include <core/status.h>
+#include <core/files/lspc/lspc.h>
 
 namespace lsp
 {
@@ -20,12 +21,21 @@ namespace lsp
         size_t          bufsize;        // Default buffer size
         uint32_t        chunk_id;       // Chunk identifier allocator
         wsize_t         length;         // Length of the output file
+        lspc_toc_entry_t *toc;          // Table of contents
+        size_t          toc_items;      // Number of entries in table of contents
+        size_t          toc_cap;        // Capacity of table of contents
+        bool            toc_valid;      // Table of contents is complete
 
         status_t        acquire();
         status_t        release();
         status_t        allocate(uint32_t *id);
         status_t        write(const void *buf, size_t count);
+        status_t        write(wsize_t pos, const void *buf, size_t count);
         ssize_t         read(wsize_t pos, void *buf, size_t count);
+
+        void            index(uint32_t uid, uint32_t magic, wsize_t offset);
+        void            sort_toc();
+        const lspc_toc_entry_t *lookup(uint32_t uid) const;
     } LSPCResource;
 
     class LSPCChunkAccessor
@@ -57,6 +57,23 @@ namespace lsp
              * @return number of skipped bytes or error code (negative)
              */
             virtual ssize_t     skip(size_t count);
+
+            /**
+             * Skip the rest of current chunk fragment and obtain the location of skipped
+             * data in the file, allows to access chunk data directly (for example, from
+             * the memory-mapped file)
+             * @param offset pointer to store the offset of skipped data in the file
+             * @return number of skipped bytes, 0 if there is no more data or error code (negative)
+             */
+            virtual ssize_t     skip_fragment(wsize_t *offset);
+
+            /**
+             * Move to the beginning of chunk fragment at the specified location
+             * in the file, the location is obtained when writing the fragment
+             * @param offset offset of the fragment header in the file
+             * @return status of operation
+             */
+            virtual status_t    seek_fragment(wsize_t offset);
     };
 
 } /* namespace lsp */
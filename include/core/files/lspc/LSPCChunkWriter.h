@@ -33,6 +33,7 @@ namespace lsp
 
         protected:
             status_t            do_flush(size_t flags);
+            status_t            write_fragment(const void *buf, size_t count, uint32_t flags);
 
         protected:
             explicit LSPCChunkWriter(LSPCResource *fd, uint32_t magic);
@@ -56,6 +57,15 @@ namespace lsp
              */
             virtual status_t    write(const void *buf, size_t count);
 
+            /**
+             * Write data to LSPC chunk as a separate chunk fragment
+             * @param buf buffer to write
+             * @param count number of bytes to write
+             * @param offset pointer to store the offset of the fragment header in the file, may be NULL
+             * @return status of operation
+             */
+            virtual status_t    append_fragment(const void *buf, size_t count, wsize_t *offset);
+
             /**
              * Flush all buffers to file
              * @return status of operation
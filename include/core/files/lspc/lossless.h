@@ -0,0 +1,84 @@
+/*
+ * lossless.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_FILES_LSPC_LOSSLESS_H_
+#define CORE_FILES_LSPC_LOSSLESS_H_
+
+#include <core/types.h>
+#include <core/status.h>
+#include <core/files/lspc/lspc.h>
+
+namespace lsp
+{
+    /**
+     * Estimate the maximum size of the block encoded with LSPC_CODEC_LOSSLESS codec
+     * @param channels number of channels
+     * @param frames number of frames in block
+     * @return maximum size of compressed block data in bytes (without block header)
+     */
+    size_t      lossless_block_size(size_t channels, size_t frames);
+
+    /**
+     * Estimate the size of temporary buffer required by the encoder
+     * @param frames number of frames in block
+     * @return size of temporary buffer in bytes
+     */
+    size_t      lossless_tmp_size(size_t frames);
+
+    /**
+     * Encode block of integer samples
+     * @param dst destination buffer of at least lossless_block_size() bytes
+     * @param src planar integer samples, one array of frames samples per channel
+     * @param channels number of channels
+     * @param frames number of frames, should not be greater than LSPC_LOSSLESS_BLOCK_FRAMES
+     * @param bits number of bits per sample (up to 24)
+     * @param tmp temporary buffer of at least lossless_tmp_size() bytes
+     * @return number of bytes stored in destination buffer
+     */
+    size_t      lossless_encode_block(uint8_t *dst, const int32_t * const *src,
+                    size_t channels, size_t frames, size_t bits, void *tmp);
+
+    /**
+     * Decode block of integer samples
+     * @param dst planar integer samples, one array of frames samples per channel
+     * @param src compressed block data
+     * @param size size of compressed block data in bytes
+     * @param channels number of channels
+     * @param frames number of frames stored in block
+     * @param bits number of bits per sample (up to 24)
+     * @return status of operation
+     */
+    status_t    lossless_decode_block(int32_t * const *dst, const uint8_t *src, size_t size,
+                    size_t channels, size_t frames, size_t bits);
+
+    /**
+     * Encode block of floating-point samples without loss of precision
+     * @param dst destination buffer of at least lossless_block_size() bytes
+     * @param src planar samples, one array of frames samples per channel
+     * @param channels number of channels
+     * @param frames number of frames, should not be greater than LSPC_LOSSLESS_BLOCK_FRAMES
+     * @param tmp temporary buffer of at least lossless_tmp_size() bytes
+     * @return number of bytes stored in destination buffer
+     */
+    size_t      lossless_encode_float_block(uint8_t *dst, const float * const *src,
+                    size_t channels, size_t frames, void *tmp);
+
+    /**
+     * Decode block of floating-point samples
+     * @param dst planar samples, one array of frames samples per channel
+     * @param src compressed block data
+     * @param size size of compressed block data in bytes
+     * @param channels number of channels
+     * @param frames number of frames stored in block
+     * @param tmp temporary buffer of at least frames integer samples
+     * @return status of operation
+     */
+    status_t    lossless_decode_float_block(float * const *dst, const uint8_t *src, size_t size,
+                    size_t channels, size_t frames, int32_t *tmp);
+}
+
+#endif /* CORE_FILES_LSPC_LOSSLESS_H_ */
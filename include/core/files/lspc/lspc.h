@@ -21,6 +21,12 @@ namespace lsp
      *      4. Chunk
      *      ...
      *      N. Chunk
+     *      N+1. Table of contents chunk (optional)
+     *
+     * The table of contents lists the position of the first fragment of each chunk
+     * in the file, it is written as the last chunk of the file, and its position is
+     * stored in the root header. Files without table of contents are read by scanning
+     * chunk headers from the start of the file.
      */
 
 #pragma pack(push, 1)
@@ -29,7 +35,8 @@ namespace lsp
         uint32_t        magic;          // Magic number, should be 'LSPC'
         uint16_t        version;        // Header version
         uint16_t        size;           // Size of header
-        uint32_t        reserved[4];    // Some reserved data
+        uint64_t        toc_offset;     // Offset of the table of contents chunk, 0 if not present
+        uint32_t        reserved[2];    // Some reserved data
     } lspc_root_header_t;
 
     typedef struct lspc_chunk_header_t
@@ -61,7 +68,8 @@ namespace lsp
         uint32_t        codec;          // Codec used
         uint64_t        frames;         // Overall number of frames in file
         int64_t 		offset; 		// Offset with which to load the frames (since header v.1, deprecated since header v.2)
-        uint32_t        reserved[4];    // Some reserved data
+        uint32_t        index_id;       // Identifier of the block index chunk, 0 if not present
+        uint32_t        reserved[3];    // Some reserved data
     } lspc_chunk_audio_header_t;
 
     typedef struct lspc_chunk_audio_profile_t // Magic number: 'LCAP'
@@ -80,12 +88,82 @@ namespace lsp
         uint32_t        reserved[6];    // Some reserved data for future use
     } lspc_chunk_audio_profile_t;
 
+    typedef struct lspc_chunk_toc_header_t // Magic number: 'TOC '
+    {
+        lspc_header_t   common;         // Common header data
+        uint32_t        entries;        // Number of entries that follow the header
+        uint32_t        reserved[4];    // Some reserved data
+    } lspc_chunk_toc_header_t;
+
+    typedef struct lspc_toc_entry_t
+    {
+        uint32_t        uid;            // Unique chunk identifier
+        uint32_t        magic;          // Chunk type
+        uint64_t        offset;         // Offset of the header of the first chunk fragment in file
+    } lspc_toc_entry_t;
+
+    /** Audio data encoded with LSPC_CODEC_LOSSLESS is stored as a sequence of
+     * independent blocks. Each block starts with the block header followed by the
+     * bit stream of compressed data that contains the channels of the block one
+     * after another. The channel is stored as:
+     *
+     *      1 bit           the channel is stored as difference with previous channel
+     *      4 bits          predictor order N (0 - 12), 15 for samples stored as is
+     *      5 bits          shift of predictor coefficients (if N > 0)
+     *      N x 16 bits     signed predictor coefficients (if N > 0)
+     *      N x (B+1) bits  signed warm-up samples, B is bits per sample
+     *      partitions      residual data split into partitions of 256 samples,
+     *                      each partition stores 5-bit Rice parameter followed
+     *                      by Rice-coded residuals
+     *
+     * If samples are stored as is, the channel contains all samples as signed
+     * (B+1)-bit values instead of predictor, warm-up samples and residual data.
+     *
+     * Floating-point samples are converted to 32-bit integers (B = 31) and each
+     * channel is prefixed with:
+     *
+     *      1 bit           all samples are integers scaled by power of 2
+     *      5 bits          the power K of the scale (if scaled)
+     *
+     * Scaled samples are stored as v * 2^K. Other samples are stored as IEEE 754
+     * single-precision values with the sign and magnitude mapped to the ordered
+     * integer (v < 0 ? -magnitude - 1 : magnitude). The difference with previous
+     * channel is not used for floating-point samples.
+     *
+     * Each block is padded to the byte boundary.
+     */
+    typedef struct lspc_audio_block_header_t
+    {
+        uint32_t        size;           // Size of compressed data that follows the header
+        uint32_t        frames;         // Number of frames stored in the block
+    } lspc_audio_block_header_t;
+
+    /** The block index allows to locate blocks of audio data encoded with
+     * LSPC_CODEC_LOSSLESS without reading the whole chunk. Each indexed block
+     * starts at the beginning of the audio chunk fragment. The index chunk contains
+     * the header followed by entries ordered by the frame number until the end of chunk.
+     */
+    typedef struct lspc_chunk_audio_index_header_t // Magic number: 'AIDX'
+    {
+        lspc_header_t   common;         // Common header data
+        uint32_t        chunk_id;       // Identifier of the indexed audio chunk
+        uint32_t        reserved[4];    // Some reserved data
+    } lspc_chunk_audio_index_header_t;
+
+    typedef struct lspc_audio_index_entry_t
+    {
+        uint64_t        frame;          // Number of the first frame of the block
+        uint64_t        offset;         // Offset of the header of the chunk fragment that starts with the block
+    } lspc_audio_index_entry_t;
+
 #pragma pack(pop)
 
 // Different chunk types
 #define LSPC_ROOT_MAGIC             0x4C535043
 #define LSPC_CHUNK_AUDIO            0x41554449
 #define LSPC_CHUNK_PROFILE          0x50524F46
+#define LSPC_CHUNK_TOC              0x544F4320
+#define LSPC_CHUNK_AUDIO_INDEX      0x41494458
 
 // Chunk flags
 #define LSPC_CHUNK_FLAG_LAST        (1 << 0)
@@ -131,6 +209,12 @@ typedef struct lspc_audio_parameters_t
 
 // Different codec types
 #define LSPC_CODEC_PCM              0
+#define LSPC_CODEC_LOSSLESS         1
+
+// Lossless codec parameters
+#define LSPC_LOSSLESS_BLOCK_FRAMES  0x1000
+#define LSPC_LOSSLESS_MAX_ORDER     12
+#define LSPC_LOSSLESS_PARTITION     0x100
 
 } /* lsp */
 
@@ -12,6 +12,10 @@
 #include <core/filters/common.h>
 #include <core/status.h>
 
+#define DYNAMIC_FILTERS_INTERP_MIN          4       /* Minimum distance between anchor points */
+#define DYNAMIC_FILTERS_INTERP_MAX          0x400   /* Maximum distance between anchor points */
+#define DYNAMIC_FILTERS_INTERP_DFL          32      /* Default maximum distance between anchor points */
+
 namespace lsp
 {
     /** This class implements set of dynamic filters grouped
@@ -44,16 +48,22 @@ namespace lsp
         protected:
             filter_t           *vFilters;           // Array of filters
             f_cascade_t        *vCascades;          // Analog filter cascade bank
+            f_cascade_t        *vAnchors;           // Analog filter cascades at anchor points
+            float              *vAnchorGain;        // Gain values at anchor points
+            size_t             *vAnchorStep;        // Distance to the next anchor point
             float              *vMemory;            // Filter memory
             biquad_bank_t       vBiquads;           // Biquad bank
             size_t              nFilters;           // Number of filters
             size_t              nSampleRate;        // Sample rate
+            size_t              nInterp;            // Distance between anchor points, 0 if cascades are computed for each sample
             void               *pData;              // Aligned pointer data
             bool                bClearMem;          // Clear memory
 
         protected:
             size_t              quantify(size_t c, size_t nc);
             size_t              build_filter_bank(f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples);
+            size_t              interpolate_filter_bank(f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples);
+            static bool         linear_gain(const float *g, size_t n);
             size_t              build_lrx_ladder_filter_bank(f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples, size_t ftype);
             size_t              build_lrx_shelf_filter_bank(f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples, size_t ftype);
 
@@ -81,6 +91,23 @@ namespace lsp
              */
             void set_sample_rate(size_t sr);
 
+            /** Set distance between anchor points. Filter cascades are computed
+             * exactly only at anchor points and linearly interpolated between them
+             * which is much cheaper for smoothly varying gain. The distance is reduced
+             * where the gain curve is not close to linear, so fast gain changes
+             * are still followed with cascades computed for each sample
+             *
+             * @param step maximum distance between anchor points in samples, 0 or 1 to compute
+             *   cascades for each sample
+             */
+            void set_interpolation(size_t step);
+
+            /** Get distance between anchor points
+             *
+             * @return distance between anchor points in samples, 0 if cascades are computed for each sample
+             */
+            inline size_t get_interpolation() const { return nInterp; };
+
             /** Destroy the dynamic filters set
              *
              */
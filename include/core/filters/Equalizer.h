@@ -10,6 +10,9 @@
 
 #include <core/filters/FilterBank.h>
 #include <core/filters/Filter.h>
+#include <core/ipc/ITask.h>
+#include <core/ipc/IExecutor.h>
+#include <core/ipc/Mutex.h>
 
 namespace lsp
 {
@@ -26,6 +29,20 @@ namespace lsp
         private:
             Equalizer & operator = (const Equalizer &);
 
+        protected:
+            class KernelTask: public ipc::ITask
+            {
+                private:
+                    Equalizer  *pCore;
+
+                public:
+                    explicit KernelTask(Equalizer *core);
+                    virtual ~KernelTask();
+
+                public:
+                    virtual status_t run();
+            };
+
         protected:
             enum eq_flags_t
             {
@@ -40,6 +57,10 @@ namespace lsp
             size_t              nSampleRate;        // Sample rate
             size_t              nConvSize;          // Convolution size
             size_t              nFftRank;           // FFT rank
+            size_t              nPartSize;          // Size of convolution partition
+            size_t              nPartRank;          // Fast convolution rank of the partition
+            size_t              nParts;             // Number of convolution partitions
+            size_t              nFdlHead;           // Position of the latest input image in the frequency-domain delay line
             size_t              nLatency;           // Equalizer latency
             size_t              nBufSize;           // Buffer size
             equalizer_mode_t    nMode;              // Equalizer mode
@@ -47,13 +68,37 @@ namespace lsp
             float              *vFftIm;             // FFT buffer (imaginary part)
             float              *vConvRe;            // Convolution (real part)
             float              *vConvIm;            // Convolution (imaginary part)
+            float              *vConv;              // Fast convolution images of the impulse response partitions
+            float              *vFdl;               // Frequency-domain delay line of input partition images
+            float              *vInput;             // Input buffer
             float              *vBuffer;            // Processing buffer
             float              *vTmp;               // Temporary buffer for various calculations
-            float              *pData;              // Allocation data
+            float              *vNewConv;           // Convolution images built by the kernel task, old images while crossfading
+            float              *vTail;              // Convolution tail of the new kernel while crossfading
+            uint8_t            *pData;              // Allocation data
             size_t              nFlags;             // Flag that identifies that equalizer has to be rebuilt
 
+            FilterBank          sKBank;             // Filter bank used by the kernel task
+            Filter             *vKFilters;          // List of filters used by the kernel task
+            filter_params_t    *vKParams;           // Snapshot of filter parameters for the kernel task
+            size_t              nKSampleRate;       // Snapshot of sample rate for the kernel task
+            equalizer_mode_t    nKMode;             // Snapshot of equalizer mode for the kernel task
+            KernelTask          sKTask;             // Kernel task
+            ipc::Mutex          sKLock;             // Lock held by the kernel task while building the kernel
+            bool                bKernelStale;       // Kernel task has been launched before the reset of the state
+            bool                bKernelCancel;      // Kernel task should not touch the equalizer data
+            ipc::IExecutor     *pExecutor;          // Executor for the kernel task
+            size_t              nXFade;             // Number of blocks left to complete the kernel crossfade
+            bool                bKernelDirty;       // Kernel has to be rebuilt
+            bool                bKernelClear;       // Kernel has to be replaced without crossfade, output is muted until then
+
         protected:
             void                reconfigure();
+            void                build_kernel();
+            void                apply_kernel(bool crossfade);
+            void                update_kernel();
+            void                convolve(float *dst, const float *conv);
+            void                process_block();
 
         public:
             explicit Equalizer();
@@ -64,9 +109,12 @@ namespace lsp
              *
              * @param filters number of filters
              * @param conv_rank convolution size rank
+             * @param part_rank rank of the uniform partition of the convolution used in
+             *      EQM_FIR and EQM_FFT modes, 0 means half of the convolution size. Lower
+             *      partition rank gives lower latency but requires more computations
              * @return true on success
              */
-            bool init(size_t filters, size_t conv_rank);
+            bool init(size_t filters, size_t conv_rank, size_t part_rank = 0);
 
             /** Destroy equalizer
              *
@@ -113,6 +161,17 @@ namespace lsp
              */
             void set_sample_rate(size_t sr);
 
+            /** Set executor for building the impulse response in EQM_FIR and EQM_FFT modes
+             * in background. When executor is set, the changes of filter parameters are
+             * applied with the crossfade between the old and the new impulse response,
+             * otherwise the impulse response is rebuilt immediately in the process() call.
+             * The executor should be shut down before the equalizer is destroyed, tasks
+             * that have been submitted but not launched are not waited by destroy()
+             *
+             * @param executor executor or NULL
+             */
+            inline void set_executor(ipc::IExecutor *executor) { pExecutor = executor; }
+
             /** Get equalizer mode
              *
              * @return equalizer mode
@@ -153,6 +212,19 @@ namespace lsp
              * @param samples number of samples to process
              */
             void process(float *out, const float *in, size_t samples);
+
+            /** Process signals of several linked equalizers with the same settings at once,
+             * for example channels of the stereo equalizer. IIR filters of all equalizers
+             * are computed simultaneously in interleaved SIMD lanes. Equalizers that are not in
+             * IIR mode or have different filter settings are processed each separately
+             *
+             * @param eq array of n equalizers
+             * @param out array of n output buffers
+             * @param in array of n input buffers, may match buffers of out
+             * @param n number of equalizers
+             * @param samples number of samples to process
+             */
+            static void process(Equalizer **eq, float **out, const float **in, size_t n, size_t samples);
     };
 
 } /* namespace lsp */
@@ -10,6 +10,11 @@
 
 #include <dsp/dsp.h>
 
+// Maximum number of filter banks processed at once in interleaved SIMD lanes
+#define FILTER_BANK_LANES_MAX       8
+// Number of samples processed per one interleaved block
+#define FILTER_BANK_BUF_SIZE        128
+
 namespace lsp
 {
     class FilterBank
@@ -28,6 +33,9 @@ namespace lsp
 
         protected:
             void        clear_delays();
+            void        chain_delays(size_t k, float **d0, float **d1);
+
+            static void process_lanes(FilterBank **fb, float **out, const float **in, size_t n, size_t samples);
 
         public:
             explicit FilterBank();
@@ -74,6 +82,29 @@ namespace lsp
              */
             void                process(float *out, const float *in, size_t samples);
 
+            /** Check that the filter bank contains the same cascades as another filter bank,
+             * so both banks can be processed together in interleaved lanes
+             *
+             * @param fb filter bank to compare with
+             * @return true if both banks contain the same number of cascades with equal coefficients
+             */
+            bool                same_chains(const FilterBank *fb) const;
+
+            /** Process signals of several filter banks of the same structure at once, for example
+             * channels of the linked stereo equalizer. Cascades that do not fill the SIMD register
+             * in the bank are computed for several channels simultaneously in interleaved lanes.
+             * The coefficients of interleaved cascades are taken from the first bank, so banks
+             * that contain different cascades are processed each separately, each bank keeps
+             * it's own filter memory
+             *
+             * @param fb array of n filter banks
+             * @param out array of n output buffers
+             * @param in array of n input buffers, may match buffers of out
+             * @param n number of filter banks
+             * @param samples number of samples to process
+             */
+            static void         process(FilterBank **fb, float **out, const float **in, size_t n, size_t samples);
+
             /** Get impulse response of the bank
              *
              * @param out output buffer to store impulse response
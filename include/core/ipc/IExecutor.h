@@ -37,6 +37,17 @@ namespace lsp
                     return next;
                 }
 
+                static inline ITask *peek_task(ITask *task)
+                {
+                    return task->pNext;
+                }
+
+                static inline void unlink_task(ITask *prev, ITask *task)
+                {
+                    prev->pNext     = task->pNext;
+                    task->pNext     = NULL;
+                }
+
                 static inline void run_task(ITask *task)
                 {
                     // Enable DSP context for executor service
@@ -66,6 +77,15 @@ namespace lsp
                  */
                 virtual bool submit(ITask *task);
 
+                /** Cancel the submitted task that has not been started yet.
+                 * Executors that are not able to cancel tasks always return false
+                 *
+                 * @param task task to cancel
+                 * @return true if the task is idle now, false if the task is
+                 *   running, completed or can not be cancelled
+                 */
+                virtual bool cancel(ITask *task);
+
                 /** Shutdown executor service
                  * The method must return only when all tasks
                  * have been completed or terminated
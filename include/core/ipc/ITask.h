@@ -26,10 +26,20 @@ namespace lsp
                     TS_COMPLETED
                 };
 
+                enum task_priority_t
+                {
+                    TP_HIGH,
+                    TP_NORMAL,
+                    TP_LOW,
+
+                    TP_TOTAL
+                };
+
             protected:
                 // Task linking
                 ITask      *pNext;
                 int         nCode;
+                task_priority_t nPriority;
 
                 // Task state
                 volatile task_state_t    nState;
@@ -89,6 +99,26 @@ namespace lsp
                  */
                 inline task_state_t state() const {return nState;                   };
 
+                /** Get task priority, executors that support priorities
+                 * fetch tasks with higher priority first
+                 *
+                 * @return task priority
+                 */
+                inline task_priority_t priority() const { return nPriority;         };
+
+                /** Set task priority, should be called only for idle task
+                 *
+                 * @param priority task priority
+                 * @return true if priority has been changed
+                 */
+                inline bool set_priority(task_priority_t priority)
+                {
+                    if ((nState != TS_IDLE) || (priority < TP_HIGH) || (priority >= TP_TOTAL))
+                        return false;
+                    nPriority   = priority;
+                    return true;
+                }
+
                 /** Reset task state
                  *
                  * @return task state
@@ -40,6 +40,8 @@ namespace lsp
 
                 virtual bool submit(ITask *task);
 
+                virtual bool cancel(ITask *task);
+
                 virtual void shutdown();
         };
     }
@@ -117,6 +117,11 @@ namespace lsp
                  */
                 static status_t sleep(wsize_t millis);
 
+                /**
+                 * Give the rest of the time slice of the current thread to other threads
+                 */
+                static void yield();
+
                 /**
                  * Return the current thread
                  * @return current thread or NULL if current thread is not an instance of ipc::Thread class
@@ -0,0 +1,116 @@
+/*
+ * ThreadPoolExecutor.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_IPC_THREADPOOLEXECUTOR_H_
+#define CORE_IPC_THREADPOOLEXECUTOR_H_
+
+#include <dsp/atomic.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/IExecutor.h>
+#include <core/ipc/ITask.h>
+
+#define THREAD_POOL_DFL_WORKERS         4           /* Default maximum number of workers            */
+#define THREAD_POOL_MAX_WORKERS         64          /* Maximum number of workers                    */
+#define THREAD_POOL_IDLE_MIN            1           /* Minimum idle delay of worker in milliseconds */
+#define THREAD_POOL_IDLE_MAX            100         /* Maximum idle delay of worker in milliseconds */
+
+namespace lsp
+{
+    namespace ipc
+    {
+        /**
+         * Executor service that runs tasks on the pool of worker threads.
+         * Each worker has it's own set of queues (one per task priority),
+         * idle workers steal tasks from queues of other workers. Tasks with
+         * higher priority are always fetched before tasks with lower priority.
+         * The submit() method never blocks, so it can be safely called from
+         * the real-time thread.
+         */
+        class ThreadPoolExecutor: public IExecutor
+        {
+            private:
+                typedef struct queue_t
+                {
+                    ITask              *pHead;
+                    ITask              *pTail;
+                } queue_t;
+
+                typedef struct worker_t
+                {
+                    ThreadPoolExecutor *pExecutor;      // Executor
+                    Thread             *pThread;        // Worker thread
+                    atomic_t            nLock;          // Queue lock
+                    queue_t             vQueues[ITask::TP_TOTAL]; // Task queues, one per priority
+                    size_t              nExecuted;      // Number of executed tasks
+                    size_t              nStolen;        // Number of tasks stolen from other workers
+                } worker_t;
+
+            private:
+                worker_t           *vWorkers;           // List of workers
+                size_t              nWorkers;           // Number of workers
+                uatomic_t           nNext;              // Round-robin counter for submission
+                volatile atomic_t   nPending;           // Number of submitted but not completed tasks
+
+            private:
+                ThreadPoolExecutor &operator = (const ThreadPoolExecutor &src); // Deny copying
+
+            protected:
+                static status_t     execute(void *params);
+                void                run(worker_t *w);
+                ITask              *fetch_task(worker_t *w);
+                static ITask       *pop_task(worker_t *w, size_t priority);
+                void                destroy();
+
+            public:
+                explicit ThreadPoolExecutor();
+                virtual ~ThreadPoolExecutor();
+
+            public:
+                /** Start executor service
+                 *
+                 * @param workers number of worker threads, zero value means
+                 *   to use number of available CPU cores but not more than THREAD_POOL_DFL_WORKERS
+                 * @return status of operation
+                 */
+                status_t start(size_t workers = 0);
+
+                /** Get number of workers
+                 *
+                 * @return number of workers
+                 */
+                inline size_t workers() const   { return nWorkers; }
+
+                /** Get number of tasks that are submitted and not yet completed
+                 *
+                 * @return number of pending tasks
+                 */
+                inline size_t pending() const   { return nPending; }
+
+                /** Get number of tasks executed by the worker
+                 *
+                 * @param worker worker index
+                 * @return number of tasks executed by the worker
+                 */
+                size_t executed(size_t worker) const;
+
+                /** Get number of tasks the worker has stolen from other workers
+                 *
+                 * @param worker worker index
+                 * @return number of tasks stolen by the worker
+                 */
+                size_t stolen(size_t worker) const;
+
+                virtual bool submit(ITask *task);
+
+                virtual bool cancel(ITask *task);
+
+                virtual void shutdown();
+        };
+    }
+}
+
+#endif /* CORE_IPC_THREADPOOLEXECUTOR_H_ */
@@ -9,6 +9,7 @@
 #define CORE_SAMPLING_SAMPLE_H_
 
 #include <core/types.h>
+#include <core/sampling/SampleStream.h>
 
 #define AUDIO_SAMPLE_CONTENT_TYPE       "application/x-lsp-audio-sample"
 
@@ -31,6 +32,7 @@ namespace lsp
             size_t      nLength;
             size_t      nMaxLength;
             size_t      nChannels;
+            SampleStream   *pStream;
 
         private:
             Sample & operator = (const Sample &);
@@ -52,6 +54,19 @@ namespace lsp
 
             inline size_t channels() const { return nChannels; };
 
+            /** Get the stream that provides the data of the sample beyond it's length
+             *
+             * @return pointer to the stream or NULL
+             */
+            inline SampleStream *stream() { return pStream; }
+
+            /** Set the stream that provides the data of the sample beyond it's length,
+             * the sample does not take ownership of the stream
+             *
+             * @param stream pointer to the stream or NULL
+             */
+            inline void set_stream(SampleStream *stream) { pStream = stream; }
+
             /** Set length of sample
              *
              * @param length length to set
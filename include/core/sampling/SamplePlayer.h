@@ -8,6 +8,9 @@
 #ifndef CORE_SAMPLING_SAMPLEPLAYER_H_
 #define CORE_SAMPLING_SAMPLEPLAYER_H_
 
+#include <dsp/atomic.h>
+#include <core/ipc/ITask.h>
+#include <core/ipc/IExecutor.h>
 #include <core/sampling/Sample.h>
 
 namespace lsp
@@ -15,15 +18,53 @@ namespace lsp
     class SamplePlayer
     {
         protected:
+            enum stream_state_t
+            {
+                SS_FREE,                // Stream slot is not used
+                SS_ACTIVE,              // Stream slot is used by playback
+                SS_RELEASED             // Stream slot is released but may be still accessed by I/O task
+            };
+
+            typedef struct stream_t
+            {
+                SampleStream       *pStream;    // Stream to read data
+                size_t              nChannel;   // Channel of the stream
+                size_t              nHead;      // Offset of the rendered sample in the file
+                size_t              nStart;     // Position in the rendered sample of the first frame in ring buffer
+                size_t              nLength;    // Length of the rendered sample
+                size_t              nFadeIn;    // Fade-in length of the rendered sample
+                size_t              nFadeOut;   // Fade-out length of the rendered sample
+                volatile uatomic_t  nRead;      // Number of frames consumed by playback
+                volatile uatomic_t  nWrite;     // Number of frames stored by I/O task
+                volatile size_t     nState;     // Stream state
+                float              *vData;      // Ring buffer, allocated by I/O task on first use
+                uint8_t            *pData;      // Allocated data of ring buffer
+            } stream_t;
+
+            class StreamTask: public ipc::ITask
+            {
+                private:
+                    SamplePlayer       *pPlayer;
+
+                public:
+                    explicit StreamTask(SamplePlayer *player);
+                    virtual ~StreamTask();
+
+                public:
+                    virtual status_t run();
+            };
+
             typedef struct playback_t
             {
                 Sample     *pSample;    // Pointer to the sample
+                stream_t   *pStream;    // Stream slot that provides data beyond the sample length
                 ssize_t     nID;        // ID of playback
                 size_t      nChannel;   // Channel to play
                 ssize_t     nOffset;    // Current offset
                 ssize_t     nFadeout;   // Fadeout (cancelling)
                 ssize_t     nFadeOffset;// Fadeout offset
                 float       nVolume;    // The volume of the sample
+                float       fRate;      // Playback rate, 1.0 means original pitch
                 playback_t *pNext;      // Pointer to the next playback in the list
                 playback_t *pPrev;      // Pointer to the previous playback in the list
             } playback_t;
@@ -43,13 +84,34 @@ namespace lsp
             list_t          sInactive;
             float           fGain;
 
+            stream_t       *vStreams;       // Stream slots
+            size_t          nStreams;       // Number of stream slots
+            size_t          nStreamTop;     // Number of stream slots that have been used at least once
+            size_t          nStreamBuffer;  // Size of ring buffer of each stream slot
+            size_t          nUnderruns;     // Number of underruns
+            StreamTask      sTask;          // I/O task that fills stream slots
+            float          *vBuffer;        // Buffer for interpolated samples
+            float          *vFetch;         // Buffer for source samples of interpolation
+            float          *vDecim;         // Buffer for band-limited source samples when pitching up
+            float          *vKernel;        // Anti-aliasing kernel for pitching up
+            float           fKernelRate;    // Playback rate the anti-aliasing kernel is designed for
+            size_t          nKernelHalf;    // Half-length of the anti-aliasing kernel
+            uint8_t        *pData;          // Allocated data for interpolation buffers
+
         protected:
             static inline void cleanup(playback_t *pb);
             static inline void list_remove(list_t *list, playback_t *pb);
             static inline playback_t *list_remove_first(list_t *list);
             static inline void list_add_first(list_t *list, playback_t *pb);
             static inline void list_insert_from_tail(list_t *list, playback_t *pb);
+            static inline void release_stream(playback_t *pb);
+            void add_samples(playback_t *pb, float *dst, const float *src, size_t count);
+            void stream_samples(playback_t *pb, float *dst, size_t offset, size_t count);
+            void fetch_samples(playback_t *pb, float *dst, ssize_t offset, size_t count);
+            void pitch_samples(playback_t *pb, float *dst, size_t offset, size_t count);
+            void design_kernel(float rate);
             void do_process(float *dst, size_t samples);
+            void fill_streams();
 
         public:
             SamplePlayer();
@@ -66,9 +128,13 @@ namespace lsp
              *
              * @param max_samples maximum available samples
              * @param max_playbacks maximum number of simultaneous played samples
+             * @param max_streams maximum number of simultaneous playbacks that read data of streamed samples,
+             *   the ring buffer of the stream slot is allocated by the I/O task when the slot is used for the
+             *   first time, so the memory is consumed only by the slots actually needed by playbacks
+             * @param stream_buffer size of the ring buffer of each streamed playback in samples
              * @return true on success
              */
-            bool init(size_t max_samples, size_t max_playbacks);
+            bool init(size_t max_samples, size_t max_playbacks, size_t max_streams = 0, size_t stream_buffer = 0);
 
             /** Destroy player
              * @param cascade destroy the bound samples
@@ -76,7 +142,9 @@ namespace lsp
             void destroy(bool cascade = true);
 
             /** Bind sample to specified ID, cancel all active playbacks previously associated
-             * with this sample
+             * with this sample. Binding the same sample again keeps its playbacks but drops
+             * their stream slots, so the changed stream of the sample is re-read on the next
+             * submit() call
              *
              * @param id id of the sample
              * @param sample pointer to the sample
@@ -131,9 +199,12 @@ namespace lsp
              * @param channel ID of the sample's channel
              * @param volume the volume of the sample
              * @param delay the delay (in samples) of the sample relatively to the next process() call
+             * @param rate the playback rate, values other than 1.0 change the pitch of the sample
+             *   by interpolating the sample data, the rate is limited to the range of 0.125 .. 8.0,
+             *   for rates above 1.0 the sample data is band-limited to prevent aliasing
              * @return true if parameters are valid
              */
-            bool play(size_t id, size_t channel, float volume, ssize_t delay = 0);
+            bool play(size_t id, size_t channel, float volume, ssize_t delay = 0, float rate = 1.0f);
 
             /** Softly cancel playback of the sample
              *
@@ -149,6 +220,28 @@ namespace lsp
              *
              */
             void stop();
+
+            /** Assign stream slots to the playbacks of streamed samples and submit the I/O task
+             * that fills the ring buffers of stream slots. Should be called from the same thread
+             * as process() after the processing
+             *
+             * @param executor executor service
+             * @return true if I/O task has been submitted
+             */
+            bool submit(ipc::IExecutor *executor);
+
+            /** Check that I/O task is not submitted and not running
+             *
+             * @return true if I/O task is idle
+             */
+            bool idle();
+
+            /** Get number of underruns of streamed playbacks since the last call and reset the counter,
+             * playbacks that reach the streamed data without assigned stream slot also cause underruns
+             *
+             * @return number of underruns
+             */
+            size_t fetch_underruns();
     };
 
 } /* namespace lsp */
@@ -0,0 +1,108 @@
+/*
+ * SampleStream.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_SAMPLING_SAMPLESTREAM_H_
+#define CORE_SAMPLING_SAMPLESTREAM_H_
+
+#include <core/types.h>
+#include <core/status.h>
+#include <core/ipc/Mutex.h>
+
+namespace lsp
+{
+    /**
+     * Audio file opened for random access reading of the sample data. The stream
+     * provides the data of the sample that is not preloaded into the memory.
+     *
+     * The rendering window (the part of the file that is played as a sample and
+     * the fade-in/fade-out parameters of the sample) should be modified only by the
+     * thread that owns the sample, the read methods can be called by any thread,
+     * simultaneous reads are serialized.
+     */
+    class SampleStream
+    {
+        private:
+            SampleStream & operator = (const SampleStream &);
+
+        protected:
+            void               *hHandle;        // Handle of the opened file
+            size_t              nChannels;      // Number of channels
+            size_t              nSampleRate;    // Sample rate
+            size_t              nFrames;        // Number of frames in the file
+            float              *vBuffer;        // Buffer for interleaved data
+            ipc::Mutex          sMutex;         // Mutex for serializing reads
+
+            size_t              nHead;          // Offset of the rendered sample in the file
+            size_t              nLength;        // Length of the rendered sample
+            size_t              nFadeIn;        // Fade-in length
+            size_t              nFadeOut;       // Fade-out length
+
+        protected:
+            ssize_t             read_frames(size_t offset, size_t count);
+            ssize_t             read_channels(float **dst, size_t first, size_t channels, size_t offset, size_t count);
+
+        public:
+            explicit SampleStream();
+            ~SampleStream();
+
+        public:
+            /** Open the audio file for streaming
+             *
+             * @param path path to the file
+             * @param max_duration maximum duration of the stream in seconds, negative value means no limit
+             * @return status of operation, STATUS_NOT_SUPPORTED if streaming of the file is not supported
+             */
+            status_t open(const char *path, float max_duration = -1);
+
+            /** Close the file
+             *
+             */
+            void close();
+
+            /** Read frames of the single channel, the data beyond the end of the file is zeroed
+             *
+             * @param channel channel to read
+             * @param dst destination buffer to store data
+             * @param offset offset of the first frame in the file
+             * @param count number of frames to read
+             * @return number of frames actually read from the file or negative error code
+             */
+            ssize_t read(size_t channel, float *dst, size_t offset, size_t count);
+
+            /** Read frames of all channels, the data beyond the end of the file is zeroed
+             *
+             * @param dst array of destination buffers for each channel of the stream, NULL buffers are skipped
+             * @param offset offset of the first frame in the file
+             * @param count number of frames to read
+             * @return number of frames actually read from the file or negative error code
+             */
+            ssize_t read(float **dst, size_t offset, size_t count);
+
+            /** Set rendering window of the sample
+             *
+             * @param head offset of the rendered sample in the file
+             * @param length length of the rendered sample
+             * @param fade_in fade-in length of the rendered sample
+             * @param fade_out fade-out length of the rendered sample
+             */
+            void set_window(size_t head, size_t length, size_t fade_in, size_t fade_out);
+
+        public:
+            inline bool opened() const          { return hHandle != NULL;   }
+            inline size_t channels() const      { return nChannels;         }
+            inline size_t sample_rate() const   { return nSampleRate;       }
+            inline size_t frames() const        { return nFrames;           }
+
+            inline size_t head() const          { return nHead;             }
+            inline size_t length() const        { return nLength;           }
+            inline size_t fade_in() const       { return nFadeIn;           }
+            inline size_t fade_out() const      { return nFadeOut;          }
+    };
+
+} /* namespace lsp */
+
+#endif /* CORE_SAMPLING_SAMPLESTREAM_H_ */
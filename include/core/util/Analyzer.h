@@ -51,8 +51,9 @@ namespace lsp
 
             typedef struct channel_t
             {
-                float      *vBuffer;        // FFT buffer
+                float      *vBuffer;        // FFT ring buffer
                 float      *vAmp;           // FFT amplitude
+                size_t      nHead;          // Position of the oldest sample in the ring buffer
                 ssize_t     nCounter;       // FFT trigger counter
                 bool        bFreeze;        // Freeze analysis
                 bool        bActive;        // Enable analysis
@@ -81,6 +82,11 @@ namespace lsp
             float      *vWindow;            // FFT window
             float      *vEnvelope;          // FFT envelope
 
+        protected:
+            void        process_channel(channel_t *c, const float *in, size_t samples);
+            void        skip_channel(channel_t *c, const float *in, size_t samples);
+            void        analyze_channel(channel_t *c);
+
         public:
             Analyzer();
             ~Analyzer();
@@ -259,6 +265,15 @@ namespace lsp
              */
             void process(size_t channel, const float *in, size_t samples);
 
+            /** Process data of all channels in one pass. Channels that are
+             * frozen or disabled do not consume CPU for buffering and analysis.
+             *
+             * @param in list of input buffers for each channel, NULL buffer
+             *        means that the channel should not be processed
+             * @param samples number of samples to process
+             */
+            void process(const float * const *in, size_t samples);
+
             /** Read spectrum data
              *
              * @param channel channel
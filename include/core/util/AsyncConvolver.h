@@ -0,0 +1,138 @@
+/*
+ * AsyncConvolver.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef CORE_UTIL_ASYNCCONVOLVER_H_
+#define CORE_UTIL_ASYNCCONVOLVER_H_
+
+#include <dsp/atomic.h>
+#include <core/types.h>
+#include <core/ipc/ITask.h>
+#include <core/ipc/IExecutor.h>
+#include <core/util/Convolver.h>
+
+#define ASYNC_CONVOLVER_RANK_EARLY      11      /* Maximum FFT rank of the early part processed in real time */
+
+namespace lsp
+{
+    /**
+     * Convolver that splits the impulse response into the early and the late part.
+     * The early part (first 'delay' samples of the impulse response) is processed
+     * in the real-time thread, the late part is processed by the background task.
+     * The input data is passed to the background task and the result is passed back
+     * through the pair of lock-free ring buffers, the 'delay' samples of the early part
+     * are the headroom for the background task to deliver the result in time.
+     * If the result is not ready when it is required by the real-time thread, the
+     * missing samples are skipped and the late deadline counter is incremented.
+     * The FFT rank of the early part is limited by ASYNC_CONVOLVER_RANK_EARLY to
+     * keep the load of the real-time thread even.
+     */
+    class AsyncConvolver
+    {
+        private:
+            AsyncConvolver & operator = (const AsyncConvolver &);
+
+        protected:
+            class LateTask: public ipc::ITask
+            {
+                private:
+                    AsyncConvolver     *pCore;
+
+                public:
+                    explicit LateTask(AsyncConvolver *core);
+                    virtual ~LateTask();
+
+                public:
+                    virtual status_t run();
+            };
+
+        protected:
+            Convolver           sEarly;         // Early part of the convolution, real-time
+            Convolver           sLate;          // Late part of the convolution, background
+            LateTask            sTask;          // Background task
+
+            float              *vInBuf;         // Ring buffer with input data
+            float              *vOutBuf;        // Ring buffer with processed late part
+            size_t              nCapacity;      // Capacity of each ring buffer
+            size_t              nDelay;         // Offset of the late part, the headroom for background task
+            size_t              nConvSize;      // Size of convolution
+            volatile uatomic_t  nWritePos;      // Position of input data written by real-time thread
+            volatile uatomic_t  nReadPos;       // Position of data processed by background task
+            size_t              nLate;          // Number of late deadlines
+            bool                bLate;          // Late part is present
+            uint8_t            *pData;
+
+        protected:
+            status_t            process_late();
+
+        public:
+            explicit AsyncConvolver();
+            ~AsyncConvolver();
+
+        public:
+            /** Initialize convolver
+             *
+             * @param data convolution data
+             * @param count number of samples in convolution
+             * @param rank convolution rank
+             * @param phase convolution phase
+             * @param delay offset of the late part in samples, zero value disables
+             *   background processing, should not be less than the maximum number
+             *   of samples passed to the process() call
+             * @return true on success
+             */
+            bool init(const float *data, size_t count, size_t rank, float phase, size_t delay);
+
+            /** Destroy convolver, the background task should be in idle state
+             *
+             */
+            void destroy();
+
+            /** Process samples, should be called from the real-time thread
+             *
+             * @param dst destination buffer
+             * @param src source buffer
+             * @param count number of samples to process
+             */
+            void process(float *dst, const float *src, size_t count);
+
+            /** Submit the background task if there is unprocessed data,
+             * should be called from the same thread as process()
+             *
+             * @param executor executor service
+             * @return true if background task is active
+             */
+            bool submit(ipc::IExecutor *executor);
+
+            /** Check that background task is not active, should be called from
+             * the same thread as process()
+             *
+             * @return true if background task is not active
+             */
+            bool idle();
+
+            /** Get number of late deadlines since the last call and reset the counter
+             *
+             * @return number of late deadlines
+             */
+            size_t fetch_late();
+
+            /** Get the actual convolution size in samples
+             *
+             * @return actual convolution size in samples
+             */
+            inline size_t data_size() const    { return nConvSize; }
+
+            /** Get offset of the late part
+             *
+             * @return offset of the late part in samples, zero if background processing is disabled
+             */
+            inline size_t delay() const        { return (bLate) ? nDelay : 0; }
+    };
+
+} /* namespace lsp */
+
+#endif /* CORE_UTIL_ASYNCCONVOLVER_H_ */
@@ -16,10 +16,19 @@
 #define CONVOLVER_RANK_FFT_SMALL    8                                 /* buffer of 256 samples (128 effective)    */
 //#define CONVOLVER_RANK_FFT_SMALL    4                               /* buffer of 16 samples (8 effective)      */
 #define CONVOLVER_RANK_MIN          (CONVOLVER_RANK_FFT_SMALL+1)    /* buffer of 512 samples (256 effective)    */
-#define CONVOLVER_RANK_MAX          16                              /* buffer of 8192 samples (4096 effective)  */
+#define CONVOLVER_RANK_MAX          20                              /* buffer of 1048576 samples (524288 effective) */
 
 namespace lsp
 {
+    /**
+     * Non-uniform partitioned convolver. The head of the impulse response is
+     * processed by the direct convolution and small FFT blocks, the middle part
+     * is processed by FFT blocks of growing size and the tail is processed by
+     * uniform FFT blocks of maximum rank using the frequency-domain delay line:
+     * products of the tail blocks are accumulated in the frequency domain and
+     * are evenly spread between calls of process(), so only one reverse FFT
+     * is performed per frame of maximum rank.
+     */
     class Convolver
     {
         private:
@@ -38,15 +47,17 @@ namespace lsp
             float      *vBufferPtr;             // Current pointer
             float      *vBufferEnd;             // Buffer End
             float      *vConvFirst;             // First part of convolution in non-FFT mode
-            float      *vTask;                  // Task for post-processing (real + imaginary)
+            float      *vAccum;                 // Accumulator of the tail convolution (real + imaginary)
+            float      *vHistory;               // History of input frames for the tail convolution (real + imaginary)
 
             size_t      nRank;                  // FFT rank for convolution
             size_t      nSteps;                 // Number of raising steps
             size_t      nBlocks;                // Number of blocks
             size_t      nBlocksDone;            // Number of blocks done
             size_t      nDirectSize;            // Direct convolution size
-            float      *pConv;                  // Task convolution (real + imaginary)
-            float      *pTargetPtr;             // Target pointer for task
+            size_t      nHistory;               // Number of frames in history
+            size_t      nHistHead;              // Index of the most recent frame in history
+            float      *pConv;                  // Tail convolution (real + imaginary)
             uint8_t    *vData;
 
         public:
@@ -44,9 +44,28 @@ namespace lsp
         OM_LANCZOS_6X2,
         OM_LANCZOS_6X3,
         OM_LANCZOS_8X2,
-        OM_LANCZOS_8X3
+        OM_LANCZOS_8X3,
+
+        OM_HALFBAND_2X_FAST,
+        OM_HALFBAND_2X_NORMAL,
+        OM_HALFBAND_2X_HIGH,
+        OM_HALFBAND_4X_FAST,
+        OM_HALFBAND_4X_NORMAL,
+        OM_HALFBAND_4X_HIGH,
+        OM_HALFBAND_8X_FAST,
+        OM_HALFBAND_8X_NORMAL,
+        OM_HALFBAND_8X_HIGH,
+
+        OM_HALFBAND_IIR_2X,
+        OM_HALFBAND_IIR_4X,
+        OM_HALFBAND_IIR_8X
     };
 
+    #define OS_HALFBAND_STAGES_MAX      3       /* Maximum number of 2x stages */
+    #define OS_HALFBAND_TAPS_MAX        64      /* Maximum number of FIR taps in the polyphase branch */
+    #define OS_HALFBAND_COEFS_MAX       8       /* Maximum number of IIR all-pass coefficients */
+    #define OS_LATENCY_MAX              80      /* Upper bound of the latency for all modes in normal samples */
+
     /** Oversampler class
      *
      */
@@ -62,6 +81,26 @@ namespace lsp
                 UP_ALL          = UP_MODE | UP_OTHER | UP_SAMPLE_RATE
             };
 
+            /** Half-band 2x resampling stage. FIR stages use the linear-phase
+             * polyphase kernel, IIR stages use two paths of cascaded all-pass
+             * filters which give minimum latency at the cost of the phase linearity
+             */
+            typedef struct halfband_t
+            {
+                float      *vUp;                                    // Upsampling buffer: history + data
+                float      *vDown;                                  // Downsampling buffer: history + data
+                size_t      nUpHistory;                             // Size of upsampling history
+                size_t      nDownHistory;                           // Size of downsampling history
+                size_t      nTaps;                                  // Number of FIR taps, 0 for IIR stage
+                size_t      nCoefs;                                 // Number of IIR all-pass coefficients
+                float       vKernel[OS_HALFBAND_TAPS_MAX];          // FIR kernel of the odd phase
+                float       vCoefs[OS_HALFBAND_COEFS_MAX];          // IIR all-pass coefficients
+                float       vUpX[OS_HALFBAND_COEFS_MAX];            // IIR upsampler input memory
+                float       vUpY[OS_HALFBAND_COEFS_MAX];            // IIR upsampler output memory
+                float       vDownX[OS_HALFBAND_COEFS_MAX];          // IIR downsampler input memory
+                float       vDownY[OS_HALFBAND_COEFS_MAX];          // IIR downsampler output memory
+            } halfband_t;
+
         protected:
             IOversamplerCallback   *pCallback;
             float                  *fUpBuffer;
@@ -73,10 +112,23 @@ namespace lsp
             Filter                  sFilter;
             uint8_t                *bData;
             bool                    bFilter;
+            size_t                  nStages;
+            size_t                  nLatency;
+            halfband_t              vStages[OS_HALFBAND_STAGES_MAX];
 
 //        protected:
 //            static void do_filter(float *out, const float *in, size_t count);
 
+        protected:
+            void            configure_halfband();
+            void            halfband_upsample(float *dst, const float *src, size_t samples);
+            void            halfband_downsample(float *dst, const float *src, size_t samples);
+
+            static void     design_fir(halfband_t *hb, size_t taps, bool high);
+            static void     design_iir(halfband_t *hb, size_t coefs, double transition);
+            static void     iir_upsample(halfband_t *hb, float *dst, const float *src, size_t count);
+            static void     iir_downsample(halfband_t *hb, float *dst, const float *src, size_t count);
+
         public:
             Oversampler();
             virtual ~Oversampler();
@@ -115,15 +167,16 @@ namespace lsp
             {
                 if (mode < OM_NONE)
                     mode = OM_NONE;
-                else if (mode > OM_LANCZOS_8X3)
-                    mode = OM_LANCZOS_8X3;
+                else if (mode > OM_HALFBAND_IIR_8X)
+                    mode = OM_HALFBAND_IIR_8X;
                 if (nMode == mode)
                     return;
                 nMode      = mode;
                 nUpdate   |= UP_MODE;
             }
 
-            /** Enable/disable low-pass filter when performing downsampling
+            /** Enable/disable low-pass filter when performing downsampling,
+             * half-band modes always perform filtering
              *
              * @param filter enables/diables low-pass filter
              */
@@ -192,7 +245,8 @@ namespace lsp
             }
 
             /**
-             * Get oversampler latency
+             * Get oversampler latency of the upsampling and downsampling round trip,
+             * for IIR half-band modes the value is the rounded group delay at low frequencies
              * @return oversampler latency in normal (non-oversampled) samples
              */
             size_t latency() const;
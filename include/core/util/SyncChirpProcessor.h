@@ -9,6 +9,7 @@
 #define CORE_UTIL_SYNCCHIRPPROCESSOR_H_
 
 #include <core/types.h>
+#include <dsp/atomic.h>
 #include <core/sampling/SamplePlayer.h>
 #include <core/status.h>
 #include <core/files/AudioFile.h>
@@ -106,11 +107,18 @@ namespace lsp
             	size_t         *vAlignOffsets;      // For each channel in the convolution result, the offset with which the result has to be stored so that all the origins of times are aligned [samples]
             	uint8_t        *pData;
 
+            	size_t         *vInParts;           // For each channel, the number of input time series partitions that contain data
+            	size_t         *vInvFirst;          // For each channel, the index of the first inverse filter partition that contains data
+            	size_t         *vBlocks;            // For each channel, the number of work items (blocks of output partitions) to compute
+            	float         **vInImages;          // For each channel, FFT images of input time series partitions that contain data
+            	float         **vInvImages;         // For each channel, FFT images of inverse filter partitions that contain data (shared between channels with same prepend)
+            	size_t          nBlockParts;        // Number of output partitions computed by single work item
+            	size_t          nItems;             // Overall number of work items
+            	float          *vCarry;             // For each work item, the tail of the last computed output partition
+            	uint8_t        *pImageData;
+
             	float 		   *vInPart; 			// Holds a single input time series partition
             	float          *vInvPart; 			// Holds a single inverse filter partition
-				float          *vInImage; 			// Holds a single input time series FFT image
-				float 	       *vInvImage; 			// Holds a single inverse filter FFT image
-				float 		   *vTemp; 				// Holds temporary data
             	uint8_t 	   *pTempData;
             	bool 			bReallocateTemp;
             } conv_t;
@@ -155,8 +163,27 @@ namespace lsp
                 float          *vTemprow2Re;
                 float          *vTemprow2Im;
                 uint8_t        *pData;
+
+                // Parameters of higher order responses windowing
+                size_t          nChannel;           // Channel in the convolution result
+                bool            bInnerSmoothing;    // Apply inner fade in and fade out
+                size_t          nFadeIn;            // Inner fade in length [samples]
+                size_t          nFadeOut;           // Inner fade out length [samples]
             } crpostproc_t;
 
+            typedef void (SyncChirpProcessor::*task_proc_t)(size_t item, float *buf);
+
+            // Set of work items processed concurrently by worker threads
+            typedef struct task_t
+            {
+                SyncChirpProcessor *pCore;          // Processor
+                task_proc_t         pProc;          // Procedure that processes single work item
+                size_t              nItems;         // Number of work items
+                size_t              nBufSize;       // Size of temporary buffer for each thread [samples]
+                volatile uatomic_t  nNext;          // Next work item to process
+                volatile uatomic_t  nDone;          // Number of processed work items
+            } task_t;
+
         private:
 
             size_t              nSampleRate;
@@ -183,6 +210,8 @@ namespace lsp
             float              *vEnvelopeBuffer;    // Buffer for Convolution Result Envelope processing
             uint8_t            *pData;
 
+            size_t              nThreads;           // Maximum number of worker threads, 0 means number of CPU cores
+
             bool                bSync;
 
         public:
@@ -235,14 +264,61 @@ namespace lsp
              */
             status_t allocateConvolutionResult(size_t sampleRate, size_t nchannels, size_t count);
 
-            /** Convolve a time series with the inverse filter
+            /** Find channel with the same inverse filter prepend, so the
+             * inverse filter images can be shared with it
+             *
+             * @param channel channel of the convolution result
+             * @return index of previous channel with the same prepend or negative value
+             */
+            ssize_t find_inverse_images(size_t channel) const;
+
+            /** Compute FFT images of the time series and inverse filter partitions
+             * for one channel of the convolution result
              *
              * @param data pointer to Sample object containing the time series
              * @param offset 0 time index for the time series
              * @param channel channel destination in the multichannel convolution result
+             * @param images pointer to the memory to store images, updated on return
+             */
+            void prepare_linear_convolution(Sample *data, size_t offset, size_t channel, float * &images);
+
+            /** Compute block of output partitions of the convolution result
+             *
+             * @param item work item
+             * @param buf temporary buffer of 2 FFT images
+             */
+            void convolution_task(size_t item, float *buf);
+
+            /** Window and transform higher order response
+             *
+             * @param item order of the response, starting with 0
+             * @param buf unused
+             */
+            void windowing_task(size_t item, float *buf);
+
+            /** Solve the identification linear systems for a block of frequency bins
+             *
+             * @param item block of frequency bins
+             * @param buf unused
+             */
+            void solve_task(size_t item, float *buf);
+
+            /** Get number of worker threads to use
+             *
+             * @return number of worker threads
+             */
+            size_t get_num_threads() const;
+
+            /** Process work items concurrently, the calling thread also processes work items
+             *
+             * @param proc procedure to process single work item
+             * @param items number of work items
+             * @param bufsize size of temporary buffer required by each thread [samples]
              * @return status
              */
-            status_t do_linear_convolution(Sample *data, size_t offset, size_t channel);
+            status_t run_tasks(task_proc_t proc, size_t items, size_t bufsize);
+
+            static status_t task_worker(void *arg);
 
             /** Allocate memory for the nonlinear identification matrices
              *
@@ -844,6 +920,24 @@ namespace lsp
                 sChirpParams.bReconfigure       = true;
                 bSync                           = true;
             }
+
+            /** Set maximum number of worker threads used for convolution and identification
+             *
+             * @param threads number of threads, 0 means number of available CPU cores
+             */
+            inline void set_threads(size_t threads)
+            {
+                nThreads                        = threads;
+            }
+
+            /** Get maximum number of worker threads used for convolution and identification
+             *
+             * @return number of threads, 0 means number of available CPU cores
+             */
+            inline size_t get_threads() const
+            {
+                return nThreads;
+            }
     };
 }
 
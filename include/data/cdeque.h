@@ -0,0 +1,225 @@
+/*
+ * cdeque.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DATA_CDEQUE_H_
+#define DATA_CDEQUE_H_
+
+#include <dsp/atomic.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#define CDEQUE_INITIAL      0x100       /* Initial capacity of the deque, should be power of 2  */
+#define CDEQUE_CACHE_LINE   0x40        /* Size of cache line to prevent false sharing          */
+
+namespace lsp
+{
+    /**
+     * Lock-free work-stealing deque (Chase-Lev deque).
+     * The owner thread pushes and pops items at the bottom of the deque
+     * in the LIFO order, other threads steal items from the top of the deque
+     * in the FIFO order. The push(), pop() and flush() methods are allowed to
+     * be called by the owner thread only, the steal() method can be called
+     * by any thread. Arrays replaced after the growth are kept until flush()
+     * is called since other threads still may read them.
+     */
+    class basic_deque
+    {
+        public:
+            enum steal_t
+            {
+                STEAL_OK,           // Item has been stolen
+                STEAL_EMPTY,        // Deque is empty
+                STEAL_ABORT         // Lost the race with other thread, retry is possible
+            };
+
+        private:
+            typedef struct array_t
+            {
+                array_t            *pNext;      // Next retired array
+                size_t              nMask;      // Capacity mask
+                void              **vItems;     // Items
+            } array_t;
+
+        private:
+            volatile ssize_t    nTop;           // Top index, modified by thieves
+            uint8_t             vPad1[CDEQUE_CACHE_LINE - sizeof(ssize_t)];
+            volatile ssize_t    nBottom;        // Bottom index, modified by the owner
+            array_t * volatile  pArray;         // Current array
+            array_t            *pRetired;       // List of retired arrays
+            uint8_t             vPad2[CDEQUE_CACHE_LINE - sizeof(ssize_t) - sizeof(array_t *) * 2];
+
+        private:
+            static array_t *alloc_array(size_t capacity)
+            {
+                array_t *a      = reinterpret_cast<array_t *>(::malloc(sizeof(array_t) + sizeof(void *) * capacity));
+                if (a == NULL)
+                    return NULL;
+
+                a->pNext        = NULL;
+                a->nMask        = capacity - 1;
+                a->vItems       = reinterpret_cast<void **>(&a[1]);
+                return a;
+            }
+
+            array_t *grow(array_t *a, ssize_t t, ssize_t b)
+            {
+                array_t *n      = alloc_array((a != NULL) ? (a->nMask + 1) << 1 : CDEQUE_INITIAL);
+                if (n == NULL)
+                    return NULL;
+
+                // Copy items and retire previous array
+                if (a != NULL)
+                {
+                    for (ssize_t i=t; i<b; ++i)
+                        n->vItems[i & n->nMask] = a->vItems[i & a->nMask];
+                    a->pNext        = pRetired;
+                    pRetired        = a;
+                }
+
+                // Items should be visible before the new array gets published
+                __sync_synchronize();
+                pArray          = n;
+                return n;
+            }
+
+        protected:
+            inline bool push_item(const void *ptr)
+            {
+                ssize_t b       = nBottom;
+                ssize_t t       = nTop;
+                array_t *a      = pArray;
+
+                if ((a == NULL) || (size_t(b - t) > a->nMask))
+                {
+                    if ((a = grow(a, t, b)) == NULL)
+                        return false;
+                }
+
+                a->vItems[b & a->nMask] = const_cast<void *>(ptr);
+                __sync_synchronize(); // Item should be visible before the bottom gets updated
+                nBottom         = b + 1;
+
+                return true;
+            }
+
+            inline void *pop_item()
+            {
+                array_t *a      = pArray;
+                if (a == NULL)
+                    return NULL;
+
+                ssize_t b       = nBottom - 1;
+                nBottom         = b;
+                __sync_synchronize(); // Bottom should be updated before the top is read
+                ssize_t t       = nTop;
+
+                // Check that deque is empty
+                if (t > b)
+                {
+                    nBottom         = b + 1;
+                    return NULL;
+                }
+
+                void *item      = a->vItems[b & a->nMask];
+                if (t == b)
+                {
+                    // This is the last item, we need to race with thieves for it
+                    if (!atomic_cas(&nTop, t, t + 1))
+                        item            = NULL;
+                    nBottom         = b + 1;
+                }
+
+                return item;
+            }
+
+            inline steal_t steal_item(void **ptr)
+            {
+                ssize_t t       = nTop;
+                __sync_synchronize(); // Top should be read before the bottom
+                ssize_t b       = nBottom;
+                if (t >= b)
+                    return STEAL_EMPTY;
+
+                array_t *a      = pArray;
+                void *item      = a->vItems[t & a->nMask];
+                if (!atomic_cas(&nTop, t, t + 1))
+                    return STEAL_ABORT;
+
+                *ptr            = item;
+                return STEAL_OK;
+            }
+
+        public:
+            explicit inline basic_deque()
+            {
+                nTop        = 0;
+                nBottom     = 0;
+                pArray      = NULL;
+                pRetired    = NULL;
+            }
+
+            inline ~basic_deque()
+            {
+                flush();
+            }
+
+            /**
+             * Get estimated number of items in the deque
+             * @return estimated number of items
+             */
+            inline size_t size() const
+            {
+                ssize_t n   = nBottom - nTop;
+                return (n > 0) ? n : 0;
+            }
+
+            void flush()
+            {
+                if (pArray != NULL)
+                {
+                    ::free(pArray);
+                    pArray      = NULL;
+                }
+
+                while (pRetired != NULL)
+                {
+                    array_t *next   = pRetired->pNext;
+                    ::free(pRetired);
+                    pRetired        = next;
+                }
+
+                nTop        = 0;
+                nBottom     = 0;
+            }
+    };
+
+    // Generalize pointers with templates
+    template <class T>
+        class cdeque: public basic_deque
+        {
+            private:
+                cdeque(const cdeque<T> &src);                           // Disable copying
+                cdeque<T> & operator = (const cdeque<T> & src);         // Disable copying
+
+            public:
+                explicit cdeque() {}
+
+            public:
+                inline bool push(T *item)   { return basic_deque::push_item(item); }
+                inline T *pop()             { return reinterpret_cast<T *>(basic_deque::pop_item()); }
+                inline steal_t steal(T **item)
+                {
+                    void *ptr       = NULL;
+                    steal_t res     = basic_deque::steal_item(&ptr);
+                    if (res == STEAL_OK)
+                        *item           = reinterpret_cast<T *>(ptr);
+                    return res;
+                }
+        };
+}
+
+#endif /* DATA_CDEQUE_H_ */
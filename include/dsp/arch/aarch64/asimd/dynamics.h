@@ -0,0 +1,99 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_AARCH64_ASIMD_DYNAMICS_H_
+#define DSP_ARCH_AARCH64_ASIMD_DYNAMICS_H_
+
+#ifndef DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace asimd
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_AARCH64_ASM(
+            __ASM_EMIT("ldp         q0, q1, [%[e], #0x00]")             // v0 = e, v1 = a
+            __ASM_EMIT("ldp         q2, q3, [%[e], #0x20]")             // v2 = r, v3 = t
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldr         q4, [%[src], #0x00]")               // v4 = s
+            __ASM_EMIT("fcmgt       v5.4s, v0.4s, v3.4s")               // v5 = [e > t]
+            __ASM_EMIT("fcmge       v6.4s, v0.4s, v4.4s")               // v6 = [s <= e]
+            __ASM_EMIT("fsub        v7.4s, v4.4s, v0.4s")               // v7 = s - e
+            __ASM_EMIT("and         v5.16b, v5.16b, v6.16b")            // v5 = M = [e > t] & [s <= e]
+            __ASM_EMIT("bsl         v5.16b, v2.16b, v1.16b")            // v5 = tau = (r & M) | (a & ~M)
+            __ASM_EMIT("fmul        v7.4s, v7.4s, v5.4s")               // v7 = tau * (s - e)
+            __ASM_EMIT("fadd        v0.4s, v0.4s, v7.4s")               // v0 = e' = e + tau * (s - e)
+            __ASM_EMIT("str         q0, [%[dst], #0x00]")
+            __ASM_EMIT("subs        %[count], %[count], #1")
+            __ASM_EMIT("add         %[src], %[src], #0x10")
+            __ASM_EMIT("add         %[dst], %[dst], #0x10")
+            __ASM_EMIT("b.ne        1b")
+
+            __ASM_EMIT("str         q0, [%[e], #0x00]")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] "+r" (count)
+            : [e] "r" (e)
+            : "cc", "memory",
+              "v0", "v1", "v2", "v3",
+              "v4", "v5", "v6", "v7"
+        );
+    }
+
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_AARCH64_ASM(
+            __ASM_EMIT("ldp         q0, q1, [%[e], #0x00]")             // v0 = e0, v1 = e1
+            __ASM_EMIT("ldp         q2, q3, [%[e], #0x20]")             // v2 = a0, v3 = a1
+            __ASM_EMIT("ldp         q4, q5, [%[e], #0x40]")             // v4 = r0, v5 = r1
+            __ASM_EMIT("ldp         q6, q7, [%[e], #0x60]")             // v6 = t0, v7 = t1
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldp         q16, q17, [%[src], #0x00]")         // v16 = s0, v17 = s1
+            __ASM_EMIT("fcmgt       v18.4s, v0.4s, v6.4s")              // v18 = [e0 > t0]
+            __ASM_EMIT("fcmgt       v19.4s, v1.4s, v7.4s")              // v19 = [e1 > t1]
+            __ASM_EMIT("fcmge       v20.4s, v0.4s, v16.4s")             // v20 = [s0 <= e0]
+            __ASM_EMIT("fcmge       v21.4s, v1.4s, v17.4s")             // v21 = [s1 <= e1]
+            __ASM_EMIT("fsub        v22.4s, v16.4s, v0.4s")             // v22 = s0 - e0
+            __ASM_EMIT("fsub        v23.4s, v17.4s, v1.4s")             // v23 = s1 - e1
+            __ASM_EMIT("and         v18.16b, v18.16b, v20.16b")         // v18 = M0 = [e0 > t0] & [s0 <= e0]
+            __ASM_EMIT("and         v19.16b, v19.16b, v21.16b")         // v19 = M1 = [e1 > t1] & [s1 <= e1]
+            __ASM_EMIT("bsl         v18.16b, v4.16b, v2.16b")           // v18 = tau0 = (r0 & M0) | (a0 & ~M0)
+            __ASM_EMIT("bsl         v19.16b, v5.16b, v3.16b")           // v19 = tau1 = (r1 & M1) | (a1 & ~M1)
+            __ASM_EMIT("fmul        v22.4s, v22.4s, v18.4s")            // v22 = tau0 * (s0 - e0)
+            __ASM_EMIT("fmul        v23.4s, v23.4s, v19.4s")            // v23 = tau1 * (s1 - e1)
+            __ASM_EMIT("fadd        v0.4s, v0.4s, v22.4s")              // v0 = e0' = e0 + tau0 * (s0 - e0)
+            __ASM_EMIT("fadd        v1.4s, v1.4s, v23.4s")              // v1 = e1' = e1 + tau1 * (s1 - e1)
+            __ASM_EMIT("stp         q0, q1, [%[dst], #0x00]")
+            __ASM_EMIT("subs        %[count], %[count], #1")
+            __ASM_EMIT("add         %[src], %[src], #0x20")
+            __ASM_EMIT("add         %[dst], %[dst], #0x20")
+            __ASM_EMIT("b.ne        1b")
+
+            __ASM_EMIT("stp         q0, q1, [%[e], #0x00]")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] "+r" (count)
+            : [e] "r" (e)
+            : "cc", "memory",
+              "v0", "v1", "v2", "v3",
+              "v4", "v5", "v6", "v7",
+              "v16", "v17", "v18", "v19",
+              "v20", "v21", "v22", "v23"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_AARCH64_ASIMD_DYNAMICS_H_ */
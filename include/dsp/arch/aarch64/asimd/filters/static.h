@@ -416,6 +416,171 @@ namespace asimd
               "q28", "q29"
         );
     }
+
+    // Compute one step of 4 lanes of filters:
+    //   input:  v0 = s, v16 = d0, v17 = d1, v18-v22 = b0, b1, b2, a1, a2
+    //   output: v0 = s2, v2 = d0', v3 = d1'
+    #define BIQUAD_I4_STEP \
+        __ASM_EMIT("fmul        v1.4s, v18.4s, v0.4s")                  /* v1   = b0*s */ \
+        __ASM_EMIT("fmul        v2.4s, v19.4s, v0.4s")                  /* v2   = b1*s */ \
+        __ASM_EMIT("fmul        v3.4s, v20.4s, v0.4s")                  /* v3   = b2*s */ \
+        __ASM_EMIT("fadd        v0.4s, v1.4s, v16.4s")                  /* v0   = s2 = b0*s + d0 */ \
+        __ASM_EMIT("fmla        v2.4s, v21.4s, v0.4s")                  /* v2   = b1*s + a1*s2 */ \
+        __ASM_EMIT("fmla        v3.4s, v22.4s, v0.4s")                  /* v3   = d1' = b2*s + a2*s2 */ \
+        __ASM_EMIT("fadd        v2.4s, v2.4s, v17.4s")                  /* v2   = d0' = d1 + b1*s + a1*s2 */
+
+    void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        IF_ARCH_AARCH64(biquad_x4_t *fx4 = &f->x4);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("cbz         %[count], 4f")
+            // Prepare
+            __ASM_EMIT("ldp         q16, q17, [%[FD]]")                     // q16  = d0, q17 = d1
+            __ASM_EMIT("ldp         q18, q19, [%[FX4], #0x00]")             // q18  = b0, q19 = b1
+            __ASM_EMIT("ldp         q20, q21, [%[FX4], #0x20]")             // q20  = b2, q21 = a1
+            __ASM_EMIT("ldr         q22, [%[FX4], #0x40]")                  // q22  = a2
+
+            // First filter only
+            __ASM_EMIT("eor         v0.16b, v0.16b, v0.16b")                // v0   = 0 0 0 0
+            __ASM_EMIT("ld1         {v0.d}[0], [%[src]]")                   // v0   = s0 s1 0 0
+            BIQUAD_I4_STEP
+            __ASM_EMIT("mov         v16.d[0], v2.d[0]")                     // v16  = d0'[0] d0'[1] d0[2] d0[3]
+            __ASM_EMIT("mov         v17.d[0], v3.d[0]")                     // v17  = d1'[0] d1'[1] d1[2] d1[3]
+            __ASM_EMIT("add         %[src], %[src], #0x08")
+            __ASM_EMIT("subs        %[count], %[count], #1")
+            __ASM_EMIT("b.eq        2f")
+
+            // Both filters, the second filter processes the output of the first filter
+            __ASM_EMIT("1:")
+            __ASM_EMIT("mov         v0.d[1], v0.d[0]")                      // v0   = ? ? s2[0] s2[1]
+            __ASM_EMIT("ld1         {v0.d}[0], [%[src]]")                   // v0   = s0 s1 s2[0] s2[1]
+            BIQUAD_I4_STEP
+            __ASM_EMIT("mov         v16.16b, v2.16b")                       // v16  = d0'
+            __ASM_EMIT("mov         v17.16b, v3.16b")                       // v17  = d1'
+            __ASM_EMIT("st1         {v0.d}[1], [%[dst]]")                   // *dst = s2[2] s2[3]
+            __ASM_EMIT("add         %[src], %[src], #0x08")
+            __ASM_EMIT("add         %[dst], %[dst], #0x08")
+            __ASM_EMIT("subs        %[count], %[count], #1")
+            __ASM_EMIT("b.ne        1b")
+
+            // Second filter only
+            __ASM_EMIT("2:")
+            __ASM_EMIT("mov         v0.d[1], v0.d[0]")                      // v0   = ? ? s2[0] s2[1]
+            BIQUAD_I4_STEP
+            __ASM_EMIT("mov         v16.d[1], v2.d[1]")                     // v16  = d0[0] d0[1] d0'[2] d0'[3]
+            __ASM_EMIT("mov         v17.d[1], v3.d[1]")                     // v17  = d1[0] d1[1] d1'[2] d1'[3]
+            __ASM_EMIT("st1         {v0.d}[1], [%[dst]]")                   // *dst = s2[2] s2[3]
+
+            // Store memory
+            __ASM_EMIT("stp         q16, q17, [%[FD]]")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [FD] "r" (&f->d[0]), [FX4] "r" (fx4)
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q16", "q17", "q18", "q19",
+              "q20", "q21", "q22"
+        );
+    }
+
+    void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        IF_ARCH_AARCH64(biquad_x4_t *fx4 = &f->x4);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("cbz         %[count], 2f")
+            // Prepare
+            __ASM_EMIT("ldp         q16, q17, [%[FD]]")                     // q16  = d0, q17 = d1
+            __ASM_EMIT("ldp         q18, q19, [%[FX4], #0x00]")             // q18  = b0, q19 = b1
+            __ASM_EMIT("ldp         q20, q21, [%[FX4], #0x20]")             // q20  = b2, q21 = a1
+            __ASM_EMIT("ldr         q22, [%[FX4], #0x40]")                  // q22  = a2
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldr         q0, [%[src]]")                          // v0   = s
+            BIQUAD_I4_STEP
+            __ASM_EMIT("mov         v16.16b, v2.16b")                       // v16  = d0'
+            __ASM_EMIT("mov         v17.16b, v3.16b")                       // v17  = d1'
+            __ASM_EMIT("str         q0, [%[dst]]")                          // *dst = s2
+            __ASM_EMIT("add         %[src], %[src], #0x10")
+            __ASM_EMIT("add         %[dst], %[dst], #0x10")
+            __ASM_EMIT("subs        %[count], %[count], #1")
+            __ASM_EMIT("b.ne        1b")
+
+            // Store memory
+            __ASM_EMIT("stp         q16, q17, [%[FD]]")
+            __ASM_EMIT("2:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [FD] "r" (&f->d[0]), [FX4] "r" (fx4)
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q16", "q17", "q18", "q19",
+              "q20", "q21", "q22"
+        );
+    }
+
+    #undef BIQUAD_I4_STEP
+
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        IF_ARCH_AARCH64(biquad_x8_t *fx8 = &f->x8);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("cbz         %[count], 2f")
+            // Prepare
+            __ASM_EMIT("ldp         q16, q17, [%[FD], #0x00]")              // q16  = d0[0..3], q17 = d0[4..7]
+            __ASM_EMIT("ldp         q18, q19, [%[FD], #0x20]")              // q18  = d1[0..3], q19 = d1[4..7]
+            __ASM_EMIT("ldp         q20, q21, [%[FX8], #0x00]")             // q20-q21 = b0
+            __ASM_EMIT("ldp         q22, q23, [%[FX8], #0x20]")             // q22-q23 = b1
+            __ASM_EMIT("ldp         q24, q25, [%[FX8], #0x40]")             // q24-q25 = b2
+            __ASM_EMIT("ldp         q26, q27, [%[FX8], #0x60]")             // q26-q27 = a1
+            __ASM_EMIT("ldp         q28, q29, [%[FX8], #0x80]")             // q28-q29 = a2
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldp         q0, q1, [%[src]]")                      // v0-v1 = s
+            __ASM_EMIT("fmul        v2.4s, v20.4s, v0.4s")                  // v2   = b0*s
+            __ASM_EMIT("fmul        v3.4s, v21.4s, v1.4s")
+            __ASM_EMIT("fmul        v4.4s, v22.4s, v0.4s")                  // v4   = b1*s
+            __ASM_EMIT("fmul        v5.4s, v23.4s, v1.4s")
+            __ASM_EMIT("fmul        v6.4s, v24.4s, v0.4s")                  // v6   = b2*s
+            __ASM_EMIT("fmul        v7.4s, v25.4s, v1.4s")
+            __ASM_EMIT("fadd        v0.4s, v2.4s, v16.4s")                  // v0   = s2 = b0*s + d0
+            __ASM_EMIT("fadd        v1.4s, v3.4s, v17.4s")
+            __ASM_EMIT("fmla        v4.4s, v26.4s, v0.4s")                  // v4   = b1*s + a1*s2
+            __ASM_EMIT("fmla        v5.4s, v27.4s, v1.4s")
+            __ASM_EMIT("fmla        v6.4s, v28.4s, v0.4s")                  // v6   = d1' = b2*s + a2*s2
+            __ASM_EMIT("fmla        v7.4s, v29.4s, v1.4s")
+            __ASM_EMIT("fadd        v16.4s, v4.4s, v18.4s")                 // v16  = d0' = d1 + b1*s + a1*s2
+            __ASM_EMIT("fadd        v17.4s, v5.4s, v19.4s")
+            __ASM_EMIT("mov         v18.16b, v6.16b")                       // v18  = d1'
+            __ASM_EMIT("mov         v19.16b, v7.16b")
+            __ASM_EMIT("stp         q0, q1, [%[dst]]")                      // *dst = s2
+            __ASM_EMIT("add         %[src], %[src], #0x20")
+            __ASM_EMIT("add         %[dst], %[dst], #0x20")
+            __ASM_EMIT("subs        %[count], %[count], #1")
+            __ASM_EMIT("b.ne        1b")
+
+            // Store memory
+            __ASM_EMIT("stp         q16, q17, [%[FD], #0x00]")
+            __ASM_EMIT("stp         q18, q19, [%[FD], #0x20]")
+            __ASM_EMIT("2:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [FD] "r" (&f->d[0]), [FX8] "r" (fx8)
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q4", "q5", "q6", "q7",
+              "q16", "q17", "q18", "q19",
+              "q20", "q21", "q22", "q23",
+              "q24", "q25", "q26", "q27",
+              "q28", "q29"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_AARCH64_ASIMD_FILTERS_STATIC_H_ */
@@ -0,0 +1,490 @@
+/*
+ * pcm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_AARCH64_ASIMD_PCM_H_
+#define DSP_ARCH_AARCH64_ASIMD_PCM_H_
+
+#ifndef DSP_ARCH_AARCH64_ASIMD_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_AARCH64_ASIMD_IMPL */
+
+namespace asimd
+{
+    #define U4VEC(x)        x, x, x, x
+    IF_ARCH_AARCH64(
+        static const float PCM_XC[] __lsp_aligned16 =
+        {
+            U4VEC(32767.0f),                // 0x00: 16-bit sample range
+            U4VEC(8388607.0f)               // 0x10: 24-bit sample range
+        };
+
+        static const double PCM_XD[] __lsp_aligned16 =
+        {
+            2147483647.0, 2147483647.0      // 0x00: 32-bit sample range
+        };
+
+        // Tables for tbl: 24 packed bytes <-> 8 samples of 32 bits, 0xff gives zero byte
+        static const uint8_t PCM_S24LE_UNPACK[] __lsp_aligned16 =
+        {
+            0xff, 0, 1, 2, 0xff, 3, 4, 5, 0xff, 6, 7, 8, 0xff, 9, 10, 11,
+            0xff, 12, 13, 14, 0xff, 15, 16, 17, 0xff, 18, 19, 20, 0xff, 21, 22, 23
+        };
+
+        static const uint8_t PCM_S24BE_UNPACK[] __lsp_aligned16 =
+        {
+            0xff, 2, 1, 0, 0xff, 5, 4, 3, 0xff, 8, 7, 6, 0xff, 11, 10, 9,
+            0xff, 14, 13, 12, 0xff, 17, 16, 15, 0xff, 20, 19, 18, 0xff, 23, 22, 21
+        };
+
+        static const uint8_t PCM_S24LE_PACK[] __lsp_aligned16 =
+        {
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 16, 17, 18, 20,
+            21, 22, 24, 25, 26, 28, 29, 30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+        };
+
+        static const uint8_t PCM_S24BE_PACK[] __lsp_aligned16 =
+        {
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 18, 17, 16, 22,
+            21, 20, 26, 25, 24, 30, 29, 28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+        };
+    )
+    #undef U4VEC
+
+    void pcm_s16_to_f32(float *dst, const int16_t *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("ldr             q30, [%[XC], #0x00]")       // v30 = 32767
+            __ASM_EMIT("subs            %[count], %[count], #8")
+            __ASM_EMIT("b.lo            2f")
+            // 8x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldr             q0, [%[src]]")
+            __ASM_EMIT("sxtl            v1.4s, v0.4h")
+            __ASM_EMIT("sxtl2           v2.4s, v0.8h")
+            __ASM_EMIT("scvtf           v1.4s, v1.4s")
+            __ASM_EMIT("scvtf           v2.4s, v2.4s")
+            __ASM_EMIT("fdiv            v1.4s, v1.4s, v30.4s")
+            __ASM_EMIT("fdiv            v2.4s, v2.4s, v30.4s")
+            __ASM_EMIT("subs            %[count], %[count], #8")
+            __ASM_EMIT("stp             q1, q2, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x10")
+            __ASM_EMIT("add             %[dst], %[dst], #0x20")
+            __ASM_EMIT("b.hs            1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #7")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("ldrsh           %w[tmp], [%[src]]")
+            __ASM_EMIT("scvtf           s0, %w[tmp]")
+            __ASM_EMIT("fdiv            s0, s0, s30")
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("str             s0, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x02")
+            __ASM_EMIT("add             %[dst], %[dst], #0x04")
+            __ASM_EMIT("b.ge            3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "r" (&PCM_XC[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q30"
+        );
+    }
+
+    /*
+     * Three bytes of each sample are moved to the upper bytes of 32-bit word by tbl
+     * and sign-extended with the arithmetic shift
+     */
+    #define PCM_S24_DECODE_BODY(X1_LOAD) \
+        __ASM_EMIT("ldr             q31, [%[XC], #0x10]")       /* v31 = 8388607 */ \
+        __ASM_EMIT("ldp             q24, q25, [%[UNPACK]]")     /* v24, v25 = unpacking table */ \
+        __ASM_EMIT("subs            %[count], %[count], #8") \
+        __ASM_EMIT("b.lo            2f") \
+        /* 8x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("ldr             q0, [%[src], #0x00]") \
+        __ASM_EMIT("ldr             d1, [%[src], #0x10]")       /* v0, v1 = 24 bytes of samples */ \
+        __ASM_EMIT("tbl             v2.16b, {v0.16b, v1.16b}, v24.16b") \
+        __ASM_EMIT("tbl             v3.16b, {v0.16b, v1.16b}, v25.16b") \
+        __ASM_EMIT("sshr            v2.4s, v2.4s, #8") \
+        __ASM_EMIT("sshr            v3.4s, v3.4s, #8") \
+        __ASM_EMIT("scvtf           v2.4s, v2.4s") \
+        __ASM_EMIT("scvtf           v3.4s, v3.4s") \
+        __ASM_EMIT("fdiv            v2.4s, v2.4s, v31.4s") \
+        __ASM_EMIT("fdiv            v3.4s, v3.4s, v31.4s") \
+        __ASM_EMIT("subs            %[count], %[count], #8") \
+        __ASM_EMIT("stp             q2, q3, [%[dst]]") \
+        __ASM_EMIT("add             %[src], %[src], #0x18") \
+        __ASM_EMIT("add             %[dst], %[dst], #0x20") \
+        __ASM_EMIT("b.hs            1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("adds            %[count], %[count], #7") \
+        __ASM_EMIT("b.lt            4f") \
+        __ASM_EMIT("3:") \
+        X1_LOAD                                                 /* tmp = b0 | (b1 << 8) | (b2 << 16) */ \
+        __ASM_EMIT("sbfx            %w[tmp], %w[tmp], #0, #24") \
+        __ASM_EMIT("scvtf           s0, %w[tmp]") \
+        __ASM_EMIT("fdiv            s0, s0, s31") \
+        __ASM_EMIT("subs            %[count], %[count], #1") \
+        __ASM_EMIT("str             s0, [%[dst]]") \
+        __ASM_EMIT("add             %[src], %[src], #0x03") \
+        __ASM_EMIT("add             %[dst], %[dst], #0x04") \
+        __ASM_EMIT("b.ge            3b") \
+        __ASM_EMIT("4:")
+
+    void pcm_s24le_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp, tmp2);
+
+        ARCH_AARCH64_ASM
+        (
+            PCM_S24_DECODE_BODY(
+                __ASM_EMIT("ldrh            %w[tmp], [%[src], #0]")
+                __ASM_EMIT("ldrb            %w[tmp2], [%[src], #2]")
+                __ASM_EMIT("orr             %w[tmp], %w[tmp], %w[tmp2], lsl #16")
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp), [tmp2] "=&r" (tmp2)
+            : [XC] "r" (&PCM_XC[0]), [UNPACK] "r" (&PCM_S24LE_UNPACK[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q24", "q25", "q31"
+        );
+    }
+
+    void pcm_s24be_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp, tmp2);
+
+        ARCH_AARCH64_ASM
+        (
+            PCM_S24_DECODE_BODY(
+                __ASM_EMIT("ldrh            %w[tmp2], [%[src], #0]")
+                __ASM_EMIT("ldrb            %w[tmp], [%[src], #2]")
+                __ASM_EMIT("rev16           %w[tmp2], %w[tmp2]")
+                __ASM_EMIT("orr             %w[tmp], %w[tmp], %w[tmp2], lsl #8")
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp), [tmp2] "=&r" (tmp2)
+            : [XC] "r" (&PCM_XC[0]), [UNPACK] "r" (&PCM_S24BE_UNPACK[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q24", "q25", "q31"
+        );
+    }
+
+    #undef PCM_S24_DECODE_BODY
+
+    void pcm_s32_to_f32(float *dst, const int32_t *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("ldr             q29, [%[XD], #0x00]")       // v29 = 2147483647
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("b.lo            2f")
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldr             q0, [%[src]]")
+            __ASM_EMIT("sxtl            v1.2d, v0.2s")
+            __ASM_EMIT("sxtl2           v2.2d, v0.4s")
+            __ASM_EMIT("scvtf           v1.2d, v1.2d")              // v1  = double(s0 s1)
+            __ASM_EMIT("scvtf           v2.2d, v2.2d")              // v2  = double(s2 s3)
+            __ASM_EMIT("fdiv            v1.2d, v1.2d, v29.2d")
+            __ASM_EMIT("fdiv            v2.2d, v2.2d, v29.2d")
+            __ASM_EMIT("fcvtn           v0.2s, v1.2d")
+            __ASM_EMIT("fcvtn2          v0.4s, v2.2d")
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("str             q0, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x10")
+            __ASM_EMIT("add             %[dst], %[dst], #0x10")
+            __ASM_EMIT("b.hs            1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #3")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("ldr             %w[tmp], [%[src]]")
+            __ASM_EMIT("scvtf           d0, %w[tmp]")
+            __ASM_EMIT("fdiv            d0, d0, d29")
+            __ASM_EMIT("fcvt            s0, d0")
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("str             s0, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x04")
+            __ASM_EMIT("add             %[dst], %[dst], #0x04")
+            __ASM_EMIT("b.ge            3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XD] "r" (&PCM_XD[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q29"
+        );
+    }
+
+    void pcm_f64_to_f32(float *dst, const double *src, size_t count)
+    {
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("b.lo            2f")
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldp             q0, q1, [%[src]]")
+            __ASM_EMIT("fcvtn           v2.2s, v0.2d")
+            __ASM_EMIT("fcvtn2          v2.4s, v1.2d")
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("str             q2, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x20")
+            __ASM_EMIT("add             %[dst], %[dst], #0x10")
+            __ASM_EMIT("b.hs            1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #3")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("ldr             d0, [%[src]]")
+            __ASM_EMIT("fcvt            s0, d0")
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("str             s0, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x08")
+            __ASM_EMIT("add             %[dst], %[dst], #0x04")
+            __ASM_EMIT("b.ge            3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            :
+            : "cc", "memory",
+              "q0", "q1", "q2"
+        );
+    }
+
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("ldr             q30, [%[XC], #0x00]")       // v30 = 32767
+            __ASM_EMIT("subs            %[count], %[count], #8")
+            __ASM_EMIT("b.lo            2f")
+            // 8x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldp             q0, q1, [%[src]]")
+            __ASM_EMIT("fmul            v0.4s, v0.4s, v30.4s")
+            __ASM_EMIT("fmul            v1.4s, v1.4s, v30.4s")
+            __ASM_EMIT("fcvtzs          v0.4s, v0.4s")
+            __ASM_EMIT("fcvtzs          v1.4s, v1.4s")
+            __ASM_EMIT("xtn             v2.4h, v0.4s")
+            __ASM_EMIT("xtn2            v2.8h, v1.4s")
+            __ASM_EMIT("subs            %[count], %[count], #8")
+            __ASM_EMIT("str             q2, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x20")
+            __ASM_EMIT("add             %[dst], %[dst], #0x10")
+            __ASM_EMIT("b.hs            1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #7")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("ldr             s0, [%[src]]")
+            __ASM_EMIT("fmul            s0, s0, s30")
+            __ASM_EMIT("fcvtzs          %w[tmp], s0")
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("strh            %w[tmp], [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x04")
+            __ASM_EMIT("add             %[dst], %[dst], #0x02")
+            __ASM_EMIT("b.ge            3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "r" (&PCM_XC[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q30"
+        );
+    }
+
+    /*
+     * Samples are converted to 32-bit integers and the three lower bytes of each
+     * are gathered by tbl in the order given by the packing table
+     */
+    #define PCM_S24_ENCODE_BODY(X1_STORE) \
+        __ASM_EMIT("ldr             q31, [%[XC], #0x10]")       /* v31 = 8388607 */ \
+        __ASM_EMIT("ldp             q24, q25, [%[PACK]]")       /* v24, v25 = packing table */ \
+        __ASM_EMIT("subs            %[count], %[count], #8") \
+        __ASM_EMIT("b.lo            2f") \
+        /* 8x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("ldp             q0, q1, [%[src]]") \
+        __ASM_EMIT("fmul            v0.4s, v0.4s, v31.4s") \
+        __ASM_EMIT("fmul            v1.4s, v1.4s, v31.4s") \
+        __ASM_EMIT("fcvtzs          v0.4s, v0.4s") \
+        __ASM_EMIT("fcvtzs          v1.4s, v1.4s") \
+        __ASM_EMIT("tbl             v2.16b, {v0.16b, v1.16b}, v24.16b") \
+        __ASM_EMIT("tbl             v3.16b, {v0.16b, v1.16b}, v25.16b") \
+        __ASM_EMIT("subs            %[count], %[count], #8") \
+        __ASM_EMIT("str             q2, [%[dst], #0x00]") \
+        __ASM_EMIT("str             d3, [%[dst], #0x10]") \
+        __ASM_EMIT("add             %[src], %[src], #0x20") \
+        __ASM_EMIT("add             %[dst], %[dst], #0x18") \
+        __ASM_EMIT("b.hs            1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("adds            %[count], %[count], #7") \
+        __ASM_EMIT("b.lt            4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("ldr             s0, [%[src]]") \
+        __ASM_EMIT("fmul            s0, s0, s31") \
+        __ASM_EMIT("fcvtzs          %w[tmp], s0") \
+        X1_STORE \
+        __ASM_EMIT("subs            %[count], %[count], #1") \
+        __ASM_EMIT("add             %[src], %[src], #0x04") \
+        __ASM_EMIT("add             %[dst], %[dst], #0x03") \
+        __ASM_EMIT("b.ge            3b") \
+        __ASM_EMIT("4:")
+
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp);
+
+        ARCH_AARCH64_ASM
+        (
+            PCM_S24_ENCODE_BODY(
+                __ASM_EMIT("strh            %w[tmp], [%[dst], #0]")
+                __ASM_EMIT("lsr             %w[tmp], %w[tmp], #16")
+                __ASM_EMIT("strb            %w[tmp], [%[dst], #2]")
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "r" (&PCM_XC[0]), [PACK] "r" (&PCM_S24LE_PACK[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q24", "q25", "q31"
+        );
+    }
+
+    void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp);
+
+        ARCH_AARCH64_ASM
+        (
+            PCM_S24_ENCODE_BODY(
+                __ASM_EMIT("strb            %w[tmp], [%[dst], #2]")
+                __ASM_EMIT("lsr             %w[tmp], %w[tmp], #8")
+                __ASM_EMIT("strb            %w[tmp], [%[dst], #1]")
+                __ASM_EMIT("lsr             %w[tmp], %w[tmp], #8")
+                __ASM_EMIT("strb            %w[tmp], [%[dst], #0]")
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "r" (&PCM_XC[0]), [PACK] "r" (&PCM_S24BE_PACK[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q24", "q25", "q31"
+        );
+    }
+
+    #undef PCM_S24_ENCODE_BODY
+
+    void pcm_f32_to_s32(int32_t *dst, const float *src, size_t count)
+    {
+        IF_ARCH_AARCH64(size_t tmp);
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("ldr             q29, [%[XD], #0x00]")       // v29 = 2147483647
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("b.lo            2f")
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldr             q0, [%[src]]")
+            __ASM_EMIT("fcvtl           v1.2d, v0.2s")              // v1  = double(s0 s1)
+            __ASM_EMIT("fcvtl2          v2.2d, v0.4s")              // v2  = double(s2 s3)
+            __ASM_EMIT("fmul            v1.2d, v1.2d, v29.2d")
+            __ASM_EMIT("fmul            v2.2d, v2.2d, v29.2d")
+            __ASM_EMIT("fcvtzs          v1.2d, v1.2d")
+            __ASM_EMIT("fcvtzs          v2.2d, v2.2d")
+            __ASM_EMIT("xtn             v0.2s, v1.2d")
+            __ASM_EMIT("xtn2            v0.4s, v2.2d")
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("str             q0, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x10")
+            __ASM_EMIT("add             %[dst], %[dst], #0x10")
+            __ASM_EMIT("b.hs            1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #3")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("ldr             s0, [%[src]]")
+            __ASM_EMIT("fcvt            d0, s0")
+            __ASM_EMIT("fmul            d0, d0, d29")
+            __ASM_EMIT("fcvtzs          %w[tmp], d0")
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("str             %w[tmp], [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x04")
+            __ASM_EMIT("add             %[dst], %[dst], #0x04")
+            __ASM_EMIT("b.ge            3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XD] "r" (&PCM_XD[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q29"
+        );
+    }
+
+    void pcm_f32_to_f64(double *dst, const float *src, size_t count)
+    {
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("b.lo            2f")
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("ldr             q0, [%[src]]")
+            __ASM_EMIT("fcvtl           v1.2d, v0.2s")
+            __ASM_EMIT("fcvtl2          v2.2d, v0.4s")
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("stp             q1, q2, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x10")
+            __ASM_EMIT("add             %[dst], %[dst], #0x20")
+            __ASM_EMIT("b.hs            1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #3")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("ldr             s0, [%[src]]")
+            __ASM_EMIT("fcvt            d0, s0")
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("str             d0, [%[dst]]")
+            __ASM_EMIT("add             %[src], %[src], #0x04")
+            __ASM_EMIT("add             %[dst], %[dst], #0x08")
+            __ASM_EMIT("b.ge            3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            :
+            : "cc", "memory",
+              "q0", "q1", "q2"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_AARCH64_ASIMD_PCM_H_ */
@@ -1872,6 +1872,133 @@ namespace asimd
               "q20", "q21", "q22", "q23"
         );
     }
+
+    IF_ARCH_AARCH64(
+        static const float cubic_interpolate_const[] __lsp_aligned16 =
+        {
+            0.0f, 1.0f, 2.0f, 3.0f,         // initial indices
+            4.0f, 4.0f, 4.0f, 4.0f,         // index step for x4 blocks
+            1.0f, 1.0f, 1.0f, 1.0f,         // index step for x1 blocks
+            3.0f, 3.0f, 3.0f, 3.0f,
+            0.5f, 0.5f, 0.5f, 0.5f
+        };
+    )
+
+    /* Catmull-Rom spline over v4 = p, v5 = s0, v6 = s1, v7 = s2 at v0 = t, result in v17 */
+    #define CUBIC_SPLINE \
+        __ASM_EMIT("fsub            v16.4s, v5.4s, v6.4s")      /* v16 = d = s0 - s1 */ \
+        __ASM_EMIT("fadd            v17.4s, v4.4s, v6.4s")      /* v17 = p + s1 */ \
+        __ASM_EMIT("fmul            v16.4s, v16.4s, v27.4s")    /* v16 = 3*d */ \
+        __ASM_EMIT("fsub            v17.4s, v17.4s, v5.4s")     /* v17 = p + s1 - s0 */ \
+        __ASM_EMIT("fadd            v16.4s, v16.4s, v7.4s")     /* v16 = 3*d + s2 */ \
+        __ASM_EMIT("fsub            v17.4s, v17.4s, v5.4s")     /* v17 = p + s1 - 2*s0 */ \
+        __ASM_EMIT("fsub            v16.4s, v16.4s, v4.4s")     /* v16 = c = 3*d + s2 - p */ \
+        __ASM_EMIT("fsub            v6.4s, v6.4s, v4.4s")       /* v6  = a = s1 - p */ \
+        __ASM_EMIT("fsub            v17.4s, v17.4s, v16.4s")    /* v17 = b = p + s1 - 2*s0 - c */ \
+        __ASM_EMIT("fmla            v17.4s, v16.4s, v0.4s")     /* v17 = c*t + b */ \
+        __ASM_EMIT("fmul            v17.4s, v17.4s, v0.4s")     /* v17 = (c*t + b)*t */ \
+        __ASM_EMIT("fadd            v17.4s, v17.4s, v6.4s")     /* v17 = (c*t + b)*t + a */ \
+        __ASM_EMIT("fmul            v17.4s, v17.4s, v0.4s")     /* v17 = ((c*t + b)*t + a)*t */ \
+        __ASM_EMIT("fmul            v17.4s, v17.4s, v28.4s")    /* v17 = 0.5*((c*t + b)*t + a)*t */ \
+        __ASM_EMIT("fadd            v17.4s, v17.4s, v5.4s")     /* v17 = 0.5*((c*t + b)*t + a)*t + s0 */
+
+    /* Compute v0 = t = x - int(x), v1 = int(x) for x = pos + step*i */
+    #define CUBIC_POSITION \
+        __ASM_EMIT("fmul            v0.4s, v24.4s, v30.4s")     /* v0  = step*i */ \
+        __ASM_EMIT("fadd            v0.4s, v0.4s, v29.4s")      /* v0  = x = pos + step*i */ \
+        __ASM_EMIT("fcvtzs          v1.4s, v0.4s")              /* v1  = n = int(x) */ \
+        __ASM_EMIT("scvtf           v2.4s, v1.4s")              /* v2  = float(n) */ \
+        __ASM_EMIT("fsub            v0.4s, v0.4s, v2.4s")       /* v0  = t = x - n */
+
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count)
+    {
+        IF_ARCH_AARCH64(
+            const float *s      = &src[-1];
+            size_t a, b;
+        );
+
+        ARCH_AARCH64_ASM
+        (
+            __ASM_EMIT("ldp             q24, q25, [%[CC], #0x00]")  // v24 = i, v25 = 4
+            __ASM_EMIT("ldp             q26, q27, [%[CC], #0x20]")  // v26 = 1, v27 = 3
+            __ASM_EMIT("ldr             q28, [%[CC], #0x40]")       // v28 = 0.5
+            __ASM_EMIT("dup             v29.4s, %S[pos].s[0]")
+            __ASM_EMIT("dup             v30.4s, %S[step].s[0]")
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("b.lo            2f")
+
+            // x4 blocks
+            __ASM_EMIT("1:")
+            CUBIC_POSITION
+            // Load 4 taps for each of 4 samples
+            __ASM_EMIT("mov             %w[a], v1.s[0]")
+            __ASM_EMIT("mov             %w[b], v1.s[1]")
+            __ASM_EMIT("add             %[a], %[s], %w[a], uxtw #2")
+            __ASM_EMIT("add             %[b], %[s], %w[b], uxtw #2")
+            __ASM_EMIT("ldr             q4, [%[a]]")                // v4  = a0 a1 a2 a3
+            __ASM_EMIT("ldr             q5, [%[b]]")                // v5  = b0 b1 b2 b3
+            __ASM_EMIT("mov             %w[a], v1.s[2]")
+            __ASM_EMIT("mov             %w[b], v1.s[3]")
+            __ASM_EMIT("add             %[a], %[s], %w[a], uxtw #2")
+            __ASM_EMIT("add             %[b], %[s], %w[b], uxtw #2")
+            __ASM_EMIT("ldr             q6, [%[a]]")                // v6  = c0 c1 c2 c3
+            __ASM_EMIT("ldr             q7, [%[b]]")                // v7  = d0 d1 d2 d3
+            // Transpose
+            __ASM_EMIT("trn1            v16.4s, v4.4s, v5.4s")      // v16 = a0 b0 a2 b2
+            __ASM_EMIT("trn2            v17.4s, v4.4s, v5.4s")      // v17 = a1 b1 a3 b3
+            __ASM_EMIT("trn1            v18.4s, v6.4s, v7.4s")      // v18 = c0 d0 c2 d2
+            __ASM_EMIT("trn2            v19.4s, v6.4s, v7.4s")      // v19 = c1 d1 c3 d3
+            __ASM_EMIT("trn1            v4.2d, v16.2d, v18.2d")     // v4  = p  = a0 b0 c0 d0
+            __ASM_EMIT("trn1            v5.2d, v17.2d, v19.2d")     // v5  = s0 = a1 b1 c1 d1
+            __ASM_EMIT("trn2            v6.2d, v16.2d, v18.2d")     // v6  = s1 = a2 b2 c2 d2
+            __ASM_EMIT("trn2            v7.2d, v17.2d, v19.2d")     // v7  = s2 = a3 b3 c3 d3
+            // Compute spline
+            CUBIC_SPLINE
+            __ASM_EMIT("fadd            v24.4s, v24.4s, v25.4s")    // v24 = i + 4
+            __ASM_EMIT("subs            %[count], %[count], #4")
+            __ASM_EMIT("str             q17, [%[dst]]")
+            __ASM_EMIT("add             %[dst], %[dst], #0x10")
+            __ASM_EMIT("b.hs            1b")
+
+            // x1 blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], %[count], #3")
+            __ASM_EMIT("b.lt            4f")
+            __ASM_EMIT("3:")
+            CUBIC_POSITION
+            __ASM_EMIT("mov             %w[a], v1.s[0]")
+            __ASM_EMIT("add             %[a], %[s], %w[a], uxtw #2")
+            __ASM_EMIT("ldr             q3, [%[a]]")                // v3  = p s0 s1 s2
+            __ASM_EMIT("dup             v4.4s, v3.s[0]")            // v4  = p
+            __ASM_EMIT("dup             v5.4s, v3.s[1]")            // v5  = s0
+            __ASM_EMIT("dup             v6.4s, v3.s[2]")            // v6  = s1
+            __ASM_EMIT("dup             v7.4s, v3.s[3]")            // v7  = s2
+            CUBIC_SPLINE
+            __ASM_EMIT("fadd            v24.4s, v24.4s, v26.4s")    // v24 = i + 1
+            __ASM_EMIT("subs            %[count], %[count], #1")
+            __ASM_EMIT("st1             {v17.s}[0], [%[dst]]")
+            __ASM_EMIT("add             %[dst], %[dst], #0x04")
+            __ASM_EMIT("b.ge            3b")
+
+            // End
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [count] "+r" (count),
+              [a] "=&r" (a), [b] "=&r" (b),
+              [pos] "+w" (pos), [step] "+w" (step)
+            : [s] "r" (s),
+              [CC] "r" (&cubic_interpolate_const[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q4", "q5", "q6", "q7",
+              "q16", "q17", "q18", "q19",
+              "q24", "q25", "q26", "q27",
+              "q28", "q29", "q30"
+        );
+    }
+
+    #undef CUBIC_POSITION
+    #undef CUBIC_SPLINE
 }
 
 
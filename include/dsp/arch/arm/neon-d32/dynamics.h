@@ -0,0 +1,91 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_ARM_NEON_D32_DYNAMICS_H_
+#define DSP_ARCH_ARM_NEON_D32_DYNAMICS_H_
+
+#ifndef DSP_ARCH_ARM_NEON_32_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_ARM_NEON_32_IMPL */
+
+namespace neon_d32
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_ARM_ASM(
+            __ASM_EMIT("vldm        %[e], {q0-q3}")                     // q0 = e, q1 = a, q2 = r, q3 = t
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vld1.32     {q4}, [%[src]]!")                   // q4 = s
+            __ASM_EMIT("vcgt.f32    q5, q0, q3")                        // q5 = [e > t]
+            __ASM_EMIT("vcge.f32    q6, q0, q4")                        // q6 = [s <= e]
+            __ASM_EMIT("vsub.f32    q7, q4, q0")                        // q7 = s - e
+            __ASM_EMIT("vand        q5, q5, q6")                        // q5 = M = [e > t] & [s <= e]
+            __ASM_EMIT("vbsl        q5, q2, q1")                        // q5 = tau = (r & M) | (a & ~M)
+            __ASM_EMIT("vmul.f32    q7, q7, q5")                        // q7 = tau * (s - e)
+            __ASM_EMIT("vadd.f32    q0, q0, q7")                        // q0 = e' = e + tau * (s - e)
+            __ASM_EMIT("subs        %[count], $1")
+            __ASM_EMIT("vst1.32     {q0}, [%[dst]]!")
+            __ASM_EMIT("bne         1b")
+
+            __ASM_EMIT("vst1.32     {q0}, [%[e]]")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] "+r" (count)
+            : [e] "r" (e)
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q4", "q5", "q6", "q7"
+        );
+    }
+
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_ARM_ASM(
+            __ASM_EMIT("vldm        %[e], {q0-q7}")                     // q0-q1 = e, q2-q3 = a, q4-q5 = r, q6-q7 = t
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vld1.32     {q8-q9}, [%[src]]!")                // q8 = s0, q9 = s1
+            __ASM_EMIT("vcgt.f32    q10, q0, q6")                       // q10 = [e0 > t0]
+            __ASM_EMIT("vcgt.f32    q11, q1, q7")                       // q11 = [e1 > t1]
+            __ASM_EMIT("vcge.f32    q12, q0, q8")                       // q12 = [s0 <= e0]
+            __ASM_EMIT("vcge.f32    q13, q1, q9")                       // q13 = [s1 <= e1]
+            __ASM_EMIT("vsub.f32    q14, q8, q0")                       // q14 = s0 - e0
+            __ASM_EMIT("vsub.f32    q15, q9, q1")                       // q15 = s1 - e1
+            __ASM_EMIT("vand        q10, q10, q12")                     // q10 = M0 = [e0 > t0] & [s0 <= e0]
+            __ASM_EMIT("vand        q11, q11, q13")                     // q11 = M1 = [e1 > t1] & [s1 <= e1]
+            __ASM_EMIT("vbsl        q10, q4, q2")                       // q10 = tau0 = (r0 & M0) | (a0 & ~M0)
+            __ASM_EMIT("vbsl        q11, q5, q3")                       // q11 = tau1 = (r1 & M1) | (a1 & ~M1)
+            __ASM_EMIT("vmul.f32    q14, q14, q10")                     // q14 = tau0 * (s0 - e0)
+            __ASM_EMIT("vmul.f32    q15, q15, q11")                     // q15 = tau1 * (s1 - e1)
+            __ASM_EMIT("vadd.f32    q0, q0, q14")                       // q0 = e0' = e0 + tau0 * (s0 - e0)
+            __ASM_EMIT("vadd.f32    q1, q1, q15")                       // q1 = e1' = e1 + tau1 * (s1 - e1)
+            __ASM_EMIT("subs        %[count], $1")
+            __ASM_EMIT("vst1.32     {q0-q1}, [%[dst]]!")
+            __ASM_EMIT("bne         1b")
+
+            __ASM_EMIT("vst1.32     {q0-q1}, [%[e]]")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] "+r" (count)
+            : [e] "r" (e)
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q4", "q5", "q6", "q7",
+              "q8", "q9", "q10", "q11",
+              "q12", "q13", "q14", "q15"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_ARM_NEON_D32_DYNAMICS_H_ */
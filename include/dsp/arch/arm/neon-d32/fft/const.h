@@ -18,7 +18,7 @@
     {
         // Cosines
         printf("A_RE:\n");
-        for (int i=0; i<16; ++i)
+        for (int i=0; i<18; ++i)
         {
             int n = 4 << i;
             for (size_t k=0; (k<8); ++k)
@@ -28,7 +28,7 @@
 
         // Sines
         printf("\nA_IM:\n");
-        for (int i=0; i<16; ++i)
+        for (int i=0; i<18; ++i)
         {
             int n = 4 << i;
             for (size_t k=0; (k<8); ++k)
@@ -38,7 +38,7 @@
 
         // Both
         printf("\nA:\n");
-        for (int i=0; i<16; ++i)
+        for (int i=0; i<18; ++i)
         {
             int n = 4 << i;
             for (size_t k=0; (k<8); ++k)
@@ -50,15 +50,15 @@
         }
 
         printf("\nDW_RE:\n");
-        for (int i=0; i<16; ++i)
+        for (int i=0; i<18; ++i)
             printf("X4VEC(%.16f),\n", cos(M_PI / (4 << i)));
 
         printf("\nDW_IM:\n");
-        for (int i=0; i<16; ++i)
+        for (int i=0; i<18; ++i)
             printf("X4VEC(%.16f),\n", sin(M_PI / (4 << i)));
 
         printf("\nDW:\n");
-        for (int i=0; i<16; ++i)
+        for (int i=0; i<18; ++i)
             printf("X4VEC(%.16f), X4VEC(%.16f),\n", cos(M_PI / (1 << i)), sin(M_PI / (1 << i)));
 
 
@@ -102,7 +102,11 @@ namespace neon_d32
         1.0000000000000000, 0.9999999988510269, 0.9999999954041073, 0.9999999896592414, 0.9999999816164293, 0.9999999712756709, 0.9999999586369661, 0.9999999437003151,
         0.0000000000000000, 0.0000479368996031, 0.0000958737990960, 0.0001438106983686, 0.0001917475973107, 0.0002396844958122, 0.0002876213937629, 0.0003355582910527,
         1.0000000000000000, 0.9999999997127567, 0.9999999988510269, 0.9999999974148104, 0.9999999954041073, 0.9999999928189177, 0.9999999896592414, 0.9999999859250787,
-        0.0000000000000000, 0.0000239684498084, 0.0000479368996031, 0.0000719053493702, 0.0000958737990960, 0.0001198422487667, 0.0001438106983686, 0.0001677791478878
+        0.0000000000000000, 0.0000239684498084, 0.0000479368996031, 0.0000719053493702, 0.0000958737990960, 0.0001198422487667, 0.0001438106983686, 0.0001677791478878,
+        1.0000000000000000, 0.9999999999281892, 0.9999999997127567, 0.9999999993537025, 0.9999999988510269, 0.9999999982047294, 0.9999999974148104, 0.9999999964812697,
+        0.0000000000000000, 0.0000119842249051, 0.0000239684498084, 0.0000359526747083, 0.0000479368996031, 0.0000599211244909, 0.0000719053493702, 0.0000838895742391,
+        1.0000000000000000, 0.9999999999820472, 0.9999999999281892, 0.9999999998384257, 0.9999999997127567, 0.9999999995511824, 0.9999999993537025, 0.9999999991203175,
+        0.0000000000000000, 0.0000059921124526, 0.0000119842249051, 0.0000179763373571, 0.0000239684498084, 0.0000299605622589, 0.0000359526747083, 0.0000419447871564
     };
 
 #define X4VEC(v)        v, v, v, v
@@ -125,6 +129,8 @@ namespace neon_d32
         X4VEC(0.9999999264657179), X4VEC(0.0003834951875714),
         X4VEC(0.9999999816164293), X4VEC(0.0001917475973107),
         X4VEC(0.9999999954041073), X4VEC(0.0000958737990960),
+        X4VEC(0.9999999988510269), X4VEC(0.0000479368996031),
+        X4VEC(0.9999999997127567), X4VEC(0.0000239684498084),
     };
 
 #undef X4VEC
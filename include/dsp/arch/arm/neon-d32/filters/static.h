@@ -397,6 +397,160 @@ namespace neon_d32
               "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
         );
     }
+
+    // Compute one step of 4 lanes of filters:
+    //   input:  q0 = s, q8 = d0, q9 = d1, q3-q7 = b0, b1, b2, a1, a2
+    //   output: q0 = s2, q14 = d0', q15 = d1'
+    #define BIQUAD_I4_STEP \
+        __ASM_EMIT("vmul.f32    q13, q3, q0")                           /* q13   = b0*s */ \
+        __ASM_EMIT("vmul.f32    q14, q4, q0")                           /* q14   = b1*s */ \
+        __ASM_EMIT("vmul.f32    q15, q5, q0")                           /* q15   = b2*s */ \
+        __ASM_EMIT("vadd.f32    q0, q13, q8")                           /* q0    = s2 = b0*s + d0 */ \
+        __ASM_EMIT("vmla.f32    q14, q6, q0")                           /* q14   = b1*s + a1*s2 */ \
+        __ASM_EMIT("vmla.f32    q15, q7, q0")                           /* q15   = d1' = b2*s + a2*s2 */ \
+        __ASM_EMIT("vadd.f32    q14, q14, q9")                          /* q14   = d0' = d1 + b1*s + a1*s2 */
+
+    void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        IF_ARCH_ARM(biquad_x4_t *fx4 = &f->x4);
+
+        ARCH_ARM_ASM
+        (
+            __ASM_EMIT("tst         %[count], %[count]")
+            __ASM_EMIT("beq         4f")
+
+            // Prepare
+            __ASM_EMIT("vldm        %[FD], {q8-q9}")                        // q8-q9 = { d0, d1 }
+            __ASM_EMIT("vldm        %[FX4], {q3-q7}")                       // q3-q7 = { b0, b1, b2, a1, a2 }
+
+            // First filter only
+            __ASM_EMIT("veor        q0, q0")                                // q0    = 0 0 0 0
+            __ASM_EMIT("vldm        %[src]!, {d0}")                         // q0    = s0 s1 0 0
+            BIQUAD_I4_STEP
+            __ASM_EMIT("vmov        d16, d28")                              // q8    = d0'[0] d0'[1] d0[2] d0[3]
+            __ASM_EMIT("vmov        d18, d30")                              // q9    = d1'[0] d1'[1] d1[2] d1[3]
+            __ASM_EMIT("subs        %[count], $1")
+            __ASM_EMIT("beq         2f")
+
+            // Both filters, the second filter processes the output of the first filter
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmov        d1, d0")                                // q0    = ? ? s2[0] s2[1]
+            __ASM_EMIT("vldm        %[src]!, {d0}")                         // q0    = s0 s1 s2[0] s2[1]
+            BIQUAD_I4_STEP
+            __ASM_EMIT("vmov        q8, q14")                               // q8    = d0'
+            __ASM_EMIT("vmov        q9, q15")                               // q9    = d1'
+            __ASM_EMIT("vstm        %[dst]!, {d1}")                         // *dst  = s2[2] s2[3]
+            __ASM_EMIT("subs        %[count], $1")
+            __ASM_EMIT("bne         1b")
+
+            // Second filter only
+            __ASM_EMIT("2:")
+            __ASM_EMIT("vmov        d1, d0")                                // q0    = ? ? s2[0] s2[1]
+            BIQUAD_I4_STEP
+            __ASM_EMIT("vmov        d17, d29")                              // q8    = d0[0] d0[1] d0'[2] d0'[3]
+            __ASM_EMIT("vmov        d19, d31")                              // q9    = d1[0] d1[1] d1'[2] d1'[3]
+            __ASM_EMIT("vstm        %[dst], {d1}")                          // *dst  = s2[2] s2[3]
+
+            // Store memory
+            __ASM_EMIT("vstm        %[FD], {q8-q9}")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [FD] "r" (&f->d[0]), [FX4] "r" (fx4)
+            : "cc", "memory",
+              "q0", "q3", "q4", "q5", "q6", "q7",
+              "q8", "q9", "q13", "q14", "q15"
+        );
+    }
+
+    void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        IF_ARCH_ARM(biquad_x4_t *fx4 = &f->x4);
+
+        ARCH_ARM_ASM
+        (
+            __ASM_EMIT("tst         %[count], %[count]")
+            __ASM_EMIT("beq         2f")
+
+            // Prepare
+            __ASM_EMIT("vldm        %[FD], {q8-q9}")                        // q8-q9 = { d0, d1 }
+            __ASM_EMIT("vldm        %[FX4], {q3-q7}")                       // q3-q7 = { b0, b1, b2, a1, a2 }
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vldm        %[src]!, {q0}")                         // q0    = s
+            BIQUAD_I4_STEP
+            __ASM_EMIT("vmov        q8, q14")                               // q8    = d0'
+            __ASM_EMIT("vmov        q9, q15")                               // q9    = d1'
+            __ASM_EMIT("vstm        %[dst]!, {q0}")                         // *dst  = s2
+            __ASM_EMIT("subs        %[count], $1")
+            __ASM_EMIT("bne         1b")
+
+            // Store memory
+            __ASM_EMIT("vstm        %[FD], {q8-q9}")
+            __ASM_EMIT("2:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [FD] "r" (&f->d[0]), [FX4] "r" (fx4)
+            : "cc", "memory",
+              "q0", "q3", "q4", "q5", "q6", "q7",
+              "q8", "q9", "q13", "q14", "q15"
+        );
+    }
+
+    #undef BIQUAD_I4_STEP
+
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        IF_ARCH_ARM(
+            float *fx8a = f->x8.b0;
+            float *fx8b = f->x8.a1;
+        );
+
+        ARCH_ARM_ASM
+        (
+            __ASM_EMIT("tst         %[count], %[count]")
+            __ASM_EMIT("beq         2f")
+
+            // Prepare
+            __ASM_EMIT("vldm        %[FD], {q2-q5}")                        // q2-q3 = d0, q4-q5 = d1
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vldm        %[src]!, {q0-q1}")                      // q0-q1 = s
+            __ASM_EMIT("vldm        %[FX8A], {q6-q11}")                     // q6-q7 = b0, q8-q9 = b1, q10-q11 = b2
+            __ASM_EMIT("vldm        %[FX8B], {q12-q15}")                    // q12-q13 = a1, q14-q15 = a2
+
+            __ASM_EMIT("vmul.f32    q6, q6, q0")                            // q6    = b0*s
+            __ASM_EMIT("vmul.f32    q7, q7, q1")
+            __ASM_EMIT("vmul.f32    q8, q8, q0")                            // q8    = b1*s
+            __ASM_EMIT("vmul.f32    q9, q9, q1")
+            __ASM_EMIT("vadd.f32    q6, q6, q2")                            // q6    = b0*s + d0 = s2
+            __ASM_EMIT("vadd.f32    q7, q7, q3")
+            __ASM_EMIT("vmul.f32    q10, q10, q0")                          // q10   = b2*s
+            __ASM_EMIT("vmul.f32    q11, q11, q1")
+            __ASM_EMIT("vmla.f32    q8, q12, q6")                           // q8    = b1*s + a1*s2
+            __ASM_EMIT("vmla.f32    q9, q13, q7")
+            __ASM_EMIT("vmla.f32    q10, q14, q6")                          // q10   = b2*s + a2*s2 = d1'
+            __ASM_EMIT("vmla.f32    q11, q15, q7")
+            __ASM_EMIT("vadd.f32    q2, q8, q4")                            // q2    = b1*s + a1*s2 + d1 = d0'
+            __ASM_EMIT("vadd.f32    q3, q9, q5")
+            __ASM_EMIT("vmov        q4, q10")                               // q4    = d1'
+            __ASM_EMIT("vmov        q5, q11")
+            __ASM_EMIT("vstm        %[dst]!, {q6-q7}")                      // *dst  = s2
+
+            __ASM_EMIT("subs        %[count], $1")
+            __ASM_EMIT("bne         1b")
+
+            // Store memory
+            __ASM_EMIT("vstm        %[FD], {q2-q5}")
+            __ASM_EMIT("2:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [FD] "r" (&f->d[0]), [FX8A] "r" (fx8a), [FX8B] "r" (fx8b)
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3" , "q4", "q5", "q6", "q7",
+              "q8", "q9", "q10", "q11", "q12", "q13", "q14", "q15"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_ARM_NEON_D32_FILTERS_STATIC_H_ */
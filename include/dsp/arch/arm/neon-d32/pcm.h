@@ -0,0 +1,189 @@
+/*
+ * pcm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_ARM_NEON_D32_PCM_H_
+#define DSP_ARCH_ARM_NEON_D32_PCM_H_
+
+#ifndef DSP_ARCH_ARM_NEON_32_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_ARM_NEON_32_IMPL */
+
+/*
+ * ARMv7 NEON has neither IEEE division nor double-precision vectors, so only
+ * the encoders that need a multiplication and truncation can match the native
+ * code bit for bit. Decoders and 32-bit/double conversions stay native.
+ */
+namespace neon_d32
+{
+    IF_ARCH_ARM(
+        static const float PCM_XC[] __lsp_aligned16 =
+        {
+            32767.0f,                       // 16-bit sample range
+            8388607.0f                      // 24-bit sample range
+        };
+
+        static const uint8_t PCM_S24LE_PACK[] __lsp_aligned16 =
+        {
+            0, 1, 2, 4, 5, 6, 8, 9,
+            10, 12, 13, 14, 16, 17, 18, 20,
+            21, 22, 24, 25, 26, 28, 29, 30
+        };
+
+        static const uint8_t PCM_S24BE_PACK[] __lsp_aligned16 =
+        {
+            2, 1, 0, 6, 5, 4, 10, 9,
+            8, 14, 13, 12, 18, 17, 16, 22,
+            21, 20, 26, 25, 24, 30, 29, 28
+        };
+    )
+
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count)
+    {
+        ARCH_ARM_ASM
+        (
+            __ASM_EMIT("vld1.32         {d30[], d31[]}, [%[XC]]")   // q15 = 32767
+            __ASM_EMIT("subs            %[count], $8")
+            __ASM_EMIT("blo             2f")
+            // 8x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vld1.32         {q0-q1}, [%[src]]!")
+            __ASM_EMIT("vmul.f32        q0, q0, q15")
+            __ASM_EMIT("vmul.f32        q1, q1, q15")
+            __ASM_EMIT("vcvt.s32.f32    q0, q0")
+            __ASM_EMIT("vcvt.s32.f32    q1, q1")
+            __ASM_EMIT("vmovn.i32       d4, q0")
+            __ASM_EMIT("vmovn.i32       d5, q1")
+            __ASM_EMIT("subs            %[count], $8")
+            __ASM_EMIT("vst1.16         {q2}, [%[dst]]!")
+            __ASM_EMIT("bhs             1b")
+            // 4x block
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], $4")
+            __ASM_EMIT("blt             4f")
+            __ASM_EMIT("vld1.32         {q0}, [%[src]]!")
+            __ASM_EMIT("vmul.f32        q0, q0, q15")
+            __ASM_EMIT("vcvt.s32.f32    q0, q0")
+            __ASM_EMIT("vmovn.i32       d4, q0")
+            __ASM_EMIT("sub             %[count], $4")
+            __ASM_EMIT("vst1.16         {d4}, [%[dst]]!")
+            // 1x blocks
+            __ASM_EMIT("4:")
+            __ASM_EMIT("adds            %[count], $3")
+            __ASM_EMIT("blt             6f")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("vld1.32         {d0[0]}, [%[src]]!")
+            __ASM_EMIT("vmul.f32        d0, d0, d30")
+            __ASM_EMIT("vcvt.s32.f32    d0, d0")
+            __ASM_EMIT("subs            %[count], $1")
+            __ASM_EMIT("vst1.16         {d0[0]}, [%[dst]]!")
+            __ASM_EMIT("bge             5b")
+            __ASM_EMIT("6:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [XC] "r" (&PCM_XC[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q15"
+        );
+    }
+
+    /*
+     * Samples are converted to 32-bit integers and the three lower bytes of each
+     * are gathered with vtbl in the order given by the packing table
+     */
+    #define PCM_S24_ENCODE_BODY(X1_STORE) \
+        __ASM_EMIT("vld1.32         {d30[], d31[]}, [%[XC]]")   /* q15 = 8388607 */ \
+        __ASM_EMIT("vld1.8          {d24-d26}, [%[PACK]]")      /* d24-d26 = packing table */ \
+        __ASM_EMIT("subs            %[count], $8") \
+        __ASM_EMIT("blo             2f") \
+        /* 8x blocks */ \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("vld1.32         {q0-q1}, [%[src]]!") \
+        __ASM_EMIT("vmul.f32        q0, q0, q15") \
+        __ASM_EMIT("vmul.f32        q1, q1, q15") \
+        __ASM_EMIT("vcvt.s32.f32    q0, q0") \
+        __ASM_EMIT("vcvt.s32.f32    q1, q1") \
+        __ASM_EMIT("vtbl.8          d4, {d0-d3}, d24") \
+        __ASM_EMIT("vtbl.8          d5, {d0-d3}, d25") \
+        __ASM_EMIT("vtbl.8          d6, {d0-d3}, d26") \
+        __ASM_EMIT("subs            %[count], $8") \
+        __ASM_EMIT("vst1.8          {d4-d6}, [%[dst]]!") \
+        __ASM_EMIT("bhs             1b") \
+        /* 4x block */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("adds            %[count], $4") \
+        __ASM_EMIT("blt             4f") \
+        __ASM_EMIT("vld1.32         {q0}, [%[src]]!") \
+        __ASM_EMIT("vmul.f32        q0, q0, q15") \
+        __ASM_EMIT("vcvt.s32.f32    q0, q0") \
+        __ASM_EMIT("vtbl.8          d4, {d0-d1}, d24") \
+        __ASM_EMIT("vtbl.8          d5, {d0-d1}, d25")          /* only 4 lower bytes are valid */ \
+        __ASM_EMIT("sub             %[count], $4") \
+        __ASM_EMIT("vst1.8          {d4}, [%[dst]]!") \
+        __ASM_EMIT("vst1.32         {d5[0]}, [%[dst]]!") \
+        /* 1x blocks */ \
+        __ASM_EMIT("4:") \
+        __ASM_EMIT("adds            %[count], $3") \
+        __ASM_EMIT("blt             6f") \
+        __ASM_EMIT("5:") \
+        __ASM_EMIT("vld1.32         {d0[0]}, [%[src]]!") \
+        __ASM_EMIT("vmul.f32        d0, d0, d30") \
+        __ASM_EMIT("vcvt.s32.f32    d0, d0") \
+        __ASM_EMIT("vmov            %[tmp], s0") \
+        X1_STORE \
+        __ASM_EMIT("add             %[dst], $3") \
+        __ASM_EMIT("subs            %[count], $1") \
+        __ASM_EMIT("bge             5b") \
+        __ASM_EMIT("6:")
+
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count)
+    {
+        IF_ARCH_ARM(size_t tmp);
+
+        ARCH_ARM_ASM
+        (
+            PCM_S24_ENCODE_BODY(
+                __ASM_EMIT("strb            %[tmp], [%[dst], $0]")
+                __ASM_EMIT("lsr             %[tmp], $8")
+                __ASM_EMIT("strb            %[tmp], [%[dst], $1]")
+                __ASM_EMIT("lsr             %[tmp], $8")
+                __ASM_EMIT("strb            %[tmp], [%[dst], $2]")
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "r" (&PCM_XC[1]), [PACK] "r" (&PCM_S24LE_PACK[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q12", "q13", "q15"
+        );
+    }
+
+    void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count)
+    {
+        IF_ARCH_ARM(size_t tmp);
+
+        ARCH_ARM_ASM
+        (
+            PCM_S24_ENCODE_BODY(
+                __ASM_EMIT("strb            %[tmp], [%[dst], $2]")
+                __ASM_EMIT("lsr             %[tmp], $8")
+                __ASM_EMIT("strb            %[tmp], [%[dst], $1]")
+                __ASM_EMIT("lsr             %[tmp], $8")
+                __ASM_EMIT("strb            %[tmp], [%[dst], $0]")
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "r" (&PCM_XC[1]), [PACK] "r" (&PCM_S24BE_PACK[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q12", "q13", "q15"
+        );
+    }
+
+    #undef PCM_S24_ENCODE_BODY
+}
+
+#endif /* DSP_ARCH_ARM_NEON_D32_PCM_H_ */
@@ -1738,6 +1738,121 @@ namespace neon_d32
         );
     }
 
+    IF_ARCH_ARM(
+        static const float cubic_interpolate_const[] __lsp_aligned16 =
+        {
+            0.0f, 1.0f, 2.0f, 3.0f,         // initial indices
+            4.0f, 4.0f, 4.0f, 4.0f,         // index step for x4 blocks
+            1.0f, 1.0f, 1.0f, 1.0f,         // index step for x1 blocks
+            3.0f, 3.0f, 3.0f, 3.0f,
+            0.5f, 0.5f, 0.5f, 0.5f
+        };
+    )
+
+    /* Catmull-Rom spline over q4 = p, q5 = s0, q6 = s1, q7 = s2 at q0 = t, result in q2 */
+    #define CUBIC_SPLINE \
+        __ASM_EMIT("vsub.f32        q1, q5, q6")                /* q1 = d = s0 - s1 */ \
+        __ASM_EMIT("vadd.f32        q2, q4, q6")                /* q2 = p + s1 */ \
+        __ASM_EMIT("vmul.f32        q1, q1, q11")               /* q1 = 3*d */ \
+        __ASM_EMIT("vsub.f32        q2, q2, q5")                /* q2 = p + s1 - s0 */ \
+        __ASM_EMIT("vadd.f32        q1, q1, q7")                /* q1 = 3*d + s2 */ \
+        __ASM_EMIT("vsub.f32        q2, q2, q5")                /* q2 = p + s1 - 2*s0 */ \
+        __ASM_EMIT("vsub.f32        q1, q1, q4")                /* q1 = c = 3*d + s2 - p */ \
+        __ASM_EMIT("vsub.f32        q6, q6, q4")                /* q6 = a = s1 - p */ \
+        __ASM_EMIT("vsub.f32        q2, q2, q1")                /* q2 = b = p + s1 - 2*s0 - c */ \
+        __ASM_EMIT("vmla.f32        q2, q1, q0")                /* q2 = c*t + b */ \
+        __ASM_EMIT("vmul.f32        q2, q2, q0")                /* q2 = (c*t + b)*t */ \
+        __ASM_EMIT("vadd.f32        q2, q2, q6")                /* q2 = (c*t + b)*t + a */ \
+        __ASM_EMIT("vmul.f32        q2, q2, q0")                /* q2 = ((c*t + b)*t + a)*t */ \
+        __ASM_EMIT("vmul.f32        q2, q2, q12")               /* q2 = 0.5*((c*t + b)*t + a)*t */ \
+        __ASM_EMIT("vadd.f32        q2, q2, q5")                /* q2 = 0.5*((c*t + b)*t + a)*t + s0 */
+
+    /* Compute q0 = t = x - int(x), q1 = int(x) for x = pos + step*i */
+    #define CUBIC_POSITION \
+        __ASM_EMIT("vmul.f32        q0, q8, q14")               /* q0 = step*i */ \
+        __ASM_EMIT("vadd.f32        q0, q0, q13")               /* q0 = x = pos + step*i */ \
+        __ASM_EMIT("vcvt.s32.f32    q1, q0")                    /* q1 = n = int(x) */ \
+        __ASM_EMIT("vcvt.f32.s32    q2, q1")                    /* q2 = float(n) */ \
+        __ASM_EMIT("vsub.f32        q0, q0, q2")                /* q0 = t = x - n */
+
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count)
+    {
+        IF_ARCH_ARM(
+            const float *s      = &src[-1];
+            size_t a, b;
+        );
+
+        ARCH_ARM_ASM
+        (
+            __ASM_EMIT("vldm            %[CC], {q8-q12}")           // q8 = i, q9 = 4, q10 = 1, q11 = 3, q12 = 0.5
+            __ASM_EMIT("vld1.32         {d26[], d27[]}, [%[pos]]")  // q13 = pos
+            __ASM_EMIT("vld1.32         {d28[], d29[]}, [%[step]]") // q14 = step
+            __ASM_EMIT("subs            %[count], $4")
+            __ASM_EMIT("blo             2f")
+
+            // x4 blocks
+            __ASM_EMIT("1:")
+            CUBIC_POSITION
+            // Load 4 taps for each of 4 samples
+            __ASM_EMIT("vmov            %[a], %[b], d2")
+            __ASM_EMIT("add             %[a], %[s], %[a], lsl $2")
+            __ASM_EMIT("add             %[b], %[s], %[b], lsl $2")
+            __ASM_EMIT("vld1.32         {q4}, [%[a]]")              // q4 = a0 a1 a2 a3
+            __ASM_EMIT("vld1.32         {q5}, [%[b]]")              // q5 = b0 b1 b2 b3
+            __ASM_EMIT("vmov            %[a], %[b], d3")
+            __ASM_EMIT("add             %[a], %[s], %[a], lsl $2")
+            __ASM_EMIT("add             %[b], %[s], %[b], lsl $2")
+            __ASM_EMIT("vld1.32         {q6}, [%[a]]")              // q6 = c0 c1 c2 c3
+            __ASM_EMIT("vld1.32         {q7}, [%[b]]")              // q7 = d0 d1 d2 d3
+            // Transpose
+            __ASM_EMIT("vtrn.32         q4, q5")                    // q4 = a0 b0 a2 b2, q5 = a1 b1 a3 b3
+            __ASM_EMIT("vtrn.32         q6, q7")                    // q6 = c0 d0 c2 d2, q7 = c1 d1 c3 d3
+            __ASM_EMIT("vswp            d9, d12")                   // q4 = p  = a0 b0 c0 d0, q6 = s1 = a2 b2 c2 d2
+            __ASM_EMIT("vswp            d11, d14")                  // q5 = s0 = a1 b1 c1 d1, q7 = s2 = a3 b3 c3 d3
+            // Compute spline
+            CUBIC_SPLINE
+            __ASM_EMIT("vadd.f32        q8, q8, q9")                // q8 = i + 4
+            __ASM_EMIT("subs            %[count], $4")
+            __ASM_EMIT("vstm            %[dst]!, {q2}")
+            __ASM_EMIT("bhs             1b")
+
+            // x1 blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("adds            %[count], $3")
+            __ASM_EMIT("blt             4f")
+            __ASM_EMIT("3:")
+            CUBIC_POSITION
+            __ASM_EMIT("vmov            %[a], s4")
+            __ASM_EMIT("add             %[a], %[s], %[a], lsl $2")
+            __ASM_EMIT("vld1.32         {q3}, [%[a]]")              // q3 = p s0 s1 s2
+            __ASM_EMIT("vdup.32         q4, d6[0]")                 // q4 = p
+            __ASM_EMIT("vdup.32         q5, d6[1]")                 // q5 = s0
+            __ASM_EMIT("vdup.32         q6, d7[0]")                 // q6 = s1
+            __ASM_EMIT("vdup.32         q7, d7[1]")                 // q7 = s2
+            CUBIC_SPLINE
+            __ASM_EMIT("vadd.f32        q8, q8, q10")               // q8 = i + 1
+            __ASM_EMIT("subs            %[count], $1")
+            __ASM_EMIT("vst1.32         {d4[0]}, [%[dst]]!")
+            __ASM_EMIT("bge             3b")
+
+            // End
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [count] "+r" (count),
+              [a] "=&r" (a), [b] "=&r" (b)
+            : [s] "r" (s),
+              [pos] "r" (&pos), [step] "r" (&step),
+              [CC] "r" (&cubic_interpolate_const[0])
+            : "cc", "memory",
+              "q0", "q1", "q2", "q3",
+              "q4", "q5", "q6", "q7",
+              "q8", "q9", "q10", "q11",
+              "q12", "q13", "q14"
+        );
+    }
+
+    #undef CUBIC_POSITION
+    #undef CUBIC_SPLINE
 }
 
 #endif /* DSP_ARCH_ARM_NEON_D32_RESAMPLING_H_ */
@@ -0,0 +1,61 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_NATIVE_DYNAMICS_H_
+#define DSP_ARCH_NATIVE_DYNAMICS_H_
+
+#ifndef __DSP_NATIVE_IMPL
+    #error "This header should not be included directly"
+#endif /* __DSP_NATIVE_IMPL */
+
+namespace native
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count)
+    {
+        float e0 = e->env[0], e1 = e->env[1], e2 = e->env[2], e3 = e->env[3];
+
+        for (size_t i=0; i<count; ++i, src += 4, dst += 4)
+        {
+            e0     += (((e0 > e->thresh[0]) && (src[0] <= e0)) ? e->release[0] : e->attack[0]) * (src[0] - e0);
+            e1     += (((e1 > e->thresh[1]) && (src[1] <= e1)) ? e->release[1] : e->attack[1]) * (src[1] - e1);
+            e2     += (((e2 > e->thresh[2]) && (src[2] <= e2)) ? e->release[2] : e->attack[2]) * (src[2] - e2);
+            e3     += (((e3 > e->thresh[3]) && (src[3] <= e3)) ? e->release[3] : e->attack[3]) * (src[3] - e3);
+
+            dst[0]  = e0;
+            dst[1]  = e1;
+            dst[2]  = e2;
+            dst[3]  = e3;
+        }
+
+        e->env[0]   = e0;
+        e->env[1]   = e1;
+        e->env[2]   = e2;
+        e->env[3]   = e3;
+    }
+
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count)
+    {
+        float v[8];
+        for (size_t j=0; j<8; ++j)
+            v[j]        = e->env[j];
+
+        for (size_t i=0; i<count; ++i, src += 8, dst += 8)
+        {
+            for (size_t j=0; j<8; ++j)
+            {
+                float s     = src[j];
+                v[j]       += (((v[j] > e->thresh[j]) && (s <= v[j])) ? e->release[j] : e->attack[j]) * (s - v[j]);
+                dst[j]      = v[j];
+            }
+        }
+
+        for (size_t j=0; j<8; ++j)
+            e->env[j]   = v[j];
+    }
+}
+
+#endif /* DSP_ARCH_NATIVE_DYNAMICS_H_ */
@@ -1076,6 +1076,39 @@ namespace native
         // Do reverse FFT transformation
         fastconv_restore_internal(dst, tmp, rank);
     }
+
+    void fastconv_mul_add(float *dst, const float *c1, const float *c2, size_t rank)
+    {
+        size_t items    = size_t(1) << (rank + 1);
+
+        // Do complex multiplication and add result to the accumulator
+        for (size_t i=0; i<items; i += 8)
+        {
+            float r0        = c1[0]*c2[0] - c1[4]*c2[4];
+            float r1        = c1[1]*c2[1] - c1[5]*c2[5];
+            float r2        = c1[2]*c2[2] - c1[6]*c2[6];
+            float r3        = c1[3]*c2[3] - c1[7]*c2[7];
+
+            float i0        = c1[0]*c2[4] + c1[4]*c2[0];
+            float i1        = c1[1]*c2[5] + c1[5]*c2[1];
+            float i2        = c1[2]*c2[6] + c1[6]*c2[2];
+            float i3        = c1[3]*c2[7] + c1[7]*c2[3];
+
+            dst[0]         += r0;
+            dst[1]         += r1;
+            dst[2]         += r2;
+            dst[3]         += r3;
+
+            dst[4]         += i0;
+            dst[5]         += i1;
+            dst[6]         += i2;
+            dst[7]         += i3;
+
+            dst            += 8;
+            c1             += 8;
+            c2             += 8;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_FASTCONV_H_ */
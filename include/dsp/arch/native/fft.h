@@ -33,7 +33,10 @@ namespace native
         0.9999999264657179f, 0.0003834951875714f,
         0.9999999816164293f, 0.0001917475973107f,
         0.9999999954041073f, 0.0000958737990960f,
-        0.9999999988510268f, 0.0000479368996031f
+        0.9999999988510268f, 0.0000479368996031f,
+        0.9999999997127567f, 0.0000239684498084f,
+        0.9999999999281892f, 0.0000119842249051f,
+        0.9999999999820472f, 0.0000059921124526f
     };
 
     static const float XFFT_A_RE[] __lsp_aligned16 =
@@ -52,7 +55,10 @@ namespace native
         1.0000000000000000f, 0.9999999264657179f, 0.9999997058628822f, 0.9999993381915255f,
         1.0000000000000000f, 0.9999999816164293f, 0.9999999264657179f, 0.9999998345478677f,
         1.0000000000000000f, 0.9999999954041073f, 0.9999999816164293f, 0.9999999586369661f,
-        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f
+        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f,
+        1.0000000000000000f, 0.9999999997127567f, 0.9999999988510269f, 0.9999999974148104f,
+        1.0000000000000000f, 0.9999999999281892f, 0.9999999997127567f, 0.9999999993537025f,
+        1.0000000000000000f, 0.9999999999820472f, 0.9999999999281892f, 0.9999999998384257f
     };
 
     static const float XFFT_A_IM[] __lsp_aligned16 =
@@ -71,7 +77,10 @@ namespace native
         0.0000000000000000f, 0.0003834951875714f, 0.0007669903187427f, 0.0011504853371138f,
         0.0000000000000000f, 0.0001917475973107f, 0.0003834951875714f, 0.0005752427637321f,
         0.0000000000000000f, 0.0000958737990960f, 0.0001917475973107f, 0.0002876213937629f,
-        0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f
+        0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f,
+        0.0000000000000000f, 0.0000239684498084f, 0.0000479368996031f, 0.0000719053493702f,
+        0.0000000000000000f, 0.0000119842249051f, 0.0000239684498084f, 0.0000359526747083f,
+        0.0000000000000000f, 0.0000059921124526f, 0.0000119842249051f, 0.0000179763373571f
     };
 
     void normalize_fft3(float *dst_re, float *dst_im, const float *src_re, const float *src_im, size_t rank)
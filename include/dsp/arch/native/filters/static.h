@@ -372,6 +372,104 @@ namespace native
             d          += 4;
         }
     }
+
+    void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        if (count <= 0)
+            return;
+
+        const biquad_x4_t *bq = &f->x4;
+        float *d        = f->d;
+        float s[4], s2[4];
+
+        // First filter only
+        s[0]            = src[0];
+        s[1]            = src[1];
+        src            += 2;
+        for (size_t j=0; j<2; ++j)
+        {
+            s2[j]           = bq->b0[j]*s[j] + d[j];
+            d[j]            = d[j+4] + bq->b1[j]*s[j] + bq->a1[j]*s2[j];
+            d[j+4]          = bq->b2[j]*s[j] + bq->a2[j]*s2[j];
+        }
+
+        // Both filters, the second filter processes the output of the first filter
+        for (size_t i=1; i<count; ++i)
+        {
+            s[0]            = src[0];
+            s[1]            = src[1];
+            s[2]            = s2[0];
+            s[3]            = s2[1];
+
+            for (size_t j=0; j<4; ++j)
+            {
+                s2[j]           = bq->b0[j]*s[j] + d[j];
+                d[j]            = d[j+4] + bq->b1[j]*s[j] + bq->a1[j]*s2[j];
+                d[j+4]          = bq->b2[j]*s[j] + bq->a2[j]*s2[j];
+            }
+
+            dst[0]          = s2[2];
+            dst[1]          = s2[3];
+            src            += 2;
+            dst            += 2;
+        }
+
+        // Second filter only
+        s[2]            = s2[0];
+        s[3]            = s2[1];
+        for (size_t j=2; j<4; ++j)
+        {
+            s2[j]           = bq->b0[j]*s[j] + d[j];
+            d[j]            = d[j+4] + bq->b1[j]*s[j] + bq->a1[j]*s2[j];
+            d[j+4]          = bq->b2[j]*s[j] + bq->a2[j]*s2[j];
+        }
+        dst[0]          = s2[2];
+        dst[1]          = s2[3];
+    }
+
+    void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        const biquad_x4_t *bq = &f->x4;
+        float *d        = f->d;
+        float s, s2;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<4; ++j)
+            {
+                s               = src[j];
+                s2              = bq->b0[j]*s + d[j];
+                d[j]            = d[j+4] + bq->b1[j]*s + bq->a1[j]*s2;
+                d[j+4]          = bq->b2[j]*s + bq->a2[j]*s2;
+                dst[j]          = s2;
+            }
+
+            src            += 4;
+            dst            += 4;
+        }
+    }
+
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        const biquad_x8_t *bq = &f->x8;
+        float *d        = f->d;
+        float s, s2;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            for (size_t j=0; j<8; ++j)
+            {
+                s               = src[j];
+                s2              = bq->b0[j]*s + d[j];
+                d[j]            = d[j+8] + bq->b1[j]*s + bq->a1[j]*s2;
+                d[j+8]          = bq->b2[j]*s + bq->a2[j]*s2;
+                dst[j]          = s2;
+            }
+
+            src            += 8;
+            dst            += 8;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_FILTERS_STATIC_H_ */
@@ -754,6 +754,37 @@ namespace native
             bc          += 8;
         } // for i
     }
+
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        float v[8], dv[8];
+        float k         = 1.0f / count;
+
+        for (size_t i=0; i<4; ++i)
+        {
+            v[i]            = c1->t[i];
+            v[i+4]          = c1->b[i];
+            dv[i]           = (c2->t[i] - c1->t[i]) * k;
+            dv[i+4]         = (c2->b[i] - c1->b[i]) * k;
+        }
+
+        while (count--)
+        {
+            for (size_t i=0; i<4; ++i)
+            {
+                dst->t[i]       = v[i];
+                dst->b[i]       = v[i+4];
+            }
+            for (size_t i=0; i<8; ++i)
+                v[i]           += dv[i];
+
+            // Move to next cascade
+            dst            += stride;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_FILTERS_TRANSFORM_H_ */
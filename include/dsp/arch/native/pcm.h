@@ -0,0 +1,100 @@
+/*
+ * pcm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_NATIVE_PCM_H_
+#define DSP_ARCH_NATIVE_PCM_H_
+
+#ifndef __DSP_NATIVE_IMPL
+    #error "This header should not be included directly"
+#endif /* __DSP_NATIVE_IMPL */
+
+namespace native
+{
+    void pcm_s16_to_f32(float *dst, const int16_t *src, size_t count)
+    {
+        while (count--)
+            *(dst++)    = float(*(src++)) / 0x7fff;
+    }
+
+    void pcm_s24le_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        while (count--)
+        {
+            int32_t v   = src[0] | (src[1] << 8) | (src[2] << 16);
+            v           = (v << 8) >> 8; // Sign-extend value
+            *(dst++)    = float(v) / 0x7fffff;
+            src        += 3;
+        }
+    }
+
+    void pcm_s24be_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        while (count--)
+        {
+            int32_t v   = src[2] | (src[1] << 8) | (src[0] << 16);
+            v           = (v << 8) >> 8; // Sign-extend value
+            *(dst++)    = float(v) / 0x7fffff;
+            src        += 3;
+        }
+    }
+
+    void pcm_s32_to_f32(float *dst, const int32_t *src, size_t count)
+    {
+        while (count--)
+            *(dst++)    = double(*(src++)) / 0x7fffffff;
+    }
+
+    void pcm_f64_to_f32(float *dst, const double *src, size_t count)
+    {
+        while (count--)
+            *(dst++)    = *(src++);
+    }
+
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count)
+    {
+        while (count--)
+            *(dst++)    = int16_t(*(src++) * 0x7fff);
+    }
+
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count)
+    {
+        while (count--)
+        {
+            int32_t v   = int32_t(*(src++) * 0x7fffff);
+            dst[0]      = uint8_t(v);
+            dst[1]      = uint8_t(v >> 8);
+            dst[2]      = uint8_t(v >> 16);
+            dst        += 3;
+        }
+    }
+
+    void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count)
+    {
+        while (count--)
+        {
+            int32_t v   = int32_t(*(src++) * 0x7fffff);
+            dst[0]      = uint8_t(v >> 16);
+            dst[1]      = uint8_t(v >> 8);
+            dst[2]      = uint8_t(v);
+            dst        += 3;
+        }
+    }
+
+    void pcm_f32_to_s32(int32_t *dst, const float *src, size_t count)
+    {
+        while (count--)
+            *(dst++)    = int32_t(double(*(src++)) * 0x7fffffff);
+    }
+
+    void pcm_f32_to_f64(double *dst, const float *src, size_t count)
+    {
+        while (count--)
+            *(dst++)    = *(src++);
+    }
+}
+
+#endif /* DSP_ARCH_NATIVE_PCM_H_ */
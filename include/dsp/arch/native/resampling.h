@@ -450,6 +450,57 @@ namespace native
             src     += 8;
         }
     }
+
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            float x         = pos + step * float(i);
+            int32_t n       = int32_t(x);
+            float t         = x - float(n);
+            const float *s  = &src[n];
+
+            // Catmull-Rom spline over s[-1], s[0], s[1], s[2]
+            float d         = s[0] - s[1];
+            float c         = (d * 3.0f + s[2]) - s[-1];
+            float b         = (s[-1] + s[1]) - s[0] - s[0] - c;
+            float a         = s[1] - s[-1];
+
+            dst[i]          = ((c * t + b) * t + a) * t * 0.5f + s[0];
+        }
+    }
+
+    void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        const float *c  = &src[taps >> 1];
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float s         = 0.0f;
+            for (size_t j=0; j<taps; ++j)
+                s              += k[j] * src[j];
+
+            dst[0]          = s;
+            dst[1]          = c[i];
+            dst            += 2;
+            src            ++;
+        }
+    }
+
+    void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        const float *c  = &src[taps - 1];
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float s         = 0.0f;
+            for (size_t j=0; j<taps; ++j)
+                s              += k[j] * src[j << 1];
+
+            dst[i]          = 0.5f * (s + c[i << 1]);
+            src            += 2;
+        }
+    }
 }
 
 #endif /* DSP_ARCH_NATIVE_RESAMPLING_H_ */
@@ -0,0 +1,98 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX_DYNAMICS_H_
+#define DSP_ARCH_X86_AVX_DYNAMICS_H_
+
+#ifndef DSP_ARCH_X86_AVX_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX_IMPL */
+
+namespace avx
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00(%[e]), %%xmm0")                        // xmm0 = e
+            __ASM_EMIT("vmovaps         0x10(%[e]), %%xmm5")                        // xmm5 = a
+            __ASM_EMIT("vmovaps         0x20(%[e]), %%xmm6")                        // xmm6 = r
+            __ASM_EMIT("vmovaps         0x30(%[e]), %%xmm7")                        // xmm7 = t
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         0x00(%[src]), %%xmm1")                      // xmm1 = s
+            __ASM_EMIT("vcmpltps        %%xmm0, %%xmm7, %%xmm3")                    // xmm3 = [t < e]
+            __ASM_EMIT("vcmpleps        %%xmm0, %%xmm1, %%xmm4")                    // xmm4 = [s <= e]
+            __ASM_EMIT("vsubps          %%xmm0, %%xmm1, %%xmm2")                    // xmm2 = s - e
+            __ASM_EMIT("vandps          %%xmm3, %%xmm4, %%xmm4")                    // xmm4 = M = [t < e] & [s <= e]
+            __ASM_EMIT("vblendvps       %%xmm4, %%xmm6, %%xmm5, %%xmm1")            // xmm1 = tau = (r & M) | (a & ~M)
+            __ASM_EMIT("vmulps          %%xmm1, %%xmm2, %%xmm2")                    // xmm2 = tau * (s - e)
+            __ASM_EMIT("vaddps          %%xmm2, %%xmm0, %%xmm0")                    // xmm0 = e' = e + tau * (s - e)
+            __ASM_EMIT("vmovups         %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT32("decl          %[count]")
+            __ASM_EMIT64("dec           %[count]")
+            __ASM_EMIT("jnz             1b")
+
+            __ASM_EMIT("vmovaps         %%xmm0, 0x00(%[e])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [e] "r" (e)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00(%[e]), %%ymm0")                        // ymm0 = e
+            __ASM_EMIT("vmovaps         0x20(%[e]), %%ymm5")                        // ymm5 = a
+            __ASM_EMIT("vmovaps         0x40(%[e]), %%ymm6")                        // ymm6 = r
+            __ASM_EMIT("vmovaps         0x60(%[e]), %%ymm7")                        // ymm7 = t
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         0x00(%[src]), %%ymm1")                      // ymm1 = s
+            __ASM_EMIT("vcmpltps        %%ymm0, %%ymm7, %%ymm3")                    // ymm3 = [t < e]
+            __ASM_EMIT("vcmpleps        %%ymm0, %%ymm1, %%ymm4")                    // ymm4 = [s <= e]
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm1, %%ymm2")                    // ymm2 = s - e
+            __ASM_EMIT("vandps          %%ymm3, %%ymm4, %%ymm4")                    // ymm4 = M = [t < e] & [s <= e]
+            __ASM_EMIT("vblendvps       %%ymm4, %%ymm6, %%ymm5, %%ymm1")            // ymm1 = tau = (r & M) | (a & ~M)
+            __ASM_EMIT("vmulps          %%ymm1, %%ymm2, %%ymm2")                    // ymm2 = tau * (s - e)
+            __ASM_EMIT("vaddps          %%ymm2, %%ymm0, %%ymm0")                    // ymm0 = e' = e + tau * (s - e)
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT32("decl          %[count]")
+            __ASM_EMIT64("dec           %[count]")
+            __ASM_EMIT("jnz             1b")
+
+            __ASM_EMIT("vmovaps         %%ymm0, 0x00(%[e])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [e] "r" (e)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_X86_AVX_DYNAMICS_H_ */
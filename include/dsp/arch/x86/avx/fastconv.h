@@ -289,6 +289,16 @@ namespace avx
 
         fastconv_reverse_butterfly_last_adding_fma3(dst, tmp, ak, wk, np);
     }
+
+    void fastconv_mul_add(float *dst, const float *c1, const float *c2, size_t rank)
+    {
+        fastconv_mul_add_internal(dst, c1, c2, 1 << (rank - 3));
+    }
+
+    void fastconv_mul_add_fma3(float *dst, const float *c1, const float *c2, size_t rank)
+    {
+        fastconv_mul_add_internal_fma3(dst, c1, c2, 1 << (rank - 3));
+    }
 }
 
 #endif /* DSP_ARCH_X86_AVX_FASTCONV_H_ */
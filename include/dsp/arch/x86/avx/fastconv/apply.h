@@ -395,6 +395,76 @@ namespace avx
         FASTCONV_APPLY_CORE(FMA_ON);
     }
 
+    #define FASTCONV_MUL_ADD_CORE(FMA_SEL) \
+        size_t off; \
+        ARCH_X86_ASM( \
+            /* 2x blocks loop */ \
+            __ASM_EMIT("xor             %[off], %[off]") \
+            __ASM_EMIT("sub             $2, %[nb]") \
+            __ASM_EMIT("jb              2f") \
+            __ASM_EMIT("1:") \
+                __ASM_EMIT("vmovups         0x00(%[c1], %[off]), %%ymm0")                   /* ymm0 = ar0 */ \
+                __ASM_EMIT("vmovups         0x20(%[c1], %[off]), %%ymm1")                   /* ymm1 = ai0 */ \
+                __ASM_EMIT("vmovups         0x40(%[c1], %[off]), %%ymm2")                   /* ymm2 = ar1 */ \
+                __ASM_EMIT("vmovups         0x60(%[c1], %[off]), %%ymm3")                   /* ymm3 = ai1 */ \
+                __ASM_EMIT("vmulps          0x20(%[c2], %[off]), %%ymm0, %%ymm4")           /* ymm4 = ar0*bi0 */ \
+                __ASM_EMIT("vmulps          0x20(%[c2], %[off]), %%ymm1, %%ymm5")           /* ymm5 = ai0*bi0 */ \
+                __ASM_EMIT("vmulps          0x60(%[c2], %[off]), %%ymm2, %%ymm6")           /* ymm6 = ar1*bi1 */ \
+                __ASM_EMIT("vmulps          0x60(%[c2], %[off]), %%ymm3, %%ymm7")           /* ymm7 = ai1*bi1 */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm0, %%ymm0", ""))      /* ymm0 = ar0*br0 */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm1, %%ymm1", ""))      /* ymm1 = ai0*br0 */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x40(%[c2], %[off]), %%ymm2, %%ymm2", ""))      /* ymm2 = ar1*br1 */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x40(%[c2], %[off]), %%ymm3, %%ymm3", ""))      /* ymm3 = ai1*br1 */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm5, %%ymm0, %%ymm0", "vfmsub132ps 0x00(%[c2], %[off]), %%ymm5, %%ymm0")) /* ymm0 = ar0*br0 - ai0*bi0 */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm4, %%ymm1, %%ymm1", "vfmadd132ps 0x00(%[c2], %[off]), %%ymm4, %%ymm1")) /* ymm1 = ai0*br0 + ar0*bi0 */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm7, %%ymm2, %%ymm2", "vfmsub132ps 0x40(%[c2], %[off]), %%ymm7, %%ymm2")) /* ymm2 = ar1*br1 - ai1*bi1 */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm6, %%ymm3, %%ymm3", "vfmadd132ps 0x40(%[c2], %[off]), %%ymm6, %%ymm3")) /* ymm3 = ai1*br1 + ar1*bi1 */ \
+                __ASM_EMIT("vaddps          0x00(%[dst], %[off]), %%ymm0, %%ymm0") \
+                __ASM_EMIT("vaddps          0x20(%[dst], %[off]), %%ymm1, %%ymm1") \
+                __ASM_EMIT("vaddps          0x40(%[dst], %[off]), %%ymm2, %%ymm2") \
+                __ASM_EMIT("vaddps          0x60(%[dst], %[off]), %%ymm3, %%ymm3") \
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst], %[off])") \
+                __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst], %[off])") \
+                __ASM_EMIT("vmovups         %%ymm2, 0x40(%[dst], %[off])") \
+                __ASM_EMIT("vmovups         %%ymm3, 0x60(%[dst], %[off])") \
+            __ASM_EMIT("add             $0x80, %[off]") \
+            __ASM_EMIT("sub             $2, %[nb]") \
+            __ASM_EMIT("jae             1b") \
+            /* 1x block */ \
+            __ASM_EMIT("2:") \
+            __ASM_EMIT("add             $1, %[nb]") \
+            __ASM_EMIT("jl              4f") \
+                __ASM_EMIT("vmovups         0x00(%[c1], %[off]), %%ymm0")                   /* ymm0 = ar0 */ \
+                __ASM_EMIT("vmovups         0x20(%[c1], %[off]), %%ymm1")                   /* ymm1 = ai0 */ \
+                __ASM_EMIT("vmulps          0x20(%[c2], %[off]), %%ymm0, %%ymm4")           /* ymm4 = ar0*bi0 */ \
+                __ASM_EMIT("vmulps          0x20(%[c2], %[off]), %%ymm1, %%ymm5")           /* ymm5 = ai0*bi0 */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm0, %%ymm0", ""))      /* ymm0 = ar0*br0 */ \
+                __ASM_EMIT(FMA_SEL("vmulps  0x00(%[c2], %[off]), %%ymm1, %%ymm1", ""))      /* ymm1 = ai0*br0 */ \
+                __ASM_EMIT(FMA_SEL("vsubps  %%ymm5, %%ymm0, %%ymm0", "vfmsub132ps 0x00(%[c2], %[off]), %%ymm5, %%ymm0")) /* ymm0 = ar0*br0 - ai0*bi0 */ \
+                __ASM_EMIT(FMA_SEL("vaddps  %%ymm4, %%ymm1, %%ymm1", "vfmadd132ps 0x00(%[c2], %[off]), %%ymm4, %%ymm1")) /* ymm1 = ai0*br0 + ar0*bi0 */ \
+                __ASM_EMIT("vaddps          0x00(%[dst], %[off]), %%ymm0, %%ymm0") \
+                __ASM_EMIT("vaddps          0x20(%[dst], %[off]), %%ymm1, %%ymm1") \
+                __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst], %[off])") \
+                __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst], %[off])") \
+            __ASM_EMIT("4:") \
+            : [off] "=&r" (off), [nb] "+r" (nb) \
+            : [dst] "r" (dst), [c1] "r" (c1), [c2] "r" (c2) \
+            : "cc", "memory", \
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3", \
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7" \
+        )
+
+    static inline void fastconv_mul_add_internal(float *dst, const float *c1, const float *c2, size_t nb)
+    {
+        FASTCONV_MUL_ADD_CORE(FMA_OFF);
+    }
+
+    static inline void fastconv_mul_add_internal_fma3(float *dst, const float *c1, const float *c2, size_t nb)
+    {
+        FASTCONV_MUL_ADD_CORE(FMA_ON);
+    }
+
+    #undef FASTCONV_MUL_ADD_CORE
     #undef FASTCONV_APPLY_PREPARE_CORE
     #undef FASTCONV_APPLY_CORE
     #undef FMA_ON
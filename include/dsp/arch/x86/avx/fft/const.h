@@ -66,6 +66,12 @@ namespace avx
         // rank == 17
         1.0000000000000000, 0.9999999997127567, 0.9999999988510269, 0.9999999974148104, 0.9999999954041073, 0.9999999928189177, 0.9999999896592414, 0.9999999859250787,
         0.0000000000000000, 0.0000239684498084, 0.0000479368996031, 0.0000719053493702, 0.0000958737990960, 0.0001198422487667, 0.0001438106983686, 0.0001677791478878,
+        // rank == 18
+        1.0000000000000000, 0.9999999999281892, 0.9999999997127567, 0.9999999993537025, 0.9999999988510269, 0.9999999982047294, 0.9999999974148104, 0.9999999964812697,
+        0.0000000000000000, 0.0000119842249051, 0.0000239684498084, 0.0000359526747083, 0.0000479368996031, 0.0000599211244909, 0.0000719053493702, 0.0000838895742391,
+        // rank == 19
+        1.0000000000000000, 0.9999999999820472, 0.9999999999281892, 0.9999999998384257, 0.9999999997127567, 0.9999999995511824, 0.9999999993537025, 0.9999999991203175,
+        0.0000000000000000, 0.0000059921124526, 0.0000119842249051, 0.0000179763373571, 0.0000239684498084, 0.0000299605622589, 0.0000359526747083, 0.0000419447871564,
     };
 
     static const float FFT_DW[] __lsp_aligned64 =
@@ -87,6 +93,8 @@ namespace avx
         X8VEC(0.9999999264657179), X8VEC(0.0003834951875714), // rank = 16
         X8VEC(0.9999999816164293), X8VEC(0.0001917475973107), // rank = 17
         X8VEC(0.9999999954041073), X8VEC(0.0000958737990960), // rank = 18
+        X8VEC(0.9999999988510269), X8VEC(0.0000479368996031), // rank = 19
+        X8VEC(0.9999999997127567), X8VEC(0.0000239684498084), // rank = 20
     };
 }
 
@@ -763,5 +763,84 @@ namespace avx
     }
 
 
+
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00(%[f]), %%ymm0")                                    // ymm0 = d0
+            __ASM_EMIT("vmovaps         0x20(%[f]), %%ymm1")                                    // ymm1 = d1
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         0x00(%[src]), %%ymm2")                                  // ymm2 = s
+            __ASM_EMIT("vmulps          " BIQUAD_XN_SOFF " + 0x00(%[f]), %%ymm2, %%ymm3")       // ymm3 = b0*s
+            __ASM_EMIT("vmulps          " BIQUAD_XN_SOFF " + 0x20(%[f]), %%ymm2, %%ymm4")       // ymm4 = b1*s
+            __ASM_EMIT("vaddps          %%ymm0, %%ymm3, %%ymm3")                                // ymm3 = s2 = b0*s + d0
+            __ASM_EMIT("vmulps          " BIQUAD_XN_SOFF " + 0x40(%[f]), %%ymm2, %%ymm2")       // ymm2 = b2*s
+            __ASM_EMIT("vaddps          %%ymm1, %%ymm4, %%ymm4")                                // ymm4 = d1 + b1*s
+            __ASM_EMIT("vmulps          " BIQUAD_XN_SOFF " + 0x60(%[f]), %%ymm3, %%ymm5")       // ymm5 = a1*s2
+            __ASM_EMIT("vmulps          " BIQUAD_XN_SOFF " + 0x80(%[f]), %%ymm3, %%ymm6")       // ymm6 = a2*s2
+            __ASM_EMIT("vmovups         %%ymm3, 0x00(%[dst])")                                  // *dst = s2
+            __ASM_EMIT("vaddps          %%ymm5, %%ymm4, %%ymm0")                                // ymm0 = d0' = d1 + b1*s + a1*s2
+            __ASM_EMIT("vaddps          %%ymm6, %%ymm2, %%ymm1")                                // ymm1 = d1' = b2*s + a2*s2
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT32("decl          %[count]")
+            __ASM_EMIT64("dec           %[count]")
+            __ASM_EMIT("jnz             1b")
+
+            __ASM_EMIT("vmovaps         %%ymm0, 0x00(%[f])")
+            __ASM_EMIT("vmovaps         %%ymm1, 0x20(%[f])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [f] "r" (f)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6"
+        );
+    }
+
+    void biquad_process_i8_fma3(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00(%[f]), %%ymm0")                                    // ymm0 = d0
+            __ASM_EMIT("vmovaps         0x20(%[f]), %%ymm1")                                    // ymm1 = d1
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         0x00(%[src]), %%ymm2")                                  // ymm2 = s
+            __ASM_EMIT("vfmadd231ps     " BIQUAD_XN_SOFF " + 0x00(%[f]), %%ymm2, %%ymm0")       // ymm0 = s2 = b0*s + d0
+            __ASM_EMIT("vfmadd231ps     " BIQUAD_XN_SOFF " + 0x20(%[f]), %%ymm2, %%ymm1")       // ymm1 = d1 + b1*s
+            __ASM_EMIT("vmulps          " BIQUAD_XN_SOFF " + 0x40(%[f]), %%ymm2, %%ymm2")       // ymm2 = b2*s
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")                                  // *dst = s2
+            __ASM_EMIT("vfmadd231ps     " BIQUAD_XN_SOFF " + 0x60(%[f]), %%ymm0, %%ymm1")       // ymm1 = d0' = d1 + b1*s + a1*s2
+            __ASM_EMIT("vfmadd231ps     " BIQUAD_XN_SOFF " + 0x80(%[f]), %%ymm0, %%ymm2")       // ymm2 = d1' = b2*s + a2*s2
+            __ASM_EMIT("vmovaps         %%ymm1, %%ymm0")                                        // ymm0 = d0
+            __ASM_EMIT("vmovaps         %%ymm2, %%ymm1")                                        // ymm1 = d1
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT32("decl          %[count]")
+            __ASM_EMIT64("dec           %[count]")
+            __ASM_EMIT("jnz             1b")
+
+            __ASM_EMIT("vmovaps         %%ymm0, 0x00(%[f])")
+            __ASM_EMIT("vmovaps         %%ymm1, 0x20(%[f])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [f] "r" (f)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2"
+        );
+    }
 }
 #endif /* DSP_ARCH_X86_AVX_FILTERS_H_ */
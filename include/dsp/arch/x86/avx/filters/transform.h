@@ -636,6 +636,39 @@ namespace avx
     //        bc              ++;
     //        bf              ++;
     }
+
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        float k         = 1.0f / count;
+        IF_ARCH_X86(stride *= sizeof(f_cascade_t));
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vbroadcastss    %[k], %%ymm2")                  // ymm2 = 1/count
+            __ASM_EMIT("vmovups         0x00(%[c1]), %%ymm0")           // ymm0 = c1
+            __ASM_EMIT("vmovups         0x00(%[c2]), %%ymm1")           // ymm1 = c2
+            __ASM_EMIT("vsubps          %%ymm0, %%ymm1, %%ymm1")        // ymm1 = c2 - c1
+            __ASM_EMIT("vmulps          %%ymm2, %%ymm1, %%ymm1")        // ymm1 = dc = (c2 - c1)/count
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("vaddps          %%ymm1, %%ymm0, %%ymm0")        // ymm0 = c + dc
+            __ASM_EMIT("add             %[stride], %[dst]")
+            __ASM_EMIT64("dec           %[count]")
+            __ASM_EMIT32("decl          %[count]")
+            __ASM_EMIT("jnz             1b")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [count] __ASM_ARG_RW(count)
+            : [c1] "r" (c1), [c2] "r" (c2), [stride] "r" (stride),
+              [k] "m" (k)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_X86_AVX_FILTERS_TRANSFORM_H_ */
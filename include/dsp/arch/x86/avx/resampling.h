@@ -1849,6 +1849,375 @@ namespace avx
               "%xmm4", "%xmm5", "%xmm6", "%xmm7"
         );
     }
+
+    IF_ARCH_X86(
+        static const float cubic_interpolate_const[] __lsp_aligned32 =
+        {
+            0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f,         // initial indices
+            8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f, 8.0f,         // index step
+            3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 3.0f,
+            0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f
+        };
+    )
+
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count)
+    {
+        IF_ARCH_X86(
+            float v[16] __lsp_aligned32 = {
+                pos, pos, pos, pos, pos, pos, pos, pos,
+                step, step, step, step, step, step, step, step
+            };
+            size_t off;
+        );
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00 + %[CC], %%ymm7")                      // ymm7 = i
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+
+            // 8x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmulps          0x20 + %[v], %%ymm7, %%ymm0")               // ymm0 = step*i
+            __ASM_EMIT("vaddps          0x00 + %[v], %%ymm0, %%ymm0")               // ymm0 = x = pos + step*i
+            __ASM_EMIT("vcvttps2dq      %%ymm0, %%ymm1")                            // ymm1 = n = int(x)
+            __ASM_EMIT("vcvtdq2ps       %%ymm1, %%ymm2")                            // ymm2 = float(n)
+            __ASM_EMIT("vsubps          %%ymm2, %%ymm0, %%ymm0")                    // ymm0 = t = x - n
+            __ASM_EMIT("vextractf128    $1, %%ymm1, %%xmm6")                        // xmm6 = n4 n5 n6 n7
+            // Load 4 taps for each of 8 samples
+            __ASM_EMIT("vmovd           %%xmm1, %k[off]")
+            __ASM_EMIT("vmovups         -0x04(%[src], %[off], 4), %%xmm2")          // ymm2 = a0 a1 a2 a3 ? ? ? ?
+            __ASM_EMIT("vpextrd         $1, %%xmm1, %k[off]")
+            __ASM_EMIT("vmovups         -0x04(%[src], %[off], 4), %%xmm3")          // ymm3 = b0 b1 b2 b3 ? ? ? ?
+            __ASM_EMIT("vpextrd         $2, %%xmm1, %k[off]")
+            __ASM_EMIT("vmovups         -0x04(%[src], %[off], 4), %%xmm4")          // ymm4 = c0 c1 c2 c3 ? ? ? ?
+            __ASM_EMIT("vpextrd         $3, %%xmm1, %k[off]")
+            __ASM_EMIT("vmovups         -0x04(%[src], %[off], 4), %%xmm5")          // ymm5 = d0 d1 d2 d3 ? ? ? ?
+            __ASM_EMIT("vmovd           %%xmm6, %k[off]")
+            __ASM_EMIT("vinsertf128     $1, -0x04(%[src], %[off], 4), %%ymm2, %%ymm2")  // ymm2 = a0 a1 a2 a3 e0 e1 e2 e3
+            __ASM_EMIT("vpextrd         $1, %%xmm6, %k[off]")
+            __ASM_EMIT("vinsertf128     $1, -0x04(%[src], %[off], 4), %%ymm3, %%ymm3")  // ymm3 = b0 b1 b2 b3 f0 f1 f2 f3
+            __ASM_EMIT("vpextrd         $2, %%xmm6, %k[off]")
+            __ASM_EMIT("vinsertf128     $1, -0x04(%[src], %[off], 4), %%ymm4, %%ymm4")  // ymm4 = c0 c1 c2 c3 g0 g1 g2 g3
+            __ASM_EMIT("vpextrd         $3, %%xmm6, %k[off]")
+            __ASM_EMIT("vinsertf128     $1, -0x04(%[src], %[off], 4), %%ymm5, %%ymm5")  // ymm5 = d0 d1 d2 d3 h0 h1 h2 h3
+            // Transpose
+            __ASM_EMIT("vunpcklps       %%ymm3, %%ymm2, %%ymm1")                    // ymm1 = a0 b0 a1 b1 e0 f0 e1 f1
+            __ASM_EMIT("vunpckhps       %%ymm3, %%ymm2, %%ymm2")                    // ymm2 = a2 b2 a3 b3 e2 f2 e3 f3
+            __ASM_EMIT("vunpcklps       %%ymm5, %%ymm4, %%ymm3")                    // ymm3 = c0 d0 c1 d1 g0 h0 g1 h1
+            __ASM_EMIT("vunpckhps       %%ymm5, %%ymm4, %%ymm4")                    // ymm4 = c2 d2 c3 d3 g2 h2 g3 h3
+            __ASM_EMIT("vshufps         $0x44, %%ymm3, %%ymm1, %%ymm5")             // ymm5 = p  = a0 b0 c0 d0 e0 f0 g0 h0
+            __ASM_EMIT("vshufps         $0xee, %%ymm3, %%ymm1, %%ymm1")             // ymm1 = s0 = a1 b1 c1 d1 e1 f1 g1 h1
+            __ASM_EMIT("vshufps         $0x44, %%ymm4, %%ymm2, %%ymm3")             // ymm3 = s1 = a2 b2 c2 d2 e2 f2 g2 h2
+            __ASM_EMIT("vshufps         $0xee, %%ymm4, %%ymm2, %%ymm2")             // ymm2 = s2 = a3 b3 c3 d3 e3 f3 g3 h3
+            // Compute spline
+            __ASM_EMIT("vsubps          %%ymm3, %%ymm1, %%ymm4")                    // ymm4 = d = s0 - s1
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm5, %%ymm6")                    // ymm6 = p + s1
+            __ASM_EMIT("vmulps          0x40 + %[CC], %%ymm4, %%ymm4")              // ymm4 = 3*d
+            __ASM_EMIT("vsubps          %%ymm1, %%ymm6, %%ymm6")                    // ymm6 = p + s1 - s0
+            __ASM_EMIT("vaddps          %%ymm2, %%ymm4, %%ymm4")                    // ymm4 = 3*d + s2
+            __ASM_EMIT("vsubps          %%ymm1, %%ymm6, %%ymm6")                    // ymm6 = p + s1 - 2*s0
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm4, %%ymm4")                    // ymm4 = c = 3*d + s2 - p
+            __ASM_EMIT("vsubps          %%ymm5, %%ymm3, %%ymm3")                    // ymm3 = a = s1 - p
+            __ASM_EMIT("vsubps          %%ymm4, %%ymm6, %%ymm6")                    // ymm6 = b = p + s1 - 2*s0 - c
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4")                    // ymm4 = c*t
+            __ASM_EMIT("vaddps          %%ymm6, %%ymm4, %%ymm4")                    // ymm4 = c*t + b
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4")                    // ymm4 = (c*t + b)*t
+            __ASM_EMIT("vaddps          %%ymm3, %%ymm4, %%ymm4")                    // ymm4 = (c*t + b)*t + a
+            __ASM_EMIT("vmulps          %%ymm0, %%ymm4, %%ymm4")                    // ymm4 = ((c*t + b)*t + a)*t
+            __ASM_EMIT("vmulps          0x60 + %[CC], %%ymm4, %%ymm4")              // ymm4 = 0.5*((c*t + b)*t + a)*t
+            __ASM_EMIT("vaddps          %%ymm1, %%ymm4, %%ymm4")                    // ymm4 = 0.5*((c*t + b)*t + a)*t + s0
+            __ASM_EMIT("vmovups         %%ymm4, 0x00(%[dst])")
+            __ASM_EMIT("vaddps          0x20 + %[CC], %%ymm7, %%ymm7")              // ymm7 = i + 8
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("vmulss          0x20 + %[v], %%xmm7, %%xmm0")               // xmm0 = step*i
+            __ASM_EMIT("vaddss          0x00 + %[v], %%xmm0, %%xmm0")               // xmm0 = x = pos + step*i
+            __ASM_EMIT("vcvttss2si      %%xmm0, %k[off]")                           // off = n = int(x)
+            __ASM_EMIT("vcvtsi2ss       %k[off], %%xmm1, %%xmm1")                   // xmm1 = float(n)
+            __ASM_EMIT("vsubss          %%xmm1, %%xmm0, %%xmm0")                    // xmm0 = t = x - n
+            __ASM_EMIT("vmovups         -0x04(%[src], %[off], 4), %%xmm5")          // xmm5 = p s0 s1 s2
+            __ASM_EMIT("vshufps         $0x55, %%xmm5, %%xmm5, %%xmm1")             // xmm1 = s0
+            __ASM_EMIT("vshufps         $0xaa, %%xmm5, %%xmm5, %%xmm3")             // xmm3 = s1
+            __ASM_EMIT("vshufps         $0xff, %%xmm5, %%xmm5, %%xmm2")             // xmm2 = s2
+            __ASM_EMIT("vsubss          %%xmm3, %%xmm1, %%xmm4")                    // xmm4 = d = s0 - s1
+            __ASM_EMIT("vaddss          %%xmm3, %%xmm5, %%xmm6")                    // xmm6 = p + s1
+            __ASM_EMIT("vmulss          0x40 + %[CC], %%xmm4, %%xmm4")              // xmm4 = 3*d
+            __ASM_EMIT("vsubss          %%xmm1, %%xmm6, %%xmm6")                    // xmm6 = p + s1 - s0
+            __ASM_EMIT("vaddss          %%xmm2, %%xmm4, %%xmm4")                    // xmm4 = 3*d + s2
+            __ASM_EMIT("vsubss          %%xmm1, %%xmm6, %%xmm6")                    // xmm6 = p + s1 - 2*s0
+            __ASM_EMIT("vsubss          %%xmm5, %%xmm4, %%xmm4")                    // xmm4 = c = 3*d + s2 - p
+            __ASM_EMIT("vsubss          %%xmm5, %%xmm3, %%xmm3")                    // xmm3 = a = s1 - p
+            __ASM_EMIT("vsubss          %%xmm4, %%xmm6, %%xmm6")                    // xmm6 = b = p + s1 - 2*s0 - c
+            __ASM_EMIT("vmulss          %%xmm0, %%xmm4, %%xmm4")                    // xmm4 = c*t
+            __ASM_EMIT("vaddss          %%xmm6, %%xmm4, %%xmm4")                    // xmm4 = c*t + b
+            __ASM_EMIT("vmulss          %%xmm0, %%xmm4, %%xmm4")                    // xmm4 = (c*t + b)*t
+            __ASM_EMIT("vaddss          %%xmm3, %%xmm4, %%xmm4")                    // xmm4 = (c*t + b)*t + a
+            __ASM_EMIT("vmulss          %%xmm0, %%xmm4, %%xmm4")                    // xmm4 = ((c*t + b)*t + a)*t
+            __ASM_EMIT("vmulss          0x60 + %[CC], %%xmm4, %%xmm4")              // xmm4 = 0.5*((c*t + b)*t + a)*t
+            __ASM_EMIT("vaddss          %%xmm1, %%xmm4, %%xmm4")                    // xmm4 = 0.5*((c*t + b)*t + a)*t + s0
+            __ASM_EMIT("vmovss          %%xmm4, 0x00(%[dst])")
+            __ASM_EMIT("vaddss          0x04 + %[CC], %%xmm7, %%xmm7")              // xmm7 = i + 1
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+
+            // End
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [count] "+r" (count),
+              [off] "=&r" (off)
+            : [src] "r" (src), [v] "o" (v),
+              [CC] "o" (cubic_interpolate_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    #define FMA_OFF(a, b)       a
+    #define FMA_ON(a, b)        b
+
+    #define HALFBAND_UPSAMPLE_CORE(SEL) \
+        __ASM_EMIT64("sub           $8, %[count]") \
+        __ASM_EMIT32("subl          $8, %[count]") \
+        __ASM_EMIT  ("jb            2f") \
+        /* 8x blocks */ \
+        __ASM_EMIT  ("1:") \
+        __ASM_EMIT  ("vxorps        %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = a */ \
+        __ASM_EMIT  ("vxorps        %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = b */ \
+        __ASM_EMIT  ("xor           %[off], %[off]") \
+        __ASM_EMIT  ("3:") \
+        __ASM_EMIT  ("vbroadcastss  0x00(%[k], %[off]), %%ymm4")                /* ymm4 = k[j] */ \
+        __ASM_EMIT  ("vbroadcastss  0x04(%[k], %[off]), %%ymm5")                /* ymm5 = k[j+1] */ \
+        __ASM_EMIT  (SEL("vmulps    0x00(%[src], %[off]), %%ymm4, %%ymm4", "")) \
+        __ASM_EMIT  (SEL("vmulps    0x04(%[src], %[off]), %%ymm5, %%ymm5", "")) \
+        __ASM_EMIT  (SEL("vaddps    %%ymm4, %%ymm0, %%ymm0", "vfmadd231ps 0x00(%[src], %[off]), %%ymm4, %%ymm0")) /* ymm0 = a + k[j]*s[i+j] */ \
+        __ASM_EMIT  (SEL("vaddps    %%ymm5, %%ymm1, %%ymm1", "vfmadd231ps 0x04(%[src], %[off]), %%ymm5, %%ymm1")) /* ymm1 = b + k[j+1]*s[i+j+1] */ \
+        __ASM_EMIT  ("add           $0x08, %[off]") \
+        __ASM_EMIT  ("cmp           %[tsize], %[off]") \
+        __ASM_EMIT  ("jb            3b") \
+        __ASM_EMIT  ("vaddps        %%ymm1, %%ymm0, %%ymm0")                    /* ymm0 = a0 a1 a2 a3 a4 a5 a6 a7 */ \
+        /* Interleave with central samples */ \
+        __ASM_EMIT  ("shr           $1, %[off]") \
+        __ASM_EMIT  ("vmovups       0x00(%[src], %[off]), %%ymm1")              /* ymm1 = s[i+taps/2] */ \
+        __ASM_EMIT  ("vunpcklps     %%ymm1, %%ymm0, %%ymm2")                    /* ymm2 = a0 s0 a1 s1 a4 s4 a5 s5 */ \
+        __ASM_EMIT  ("vunpckhps     %%ymm1, %%ymm0, %%ymm3")                    /* ymm3 = a2 s2 a3 s3 a6 s6 a7 s7 */ \
+        __ASM_EMIT  ("vperm2f128    $0x20, %%ymm3, %%ymm2, %%ymm0")             /* ymm0 = a0 s0 a1 s1 a2 s2 a3 s3 */ \
+        __ASM_EMIT  ("vperm2f128    $0x31, %%ymm3, %%ymm2, %%ymm1")             /* ymm1 = a4 s4 a5 s5 a6 s6 a7 s7 */ \
+        __ASM_EMIT  ("vmovups       %%ymm0, 0x00(%[dst])") \
+        __ASM_EMIT  ("vmovups       %%ymm1, 0x20(%[dst])") \
+        __ASM_EMIT  ("add           $0x20, %[src]") \
+        __ASM_EMIT  ("add           $0x40, %[dst]") \
+        __ASM_EMIT64("sub           $8, %[count]") \
+        __ASM_EMIT32("subl          $8, %[count]") \
+        __ASM_EMIT  ("jae           1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT  ("2:") \
+        __ASM_EMIT64("add           $7, %[count]") \
+        __ASM_EMIT32("addl          $7, %[count]") \
+        __ASM_EMIT  ("jl            6f") \
+        __ASM_EMIT  ("4:") \
+        __ASM_EMIT  ("vxorps        %%xmm0, %%xmm0, %%xmm0") \
+        __ASM_EMIT  ("xor           %[off], %[off]") \
+        __ASM_EMIT  ("5:") \
+        __ASM_EMIT  ("vmovups       0x00(%[k], %[off]), %%xmm4")                /* xmm4 = k[j] */ \
+        __ASM_EMIT  (SEL("vmulps    0x00(%[src], %[off]), %%xmm4, %%xmm4", "")) \
+        __ASM_EMIT  (SEL("vaddps    %%xmm4, %%xmm0, %%xmm0", "vfmadd231ps 0x00(%[src], %[off]), %%xmm4, %%xmm0")) \
+        __ASM_EMIT  ("add           $0x10, %[off]") \
+        __ASM_EMIT  ("cmp           %[tsize], %[off]") \
+        __ASM_EMIT  ("jb            5b") \
+        __ASM_EMIT  ("vhaddps       %%xmm0, %%xmm0, %%xmm0") \
+        __ASM_EMIT  ("vhaddps       %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = a */ \
+        __ASM_EMIT  ("shr           $1, %[off]") \
+        __ASM_EMIT  ("vmovss        0x00(%[src], %[off]), %%xmm1")              /* xmm1 = s[i+taps/2] */ \
+        __ASM_EMIT  ("vmovss        %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT  ("vmovss        %%xmm1, 0x04(%[dst])") \
+        __ASM_EMIT  ("add           $0x04, %[src]") \
+        __ASM_EMIT  ("add           $0x08, %[dst]") \
+        __ASM_EMIT64("dec           %[count]") \
+        __ASM_EMIT32("decl          %[count]") \
+        __ASM_EMIT  ("jge           4b") \
+        /* End */ \
+        __ASM_EMIT  ("6:") \
+        __ASM_EMIT  ("vzeroupper")
+
+    void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        IF_ARCH_X86(
+            size_t off;
+            size_t tsize    = taps * sizeof(float);
+        );
+
+        ARCH_X86_ASM
+        (
+            HALFBAND_UPSAMPLE_CORE(FMA_OFF)
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] __ASM_ARG_RW(count),
+              [off] "=&r" (off)
+            : [k] "r" (k), [tsize] "g" (tsize)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+    }
+
+    void halfband_upsample_2x_fma3(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        IF_ARCH_X86(
+            size_t off;
+            size_t tsize    = taps * sizeof(float);
+        );
+
+        ARCH_X86_ASM
+        (
+            HALFBAND_UPSAMPLE_CORE(FMA_ON)
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] __ASM_ARG_RW(count),
+              [off] "=&r" (off)
+            : [k] "r" (k), [tsize] "g" (tsize)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+    }
+
+    #undef HALFBAND_UPSAMPLE_CORE
+
+    IF_ARCH_X86(
+        static const float halfband_const[] __lsp_aligned32 =
+        {
+            0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f
+        };
+    )
+
+    /*
+     * Even samples of two adjacent vectors are gathered with the lane-local vshufps,
+     * so the 8x accumulator keeps outputs in order: o0 o1 o4 o5 o2 o3 o6 o7
+     */
+    #define HALFBAND_DOWNSAMPLE_CORE(SEL) \
+        __ASM_EMIT64("sub           $8, %[count]") \
+        __ASM_EMIT32("subl          $8, %[count]") \
+        __ASM_EMIT  ("jb            2f") \
+        /* 8x blocks */ \
+        __ASM_EMIT  ("1:") \
+        __ASM_EMIT  ("vxorps        %%ymm0, %%ymm0, %%ymm0")                    /* ymm0 = a */ \
+        __ASM_EMIT  ("vxorps        %%ymm1, %%ymm1, %%ymm1")                    /* ymm1 = b */ \
+        __ASM_EMIT  ("xor           %[off], %[off]") \
+        __ASM_EMIT  ("3:") \
+        __ASM_EMIT  ("vmovups       0x00(%[src], %[off], 2), %%ymm2") \
+        __ASM_EMIT  ("vmovups       0x08(%[src], %[off], 2), %%ymm3") \
+        __ASM_EMIT  ("vbroadcastss  0x00(%[k], %[off]), %%ymm4")                /* ymm4 = k[j] */ \
+        __ASM_EMIT  ("vbroadcastss  0x04(%[k], %[off]), %%ymm5")                /* ymm5 = k[j+1] */ \
+        __ASM_EMIT  ("vshufps       $0x88, 0x20(%[src], %[off], 2), %%ymm2, %%ymm2") /* ymm2 = s[2i+2j] */ \
+        __ASM_EMIT  ("vshufps       $0x88, 0x28(%[src], %[off], 2), %%ymm3, %%ymm3") /* ymm3 = s[2i+2j+2] */ \
+        __ASM_EMIT  (SEL("vmulps    %%ymm4, %%ymm2, %%ymm2", "")) \
+        __ASM_EMIT  (SEL("vmulps    %%ymm5, %%ymm3, %%ymm3", "")) \
+        __ASM_EMIT  (SEL("vaddps    %%ymm2, %%ymm0, %%ymm0", "vfmadd231ps %%ymm4, %%ymm2, %%ymm0")) /* ymm0 = a + k[j]*s[2i+2j] */ \
+        __ASM_EMIT  (SEL("vaddps    %%ymm3, %%ymm1, %%ymm1", "vfmadd231ps %%ymm5, %%ymm3, %%ymm1")) /* ymm1 = b + k[j+1]*s[2i+2j+2] */ \
+        __ASM_EMIT  ("add           $0x08, %[off]") \
+        __ASM_EMIT  ("cmp           %[tsize], %[off]") \
+        __ASM_EMIT  ("jb            3b") \
+        __ASM_EMIT  ("vaddps        %%ymm1, %%ymm0, %%ymm0")                    /* ymm0 = a0 a1 a4 a5 a2 a3 a6 a7 */ \
+        /* Add central samples */ \
+        __ASM_EMIT  ("vmovups       -0x04(%[src], %[off]), %%ymm1") \
+        __ASM_EMIT  ("vshufps       $0x88, 0x1c(%[src], %[off]), %%ymm1, %%ymm1") /* ymm1 = s[2i+taps-1] */ \
+        __ASM_EMIT  ("vaddps        %%ymm1, %%ymm0, %%ymm0") \
+        __ASM_EMIT  ("vmulps        %[CC], %%ymm0, %%ymm0")                     /* ymm0 = 0.5*(a + s) */ \
+        __ASM_EMIT  ("vextractf128  $1, %%ymm0, %%xmm1")                        /* xmm1 = a2 a3 a6 a7 */ \
+        __ASM_EMIT  ("vunpcklpd     %%xmm1, %%xmm0, %%xmm2")                    /* xmm2 = a0 a1 a2 a3 */ \
+        __ASM_EMIT  ("vunpckhpd     %%xmm1, %%xmm0, %%xmm3")                    /* xmm3 = a4 a5 a6 a7 */ \
+        __ASM_EMIT  ("vmovups       %%xmm2, 0x00(%[dst])") \
+        __ASM_EMIT  ("vmovups       %%xmm3, 0x10(%[dst])") \
+        __ASM_EMIT  ("add           $0x40, %[src]") \
+        __ASM_EMIT  ("add           $0x20, %[dst]") \
+        __ASM_EMIT64("sub           $8, %[count]") \
+        __ASM_EMIT32("subl          $8, %[count]") \
+        __ASM_EMIT  ("jae           1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT  ("2:") \
+        __ASM_EMIT64("add           $7, %[count]") \
+        __ASM_EMIT32("addl          $7, %[count]") \
+        __ASM_EMIT  ("jl            6f") \
+        __ASM_EMIT  ("4:") \
+        __ASM_EMIT  ("vxorps        %%xmm0, %%xmm0, %%xmm0") \
+        __ASM_EMIT  ("xor           %[off], %[off]") \
+        __ASM_EMIT  ("5:") \
+        __ASM_EMIT  ("vmovups       0x00(%[src], %[off], 2), %%xmm2") \
+        __ASM_EMIT  ("vmovups       0x00(%[k], %[off]), %%xmm4")                /* xmm4 = k[j] */ \
+        __ASM_EMIT  ("vshufps       $0x88, 0x10(%[src], %[off], 2), %%xmm2, %%xmm2") /* xmm2 = s[2i+2j] */ \
+        __ASM_EMIT  (SEL("vmulps    %%xmm4, %%xmm2, %%xmm2", "")) \
+        __ASM_EMIT  (SEL("vaddps    %%xmm2, %%xmm0, %%xmm0", "vfmadd231ps %%xmm4, %%xmm2, %%xmm0")) \
+        __ASM_EMIT  ("add           $0x10, %[off]") \
+        __ASM_EMIT  ("cmp           %[tsize], %[off]") \
+        __ASM_EMIT  ("jb            5b") \
+        __ASM_EMIT  ("vhaddps       %%xmm0, %%xmm0, %%xmm0") \
+        __ASM_EMIT  ("vhaddps       %%xmm0, %%xmm0, %%xmm0")                    /* xmm0 = a */ \
+        __ASM_EMIT  ("vaddss        -0x04(%[src], %[off]), %%xmm0, %%xmm0")     /* xmm0 = a + s[2i+taps-1] */ \
+        __ASM_EMIT  ("vmulss        %[CC], %%xmm0, %%xmm0") \
+        __ASM_EMIT  ("vmovss        %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT  ("add           $0x08, %[src]") \
+        __ASM_EMIT  ("add           $0x04, %[dst]") \
+        __ASM_EMIT64("dec           %[count]") \
+        __ASM_EMIT32("decl          %[count]") \
+        __ASM_EMIT  ("jge           4b") \
+        /* End */ \
+        __ASM_EMIT  ("6:") \
+        __ASM_EMIT  ("vzeroupper")
+
+    void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        IF_ARCH_X86(
+            size_t off;
+            size_t tsize    = taps * sizeof(float);
+        );
+
+        ARCH_X86_ASM
+        (
+            HALFBAND_DOWNSAMPLE_CORE(FMA_OFF)
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] __ASM_ARG_RW(count),
+              [off] "=&r" (off)
+            : [k] "r" (k), [tsize] "g" (tsize),
+              [CC] "o" (halfband_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+    }
+
+    void halfband_downsample_2x_fma3(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        IF_ARCH_X86(
+            size_t off;
+            size_t tsize    = taps * sizeof(float);
+        );
+
+        ARCH_X86_ASM
+        (
+            HALFBAND_DOWNSAMPLE_CORE(FMA_ON)
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] __ASM_ARG_RW(count),
+              [off] "=&r" (off)
+            : [k] "r" (k), [tsize] "g" (tsize),
+              [CC] "o" (halfband_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5"
+        );
+    }
+
+    #undef HALFBAND_DOWNSAMPLE_CORE
+
+    #undef FMA_OFF
+    #undef FMA_ON
 }
 
 #endif /* DSP_ARCH_X86_AVX_RESAMPLING_H_ */
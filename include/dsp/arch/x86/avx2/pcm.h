@@ -0,0 +1,485 @@
+/*
+ * pcm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_AVX2_PCM_H_
+#define DSP_ARCH_X86_AVX2_PCM_H_
+
+#ifndef DSP_ARCH_X86_AVX2_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_AVX2_IMPL */
+
+namespace avx2
+{
+    #define U8VEC(x)        x, x, x, x, x, x, x, x
+    #define S24_LANE(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) \
+        a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, \
+        a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p
+    IF_ARCH_X86(
+        static const float PCM_XC[] __lsp_aligned32 =
+        {
+            U8VEC(32767.0f),                // 0x00: 16-bit sample range
+            U8VEC(8388607.0f)               // 0x20: 24-bit sample range
+        };
+
+        static const double PCM_XD[] __lsp_aligned32 =
+        {
+            2147483647.0, 2147483647.0, 2147483647.0, 2147483647.0  // 0x00: 32-bit sample range
+        };
+
+        static const uint8_t PCM_S24_SHUF[] __lsp_aligned32 =
+        {
+            // 0x00: unpack little-endian samples to the high 24 bits of each dword
+            S24_LANE(0x80, 0, 1, 2, 0x80, 3, 4, 5, 0x80, 6, 7, 8, 0x80, 9, 10, 11),
+            // 0x20: unpack big-endian samples to the high 24 bits of each dword
+            S24_LANE(0x80, 2, 1, 0, 0x80, 5, 4, 3, 0x80, 8, 7, 6, 0x80, 11, 10, 9),
+            // 0x40: pack low 24 bits of each dword as little-endian samples
+            S24_LANE(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0x80, 0x80, 0x80, 0x80),
+            // 0x60: pack low 24 bits of each dword as big-endian samples
+            S24_LANE(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0x80, 0x80, 0x80, 0x80)
+        };
+    )
+    #undef S24_LANE
+    #undef U8VEC
+
+    void pcm_s16_to_f32(float *dst, const int16_t *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00 + %[XC], %%ymm7")
+            // 16x blocks
+            __ASM_EMIT("sub             $16, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vpmovsxwd       0x00(%[src]), %%ymm0")
+            __ASM_EMIT("vpmovsxwd       0x10(%[src]), %%ymm1")
+            __ASM_EMIT("vcvtdq2ps       %%ymm0, %%ymm0")
+            __ASM_EMIT("vcvtdq2ps       %%ymm1, %%ymm1")
+            __ASM_EMIT("vdivps          %%ymm7, %%ymm0, %%ymm0")
+            __ASM_EMIT("vdivps          %%ymm7, %%ymm1, %%ymm1")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("vmovups         %%ymm1, 0x20(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x40, %[dst]")
+            __ASM_EMIT("sub             $16, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 8x block
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $8, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("vpmovsxwd       0x00(%[src]), %%ymm0")
+            __ASM_EMIT("vcvtdq2ps       %%ymm0, %%ymm0")
+            __ASM_EMIT("vdivps          %%ymm7, %%ymm0, %%ymm0")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            // 1x blocks
+            __ASM_EMIT("4:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              6f")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("movswl          0x00(%[src]), %k[tmp]")
+            __ASM_EMIT("vcvtsi2ss       %k[tmp], %%xmm0, %%xmm0")
+            __ASM_EMIT("vdivss          %%xmm7, %%xmm0, %%xmm0")
+            __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x02, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             5b")
+            __ASM_EMIT("6:")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    /*
+     * The 8x block of 24-bit samples reads 28 bytes of data, so it is executed
+     * only if there are at least two more samples after the block
+     */
+    #define PCM_S24_DECODE_BODY(SHUF, X1_SWAP) \
+        __ASM_EMIT("vmovaps         0x20 + %[XC], %%ymm7") \
+        __ASM_EMIT("vmovdqa         " SHUF " + %[XS], %%ymm6") \
+        /* 8x blocks */ \
+        __ASM_EMIT("sub             $10, %[count]") \
+        __ASM_EMIT("jb              2f") \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("vmovdqu         0x00(%[src]), %%xmm0")                  /* xmm0 = b0 .. b11 ? */ \
+        __ASM_EMIT("vinserti128     $1, 0x0c(%[src]), %%ymm0, %%ymm0")      /* ymm0 = b0 .. b11 ? b12 .. b23 ? */ \
+        __ASM_EMIT("vpshufb         %%ymm6, %%ymm0, %%ymm0")                /* ymm0 = v0 << 8 .. v7 << 8 */ \
+        __ASM_EMIT("vpsrad          $8, %%ymm0, %%ymm0") \
+        __ASM_EMIT("vcvtdq2ps       %%ymm0, %%ymm0") \
+        __ASM_EMIT("vdivps          %%ymm7, %%ymm0, %%ymm0") \
+        __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])") \
+        __ASM_EMIT("add             $0x18, %[src]") \
+        __ASM_EMIT("add             $0x20, %[dst]") \
+        __ASM_EMIT("sub             $8, %[count]") \
+        __ASM_EMIT("jae             1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add             $9, %[count]") \
+        __ASM_EMIT("jl              4f") \
+        __ASM_EMIT("3:") \
+        X1_SWAP \
+        __ASM_EMIT("vcvtsi2ss       %k[tmp], %%xmm0, %%xmm0") \
+        __ASM_EMIT("vdivss          %%xmm7, %%xmm0, %%xmm0") \
+        __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT("add             $0x03, %[src]") \
+        __ASM_EMIT("add             $0x04, %[dst]") \
+        __ASM_EMIT("dec             %[count]") \
+        __ASM_EMIT("jge             3b") \
+        __ASM_EMIT("4:") \
+        __ASM_EMIT("vzeroupper")
+
+    void pcm_s24le_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_DECODE_BODY(
+                "0x00",
+                __ASM_EMIT("movsbl          0x02(%[src]), %k[tmp]")
+                __ASM_EMIT("shl             $16, %k[tmp]")
+                __ASM_EMIT("mov             0x00(%[src]), %w[tmp]")     // tmp = int(b0 b1 b2)
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC), [XS] "o" (PCM_S24_SHUF)
+            : "cc", "memory",
+              "%xmm0", "%xmm6", "%xmm7"
+        );
+    }
+
+    void pcm_s24be_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_DECODE_BODY(
+                "0x20",
+                __ASM_EMIT("movsbl          0x00(%[src]), %k[tmp]")
+                __ASM_EMIT("shl             $16, %k[tmp]")
+                __ASM_EMIT("mov             0x01(%[src]), %w[tmp]")
+                __ASM_EMIT("rol             $8, %w[tmp]")               // tmp = int(b0 b1 b2)
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC), [XS] "o" (PCM_S24_SHUF)
+            : "cc", "memory",
+              "%xmm0", "%xmm6", "%xmm7"
+        );
+    }
+
+    #undef PCM_S24_DECODE_BODY
+
+    void pcm_s32_to_f32(float *dst, const int32_t *src, size_t count)
+    {
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovapd         0x00 + %[XD], %%ymm7")
+            // 8x blocks
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vcvtdq2pd       0x00(%[src]), %%ymm0")          // ymm0 = double(s0 .. s3)
+            __ASM_EMIT("vcvtdq2pd       0x10(%[src]), %%ymm1")          // ymm1 = double(s4 .. s7)
+            __ASM_EMIT("vdivpd          %%ymm7, %%ymm0, %%ymm0")
+            __ASM_EMIT("vdivpd          %%ymm7, %%ymm1, %%ymm1")
+            __ASM_EMIT("vcvtpd2ps       %%ymm0, %%xmm0")
+            __ASM_EMIT("vcvtpd2ps       %%ymm1, %%xmm1")
+            __ASM_EMIT("vinsertf128     $1, %%xmm1, %%ymm0, %%ymm0")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("vcvtsi2sdl      0x00(%[src]), %%xmm0, %%xmm0")
+            __ASM_EMIT("vdivsd          %%xmm7, %%xmm0, %%xmm0")
+            __ASM_EMIT("vcvtsd2ss       %%xmm0, %%xmm0, %%xmm0")
+            __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [XD] "o" (PCM_XD)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    void pcm_f64_to_f32(float *dst, const double *src, size_t count)
+    {
+        ARCH_X86_ASM
+        (
+            // 8x blocks
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vcvtpd2psy      0x00(%[src]), %%xmm0")
+            __ASM_EMIT("vcvtpd2psy      0x20(%[src]), %%xmm1")
+            __ASM_EMIT("vinsertf128     $1, %%xmm1, %%ymm0, %%ymm0")
+            __ASM_EMIT("vmovups         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x40, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("vcvtsd2ss       0x00(%[src]), %%xmm0, %%xmm0")
+            __ASM_EMIT("vmovss          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x08, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1"
+        );
+    }
+
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovaps         0x00 + %[XC], %%ymm7")
+            // 16x blocks
+            __ASM_EMIT("sub             $16, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vmulps          0x00(%[src]), %%ymm7, %%ymm0")
+            __ASM_EMIT("vmulps          0x20(%[src]), %%ymm7, %%ymm1")
+            __ASM_EMIT("vcvttps2dq      %%ymm0, %%ymm0")
+            __ASM_EMIT("vcvttps2dq      %%ymm1, %%ymm1")
+            __ASM_EMIT("vpackssdw       %%ymm1, %%ymm0, %%ymm0")        // ymm0 = s0 .. s3 s8 .. s11 s4 .. s7 s12 .. s15
+            __ASM_EMIT("vpermq          $0xd8, %%ymm0, %%ymm0")         // ymm0 = s0 .. s15
+            __ASM_EMIT("vmovdqu         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x40, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $16, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 8x block
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $8, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("vmulps          0x00(%[src]), %%ymm7, %%ymm0")
+            __ASM_EMIT("vcvttps2dq      %%ymm0, %%ymm0")
+            __ASM_EMIT("vextracti128    $1, %%ymm0, %%xmm1")
+            __ASM_EMIT("vpackssdw       %%xmm1, %%xmm0, %%xmm0")
+            __ASM_EMIT("vmovdqu         %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            // 1x blocks
+            __ASM_EMIT("4:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              6f")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("vmulss          0x00(%[src]), %%xmm7, %%xmm0")
+            __ASM_EMIT("vcvttss2si      %%xmm0, %k[tmp]")
+            __ASM_EMIT("mov             %w[tmp], 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x02, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             5b")
+            __ASM_EMIT("6:")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    /*
+     * The 8x block of 24-bit samples writes 28 bytes of data, so it is executed
+     * only if there are at least two more samples after the block which overwrite
+     * the extra bytes
+     */
+    #define PCM_S24_ENCODE_BODY(SHUF, X1_SWAP) \
+        __ASM_EMIT("vmovaps         0x20 + %[XC], %%ymm7") \
+        __ASM_EMIT("vmovdqa         " SHUF " + %[XS], %%ymm6") \
+        /* 8x blocks */ \
+        __ASM_EMIT("sub             $10, %[count]") \
+        __ASM_EMIT("jb              2f") \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("vmulps          0x00(%[src]), %%ymm7, %%ymm0") \
+        __ASM_EMIT("vcvttps2dq      %%ymm0, %%ymm0")                        /* ymm0 = v0 .. v7 */ \
+        __ASM_EMIT("vpshufb         %%ymm6, %%ymm0, %%ymm0")                /* ymm0 = b0 .. b11 ? b12 .. b23 ? */ \
+        __ASM_EMIT("vmovdqu         %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT("vextracti128    $1, %%ymm0, 0x0c(%[dst])") \
+        __ASM_EMIT("add             $0x20, %[src]") \
+        __ASM_EMIT("add             $0x18, %[dst]") \
+        __ASM_EMIT("sub             $8, %[count]") \
+        __ASM_EMIT("jae             1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add             $9, %[count]") \
+        __ASM_EMIT("jl              4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("vmulss          0x00(%[src]), %%xmm7, %%xmm0") \
+        __ASM_EMIT("vcvttss2si      %%xmm0, %k[tmp]") \
+        X1_SWAP \
+        __ASM_EMIT("mov             %w[tmp], 0x00(%[dst])") \
+        __ASM_EMIT("shr             $8, %k[tmp]") \
+        __ASM_EMIT("mov             %w[tmp], 0x01(%[dst])") \
+        __ASM_EMIT("add             $0x04, %[src]") \
+        __ASM_EMIT("add             $0x03, %[dst]") \
+        __ASM_EMIT("dec             %[count]") \
+        __ASM_EMIT("jge             3b") \
+        __ASM_EMIT("4:") \
+        __ASM_EMIT("vzeroupper")
+
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_ENCODE_BODY("0x40", "")
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC), [XS] "o" (PCM_S24_SHUF)
+            : "cc", "memory",
+              "%xmm0", "%xmm6", "%xmm7"
+        );
+    }
+
+    void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_ENCODE_BODY(
+                "0x60",
+                __ASM_EMIT("bswap           %k[tmp]")
+                __ASM_EMIT("shr             $8, %k[tmp]")               // tmp = b2 b1 b0 0
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC), [XS] "o" (PCM_S24_SHUF)
+            : "cc", "memory",
+              "%xmm0", "%xmm6", "%xmm7"
+        );
+    }
+
+    #undef PCM_S24_ENCODE_BODY
+
+    void pcm_f32_to_s32(int32_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("vmovapd         0x00 + %[XD], %%ymm7")
+            // 8x blocks
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vcvtps2pd       0x00(%[src]), %%ymm0")          // ymm0 = double(s0 .. s3)
+            __ASM_EMIT("vcvtps2pd       0x10(%[src]), %%ymm1")          // ymm1 = double(s4 .. s7)
+            __ASM_EMIT("vmulpd          %%ymm7, %%ymm0, %%ymm0")
+            __ASM_EMIT("vmulpd          %%ymm7, %%ymm1, %%ymm1")
+            __ASM_EMIT("vcvttpd2dq      %%ymm0, %%xmm0")
+            __ASM_EMIT("vcvttpd2dq      %%ymm1, %%xmm1")
+            __ASM_EMIT("vinserti128     $1, %%xmm1, %%ymm0, %%ymm0")
+            __ASM_EMIT("vmovdqu         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("vcvtss2sd       0x00(%[src]), %%xmm0, %%xmm0")
+            __ASM_EMIT("vmulsd          %%xmm7, %%xmm0, %%xmm0")
+            __ASM_EMIT("vcvttsd2si      %%xmm0, %k[tmp]")
+            __ASM_EMIT("mov             %k[tmp], 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XD] "o" (PCM_XD)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    void pcm_f32_to_f64(double *dst, const float *src, size_t count)
+    {
+        ARCH_X86_ASM
+        (
+            // 8x blocks
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("vcvtps2pd       0x00(%[src]), %%ymm0")
+            __ASM_EMIT("vcvtps2pd       0x10(%[src]), %%ymm1")
+            __ASM_EMIT("vmovupd         %%ymm0, 0x00(%[dst])")
+            __ASM_EMIT("vmovupd         %%ymm1, 0x20(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x40, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $7, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("vcvtss2sd       0x00(%[src]), %%xmm0, %%xmm0")
+            __ASM_EMIT("vmovsd          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x08, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+            __ASM_EMIT("vzeroupper")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_X86_AVX2_PCM_H_ */
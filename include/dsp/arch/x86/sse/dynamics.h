@@ -0,0 +1,121 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE_DYNAMICS_H_
+#define DSP_ARCH_X86_SSE_DYNAMICS_H_
+
+#ifndef DSP_ARCH_X86_SSE_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE_IMPL */
+
+namespace sse
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[e]), %%xmm0")                // xmm0 = e
+            __ASM_EMIT("movaps      0x10(%[e]), %%xmm5")                // xmm5 = a
+            __ASM_EMIT("movaps      0x20(%[e]), %%xmm6")                // xmm6 = r
+            __ASM_EMIT("movaps      0x30(%[e]), %%xmm7")                // xmm7 = t
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      0x00(%[src]), %%xmm1")              // xmm1 = s
+            __ASM_EMIT("movaps      %%xmm7, %%xmm3")                    // xmm3 = t
+            __ASM_EMIT("movaps      %%xmm1, %%xmm2")                    // xmm2 = s
+            __ASM_EMIT("cmpltps     %%xmm0, %%xmm3")                    // xmm3 = [t < e]
+            __ASM_EMIT("cmpleps     %%xmm0, %%xmm1")                    // xmm1 = [s <= e]
+            __ASM_EMIT("subps       %%xmm0, %%xmm2")                    // xmm2 = s - e
+            __ASM_EMIT("andps       %%xmm3, %%xmm1")                    // xmm1 = M = [t < e] & [s <= e]
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                    // xmm3 = M
+            __ASM_EMIT("andps       %%xmm6, %%xmm1")                    // xmm1 = r & M
+            __ASM_EMIT("andnps      %%xmm5, %%xmm3")                    // xmm3 = a & ~M
+            __ASM_EMIT("orps        %%xmm3, %%xmm1")                    // xmm1 = tau = (r & M) | (a & ~M)
+            __ASM_EMIT("mulps       %%xmm1, %%xmm2")                    // xmm2 = tau * (s - e)
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")                    // xmm0 = e' = e + tau * (s - e)
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add         $0x10, %[src]")
+            __ASM_EMIT("add         $0x10, %[dst]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            __ASM_EMIT("movaps      %%xmm0, 0x00(%[e])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [e] "r" (e)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[e]), %%xmm0")                // xmm0 = e0
+            __ASM_EMIT("movaps      0x10(%[e]), %%xmm4")                // xmm4 = e1
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      0x00(%[src]), %%xmm1")              // xmm1 = s0
+            __ASM_EMIT("movups      0x10(%[src]), %%xmm5")              // xmm5 = s1
+            __ASM_EMIT("movaps      0x60(%[e]), %%xmm3")                // xmm3 = t0
+            __ASM_EMIT("movaps      0x70(%[e]), %%xmm7")                // xmm7 = t1
+            __ASM_EMIT("movaps      %%xmm1, %%xmm2")                    // xmm2 = s0
+            __ASM_EMIT("movaps      %%xmm5, %%xmm6")                    // xmm6 = s1
+            __ASM_EMIT("cmpltps     %%xmm0, %%xmm3")                    // xmm3 = [t0 < e0]
+            __ASM_EMIT("cmpltps     %%xmm4, %%xmm7")                    // xmm7 = [t1 < e1]
+            __ASM_EMIT("cmpleps     %%xmm0, %%xmm1")                    // xmm1 = [s0 <= e0]
+            __ASM_EMIT("cmpleps     %%xmm4, %%xmm5")                    // xmm5 = [s1 <= e1]
+            __ASM_EMIT("subps       %%xmm0, %%xmm2")                    // xmm2 = s0 - e0
+            __ASM_EMIT("subps       %%xmm4, %%xmm6")                    // xmm6 = s1 - e1
+            __ASM_EMIT("andps       %%xmm3, %%xmm1")                    // xmm1 = M0 = [t0 < e0] & [s0 <= e0]
+            __ASM_EMIT("andps       %%xmm7, %%xmm5")                    // xmm5 = M1 = [t1 < e1] & [s1 <= e1]
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                    // xmm3 = M0
+            __ASM_EMIT("movaps      %%xmm5, %%xmm7")                    // xmm7 = M1
+            __ASM_EMIT("andps       0x40(%[e]), %%xmm1")                // xmm1 = r0 & M0
+            __ASM_EMIT("andps       0x50(%[e]), %%xmm5")                // xmm5 = r1 & M1
+            __ASM_EMIT("andnps      0x20(%[e]), %%xmm3")                // xmm3 = a0 & ~M0
+            __ASM_EMIT("andnps      0x30(%[e]), %%xmm7")                // xmm7 = a1 & ~M1
+            __ASM_EMIT("orps        %%xmm3, %%xmm1")                    // xmm1 = tau0 = (r0 & M0) | (a0 & ~M0)
+            __ASM_EMIT("orps        %%xmm7, %%xmm5")                    // xmm5 = tau1 = (r1 & M1) | (a1 & ~M1)
+            __ASM_EMIT("mulps       %%xmm1, %%xmm2")                    // xmm2 = tau0 * (s0 - e0)
+            __ASM_EMIT("mulps       %%xmm5, %%xmm6")                    // xmm6 = tau1 * (s1 - e1)
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")                    // xmm0 = e0' = e0 + tau0 * (s0 - e0)
+            __ASM_EMIT("addps       %%xmm6, %%xmm4")                    // xmm4 = e1' = e1 + tau1 * (s1 - e1)
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("movups      %%xmm4, 0x10(%[dst])")
+            __ASM_EMIT("add         $0x20, %[src]")
+            __ASM_EMIT("add         $0x20, %[dst]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            __ASM_EMIT("movaps      %%xmm0, 0x00(%[e])")
+            __ASM_EMIT("movaps      %%xmm4, 0x10(%[e])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [e] "r" (e)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_X86_SSE_DYNAMICS_H_ */
@@ -42,6 +42,12 @@ namespace sse
         // Do reverse FFT
         fastconv_restore_internal(dst, tmp, rank);
     }
+
+    void fastconv_mul_add(float *dst, const float *c1, const float *c2, size_t rank)
+    {
+        // Apply complex convolution and add to the accumulator
+        fastconv_mul_add_internal(dst, c1, c2, rank);
+    }
 }
 
 #undef DSP_ARCH_X86_SSE_FASTCONV_H_IMPL
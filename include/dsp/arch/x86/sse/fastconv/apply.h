@@ -111,4 +111,50 @@ namespace sse
         );
 
     }
+
+    static inline void fastconv_mul_add_internal(float *dst, const float *c1, const float *c2, size_t rank)
+    {
+        size_t items    = size_t(1) << (rank + 1);
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("1:")
+
+            // Load data
+            __ASM_EMIT("movups      0x00(%[c1]), %%xmm0")       /* xmm0 = ar0 ar1 ar2 ar3 */
+            __ASM_EMIT("movups      0x10(%[c1]), %%xmm1")       /* xmm1 = ai0 ai1 ai2 ai3 */
+            __ASM_EMIT("movups      0x00(%[c2]), %%xmm2")       /* xmm2 = br0 br1 br2 br3 */
+            __ASM_EMIT("movups      0x10(%[c2]), %%xmm3")       /* xmm3 = bi0 bi1 bi2 bi3 */
+
+            // Do complex multiplication
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")            /* xmm4 = ar */
+            __ASM_EMIT("mulps       %%xmm2, %%xmm0")            /* xmm0 = ar*br */
+            __ASM_EMIT("mulps       %%xmm3, %%xmm4")            /* xmm4 = ar*bi */
+            __ASM_EMIT("mulps       %%xmm1, %%xmm3")            /* xmm3 = ai*bi */
+            __ASM_EMIT("mulps       %%xmm1, %%xmm2")            /* xmm2 = ai*br */
+            __ASM_EMIT("movups      0x00(%[dst]), %%xmm5")      /* xmm5 = dr */
+            __ASM_EMIT("movups      0x10(%[dst]), %%xmm6")      /* xmm6 = di */
+            __ASM_EMIT("subps       %%xmm3, %%xmm0")            /* xmm0 = ar*br - ai*bi */
+            __ASM_EMIT("addps       %%xmm4, %%xmm2")            /* xmm2 = ai*br + ar*bi */
+
+            // Add to the accumulator
+            __ASM_EMIT("addps       %%xmm5, %%xmm0")            /* xmm0 = dr + ar*br - ai*bi */
+            __ASM_EMIT("addps       %%xmm6, %%xmm2")            /* xmm2 = di + ai*br + ar*bi */
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("movups      %%xmm2, 0x10(%[dst])")
+
+            // Move pointers and repeat loop
+            __ASM_EMIT("add         $0x20, %[c1]")
+            __ASM_EMIT("add         $0x20, %[c2]")
+            __ASM_EMIT("add         $0x20, %[dst]")
+            __ASM_EMIT("sub         $8, %[items]")
+            __ASM_EMIT("jnz         1b")
+
+            : [dst] "+r" (dst), [c1] "+r" (c1), [c2] "+r" (c2), [items] "+r" (items)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6"
+        );
+    }
 }
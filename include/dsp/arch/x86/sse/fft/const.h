@@ -35,7 +35,10 @@ namespace sse
         X4VEC(0.9999999264657179f),
         X4VEC(0.9999999816164293f),
         X4VEC(0.9999999954041073f),
-        X4VEC(0.9999999988510268f)
+        X4VEC(0.9999999988510268f),
+        X4VEC(0.9999999997127567f),
+        X4VEC(0.9999999999281892f),
+        X4VEC(0.9999999999820472f)
     };
 
     static const float XFFT_W_IM[] __lsp_aligned16 =
@@ -56,7 +59,10 @@ namespace sse
         X4VEC(0.0003834951875714f),
         X4VEC(0.0001917475973107f),
         X4VEC(0.0000958737990960f),
-        X4VEC(0.0000479368996031f)
+        X4VEC(0.0000479368996031f),
+        X4VEC(0.0000239684498084f),
+        X4VEC(0.0000119842249051f),
+        X4VEC(0.0000059921124526f)
     };
 
     static const float XFFT_W[] __lsp_aligned16 =
@@ -77,7 +83,10 @@ namespace sse
         X4VEC(0.9999999264657179f), X4VEC(0.0003834951875714f),
         X4VEC(0.9999999816164293f), X4VEC(0.0001917475973107f),
         X4VEC(0.9999999954041073f), X4VEC(0.0000958737990960f),
-        X4VEC(0.9999999988510268f), X4VEC(0.0000479368996031f)
+        X4VEC(0.9999999988510268f), X4VEC(0.0000479368996031f),
+        X4VEC(0.9999999997127567f), X4VEC(0.0000239684498084f),
+        X4VEC(0.9999999999281892f), X4VEC(0.0000119842249051f),
+        X4VEC(0.9999999999820472f), X4VEC(0.0000059921124526f)
     };
 
 #undef X4VEC
@@ -98,7 +107,10 @@ namespace sse
         1.0000000000000000f, 0.9999999264657179f, 0.9999997058628822f, 0.9999993381915255f,
         1.0000000000000000f, 0.9999999816164293f, 0.9999999264657179f, 0.9999998345478677f,
         1.0000000000000000f, 0.9999999954041073f, 0.9999999816164293f, 0.9999999586369661f,
-        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f
+        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f,
+        1.0000000000000000f, 0.9999999997127567f, 0.9999999988510269f, 0.9999999974148104f,
+        1.0000000000000000f, 0.9999999999281892f, 0.9999999997127567f, 0.9999999993537025f,
+        1.0000000000000000f, 0.9999999999820472f, 0.9999999999281892f, 0.9999999998384257f
     };
 
     static const float XFFT_A_IM[] __lsp_aligned16 =
@@ -117,7 +129,10 @@ namespace sse
         0.0000000000000000f, 0.0003834951875714f, 0.0007669903187427f, 0.0011504853371138f,
         0.0000000000000000f, 0.0001917475973107f, 0.0003834951875714f, 0.0005752427637321f,
         0.0000000000000000f, 0.0000958737990960f, 0.0001917475973107f, 0.0002876213937629f,
-        0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f
+        0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f,
+        0.0000000000000000f, 0.0000239684498084f, 0.0000479368996031f, 0.0000719053493702f,
+        0.0000000000000000f, 0.0000119842249051f, 0.0000239684498084f, 0.0000359526747083f,
+        0.0000000000000000f, 0.0000059921124526f, 0.0000119842249051f, 0.0000179763373571f
     };
 
     static const float XFFT_A[] __lsp_aligned16 =
@@ -136,7 +151,10 @@ namespace sse
         1.0000000000000000f, 0.9999999264657179f, 0.9999997058628822f, 0.9999993381915255f, 0.0000000000000000f, 0.0003834951875714f, 0.0007669903187427f, 0.0011504853371138f,
         1.0000000000000000f, 0.9999999816164293f, 0.9999999264657179f, 0.9999998345478677f, 0.0000000000000000f, 0.0001917475973107f, 0.0003834951875714f, 0.0005752427637321f,
         1.0000000000000000f, 0.9999999954041073f, 0.9999999816164293f, 0.9999999586369661f, 0.0000000000000000f, 0.0000958737990960f, 0.0001917475973107f, 0.0002876213937629f,
-        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f, 0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f
+        1.0000000000000000f, 0.9999999988510268f, 0.9999999954041073f, 0.9999999896592415f, 0.0000000000000000f, 0.0000479368996031f, 0.0000958737990960f, 0.0001438106983686f,
+        1.0000000000000000f, 0.9999999997127567f, 0.9999999988510269f, 0.9999999974148104f, 0.0000000000000000f, 0.0000239684498084f, 0.0000479368996031f, 0.0000719053493702f,
+        1.0000000000000000f, 0.9999999999281892f, 0.9999999997127567f, 0.9999999993537025f, 0.0000000000000000f, 0.0000119842249051f, 0.0000239684498084f, 0.0000359526747083f,
+        1.0000000000000000f, 0.9999999999820472f, 0.9999999999281892f, 0.9999999998384257f, 0.0000000000000000f, 0.0000059921124526f, 0.0000119842249051f, 0.0000179763373571f
     };
 }
 
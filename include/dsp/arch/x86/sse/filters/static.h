@@ -661,6 +661,188 @@ namespace sse
               "%xmm4", "%xmm5", "%xmm6", "%xmm7"
         );
     }
+
+    // Compute one step of 4 lanes of filters:
+    //   input:  xmm0 = d0, xmm1 = d1, xmm2 = s
+    //   output: xmm3 = s2, xmm4 = d0', xmm2 = d1'
+    #define BIQUAD_I4_STEP \
+        __ASM_EMIT("movaps      %%xmm2, %%xmm3")                                /* xmm3 = s */ \
+        __ASM_EMIT("movaps      %%xmm2, %%xmm4")                                /* xmm4 = s */ \
+        __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x00(%[f]), %%xmm3")       /* xmm3 = b0*s */ \
+        __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x10(%[f]), %%xmm4")       /* xmm4 = b1*s */ \
+        __ASM_EMIT("addps       %%xmm0, %%xmm3")                                /* xmm3 = s2 = b0*s + d0 */ \
+        __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x20(%[f]), %%xmm2")       /* xmm2 = b2*s */ \
+        __ASM_EMIT("movaps      %%xmm3, %%xmm5")                                /* xmm5 = s2 */ \
+        __ASM_EMIT("movaps      %%xmm3, %%xmm6")                                /* xmm6 = s2 */ \
+        __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x30(%[f]), %%xmm5")       /* xmm5 = a1*s2 */ \
+        __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x40(%[f]), %%xmm6")       /* xmm6 = a2*s2 */ \
+        __ASM_EMIT("addps       %%xmm1, %%xmm4")                                /* xmm4 = d1 + b1*s */ \
+        __ASM_EMIT("addps       %%xmm6, %%xmm2")                                /* xmm2 = d1' = b2*s + a2*s2 */ \
+        __ASM_EMIT("addps       %%xmm5, %%xmm4")                                /* xmm4 = d0' = d1 + b1*s + a1*s2 */
+
+    void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[f]), %%xmm0")                        // xmm0 = d0
+            __ASM_EMIT("movaps      0x10(%[f]), %%xmm1")                        // xmm1 = d1
+
+            // First filter only
+            __ASM_EMIT("xorps       %%xmm2, %%xmm2")                            // xmm2 = 0 0 0 0
+            __ASM_EMIT("movlps      0x00(%[src]), %%xmm2")                      // xmm2 = s0 s1 0 0
+            BIQUAD_I4_STEP
+            __ASM_EMIT("shufps      $0xe4, %%xmm0, %%xmm4")                     // xmm4 = d0'[0] d0'[1] d0[2] d0[3]
+            __ASM_EMIT("shufps      $0xe4, %%xmm1, %%xmm2")                     // xmm2 = d1'[0] d1'[1] d1[2] d1[3]
+            __ASM_EMIT("movaps      %%xmm4, %%xmm0")                            // xmm0 = d0
+            __ASM_EMIT("movaps      %%xmm2, %%xmm1")                            // xmm1 = d1
+            __ASM_EMIT("add         $0x08, %[src]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jz          2f")
+
+            // Both filters, the second filter processes the output of the first filter
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movlhps     %%xmm3, %%xmm2")                            // xmm2 = ? ? s2[0] s2[1]
+            __ASM_EMIT("movlps      0x00(%[src]), %%xmm2")                      // xmm2 = s0 s1 s2[0] s2[1]
+            BIQUAD_I4_STEP
+            __ASM_EMIT("movhps      %%xmm3, 0x00(%[dst])")                      // *dst = s2[2] s2[3]
+            __ASM_EMIT("movaps      %%xmm4, %%xmm0")                            // xmm0 = d0
+            __ASM_EMIT("movaps      %%xmm2, %%xmm1")                            // xmm1 = d1
+            __ASM_EMIT("add         $0x08, %[src]")
+            __ASM_EMIT("add         $0x08, %[dst]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            // Second filter only
+            __ASM_EMIT("2:")
+            __ASM_EMIT("xorps       %%xmm2, %%xmm2")                            // xmm2 = 0 0 0 0
+            __ASM_EMIT("movlhps     %%xmm3, %%xmm2")                            // xmm2 = 0 0 s2[0] s2[1]
+            BIQUAD_I4_STEP
+            __ASM_EMIT("movhps      %%xmm3, 0x00(%[dst])")                      // *dst = s2[2] s2[3]
+            __ASM_EMIT("shufps      $0xe4, %%xmm4, %%xmm0")                     // xmm0 = d0[0] d0[1] d0'[2] d0'[3]
+            __ASM_EMIT("shufps      $0xe4, %%xmm2, %%xmm1")                     // xmm1 = d1[0] d1[1] d1'[2] d1'[3]
+            __ASM_EMIT("movaps      %%xmm0, 0x00(%[f])")
+            __ASM_EMIT("movaps      %%xmm1, 0x10(%[f])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [f] "r" (f)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6"
+        );
+    }
+
+    void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[f]), %%xmm0")                        // xmm0 = d0
+            __ASM_EMIT("movaps      0x10(%[f]), %%xmm1")                        // xmm1 = d1
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      0x00(%[src]), %%xmm2")                      // xmm2 = s
+            BIQUAD_I4_STEP
+            __ASM_EMIT("movups      %%xmm3, 0x00(%[dst])")                      // *dst = s2
+            __ASM_EMIT("movaps      %%xmm4, %%xmm0")                            // xmm0 = d0
+            __ASM_EMIT("movaps      %%xmm2, %%xmm1")                            // xmm1 = d1
+            __ASM_EMIT("add         $0x10, %[src]")
+            __ASM_EMIT("add         $0x10, %[dst]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            __ASM_EMIT("movaps      %%xmm0, 0x00(%[f])")
+            __ASM_EMIT("movaps      %%xmm1, 0x10(%[f])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [f] "r" (f)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6"
+        );
+    }
+
+    #undef BIQUAD_I4_STEP
+
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f)
+    {
+        if (count <= 0)
+            return;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00(%[f]), %%xmm0")                        // xmm0 = d0[0..3]
+            __ASM_EMIT("movaps      0x10(%[f]), %%xmm1")                        // xmm1 = d0[4..7]
+            __ASM_EMIT("movaps      0x20(%[f]), %%xmm2")                        // xmm2 = d1[0..3]
+            __ASM_EMIT("movaps      0x30(%[f]), %%xmm3")                        // xmm3 = d1[4..7]
+
+            __ASM_EMIT("1:")
+            // Lanes 0..3
+            __ASM_EMIT("movups      0x00(%[src]), %%xmm4")                      // xmm4 = s
+            __ASM_EMIT("movaps      %%xmm4, %%xmm5")                            // xmm5 = s
+            __ASM_EMIT("movaps      %%xmm4, %%xmm6")                            // xmm6 = s
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x00(%[f]), %%xmm5")   // xmm5 = b0*s
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x20(%[f]), %%xmm6")   // xmm6 = b1*s
+            __ASM_EMIT("addps       %%xmm0, %%xmm5")                            // xmm5 = s2 = b0*s + d0
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x40(%[f]), %%xmm4")   // xmm4 = b2*s
+            __ASM_EMIT("addps       %%xmm2, %%xmm6")                            // xmm6 = d1 + b1*s
+            __ASM_EMIT("movups      %%xmm5, 0x00(%[dst])")                      // *dst = s2
+            __ASM_EMIT("movaps      %%xmm5, %%xmm7")                            // xmm7 = s2
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x60(%[f]), %%xmm5")   // xmm5 = a1*s2
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x80(%[f]), %%xmm7")   // xmm7 = a2*s2
+            __ASM_EMIT("addps       %%xmm6, %%xmm5")                            // xmm5 = d0' = d1 + b1*s + a1*s2
+            __ASM_EMIT("addps       %%xmm4, %%xmm7")                            // xmm7 = d1' = b2*s + a2*s2
+            __ASM_EMIT("movaps      %%xmm5, %%xmm0")                            // xmm0 = d0
+            __ASM_EMIT("movaps      %%xmm7, %%xmm2")                            // xmm2 = d1
+            // Lanes 4..7
+            __ASM_EMIT("movups      0x10(%[src]), %%xmm4")                      // xmm4 = s
+            __ASM_EMIT("movaps      %%xmm4, %%xmm5")                            // xmm5 = s
+            __ASM_EMIT("movaps      %%xmm4, %%xmm6")                            // xmm6 = s
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x10(%[f]), %%xmm5")   // xmm5 = b0*s
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x30(%[f]), %%xmm6")   // xmm6 = b1*s
+            __ASM_EMIT("addps       %%xmm1, %%xmm5")                            // xmm5 = s2 = b0*s + d0
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x50(%[f]), %%xmm4")   // xmm4 = b2*s
+            __ASM_EMIT("addps       %%xmm3, %%xmm6")                            // xmm6 = d1 + b1*s
+            __ASM_EMIT("movups      %%xmm5, 0x10(%[dst])")                      // *dst = s2
+            __ASM_EMIT("movaps      %%xmm5, %%xmm7")                            // xmm7 = s2
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x70(%[f]), %%xmm5")   // xmm5 = a1*s2
+            __ASM_EMIT("mulps       " BIQUAD_XN_SOFF " + 0x90(%[f]), %%xmm7")   // xmm7 = a2*s2
+            __ASM_EMIT("addps       %%xmm6, %%xmm5")                            // xmm5 = d0' = d1 + b1*s + a1*s2
+            __ASM_EMIT("addps       %%xmm4, %%xmm7")                            // xmm7 = d1' = b2*s + a2*s2
+            __ASM_EMIT("movaps      %%xmm5, %%xmm1")                            // xmm1 = d0
+            __ASM_EMIT("movaps      %%xmm7, %%xmm3")                            // xmm3 = d1
+
+            __ASM_EMIT("add         $0x20, %[src]")
+            __ASM_EMIT("add         $0x20, %[dst]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            __ASM_EMIT("movaps      %%xmm0, 0x00(%[f])")
+            __ASM_EMIT("movaps      %%xmm1, 0x10(%[f])")
+            __ASM_EMIT("movaps      %%xmm2, 0x20(%[f])")
+            __ASM_EMIT("movaps      %%xmm3, 0x30(%[f])")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              __IF_64([count] "+r" (count))
+              __IF_32([count] "+g" (count))
+            : [f] "r" (f)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_FILTERS_STATIC_H_ */
@@ -1201,6 +1201,44 @@ namespace sse
             : "cc", "memory"
         );
     }
+
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count)
+    {
+        if (count <= 0)
+            return;
+
+        float k         = 1.0f / count;
+        IF_ARCH_X86(stride *= sizeof(f_cascade_t));
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movups      0x00(%[c1]), %%xmm0")       // xmm0 = t1
+            __ASM_EMIT("movups      0x10(%[c1]), %%xmm1")       // xmm1 = b1
+            __ASM_EMIT("movups      0x00(%[c2]), %%xmm2")       // xmm2 = t2
+            __ASM_EMIT("movups      0x10(%[c2]), %%xmm3")       // xmm3 = b2
+            __ASM_EMIT("shufps      $0x00, %[k], %[k]")         // k    = 1/count
+            __ASM_EMIT("subps       %%xmm0, %%xmm2")            // xmm2 = t2 - t1
+            __ASM_EMIT("subps       %%xmm1, %%xmm3")            // xmm3 = b2 - b1
+            __ASM_EMIT("mulps       %[k], %%xmm2")              // xmm2 = dt = (t2 - t1)/count
+            __ASM_EMIT("mulps       %[k], %%xmm3")              // xmm3 = db = (b2 - b1)/count
+
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("movups      %%xmm1, 0x10(%[dst])")
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")            // xmm0 = t + dt
+            __ASM_EMIT("addps       %%xmm3, %%xmm1")            // xmm1 = b + db
+            __ASM_EMIT("add         %[stride], %[dst]")
+            __ASM_EMIT64("dec       %[count]")
+            __ASM_EMIT32("decl      %[count]")
+            __ASM_EMIT("jnz         1b")
+
+            : [dst] "+r" (dst), [count] __ASM_ARG_RW(count),
+              [k] "+x" (k)
+            : [c1] "r" (c1), [c2] "r" (c2), [stride] "r" (stride)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_FILTERS_TRANSFORM_H_ */
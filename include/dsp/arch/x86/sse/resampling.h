@@ -1746,6 +1746,374 @@ namespace sse
               "%xmm4", "%xmm5", "%xmm6", "%xmm7"
         );
     }
+
+    IF_ARCH_X86(
+        static const float cubic_interpolate_const[] __lsp_aligned16 =
+        {
+            0.0f, 1.0f, 2.0f, 3.0f,         // initial indices
+            4.0f, 4.0f, 4.0f, 4.0f,         // index step
+            3.0f, 3.0f, 3.0f, 3.0f,
+            0.5f, 0.5f, 0.5f, 0.5f
+        };
+    )
+
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count)
+    {
+        IF_ARCH_X86(
+            float v[8] __lsp_aligned16 = { pos, pos, pos, pos, step, step, step, step };
+            size_t off;
+        );
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps      0x00 + %[CC], %%xmm7")              // xmm7 = i
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jb          2f")
+
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movaps      %%xmm7, %%xmm0")                    // xmm0 = i
+            __ASM_EMIT("mulps       0x10 + %[v], %%xmm0")               // xmm0 = step*i
+            __ASM_EMIT("addps       0x00 + %[v], %%xmm0")               // xmm0 = x = pos + step*i
+            __ASM_EMIT("cvttps2dq   %%xmm0, %%xmm1")                    // xmm1 = n = int(x)
+            __ASM_EMIT("cvtdq2ps    %%xmm1, %%xmm2")                    // xmm2 = float(n)
+            __ASM_EMIT("subps       %%xmm2, %%xmm0")                    // xmm0 = t = x - n
+            // Load 4 taps for each of 4 samples
+            __ASM_EMIT("movd        %%xmm1, %k[off]")
+            __ASM_EMIT("pshufd      $0x39, %%xmm1, %%xmm1")
+            __ASM_EMIT("movups      -0x04(%[src], %[off], 4), %%xmm2")  // xmm2 = a0 a1 a2 a3
+            __ASM_EMIT("movd        %%xmm1, %k[off]")
+            __ASM_EMIT("pshufd      $0x39, %%xmm1, %%xmm1")
+            __ASM_EMIT("movups      -0x04(%[src], %[off], 4), %%xmm3")  // xmm3 = b0 b1 b2 b3
+            __ASM_EMIT("movd        %%xmm1, %k[off]")
+            __ASM_EMIT("pshufd      $0x39, %%xmm1, %%xmm1")
+            __ASM_EMIT("movups      -0x04(%[src], %[off], 4), %%xmm4")  // xmm4 = c0 c1 c2 c3
+            __ASM_EMIT("movd        %%xmm1, %k[off]")
+            __ASM_EMIT("movups      -0x04(%[src], %[off], 4), %%xmm5")  // xmm5 = d0 d1 d2 d3
+            // Transpose
+            __ASM_EMIT("movaps      %%xmm2, %%xmm1")                    // xmm1 = a0 a1 a2 a3
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                    // xmm2 = a0 b0 a1 b1
+            __ASM_EMIT("unpckhps    %%xmm3, %%xmm1")                    // xmm1 = a2 b2 a3 b3
+            __ASM_EMIT("movaps      %%xmm4, %%xmm6")                    // xmm6 = c0 c1 c2 c3
+            __ASM_EMIT("unpcklps    %%xmm5, %%xmm4")                    // xmm4 = c0 d0 c1 d1
+            __ASM_EMIT("unpckhps    %%xmm5, %%xmm6")                    // xmm6 = c2 d2 c3 d3
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3")                    // xmm3 = a0 b0 a1 b1
+            __ASM_EMIT("movlhps     %%xmm4, %%xmm2")                    // xmm2 = p  = a0 b0 c0 d0
+            __ASM_EMIT("movhlps     %%xmm3, %%xmm4")                    // xmm4 = s0 = a1 b1 c1 d1
+            __ASM_EMIT("movaps      %%xmm1, %%xmm3")                    // xmm3 = a2 b2 a3 b3
+            __ASM_EMIT("movlhps     %%xmm6, %%xmm3")                    // xmm3 = s1 = a2 b2 c2 d2
+            __ASM_EMIT("movhlps     %%xmm1, %%xmm6")                    // xmm6 = s2 = a3 b3 c3 d3
+            // Compute spline
+            __ASM_EMIT("movaps      %%xmm4, %%xmm1")                    // xmm1 = s0
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")                    // xmm5 = p
+            __ASM_EMIT("subps       %%xmm3, %%xmm1")                    // xmm1 = d = s0 - s1
+            __ASM_EMIT("addps       %%xmm3, %%xmm5")                    // xmm5 = p + s1
+            __ASM_EMIT("mulps       0x20 + %[CC], %%xmm1")              // xmm1 = 3*d
+            __ASM_EMIT("subps       %%xmm4, %%xmm5")                    // xmm5 = p + s1 - s0
+            __ASM_EMIT("addps       %%xmm6, %%xmm1")                    // xmm1 = 3*d + s2
+            __ASM_EMIT("subps       %%xmm4, %%xmm5")                    // xmm5 = p + s1 - 2*s0
+            __ASM_EMIT("subps       %%xmm2, %%xmm1")                    // xmm1 = c = 3*d + s2 - p
+            __ASM_EMIT("subps       %%xmm2, %%xmm3")                    // xmm3 = a = s1 - p
+            __ASM_EMIT("subps       %%xmm1, %%xmm5")                    // xmm5 = b = p + s1 - 2*s0 - c
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1")                    // xmm1 = c*t
+            __ASM_EMIT("addps       %%xmm5, %%xmm1")                    // xmm1 = c*t + b
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1")                    // xmm1 = (c*t + b)*t
+            __ASM_EMIT("addps       %%xmm3, %%xmm1")                    // xmm1 = (c*t + b)*t + a
+            __ASM_EMIT("mulps       %%xmm0, %%xmm1")                    // xmm1 = ((c*t + b)*t + a)*t
+            __ASM_EMIT("mulps       0x30 + %[CC], %%xmm1")              // xmm1 = 0.5*((c*t + b)*t + a)*t
+            __ASM_EMIT("addps       %%xmm4, %%xmm1")                    // xmm1 = 0.5*((c*t + b)*t + a)*t + s0
+            __ASM_EMIT("movups      %%xmm1, 0x00(%[dst])")
+            __ASM_EMIT("addps       0x10 + %[CC], %%xmm7")              // xmm7 = i + 4
+            __ASM_EMIT("add         $0x10, %[dst]")
+            __ASM_EMIT("sub         $4, %[count]")
+            __ASM_EMIT("jae         1b")
+
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add         $3, %[count]")
+            __ASM_EMIT("jl          4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movaps      %%xmm7, %%xmm0")                    // xmm0 = i
+            __ASM_EMIT("mulss       0x10 + %[v], %%xmm0")               // xmm0 = step*i
+            __ASM_EMIT("addss       0x00 + %[v], %%xmm0")               // xmm0 = x = pos + step*i
+            __ASM_EMIT("cvttss2si   %%xmm0, %k[off]")                   // off = n = int(x)
+            __ASM_EMIT("cvtsi2ss    %k[off], %%xmm1")                   // xmm1 = float(n)
+            __ASM_EMIT("subss       %%xmm1, %%xmm0")                    // xmm0 = t = x - n
+            __ASM_EMIT("movups      -0x04(%[src], %[off], 4), %%xmm2")  // xmm2 = p s0 s1 s2
+            __ASM_EMIT("movaps      %%xmm2, %%xmm4")
+            __ASM_EMIT("movaps      %%xmm2, %%xmm3")
+            __ASM_EMIT("movaps      %%xmm2, %%xmm6")
+            __ASM_EMIT("shufps      $0x55, %%xmm4, %%xmm4")             // xmm4 = s0
+            __ASM_EMIT("shufps      $0xaa, %%xmm3, %%xmm3")             // xmm3 = s1
+            __ASM_EMIT("shufps      $0xff, %%xmm6, %%xmm6")             // xmm6 = s2
+            __ASM_EMIT("movaps      %%xmm4, %%xmm1")                    // xmm1 = s0
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")                    // xmm5 = p
+            __ASM_EMIT("subss       %%xmm3, %%xmm1")                    // xmm1 = d = s0 - s1
+            __ASM_EMIT("addss       %%xmm3, %%xmm5")                    // xmm5 = p + s1
+            __ASM_EMIT("mulss       0x20 + %[CC], %%xmm1")              // xmm1 = 3*d
+            __ASM_EMIT("subss       %%xmm4, %%xmm5")                    // xmm5 = p + s1 - s0
+            __ASM_EMIT("addss       %%xmm6, %%xmm1")                    // xmm1 = 3*d + s2
+            __ASM_EMIT("subss       %%xmm4, %%xmm5")                    // xmm5 = p + s1 - 2*s0
+            __ASM_EMIT("subss       %%xmm2, %%xmm1")                    // xmm1 = c = 3*d + s2 - p
+            __ASM_EMIT("subss       %%xmm2, %%xmm3")                    // xmm3 = a = s1 - p
+            __ASM_EMIT("subss       %%xmm1, %%xmm5")                    // xmm5 = b = p + s1 - 2*s0 - c
+            __ASM_EMIT("mulss       %%xmm0, %%xmm1")                    // xmm1 = c*t
+            __ASM_EMIT("addss       %%xmm5, %%xmm1")                    // xmm1 = c*t + b
+            __ASM_EMIT("mulss       %%xmm0, %%xmm1")                    // xmm1 = (c*t + b)*t
+            __ASM_EMIT("addss       %%xmm3, %%xmm1")                    // xmm1 = (c*t + b)*t + a
+            __ASM_EMIT("mulss       %%xmm0, %%xmm1")                    // xmm1 = ((c*t + b)*t + a)*t
+            __ASM_EMIT("mulss       0x30 + %[CC], %%xmm1")              // xmm1 = 0.5*((c*t + b)*t + a)*t
+            __ASM_EMIT("addss       %%xmm4, %%xmm1")                    // xmm1 = 0.5*((c*t + b)*t + a)*t + s0
+            __ASM_EMIT("movss       %%xmm1, 0x00(%[dst])")
+            __ASM_EMIT("addss       0x04 + %[CC], %%xmm7")              // xmm7 = i + 1
+            __ASM_EMIT("add         $0x04, %[dst]")
+            __ASM_EMIT("dec         %[count]")
+            __ASM_EMIT("jge         3b")
+
+            // End
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [count] "+r" (count),
+              [off] "=&r" (off)
+            : [src] "r" (src), [v] "o" (v),
+              [CC] "o" (cubic_interpolate_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    IF_ARCH_X86(
+        static const float halfband_const[] __lsp_aligned16 =
+        {
+            0.5f, 0.5f, 0.5f, 0.5f
+        };
+    )
+
+    void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        IF_ARCH_X86(
+            size_t off;
+            size_t tsize    = taps * sizeof(float);
+        );
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT64("sub         $4, %[count]")
+            __ASM_EMIT32("subl        $4, %[count]")
+            __ASM_EMIT("jb          2f")
+
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("xorps       %%xmm0, %%xmm0")                    // xmm0 = a
+            __ASM_EMIT("xorps       %%xmm1, %%xmm1")                    // xmm1 = b
+            __ASM_EMIT("xorps       %%xmm2, %%xmm2")                    // xmm2 = c
+            __ASM_EMIT("xorps       %%xmm3, %%xmm3")                    // xmm3 = d
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movups      0x00(%[k], %[off]), %%xmm4")        // xmm4 = k[j]
+            __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = s[i+j]
+            __ASM_EMIT("movups      0x04(%[src], %[off]), %%xmm6")      // xmm6 = s[i+j+1]
+            __ASM_EMIT("movups      0x08(%[src], %[off]), %%xmm7")      // xmm7 = s[i+j+2]
+            __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+            __ASM_EMIT("mulps       %%xmm4, %%xmm6")
+            __ASM_EMIT("mulps       %%xmm4, %%xmm7")
+            __ASM_EMIT("addps       %%xmm5, %%xmm0")
+            __ASM_EMIT("addps       %%xmm6, %%xmm1")
+            __ASM_EMIT("movups      0x0c(%[src], %[off]), %%xmm5")      // xmm5 = s[i+j+3]
+            __ASM_EMIT("addps       %%xmm7, %%xmm2")
+            __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("addps       %%xmm5, %%xmm3")
+            __ASM_EMIT("cmp         %[tsize], %[off]")
+            __ASM_EMIT("jb          3b")
+            // Horizontal sums
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                    // xmm0 = a0 b0 a1 b1
+            __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")                    // xmm4 = a2 b2 a3 b3
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                    // xmm2 = c0 d0 c1 d1
+            __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")                    // xmm5 = c2 d2 c3 d3
+            __ASM_EMIT("addps       %%xmm4, %%xmm0")                    // xmm0 = a02 b02 a13 b13
+            __ASM_EMIT("addps       %%xmm5, %%xmm2")                    // xmm2 = c02 d02 c13 d13
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                    // xmm0 = a02 b02 c02 d02
+            __ASM_EMIT("movhlps     %%xmm4, %%xmm2")                    // xmm2 = a13 b13 c13 d13
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")                    // xmm0 = a b c d
+            // Interleave with central samples
+            __ASM_EMIT("shr         $1, %[off]")
+            __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm1")      // xmm1 = s[i+taps/2]
+            __ASM_EMIT("movaps      %%xmm0, %%xmm2")
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                    // xmm0 = a s0 b s1
+            __ASM_EMIT("unpckhps    %%xmm1, %%xmm2")                    // xmm2 = c s2 d s3
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("movups      %%xmm2, 0x10(%[dst])")
+            __ASM_EMIT("add         $0x10, %[src]")
+            __ASM_EMIT("add         $0x20, %[dst]")
+            __ASM_EMIT64("sub         $4, %[count]")
+            __ASM_EMIT32("subl        $4, %[count]")
+            __ASM_EMIT("jae         1b")
+
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT64("add         $3, %[count]")
+            __ASM_EMIT32("addl        $3, %[count]")
+            __ASM_EMIT("jl          6f")
+            __ASM_EMIT("4:")
+            __ASM_EMIT("xorps       %%xmm0, %%xmm0")
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("movups      0x00(%[k], %[off]), %%xmm4")        // xmm4 = k[j]
+            __ASM_EMIT("movups      0x00(%[src], %[off]), %%xmm5")      // xmm5 = s[i+j]
+            __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("addps       %%xmm5, %%xmm0")
+            __ASM_EMIT("cmp         %[tsize], %[off]")
+            __ASM_EMIT("jb          5b")
+            __ASM_EMIT("movhlps     %%xmm0, %%xmm1")
+            __ASM_EMIT("addps       %%xmm1, %%xmm0")
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+            __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1")
+            __ASM_EMIT("addss       %%xmm1, %%xmm0")                    // xmm0 = a
+            __ASM_EMIT("shr         $1, %[off]")
+            __ASM_EMIT("movss       0x00(%[src], %[off]), %%xmm1")      // xmm1 = s[i+taps/2]
+            __ASM_EMIT("movss       %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("movss       %%xmm1, 0x04(%[dst])")
+            __ASM_EMIT("add         $0x04, %[src]")
+            __ASM_EMIT("add         $0x08, %[dst]")
+            __ASM_EMIT64("dec         %[count]")
+            __ASM_EMIT32("decl        %[count]")
+            __ASM_EMIT("jge         4b")
+
+            // End
+            __ASM_EMIT("6:")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] __ASM_ARG_RW(count),
+              [off] "=&r" (off)
+            : [k] "r" (k), [tsize] "g" (tsize)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
+
+    void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count)
+    {
+        IF_ARCH_X86(
+            size_t off;
+            size_t tsize    = taps * sizeof(float);
+        );
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT64("sub         $4, %[count]")
+            __ASM_EMIT32("subl        $4, %[count]")
+            __ASM_EMIT("jb          2f")
+
+            // 4x blocks
+            __ASM_EMIT("1:")
+            __ASM_EMIT("xorps       %%xmm0, %%xmm0")                    // xmm0 = a
+            __ASM_EMIT("xorps       %%xmm1, %%xmm1")                    // xmm1 = b
+            __ASM_EMIT("xorps       %%xmm2, %%xmm2")                    // xmm2 = c
+            __ASM_EMIT("xorps       %%xmm3, %%xmm3")                    // xmm3 = d
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("movups      0x00(%[k], %[off]), %%xmm4")        // xmm4 = k[j]
+            __ASM_EMIT("movups      0x00(%[src], %[off], 2), %%xmm5")
+            __ASM_EMIT("movups      0x10(%[src], %[off], 2), %%xmm6")
+            __ASM_EMIT("shufps      $0x88, %%xmm6, %%xmm5")             // xmm5 = s[2i+2j]
+            __ASM_EMIT("movups      0x08(%[src], %[off], 2), %%xmm6")
+            __ASM_EMIT("movups      0x18(%[src], %[off], 2), %%xmm7")
+            __ASM_EMIT("shufps      $0x88, %%xmm7, %%xmm6")             // xmm6 = s[2i+2j+2]
+            __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+            __ASM_EMIT("mulps       %%xmm4, %%xmm6")
+            __ASM_EMIT("addps       %%xmm5, %%xmm0")
+            __ASM_EMIT("addps       %%xmm6, %%xmm1")
+            __ASM_EMIT("movups      0x10(%[src], %[off], 2), %%xmm5")
+            __ASM_EMIT("movups      0x20(%[src], %[off], 2), %%xmm6")
+            __ASM_EMIT("shufps      $0x88, %%xmm6, %%xmm5")             // xmm5 = s[2i+2j+4]
+            __ASM_EMIT("movups      0x18(%[src], %[off], 2), %%xmm6")
+            __ASM_EMIT("movups      0x28(%[src], %[off], 2), %%xmm7")
+            __ASM_EMIT("shufps      $0x88, %%xmm7, %%xmm6")             // xmm6 = s[2i+2j+6]
+            __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+            __ASM_EMIT("mulps       %%xmm4, %%xmm6")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("addps       %%xmm5, %%xmm2")
+            __ASM_EMIT("addps       %%xmm6, %%xmm3")
+            __ASM_EMIT("cmp         %[tsize], %[off]")
+            __ASM_EMIT("jb          3b")
+            // Horizontal sums
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("movaps      %%xmm2, %%xmm5")
+            __ASM_EMIT("unpcklps    %%xmm1, %%xmm0")                    // xmm0 = a0 b0 a1 b1
+            __ASM_EMIT("unpckhps    %%xmm1, %%xmm4")                    // xmm4 = a2 b2 a3 b3
+            __ASM_EMIT("unpcklps    %%xmm3, %%xmm2")                    // xmm2 = c0 d0 c1 d1
+            __ASM_EMIT("unpckhps    %%xmm3, %%xmm5")                    // xmm5 = c2 d2 c3 d3
+            __ASM_EMIT("addps       %%xmm4, %%xmm0")                    // xmm0 = a02 b02 a13 b13
+            __ASM_EMIT("addps       %%xmm5, %%xmm2")                    // xmm2 = c02 d02 c13 d13
+            __ASM_EMIT("movaps      %%xmm0, %%xmm4")
+            __ASM_EMIT("movlhps     %%xmm2, %%xmm0")                    // xmm0 = a02 b02 c02 d02
+            __ASM_EMIT("movhlps     %%xmm4, %%xmm2")                    // xmm2 = a13 b13 c13 d13
+            __ASM_EMIT("addps       %%xmm2, %%xmm0")                    // xmm0 = a b c d
+            // Add central samples
+            __ASM_EMIT("movups      -0x04(%[src], %[off]), %%xmm1")
+            __ASM_EMIT("movups      0x0c(%[src], %[off]), %%xmm2")
+            __ASM_EMIT("shufps      $0x88, %%xmm2, %%xmm1")             // xmm1 = s[2i+taps-1]
+            __ASM_EMIT("addps       %%xmm1, %%xmm0")
+            __ASM_EMIT("mulps       %[CC], %%xmm0")                     // xmm0 = 0.5*(a + s)
+            __ASM_EMIT("movups      %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add         $0x20, %[src]")
+            __ASM_EMIT("add         $0x10, %[dst]")
+            __ASM_EMIT64("sub         $4, %[count]")
+            __ASM_EMIT32("subl        $4, %[count]")
+            __ASM_EMIT("jae         1b")
+
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT64("add         $3, %[count]")
+            __ASM_EMIT32("addl        $3, %[count]")
+            __ASM_EMIT("jl          6f")
+            __ASM_EMIT("4:")
+            __ASM_EMIT("xorps       %%xmm0, %%xmm0")
+            __ASM_EMIT("xor         %[off], %[off]")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("movups      0x00(%[src], %[off], 2), %%xmm5")
+            __ASM_EMIT("movups      0x10(%[src], %[off], 2), %%xmm6")
+            __ASM_EMIT("movups      0x00(%[k], %[off]), %%xmm4")        // xmm4 = k[j]
+            __ASM_EMIT("shufps      $0x88, %%xmm6, %%xmm5")             // xmm5 = s[2i+2j]
+            __ASM_EMIT("mulps       %%xmm4, %%xmm5")
+            __ASM_EMIT("add         $0x10, %[off]")
+            __ASM_EMIT("addps       %%xmm5, %%xmm0")
+            __ASM_EMIT("cmp         %[tsize], %[off]")
+            __ASM_EMIT("jb          5b")
+            __ASM_EMIT("movhlps     %%xmm0, %%xmm1")
+            __ASM_EMIT("addps       %%xmm1, %%xmm0")
+            __ASM_EMIT("movaps      %%xmm0, %%xmm1")
+            __ASM_EMIT("shufps      $0x55, %%xmm1, %%xmm1")
+            __ASM_EMIT("addss       %%xmm1, %%xmm0")                    // xmm0 = a
+            __ASM_EMIT("addss       -0x04(%[src], %[off]), %%xmm0")     // xmm0 = a + s[2i+taps-1]
+            __ASM_EMIT("mulss       %[CC], %%xmm0")
+            __ASM_EMIT("movss       %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add         $0x08, %[src]")
+            __ASM_EMIT("add         $0x04, %[dst]")
+            __ASM_EMIT64("dec         %[count]")
+            __ASM_EMIT32("decl        %[count]")
+            __ASM_EMIT("jge         4b")
+
+            // End
+            __ASM_EMIT("6:")
+
+            : [dst] "+r" (dst), [src] "+r" (src),
+              [count] __ASM_ARG_RW(count),
+              [off] "=&r" (off)
+            : [k] "r" (k), [tsize] "g" (tsize),
+              [CC] "o" (halfband_const)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm4", "%xmm5", "%xmm6", "%xmm7"
+        );
+    }
 }
 
 #endif /* DSP_ARCH_X86_SSE_RESAMPLING_H_ */
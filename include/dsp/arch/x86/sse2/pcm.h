@@ -0,0 +1,517 @@
+/*
+ * pcm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_ARCH_X86_SSE2_PCM_H_
+#define DSP_ARCH_X86_SSE2_PCM_H_
+
+#ifndef DSP_ARCH_X86_SSE2_IMPL
+    #error "This header should not be included directly"
+#endif /* DSP_ARCH_X86_SSE2_IMPL */
+
+namespace sse2
+{
+    #define U4VEC(x)        x, x, x, x
+    IF_ARCH_X86(
+        static const float PCM_XC[] __lsp_aligned16 =
+        {
+            U4VEC(32767.0f),                // 0x00: 16-bit sample range
+            U4VEC(8388607.0f)               // 0x10: 24-bit sample range
+        };
+
+        static const double PCM_XD[] __lsp_aligned16 =
+        {
+            2147483647.0, 2147483647.0      // 0x00: 32-bit sample range
+        };
+
+        static const uint32_t PCM_XM[] __lsp_aligned16 =
+        {
+            U4VEC(0x00ff0000),              // 0x00: byte 2 mask
+            U4VEC(0x0000ff00),              // 0x10: byte 1 mask
+            U4VEC(0x000000ff)               // 0x20: byte 0 mask
+        };
+    )
+    #undef U4VEC
+
+    void pcm_s16_to_f32(float *dst, const int16_t *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps          0x00 + %[XC], %%xmm7")
+            // 8x blocks
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movdqu          0x00(%[src]), %%xmm0")          // xmm0 = s0 s1 s2 s3 s4 s5 s6 s7
+            __ASM_EMIT("movdqa          %%xmm0, %%xmm1")
+            __ASM_EMIT("punpcklwd       %%xmm0, %%xmm0")                // xmm0 = s0 s0 s1 s1 s2 s2 s3 s3
+            __ASM_EMIT("punpckhwd       %%xmm1, %%xmm1")                // xmm1 = s4 s4 s5 s5 s6 s6 s7 s7
+            __ASM_EMIT("psrad           $16, %%xmm0")                   // xmm0 = int(s0) int(s1) int(s2) int(s3)
+            __ASM_EMIT("psrad           $16, %%xmm1")                   // xmm1 = int(s4) int(s5) int(s6) int(s7)
+            __ASM_EMIT("cvtdq2ps        %%xmm0, %%xmm0")
+            __ASM_EMIT("cvtdq2ps        %%xmm1, %%xmm1")
+            __ASM_EMIT("divps           %%xmm7, %%xmm0")
+            __ASM_EMIT("divps           %%xmm7, %%xmm1")
+            __ASM_EMIT("movups          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("movups          %%xmm1, 0x10(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 4x block
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $4, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("movq            0x00(%[src]), %%xmm0")
+            __ASM_EMIT("punpcklwd       %%xmm0, %%xmm0")
+            __ASM_EMIT("psrad           $16, %%xmm0")
+            __ASM_EMIT("cvtdq2ps        %%xmm0, %%xmm0")
+            __ASM_EMIT("divps           %%xmm7, %%xmm0")
+            __ASM_EMIT("movups          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x08, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            // 1x blocks
+            __ASM_EMIT("4:")
+            __ASM_EMIT("add             $3, %[count]")
+            __ASM_EMIT("jl              6f")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("movswl          0x00(%[src]), %k[tmp]")
+            __ASM_EMIT("cvtsi2ss        %k[tmp], %%xmm0")
+            __ASM_EMIT("divss           %%xmm7, %%xmm0")
+            __ASM_EMIT("movss           %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x02, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             5b")
+            __ASM_EMIT("6:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    /*
+     * The 4x block of 24-bit samples reads 4 bytes for each sample, so it is
+     * executed only if there is at least one more sample after the block
+     */
+    #define PCM_S24_LOAD_X4 \
+        __ASM_EMIT("movd            0x00(%[src]), %%xmm0")          /* xmm0 = b0 b1 b2 ? */ \
+        __ASM_EMIT("movd            0x03(%[src]), %%xmm1")          /* xmm1 = b3 b4 b5 ? */ \
+        __ASM_EMIT("movd            0x06(%[src]), %%xmm2")          /* xmm2 = b6 b7 b8 ? */ \
+        __ASM_EMIT("movd            0x09(%[src]), %%xmm3")          /* xmm3 = b9 b10 b11 ? */ \
+        __ASM_EMIT("punpckldq       %%xmm1, %%xmm0") \
+        __ASM_EMIT("punpckldq       %%xmm3, %%xmm2") \
+        __ASM_EMIT("punpcklqdq      %%xmm2, %%xmm0")                /* xmm0 = v0 v1 v2 v3 */
+
+    #define PCM_S24_DECODE_BODY(X4_SWAP, X1_SWAP) \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm7") \
+        /* 4x blocks */ \
+        __ASM_EMIT("sub             $5, %[count]") \
+        __ASM_EMIT("jb              2f") \
+        __ASM_EMIT("1:") \
+        PCM_S24_LOAD_X4 \
+        X4_SWAP \
+        __ASM_EMIT("pslld           $8, %%xmm0") \
+        __ASM_EMIT("psrad           $8, %%xmm0")                    /* xmm0 = sign-extended samples */ \
+        __ASM_EMIT("cvtdq2ps        %%xmm0, %%xmm0") \
+        __ASM_EMIT("divps           %%xmm7, %%xmm0") \
+        __ASM_EMIT("movups          %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT("add             $0x0c, %[src]") \
+        __ASM_EMIT("add             $0x10, %[dst]") \
+        __ASM_EMIT("sub             $4, %[count]") \
+        __ASM_EMIT("jae             1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add             $4, %[count]") \
+        __ASM_EMIT("jl              4f") \
+        __ASM_EMIT("3:") \
+        X1_SWAP \
+        __ASM_EMIT("cvtsi2ss        %k[tmp], %%xmm0") \
+        __ASM_EMIT("divss           %%xmm7, %%xmm0") \
+        __ASM_EMIT("movss           %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT("add             $0x03, %[src]") \
+        __ASM_EMIT("add             $0x04, %[dst]") \
+        __ASM_EMIT("dec             %[count]") \
+        __ASM_EMIT("jge             3b") \
+        __ASM_EMIT("4:")
+
+    void pcm_s24le_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_DECODE_BODY(
+                "",
+                __ASM_EMIT("movsbl          0x02(%[src]), %k[tmp]")
+                __ASM_EMIT("shl             $16, %k[tmp]")
+                __ASM_EMIT("mov             0x00(%[src]), %w[tmp]")     // tmp = int(b0 b1 b2)
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm7"
+        );
+    }
+
+    void pcm_s24be_to_f32(float *dst, const uint8_t *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_DECODE_BODY(
+                __ASM_EMIT("movdqa          %%xmm0, %%xmm1")
+                __ASM_EMIT("movdqa          %%xmm0, %%xmm2")
+                __ASM_EMIT("pslld           $16, %%xmm0")           // xmm0 = b0 << 16
+                __ASM_EMIT("psrld           $16, %%xmm2")           // xmm2 = b2 | (? << 8)
+                __ASM_EMIT("pand            0x00 + %[XM], %%xmm0")
+                __ASM_EMIT("pand            0x10 + %[XM], %%xmm1")  // xmm1 = b1 << 8
+                __ASM_EMIT("pand            0x20 + %[XM], %%xmm2")  // xmm2 = b2
+                __ASM_EMIT("por             %%xmm1, %%xmm0")
+                __ASM_EMIT("por             %%xmm2, %%xmm0"),       // xmm0 = b2 b1 b0 0
+                __ASM_EMIT("movsbl          0x00(%[src]), %k[tmp]")
+                __ASM_EMIT("shl             $16, %k[tmp]")
+                __ASM_EMIT("mov             0x01(%[src]), %w[tmp]")
+                __ASM_EMIT("rol             $8, %w[tmp]")               // tmp = int(b0 b1 b2)
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC), [XM] "o" (PCM_XM)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm3",
+              "%xmm7"
+        );
+    }
+
+    #undef PCM_S24_DECODE_BODY
+    #undef PCM_S24_LOAD_X4
+
+    void pcm_s32_to_f32(float *dst, const int32_t *src, size_t count)
+    {
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movapd          0x00 + %[XD], %%xmm7")
+            // 4x blocks
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movdqu          0x00(%[src]), %%xmm0")          // xmm0 = s0 s1 s2 s3
+            __ASM_EMIT("pshufd          $0x4e, %%xmm0, %%xmm1")         // xmm1 = s2 s3 s0 s1
+            __ASM_EMIT("cvtdq2pd        %%xmm0, %%xmm0")                // xmm0 = double(s0 s1)
+            __ASM_EMIT("cvtdq2pd        %%xmm1, %%xmm1")                // xmm1 = double(s2 s3)
+            __ASM_EMIT("divpd           %%xmm7, %%xmm0")
+            __ASM_EMIT("divpd           %%xmm7, %%xmm1")
+            __ASM_EMIT("cvtpd2ps        %%xmm0, %%xmm0")
+            __ASM_EMIT("cvtpd2ps        %%xmm1, %%xmm1")
+            __ASM_EMIT("movlhps         %%xmm1, %%xmm0")
+            __ASM_EMIT("movups          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $3, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("cvtsi2sdl       0x00(%[src]), %%xmm0")
+            __ASM_EMIT("divsd           %%xmm7, %%xmm0")
+            __ASM_EMIT("cvtsd2ss        %%xmm0, %%xmm0")
+            __ASM_EMIT("movss           %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            : [XD] "o" (PCM_XD)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    void pcm_f64_to_f32(float *dst, const double *src, size_t count)
+    {
+        ARCH_X86_ASM
+        (
+            // 4x blocks
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movupd          0x00(%[src]), %%xmm0")
+            __ASM_EMIT("movupd          0x10(%[src]), %%xmm1")
+            __ASM_EMIT("cvtpd2ps        %%xmm0, %%xmm0")
+            __ASM_EMIT("cvtpd2ps        %%xmm1, %%xmm1")
+            __ASM_EMIT("movlhps         %%xmm1, %%xmm0")
+            __ASM_EMIT("movups          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $3, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("cvtsd2ss        0x00(%[src]), %%xmm0")
+            __ASM_EMIT("movss           %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x08, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1"
+        );
+    }
+
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movaps          0x00 + %[XC], %%xmm7")
+            // 8x blocks
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups          0x00(%[src]), %%xmm0")
+            __ASM_EMIT("movups          0x10(%[src]), %%xmm1")
+            __ASM_EMIT("mulps           %%xmm7, %%xmm0")
+            __ASM_EMIT("mulps           %%xmm7, %%xmm1")
+            __ASM_EMIT("cvttps2dq       %%xmm0, %%xmm0")
+            __ASM_EMIT("cvttps2dq       %%xmm1, %%xmm1")
+            __ASM_EMIT("packssdw        %%xmm1, %%xmm0")                // xmm0 = s0 s1 s2 s3 s4 s5 s6 s7
+            __ASM_EMIT("movdqu          %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x20, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $8, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 4x block
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $4, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("movups          0x00(%[src]), %%xmm0")
+            __ASM_EMIT("mulps           %%xmm7, %%xmm0")
+            __ASM_EMIT("cvttps2dq       %%xmm0, %%xmm0")
+            __ASM_EMIT("packssdw        %%xmm0, %%xmm0")
+            __ASM_EMIT("movq            %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x08, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            // 1x blocks
+            __ASM_EMIT("4:")
+            __ASM_EMIT("add             $3, %[count]")
+            __ASM_EMIT("jl              6f")
+            __ASM_EMIT("5:")
+            __ASM_EMIT("movss           0x00(%[src]), %%xmm0")
+            __ASM_EMIT("mulss           %%xmm7, %%xmm0")
+            __ASM_EMIT("cvttss2si       %%xmm0, %k[tmp]")
+            __ASM_EMIT("mov             %w[tmp], 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x02, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             5b")
+            __ASM_EMIT("6:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    /*
+     * The 4x block of 24-bit samples writes 4 bytes for each sample, so it is
+     * executed only if there is at least one more sample after the block which
+     * overwrites the extra byte
+     */
+    #define PCM_S24_ENCODE_BODY(X4_SWAP, X1_SWAP) \
+        __ASM_EMIT("movaps          0x10 + %[XC], %%xmm7") \
+        /* 4x blocks */ \
+        __ASM_EMIT("sub             $5, %[count]") \
+        __ASM_EMIT("jb              2f") \
+        __ASM_EMIT("1:") \
+        __ASM_EMIT("movups          0x00(%[src]), %%xmm0") \
+        __ASM_EMIT("mulps           %%xmm7, %%xmm0") \
+        __ASM_EMIT("cvttps2dq       %%xmm0, %%xmm0")                /* xmm0 = v0 v1 v2 v3 */ \
+        X4_SWAP \
+        __ASM_EMIT("movd            %%xmm0, 0x00(%[dst])") \
+        __ASM_EMIT("psrldq          $4, %%xmm0") \
+        __ASM_EMIT("movd            %%xmm0, 0x03(%[dst])") \
+        __ASM_EMIT("psrldq          $4, %%xmm0") \
+        __ASM_EMIT("movd            %%xmm0, 0x06(%[dst])") \
+        __ASM_EMIT("psrldq          $4, %%xmm0") \
+        __ASM_EMIT("movd            %%xmm0, 0x09(%[dst])") \
+        __ASM_EMIT("add             $0x10, %[src]") \
+        __ASM_EMIT("add             $0x0c, %[dst]") \
+        __ASM_EMIT("sub             $4, %[count]") \
+        __ASM_EMIT("jae             1b") \
+        /* 1x blocks */ \
+        __ASM_EMIT("2:") \
+        __ASM_EMIT("add             $4, %[count]") \
+        __ASM_EMIT("jl              4f") \
+        __ASM_EMIT("3:") \
+        __ASM_EMIT("movss           0x00(%[src]), %%xmm0") \
+        __ASM_EMIT("mulss           %%xmm7, %%xmm0") \
+        __ASM_EMIT("cvttss2si       %%xmm0, %k[tmp]") \
+        X1_SWAP \
+        __ASM_EMIT("mov             %w[tmp], 0x00(%[dst])") \
+        __ASM_EMIT("shr             $8, %k[tmp]") \
+        __ASM_EMIT("mov             %w[tmp], 0x01(%[dst])") \
+        __ASM_EMIT("add             $0x04, %[src]") \
+        __ASM_EMIT("add             $0x03, %[dst]") \
+        __ASM_EMIT("dec             %[count]") \
+        __ASM_EMIT("jge             3b") \
+        __ASM_EMIT("4:")
+
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_ENCODE_BODY("", "")
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC)
+            : "cc", "memory",
+              "%xmm0", "%xmm7"
+        );
+    }
+
+    void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            PCM_S24_ENCODE_BODY(
+                __ASM_EMIT("movdqa          %%xmm0, %%xmm1")
+                __ASM_EMIT("movdqa          %%xmm0, %%xmm2")
+                __ASM_EMIT("psrld           $16, %%xmm0")           // xmm0 = b2 | (b3 << 8)
+                __ASM_EMIT("pslld           $16, %%xmm2")           // xmm2 = (b0 << 16) | (b1 << 24)
+                __ASM_EMIT("pand            0x20 + %[XM], %%xmm0")  // xmm0 = b2
+                __ASM_EMIT("pand            0x10 + %[XM], %%xmm1")  // xmm1 = b1 << 8
+                __ASM_EMIT("pand            0x00 + %[XM], %%xmm2")  // xmm2 = b0 << 16
+                __ASM_EMIT("por             %%xmm1, %%xmm0")
+                __ASM_EMIT("por             %%xmm2, %%xmm0"),       // xmm0 = b2 b1 b0 0
+                __ASM_EMIT("bswap           %k[tmp]")
+                __ASM_EMIT("shr             $8, %k[tmp]")               // tmp = b2 b1 b0 0
+            )
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XC] "o" (PCM_XC), [XM] "o" (PCM_XM)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm2", "%xmm7"
+        );
+    }
+
+    #undef PCM_S24_ENCODE_BODY
+
+    void pcm_f32_to_s32(int32_t *dst, const float *src, size_t count)
+    {
+        size_t tmp;
+
+        ARCH_X86_ASM
+        (
+            __ASM_EMIT("movapd          0x00 + %[XD], %%xmm7")
+            // 4x blocks
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups          0x00(%[src]), %%xmm0")          // xmm0 = s0 s1 s2 s3
+            __ASM_EMIT("cvtps2pd        %%xmm0, %%xmm1")                // xmm1 = double(s0 s1)
+            __ASM_EMIT("movhlps         %%xmm0, %%xmm0")                // xmm0 = s2 s3 s2 s3
+            __ASM_EMIT("cvtps2pd        %%xmm0, %%xmm0")                // xmm0 = double(s2 s3)
+            __ASM_EMIT("mulpd           %%xmm7, %%xmm1")
+            __ASM_EMIT("mulpd           %%xmm7, %%xmm0")
+            __ASM_EMIT("cvttpd2dq       %%xmm1, %%xmm1")
+            __ASM_EMIT("cvttpd2dq       %%xmm0, %%xmm0")
+            __ASM_EMIT("punpcklqdq      %%xmm0, %%xmm1")
+            __ASM_EMIT("movdqu          %%xmm1, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x10, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $3, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("cvtss2sd        0x00(%[src]), %%xmm0")
+            __ASM_EMIT("mulsd           %%xmm7, %%xmm0")
+            __ASM_EMIT("cvttsd2si       %%xmm0, %k[tmp]")
+            __ASM_EMIT("mov             %k[tmp], 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x04, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count),
+              [tmp] "=&r" (tmp)
+            : [XD] "o" (PCM_XD)
+            : "cc", "memory",
+              "%xmm0", "%xmm1", "%xmm7"
+        );
+    }
+
+    void pcm_f32_to_f64(double *dst, const float *src, size_t count)
+    {
+        ARCH_X86_ASM
+        (
+            // 4x blocks
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jb              2f")
+            __ASM_EMIT("1:")
+            __ASM_EMIT("movups          0x00(%[src]), %%xmm0")
+            __ASM_EMIT("cvtps2pd        %%xmm0, %%xmm1")
+            __ASM_EMIT("movhlps         %%xmm0, %%xmm0")
+            __ASM_EMIT("cvtps2pd        %%xmm0, %%xmm0")
+            __ASM_EMIT("movupd          %%xmm1, 0x00(%[dst])")
+            __ASM_EMIT("movupd          %%xmm0, 0x10(%[dst])")
+            __ASM_EMIT("add             $0x10, %[src]")
+            __ASM_EMIT("add             $0x20, %[dst]")
+            __ASM_EMIT("sub             $4, %[count]")
+            __ASM_EMIT("jae             1b")
+            // 1x blocks
+            __ASM_EMIT("2:")
+            __ASM_EMIT("add             $3, %[count]")
+            __ASM_EMIT("jl              4f")
+            __ASM_EMIT("3:")
+            __ASM_EMIT("cvtss2sd        0x00(%[src]), %%xmm0")
+            __ASM_EMIT("movsd           %%xmm0, 0x00(%[dst])")
+            __ASM_EMIT("add             $0x04, %[src]")
+            __ASM_EMIT("add             $0x08, %[dst]")
+            __ASM_EMIT("dec             %[count]")
+            __ASM_EMIT("jge             3b")
+            __ASM_EMIT("4:")
+
+            : [dst] "+r" (dst), [src] "+r" (src), [count] "+r" (count)
+            :
+            : "cc", "memory",
+              "%xmm0", "%xmm1"
+        );
+    }
+}
+
+#endif /* DSP_ARCH_X86_SSE2_PCM_H_ */
@@ -0,0 +1,88 @@
+/*
+ * dynamics.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_COMMON_DYNAMICS_H_
+#define DSP_COMMON_DYNAMICS_H_
+
+#ifndef __DSP_DSP_DEFS
+    #error "This header should not be included directly"
+#endif /* __DSP_DSP_DEFS */
+
+//-----------------------------------------------------------------------
+// Envelope followers of dynamic processors
+/*
+    The envelope follower computes the envelope of the sidechain signal
+    with different reaction for attack and release:
+
+        tau     = ((e > t) && (s <= e)) ? r : a
+        e       = e + tau * (s - e)
+
+    where:
+        s       - the sidechain sample
+        e       - the envelope
+        a       - the attack time constant
+        r       - the release time constant
+        t       - the release threshold
+
+    Envelope followers are organized in banks of independent followers
+    for SIMD processing. The input and output data of the bank is interleaved,
+    for example, the x4 bank processes the following data:
+        ┌───────┬───────┬───────┬───────┬───────┬───────┬─────
+        │ s0[0] │ s1[0] │ s2[0] │ s3[0] │ s0[1] │ s1[1] │ ...
+        └───────┴───────┴───────┴───────┴───────┴───────┴─────
+ */
+
+#define ENVELOPE_ALIGN          0x20
+
+#pragma pack(push, 1)
+
+/**
+ * Bank of 4 envelope followers
+ */
+typedef struct envelope_x4_t
+{
+    float   env[4];         // Current envelope
+    float   attack[4];      // Attack time constant
+    float   release[4];     // Release time constant
+    float   thresh[4];      // Release threshold
+} __lsp_aligned(ENVELOPE_ALIGN) envelope_x4_t;
+
+/**
+ * Bank of 8 envelope followers
+ */
+typedef struct envelope_x8_t
+{
+    float   env[8];         // Current envelope
+    float   attack[8];      // Attack time constant
+    float   release[8];     // Release time constant
+    float   thresh[8];      // Release threshold
+} __lsp_aligned(ENVELOPE_ALIGN) envelope_x8_t;
+
+#pragma pack(pop)
+
+namespace dsp
+{
+    /** Process bank of 4 envelope followers
+     *
+     * @param dst destination buffer of 4*count interleaved envelope samples, can be the same with src
+     * @param src source buffer of 4*count interleaved sidechain samples
+     * @param e bank of envelope followers, should be aligned to ENVELOPE_ALIGN
+     * @param count number of samples to process for each envelope follower
+     */
+    extern void (* envelope_process_x4)(float *dst, const float *src, envelope_x4_t *e, size_t count);
+
+    /** Process bank of 8 envelope followers
+     *
+     * @param dst destination buffer of 8*count interleaved envelope samples, can be the same with src
+     * @param src source buffer of 8*count interleaved sidechain samples
+     * @param e bank of envelope followers, should be aligned to ENVELOPE_ALIGN
+     * @param count number of samples to process for each envelope follower
+     */
+    extern void (* envelope_process_x8)(float *dst, const float *src, envelope_x8_t *e, size_t count);
+}
+
+#endif /* DSP_COMMON_DYNAMICS_H_ */
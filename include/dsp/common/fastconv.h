@@ -55,6 +55,16 @@ namespace dsp
      * @param rank the convolution rank
      */
     extern void (* fastconv_apply)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+
+    /** Convolve two convolutions and add the result to the accumulator
+     * of fast convolution data without restoring it to real data
+     *
+     * @param dst fast convolution data of 2^(rank+1) floats to accumulate result
+     * @param c1 fast convolution data of 2^(rank+1) floats
+     * @param c2 fast convolution data of 2^(rank+1) floats
+     * @param rank the convolution rank
+     */
+    extern void (* fastconv_mul_add)(float *dst, const float *c1, const float *c2, size_t rank);
 }
 
 #endif /* DSP_COMMON_FASTCONV_H_ */
@@ -312,6 +312,43 @@ namespace dsp
      */
     extern void (* biquad_process_x8)(float *dst, const float *src, size_t count, biquad_t *f);
 
+    //---------------------------------------------------------------------------------------
+    // Static filters for interleaved channels
+    //---------------------------------------------------------------------------------------
+    /** Process two interleaved channels, each channel is passed through the cascade of two
+     * bi-quadratic filters. The filters are computed in four lanes: filter 0 of channel 0,
+     * filter 0 of channel 1, filter 1 of channel 0, filter 1 of channel 1. Coefficients of
+     * lanes are stored in f->x4, memory of lanes is stored in f->d as d0[4], d1[4]
+     *
+     * @param dst destination buffer of 2*count interleaved samples, can be the same with src
+     * @param src source buffer of 2*count interleaved samples
+     * @param count number of samples to process for each channel
+     * @param f bi-quadratic filter structure
+     */
+    extern void (* biquad_process_i2)(float *dst, const float *src, size_t count, biquad_t *f);
+
+    /** Process four interleaved channels, each channel is passed through its own bi-quadratic
+     * filter. Coefficients of filters are stored in f->x4, memory of filters is stored in f->d
+     * as d0[4], d1[4]
+     *
+     * @param dst destination buffer of 4*count interleaved samples, can be the same with src
+     * @param src source buffer of 4*count interleaved samples
+     * @param count number of samples to process for each channel
+     * @param f bi-quadratic filter structure
+     */
+    extern void (* biquad_process_i4)(float *dst, const float *src, size_t count, biquad_t *f);
+
+    /** Process eight interleaved channels, each channel is passed through its own bi-quadratic
+     * filter. Coefficients of filters are stored in f->x8, memory of filters is stored in f->d
+     * as d0[8], d1[8]
+     *
+     * @param dst destination buffer of 8*count interleaved samples, can be the same with src
+     * @param src source buffer of 8*count interleaved samples
+     * @param count number of samples to process for each channel
+     * @param f bi-quadratic filter structure
+     */
+    extern void (* biquad_process_i8)(float *dst, const float *src, size_t count, biquad_t *f);
+
     //---------------------------------------------------------------------------------------
     // Dynamic filters
     //---------------------------------------------------------------------------------------
@@ -482,6 +519,22 @@ namespace dsp
      */
     extern void (* matched_transform_x8)(biquad_x8_t *bf, f_cascade_t *bc, float kf, float td, size_t count);
 
+    //---------------------------------------------------------------------------------------
+    // Interpolation of dynamic filters
+    //---------------------------------------------------------------------------------------
+    /** Linearly interpolate analog filter cascades between two anchor cascades:
+     * dst[i*stride] = c1 + (c2 - c1) * i / count, the c2 cascade itself is not stored.
+     * Second-order analog polynomials with coefficients of the same sign form
+     * a convex set, so the interpolation of two stable cascades is also stable
+     *
+     * @param dst target cascades
+     * @param c1 anchor cascade at the start of the interpolated range
+     * @param c2 anchor cascade at the end of the interpolated range
+     * @param stride distance between target cascades (in cascades)
+     * @param count number of cascades to generate
+     */
+    extern void (* interpolate_cascades)(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count);
+
 } // dsp
 
 #endif /* DSP_COMMON_FILTERS_H_ */
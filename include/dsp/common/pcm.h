@@ -0,0 +1,105 @@
+/*
+ * pcm.h
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#ifndef DSP_COMMON_PCM_H_
+#define DSP_COMMON_PCM_H_
+
+//-----------------------------------------------------------------------
+// PCM sample format conversions
+namespace dsp
+{
+    /** Convert signed 16-bit samples stored in CPU byte order to floating-point samples,
+     * the value range is -32767 .. 32767 which maps to -1.0 .. 1.0
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_s16_to_f32)(float *dst, const int16_t *src, size_t count);
+
+    /** Convert signed little-endian 24-bit packed samples to floating-point samples,
+     * the value range is -8388607 .. 8388607 which maps to -1.0 .. 1.0
+     *
+     * @param dst destination buffer
+     * @param src source buffer, 3 bytes per sample
+     * @param count number of samples
+     */
+    extern void (* pcm_s24le_to_f32)(float *dst, const uint8_t *src, size_t count);
+
+    /** Convert signed big-endian 24-bit packed samples to floating-point samples,
+     * the value range is -8388607 .. 8388607 which maps to -1.0 .. 1.0
+     *
+     * @param dst destination buffer
+     * @param src source buffer, 3 bytes per sample
+     * @param count number of samples
+     */
+    extern void (* pcm_s24be_to_f32)(float *dst, const uint8_t *src, size_t count);
+
+    /** Convert signed 32-bit samples stored in CPU byte order to floating-point samples,
+     * the value range is -2147483647 .. 2147483647 which maps to -1.0 .. 1.0
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_s32_to_f32)(float *dst, const int32_t *src, size_t count);
+
+    /** Convert double-precision samples stored in CPU byte order to floating-point samples
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_f64_to_f32)(float *dst, const double *src, size_t count);
+
+    /** Convert floating-point samples to signed 16-bit samples in CPU byte order,
+     * the fractional part is truncated. Source samples should be in range of -1.0 .. 1.0,
+     * use limit_saturate functions to ensure this.
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_f32_to_s16)(int16_t *dst, const float *src, size_t count);
+
+    /** Convert floating-point samples to signed little-endian 24-bit packed samples,
+     * the fractional part is truncated. Source samples should be in range of -1.0 .. 1.0
+     *
+     * @param dst destination buffer, 3 bytes per sample
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_f32_to_s24le)(uint8_t *dst, const float *src, size_t count);
+
+    /** Convert floating-point samples to signed big-endian 24-bit packed samples,
+     * the fractional part is truncated. Source samples should be in range of -1.0 .. 1.0
+     *
+     * @param dst destination buffer, 3 bytes per sample
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_f32_to_s24be)(uint8_t *dst, const float *src, size_t count);
+
+    /** Convert floating-point samples to signed 32-bit samples in CPU byte order,
+     * the fractional part is truncated. Source samples should be in range of -1.0 .. 1.0
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_f32_to_s32)(int32_t *dst, const float *src, size_t count);
+
+    /** Convert floating-point samples to double-precision samples in CPU byte order
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param count number of samples
+     */
+    extern void (* pcm_f32_to_f64)(double *dst, const float *src, size_t count);
+}
+
+#endif /* DSP_COMMON_PCM_H_ */
@@ -157,6 +157,45 @@ namespace dsp
      * @param count number of samples to process
      */
     extern void (* downsample_8x)(float *dst, const float *src, size_t count);
+
+    /** Interpolate the source signal with the cubic Hermite (Catmull-Rom) kernel
+     * at the fractional positions: dst[i] = cubic(src, pos + i*step)
+     * The source buffer should contain one sample before and two samples after
+     * the interpolated range
+     *
+     * @param dst destination buffer
+     * @param src source buffer
+     * @param pos non-negative position of the first interpolated sample in the source buffer
+     * @param step non-negative step between positions of interpolated samples
+     * @param count number of samples to interpolate
+     */
+    extern void (* cubic_interpolate)(float *dst, const float *src, float pos, float step, size_t count);
+
+    /** Perform 2x upsampling with the polyphase half-band FIR filter. Even output samples are
+     * computed by the non-trivial polyphase component of the filter, odd output samples are
+     * the delayed source samples:
+     *   dst[2*i]   = sum(k[j] * src[i + j]), j = 0..taps-1
+     *   dst[2*i+1] = src[i + taps/2]
+     *
+     * @param dst destination buffer of count*2 samples
+     * @param src source buffer of count + taps - 1 samples, first taps - 1 samples are the history
+     * @param k coefficients of the non-trivial polyphase component scaled by 2
+     * @param taps number of coefficients, should be multiple of 4
+     * @param count number of source samples to process
+     */
+    extern void (* halfband_upsample_2x)(float *dst, const float *src, const float *k, size_t taps, size_t count);
+
+    /** Perform 2x downsampling with the polyphase half-band FIR filter, the same set of
+     * coefficients as for the upsampling is used:
+     *   dst[i]     = 0.5 * (sum(k[j] * src[2*i + 2*j]) + src[2*i + taps - 1]), j = 0..taps-1
+     *
+     * @param dst destination buffer of count samples
+     * @param src source buffer of count*2 + taps*2 - 2 samples, first taps*2 - 2 samples are the history
+     * @param k coefficients of the non-trivial polyphase component scaled by 2
+     * @param taps number of coefficients, should be multiple of 4
+     * @param count number of destination samples to produce
+     */
+    extern void (* halfband_downsample_2x)(float *dst, const float *src, const float *k, size_t taps, size_t count);
 }
 
 #endif /* DSP_COMMON_RESAMPLING_H_ */
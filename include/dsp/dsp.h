@@ -51,6 +51,8 @@
 #include <dsp/common/misc.h>
 #include <dsp/common/convolution.h>
 #include <dsp/common/coding.h>
+#include <dsp/common/pcm.h>
+#include <dsp/common/dynamics.h>
 
 #undef __DSP_DSP_DEFS
 
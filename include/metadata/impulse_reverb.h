@@ -32,6 +32,8 @@ namespace lsp
 
         static const size_t FFT_RANK_MIN            = 9;        // Minimum FFT rank
 
+        static const float BG_DELAY                 = 200.0f;   // Part of IR processed in real time when the background processing is on (ms)
+
         static const float LCF_MIN                  = 10.0f;
         static const float LCF_MAX                  = 1000.0f;
         static const float LCF_DFL                  = 50.0f;
@@ -59,6 +61,10 @@ namespace lsp
             FFT_RANK_16384,
             FFT_RANK_32767,
             FFT_RANK_65536,
+            FFT_RANK_131072,
+            FFT_RANK_262144,
+            FFT_RANK_524288,
+            FFT_RANK_1048576,
 
             FFT_RANK_DEFAULT = FFT_RANK_32767
         };
@@ -74,6 +74,20 @@ namespace lsp
             OVS_FULL_8X2,
             OVS_FULL_8X3,
 
+            OVS_FIR_2X_FAST,
+            OVS_FIR_2X_NORMAL,
+            OVS_FIR_2X_HIGH,
+            OVS_FIR_4X_FAST,
+            OVS_FIR_4X_NORMAL,
+            OVS_FIR_4X_HIGH,
+            OVS_FIR_8X_FAST,
+            OVS_FIR_8X_NORMAL,
+            OVS_FIR_8X_HIGH,
+
+            OVS_IIR_2X,
+            OVS_IIR_4X,
+            OVS_IIR_8X,
+
             OVS_DEFAULT     = OVS_NONE
         };
 
@@ -134,6 +134,10 @@ namespace lsp
             FFT_RANK_16384,
             FFT_RANK_32767,
             FFT_RANK_65536,
+            FFT_RANK_131072,
+            FFT_RANK_262144,
+            FFT_RANK_524288,
+            FFT_RANK_1048576,
 
             FFT_RANK_DEFAULT = FFT_RANK_32767
         };
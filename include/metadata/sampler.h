@@ -33,6 +33,9 @@ namespace lsp
         static const size_t TRACKS_MAX              = 2;        // Maximum tracks per mesh/sample
         static const float ACTIVITY_LIGHTING        = 0.1f;     // Activity lighting (seconds)
 
+        static const float STREAM_HEAD              = 250.0f;   // Length of the sample head kept in memory for streamed files (ms)
+        static const size_t STREAM_PEAK             = 256;      // Number of samples per peak value of the streamed file
+
         static const size_t CHANNEL_DFL             = 0;        // Default channel
         static const size_t NOTE_DFL                = 9;        // A
         static const size_t OCTAVE_DFL              = 4;        // 4th octave
@@ -53,6 +56,8 @@ namespace lsp
         static const size_t PLAYBACKS_MAX           = 8192;     // Maximum number of simultaneously playing samples
         static const size_t SAMPLE_FILES            = 8;        // Number of sample files
         static const size_t BUFFER_SIZE             = 4096;     // Size of temporary buffer
+        static const size_t STREAMS_MAX             = PLAYBACKS_MAX; // Maximum number of simultaneously streamed playbacks per channel
+        static const size_t STREAM_BUFFER           = 8192;     // Size of ring buffer of each streamed playback
 
         static const size_t INSTRUMENTS_MAX         = 64;       // Maximum supported instruments
     };
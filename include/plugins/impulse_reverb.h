@@ -10,7 +10,7 @@
 
 #include <core/plugin.h>
 #include <core/ipc/IExecutor.h>
-#include <core/util/Convolver.h>
+#include <core/util/AsyncConvolver.h>
 #include <core/util/Bypass.h>
 #include <core/util/Delay.h>
 #include <core/util/Toggle.h>
@@ -54,6 +54,7 @@ namespace lsp
                 size_t                  nFile[impulse_reverb_base_metadata::CONVOLVERS];
                 size_t                  nTrack[impulse_reverb_base_metadata::CONVOLVERS];
                 size_t                  nRank[impulse_reverb_base_metadata::CONVOLVERS];
+                bool                    bBackground;
             } reconfig_t;
 
             class IRConfigurator: public ipc::ITask
@@ -73,6 +74,7 @@ namespace lsp
                     inline void set_file(size_t idx, size_t file)       { sReconfig.nFile[idx]      = file;     }
                     inline void set_track(size_t idx, size_t track)     { sReconfig.nTrack[idx]     = track;    }
                     inline void set_rank(size_t idx, size_t rank)       { sReconfig.nRank[idx]      = rank;     }
+                    inline void set_background(bool background)         { sReconfig.bBackground     = background; }
             };
 
             typedef struct af_descriptor_t
@@ -114,8 +116,8 @@ namespace lsp
             {
                 Delay           sDelay;         // Delay line
 
-                Convolver      *pCurr;          // Currently used convolver
-                Convolver      *pSwap;          // Swap
+                AsyncConvolver *pCurr;          // Currently used convolver
+                AsyncConvolver *pSwap;          // Swap
 //                bool            bSwap;          // Swapping flag
                 size_t          nRank;          // Last applied rank
                 size_t          nRankReq;       // Rank request
@@ -177,6 +179,8 @@ namespace lsp
             size_t                  nInputs;
             size_t                  nReconfigReq;
             size_t                  nReconfigResp;
+            bool                    bBackground;    // Process late part of convolution in background
+            size_t                  nLateDeadlines; // Number of late deadlines of background processing
 
             input_t                 vInputs[2];
             channel_t               vChannels[2];
@@ -187,6 +191,8 @@ namespace lsp
 
             IPort                  *pBypass;
             IPort                  *pRank;
+            IPort                  *pBackground;
+            IPort                  *pLateDeadlines;
             IPort                  *pDry;
             IPort                  *pWet;
             IPort                  *pOutGain;
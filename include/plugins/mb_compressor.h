@@ -53,6 +53,7 @@ namespace lsp
 
                 float          *vTr;                // Transfer function
                 float          *vVCA;               // Voltage-controlled amplification value for each band
+                float          *vEnv;               // Envelope of each band
                 float           fScPreamp;          // Sidechain preamp
 
                 float           fFreqStart;
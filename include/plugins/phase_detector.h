@@ -29,6 +29,8 @@ namespace lsp
             float              *vFunction;
             float              *vAccumulated;
             float              *vNormalized;
+            float              *vFftSignal;     // Packed complex FFT buffer for A samples
+            float              *vFftSpectrum;   // Packed complex FFT buffer for B samples
 
             size_t              nMaxVectorSize;
             size_t              nVectorSize;
@@ -41,6 +43,10 @@ namespace lsp
             size_t              nMaxGapSize;
             size_t              nGapOffset;
 
+            size_t              nFftRank;       // Rank of FFT for block cross-correlation
+            size_t              nFftBlock;      // Maximum number of samples processed by one FFT block
+            size_t              nFftThresh;     // Minimum number of samples to use FFT instead of direct method
+
             buffer_t            vA, vB;
 
             float               fTau;
@@ -55,6 +61,9 @@ namespace lsp
 
         protected:
             size_t fillGap(const float *a, const float *b, size_t count);
+            void correlate(const float *a, const float *b, size_t count);
+            void correlateDirect(size_t count);
+            void correlateFFT(size_t count);
             void clearBuffers();
             void printFunction(const char *s, const float *f);
             bool setTimeInterval(float interval, bool force);
@@ -43,6 +43,20 @@ namespace lsp
                     virtual status_t run();
             };
 
+            class AFScanner: public ipc::ITask
+            {
+                private:
+                    sampler_kernel         *pCore;
+                    afile_t                *pFile;
+
+                public:
+                    AFScanner(sampler_kernel *base, afile_t *descr);
+                    virtual ~AFScanner();
+
+                public:
+                    virtual status_t run();
+            };
+
         protected:
             struct afsample_t
             {
@@ -50,6 +64,11 @@ namespace lsp
                 float               fNorm;                  // Normalizing factor
                 Sample             *pSample;                // Sample
                 float              *vThumbs[TRACKS_MAX];    // List of thumbnails
+                SampleStream       *pStream;                // Stream of the file if it is not completely loaded
+                size_t              nOffset;                // Offset of the preloaded data in the streamed file
+                size_t              nPeaks;                 // Number of peak values for each channel of streamed file
+                size_t              nScanned;               // Number of peak values already computed by the scanner
+                float              *vPeaks[TRACKS_MAX];     // Peak values of the streamed file
             };
 
             enum afindex_t
@@ -64,8 +83,12 @@ namespace lsp
             {
                 size_t              nID;                    // ID of sample
                 AFLoader           *pLoader;                // Audio file loader task
+                AFScanner          *pScanner;               // Peak scanner task of the streamed file
 
                 bool                bDirty;                 // Dirty flag
+                bool                bReload;                // Reload the preloaded part of the streamed file
+                bool                bPreload;               // Loader task only reloads the preloaded part of the current streamed file
+                volatile bool       bInterrupt;             // Interrupt the peak scanner to let the loader replace the sample
                 float               fVelocity;              // Velocity
                 float               fHeadCut;               // Head cut (ms)
                 float               fTailCut;               // Tail cut (ms)
@@ -132,6 +155,9 @@ namespace lsp
             void        destroy_state();
             void        destroy_afsample(afsample_t *af);
             int         load_file(afile_t *file);
+            status_t    load_stream(afile_t *file, afsample_t *af, const char *fname);
+            status_t    scan_peaks(afile_t *file);
+            bool        streams_idle();
             void        copy_asample(afsample_t *dst, const afsample_t *src);
             void        clear_asample(afsample_t *dst);
             void        render_sample(afile_t *af);
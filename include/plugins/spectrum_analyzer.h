@@ -81,6 +81,7 @@ namespace lsp
             float              *vFrequences;
             float              *vMFrequences;
             uint32_t           *vIndexes;
+            const float       **vAnalyze;           // List of analyzer inputs
             uint8_t            *pData;
 
             bool                bBypass;
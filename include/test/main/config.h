@@ -12,6 +12,7 @@
 #include <core/stdlib/stdio.h>
 #include <core/io/charset.h>
 #include <test/main/types.h>
+#include <test/ptest.h>
 #include <data/cvector.h>
 #include <unistd.h>
 #include <errno.h>
@@ -43,6 +44,12 @@ namespace lsp
             const char                 *executable;
             const char                 *outfile;
             const char                 *tracepath;
+            const char                 *report;
+            const char                 *baseline;
+            test::ptest_clock_t         clock;
+            test::ptest_report_t        report_format;
+            size_t                      warmup;
+            double                      tolerance;
             cvector<char>               list;
             cvector<char>               ignore;
             cvector<char>               args;
@@ -74,6 +81,12 @@ namespace lsp
         fputs("    mtest                 Manual testing subsystem\n", out);
         fputs("  Additional arguments:\n", out);
         fputs("    -a, --args [args...]  Pass arguments to test\n", out);
+        fputs("    -b, --baseline file   Fail performance tests which are slower than the\n", out);
+        fputs("                          JSON report of previous launch stored in file\n", out);
+        fputs("    -bt, --tolerance pct  Allowed slowdown relative to the baseline, percents\n", out);
+        fputs("                          (default 10)\n", out);
+        fputs("    -c, --clock type      Clock for performance tests: cpu, mono (default)\n", out);
+        fputs("                          or cycles\n", out);
         fputs("    -d, --debug           Disable time restrictions for unit tests\n", out);
         fputs("                          for debugging purposes\n", out);
         fputs("    -e, --execute         Launch tests specified after this switch\n", out);
@@ -92,10 +105,13 @@ namespace lsp
     #endif /* PLATFORM_LINUX */
         fputs("    -nsi, --nosysinfo     Do not output system information\n", out);
         fputs("    -o, --outfile file    Output performance test statistics to specified file\n", out);
+        fputs("    -r, --report file     Output machine-readable performance test report\n", out);
+        fputs("    -rf, --report-format  Format of the report: json (default) or csv\n", out);
         fputs("    -s, --silent          Do not output additional information from tests\n", out);
         fputs("    -si, --sysinfo        Output system information\n", out);
         fputs("    -t, --tracepath path  Override default trace path with specified value\n", out);
         fputs("    -v, --verbose         Output additional information from tests\n", out);
+        fputs("    -w, --warmup count    Number of warmup batches of performance test loops\n", out);
 
         return STATUS_INSUFFICIENT;
     }
@@ -200,6 +216,96 @@ namespace lsp
                 }
                 outfile     = argv[i];
             }
+            else if ((!strcmp(argv[i], "--report")) || (!strcmp(argv[i], "-r")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified name of report file\n");
+                    return STATUS_INVALID_VALUE;
+                }
+                report      = argv[i];
+            }
+            else if ((!strcmp(argv[i], "--report-format")) || (!strcmp(argv[i], "-rf")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified format of report\n");
+                    return STATUS_INVALID_VALUE;
+                }
+                if (!strcmp(argv[i], "json"))
+                    report_format   = test::PTEST_REPORT_JSON;
+                else if (!strcmp(argv[i], "csv"))
+                    report_format   = test::PTEST_REPORT_CSV;
+                else
+                {
+                    fprintf(stderr, "Invalid value for --report-format parameter: %s\n", argv[i]);
+                    return STATUS_INVALID_VALUE;
+                }
+            }
+            else if ((!strcmp(argv[i], "--baseline")) || (!strcmp(argv[i], "-b")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified name of baseline file\n");
+                    return STATUS_INVALID_VALUE;
+                }
+                baseline    = argv[i];
+            }
+            else if ((!strcmp(argv[i], "--tolerance")) || (!strcmp(argv[i], "-bt")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified value for --tolerance parameter\n");
+                    return STATUS_INVALID_VALUE;
+                }
+
+                errno           = 0;
+                char *end       = NULL;
+                double tol      = strtod(argv[i], &end);
+                if ((errno != 0) || ((*end) != '\0') || (tol < 0.0))
+                {
+                    fprintf(stderr, "Invalid value for --tolerance parameter: %s\n", argv[i]);
+                    return STATUS_INVALID_VALUE;
+                }
+                tolerance       = tol;
+            }
+            else if ((!strcmp(argv[i], "--clock")) || (!strcmp(argv[i], "-c")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified type of clock\n");
+                    return STATUS_INVALID_VALUE;
+                }
+                if (!strcmp(argv[i], "cpu"))
+                    clock           = test::PTEST_CLOCK_CPU;
+                else if (!strcmp(argv[i], "mono"))
+                    clock           = test::PTEST_CLOCK_MONOTONIC;
+                else if (!strcmp(argv[i], "cycles"))
+                    clock           = test::PTEST_CLOCK_CYCLES;
+                else
+                {
+                    fprintf(stderr, "Invalid value for --clock parameter: %s\n", argv[i]);
+                    return STATUS_INVALID_VALUE;
+                }
+            }
+            else if ((!strcmp(argv[i], "--warmup")) || (!strcmp(argv[i], "-w")))
+            {
+                if ((++i) >= argc)
+                {
+                    fprintf(stderr, "Not specified number of batches for --warmup parameter\n");
+                    return STATUS_INVALID_VALUE;
+                }
+
+                errno           = 0;
+                char *end       = NULL;
+                long count      = strtol(argv[i], &end, 10);
+                if ((errno != 0) || ((*end) != '\0') || (count < 0))
+                {
+                    fprintf(stderr, "Invalid value for --warmup parameter: %s\n", argv[i]);
+                    return STATUS_INVALID_VALUE;
+                }
+                warmup          = size_t(count);
+            }
             else if ((!strcmp(argv[i], "--args")) || (!strcmp(argv[i], "-a")))
             {
                 while (++i < argc)
@@ -259,6 +365,12 @@ namespace lsp
         executable  = NULL;
         tracepath   = "/tmp/lsp-plugins-trace";
         outfile     = NULL;
+        report      = NULL;
+        baseline    = NULL;
+        clock       = test::PTEST_CLOCK_MONOTONIC;
+        report_format   = test::PTEST_REPORT_JSON;
+        warmup      = 0;
+        tolerance   = 10.0;
         threads     = 1;
 
 #if defined(PLATFORM_WINDOWS)
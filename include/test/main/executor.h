@@ -279,6 +279,8 @@ namespace lsp
         // Execute performance test
         test->set_executable(pCfg->executable);
         test->set_verbose(pCfg->verbose);
+        test->set_clock(pCfg->clock);
+        test->set_warmup(pCfg->warmup);
         start_memcheck(test);
         test->init();
         test->execute(pCfg->args.size(), const_cast<const char **>(cfg->args.get_array()));
@@ -304,9 +306,30 @@ namespace lsp
             }
         }
 
+        // Append machine-readable records to the report file
+        if (pCfg->report != NULL)
+        {
+            FILE *fd = fopen(pCfg->report, "a");
+            if (fd != NULL)
+            {
+                test->dump_report(fd, pCfg->report_format);
+                fflush(fd);
+                fclose(fd);
+            }
+        }
+
+        // Compare results with the baseline
+        status_t res = STATUS_OK;
+        if (pCfg->baseline != NULL)
+        {
+            res = test->check_baseline(pCfg->baseline, pCfg->tolerance);
+            if ((res != STATUS_OK) && (res != STATUS_FAILED))
+                fprintf(stderr, "Could not read baseline file %s, error code=%d\n", pCfg->baseline, int(res));
+        }
+
         test->free_stats();
 
-        return STATUS_OK;
+        return res;
     }
 
     status_t TestExecutor::launch(test::ManualTest *test)
@@ -530,6 +553,43 @@ namespace lsp
             if (res == STATUS_OK)
                 res     = cmdline_append_escaped(&cmdbuf, &len, &cap, pCfg->outfile);
         }
+        if ((res == STATUS_OK) && (pCfg->report != NULL))
+        {
+            res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--report");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, pCfg->report);
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--report-format");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, (pCfg->report_format == test::PTEST_REPORT_CSV) ? "csv" : "json");
+        }
+        if ((res == STATUS_OK) && (pCfg->baseline != NULL))
+        {
+            char buf[32];
+            sprintf(buf, "%f", pCfg->tolerance);
+            res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--baseline");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, pCfg->baseline);
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--tolerance");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, buf);
+        }
+        if (res == STATUS_OK)
+        {
+            char buf[32];
+            sprintf(buf, "%d", int(pCfg->warmup));
+            res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--clock");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap,
+                        (pCfg->clock == test::PTEST_CLOCK_CPU) ? "cpu" :
+                        (pCfg->clock == test::PTEST_CLOCK_CYCLES) ? "cycles" :
+                        "mono");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, "--warmup");
+            if (res == STATUS_OK)
+                res     = cmdline_append_escaped(&cmdbuf, &len, &cap, buf);
+        }
         if (res == STATUS_OK)
             res     = cmdline_append_escaped(&cmdbuf, &len, &cap, task->test->full_name());
         if ((res == STATUS_OK) && (pCfg->args.size() > 0))
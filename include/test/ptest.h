@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <core/types.h>
+#include <core/status.h>
 #include <core/stdlib/stdio.h>
 #include <data/cstorage.h>
 #include <test/test.h>
@@ -41,49 +42,41 @@
 #define PTEST_SUPPORTED(ptr)        TEST_SUPPORTED(ptr)
 
 #define PTEST_LOOP(__key, ...) { \
-        double __start = clock(); \
-        double __time = 0.0f; \
-        wsize_t __iterations = 0; \
+        loop_t __loop; \
         \
+        start_loop(&__loop); \
         do { \
             for (size_t __i=0; __i<__test_iterations; ++__i) { \
                 __VA_ARGS__; \
             } \
-            /* Calculate statistics */ \
-            __iterations   += __test_iterations; \
-            __time          = (clock() - __start) / CLOCKS_PER_SEC; \
-        } while (__time < __test_time); \
+        } while (next_batch(&__loop, __test_iterations)); \
         \
-        gather_stats(__key, __time, __iterations); \
+        gather_stats(__key, &__loop); \
         if (__verbose) { \
-            printf("  time [s]:                 %.2f/%.2f\n", __time, __test_time); \
-            printf("  iterations:               %ld/%ld\n", long(__iterations), long((__iterations * __test_time) / __time)); \
-            printf("  performance [i/s]:        %.2f\n", __iterations / __time); \
-            printf("  iteration time [us/i]:    %.4f\n\n", (1000000.0 * __time) / __iterations); \
+            printf("  time [s]:                 %.2f/%.2f\n", __loop.time, __test_time); \
+            printf("  iterations:               %ld/%ld\n", long(__loop.iterations), long((__loop.iterations * __test_time) / __loop.time)); \
+            printf("  performance [i/s]:        %.2f\n", __loop.iterations / __loop.time); \
+            printf("  iteration time [us/i]:    %.4f\n\n", (1000000.0 * __loop.time) / __loop.iterations); \
         } \
     }
 
 #define PTEST_KLOOP(__key, __mul, ...) { \
-        double __start = clock(); \
-        double __time = 0.0f; \
-        wsize_t __iterations = 0; \
+        loop_t __loop; \
         wsize_t __k_iterations = __test_iterations; \
         \
+        start_loop(&__loop); \
         do { \
             for (size_t __i=0; __i<__k_iterations; ++__i) { \
                 __VA_ARGS__; \
             } \
-            /* Calculate statistics */ \
-            __iterations   += __k_iterations; \
-            __time          = (clock() - __start) / CLOCKS_PER_SEC; \
-        } while (__time < __test_time); \
+        } while (next_batch(&__loop, __k_iterations)); \
         \
-        gather_stats(__key, __time, __iterations); \
+        gather_stats(__key, &__loop); \
         if (__verbose) { \
-            printf("  time [s]:                 %.2f/%.2f\n", __time, __test_time); \
-            printf("  iterations:               %ld/%ld\n", long(__iterations), long((__iterations * __test_time) / __time)); \
-            printf("  performance [i/s]:        %.2f\n", __iterations / __time); \
-            printf("  iteration time [us/i]:    %.4f\n\n", (1000000.0 * __time) / __iterations); \
+            printf("  time [s]:                 %.2f/%.2f\n", __loop.time, __test_time); \
+            printf("  iterations:               %ld/%ld\n", long(__loop.iterations), long((__loop.iterations * __test_time) / __loop.time)); \
+            printf("  performance [i/s]:        %.2f\n", __loop.iterations / __loop.time); \
+            printf("  iteration time [us/i]:    %.4f\n\n", (1000000.0 * __loop.time) / __loop.iterations); \
         } \
     }
 
@@ -114,6 +107,25 @@
 
 namespace test
 {
+    /**
+     * Clock used for measurements
+     */
+    enum ptest_clock_t
+    {
+        PTEST_CLOCK_CPU,            // Process CPU time
+        PTEST_CLOCK_MONOTONIC,      // Monotonic wall-clock time
+        PTEST_CLOCK_CYCLES          // CPU cycle counter, the time budget is controlled by monotonic clock
+    };
+
+    /**
+     * Format of machine-readable report
+     */
+    enum ptest_report_t
+    {
+        PTEST_REPORT_JSON,          // One JSON object per case, the whole report is a JSON array
+        PTEST_REPORT_CSV            // One CSV row per case
+    };
+
     class PerformanceTest: public Test
     {
         private:
@@ -133,20 +145,51 @@ namespace test
                 char       *n_iterations;   /* Normalized number of iterations */
                 char       *performance;    /* The performance of test [iterations per second] */
                 char       *time_cost;      /* The amount of time spent per iteration [milliseconds per iteration] */
+                char       *p50;            /* Median cost of iteration */
+                char       *p99;            /* 99th percentile of iteration cost */
+                char       *max;            /* Maximum cost of iteration */
                 char       *rel;            /* The relative speed */
                 double      cost;           /* The overall cost */
+                double      v_time;         /* Actual time [seconds] */
+                wsize_t     v_iterations;   /* Number of iterations */
+                double      v_mean;         /* Mean cost of iteration [clock units] */
+                double      v_p50;          /* Median cost of iteration [clock units] */
+                double      v_p99;          /* 99th percentile of iteration cost [clock units] */
+                double      v_max;          /* Maximum cost of iteration [clock units] */
             } stats_t;
 
+            typedef struct loop_t
+            {
+                double                  start;      /* Start time of measurement [seconds] */
+                double                  time;       /* Overall time of measurement [seconds] */
+                wsize_t                 iterations; /* Overall number of measured iterations */
+                double                  stamp;      /* Start of the current batch [clock units] */
+                size_t                  warmup;     /* Number of warmup batches left */
+                lsp::cstorage<double>   samples;    /* Cost of one iteration in each batch [clock units] */
+            } loop_t;
+
         protected:
             size_t                              __test_iterations;
             double                              __test_time;
+            ptest_clock_t                       __test_clock;
+            size_t                              __test_warmup;
             mutable lsp::cstorage<stats_t>      __test_stats;
 
         protected:
+            double  time_stamp() const;
+            double  sample_stamp() const;
+            const char *units() const;
+            double  units_scale() const;
+
+            void start_loop(loop_t *loop);
+            bool next_batch(loop_t *loop, wsize_t iterations);
+
             void gather_stats(const char *key, double time, wsize_t iterations);
+            void gather_stats(const char *key, loop_t *loop);
             static void destroy_stats(stats_t *stats);
             static void estimate(size_t *len, const char *text);
             static void out_text(FILE *out, size_t length, const char *text, int align, const char *padding, const char *tail);
+            static void out_escaped(FILE *out, const char *text, ptest_report_t format);
 
         public:
             int             printf(const char *fmt, ...);
@@ -159,8 +202,28 @@ namespace test
             inline PerformanceTest *next()          { return __next; }
             virtual Test *next_test() const         { return const_cast<PerformanceTest *>(__next); };
 
+            inline void set_clock(ptest_clock_t clock)  { __test_clock = clock; }
+            inline void set_warmup(size_t warmup)       { __test_warmup = warmup; }
+
             void dump_stats(FILE *out) const;
             void free_stats();
+
+            /**
+             * Output machine-readable statistics, one record per measured case
+             * @param out output file
+             * @param format format of the report
+             */
+            void dump_report(FILE *out, ptest_report_t format) const;
+
+            /**
+             * Compare median iteration cost of all measured cases with the baseline
+             * which is the JSON report of one of previous launches
+             * @param path location of the baseline report
+             * @param tolerance allowed slowdown relative to the baseline [%]
+             * @return STATUS_OK if there are no regressions, STATUS_FAILED if there are
+             *   regressions, other error code on error
+             */
+            status_t check_baseline(const char *path, double tolerance) const;
     };
 
 
@@ -32,6 +32,7 @@ namespace lsp
                 uint32_t        nCurrRow;       // Synchronized rowId
                 float          *vData;          // Frame buffer data
                 float          *vTempRGBA;      // Temporary RGBA buffer data
+                uint32_t       *vPalette;       // Lookup table of BGRA32 colors for palette
                 uint8_t        *pData;          // Allocation pointer
                 float           fTransparency;  // Frame buffer transparency
                 size_t          nAngle;         // Frame buffer rotation angle 0..3
@@ -54,6 +55,8 @@ namespace lsp
                 void            calc_lightness(float *rgba, const float *value, size_t n);
                 void            calc_lightness2(float *rgba, const float *value, size_t n);
                 void            allocate_buffer();
+                void            build_palette();
+                void            colorize(uint32_t *dst, const float *v, size_t n);
                 void            check_color_changed();
                 float          *get_buffer();
                 float          *get_rgba_buffer();
@@ -9,7 +9,7 @@
 #include <core/lib.h>
 #include <core/debug.h>
 #include <core/status.h>
-#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/ThreadPoolExecutor.h>
 
 #include <dsp/dsp.h>
 
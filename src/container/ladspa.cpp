@@ -7,7 +7,7 @@
 #include <core/types.h>
 #include <core/lib.h>
 #include <core/debug.h>
-#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/ThreadPoolExecutor.h>
 #include <core/resource.h>
 #include <plugins/plugins.h>
 
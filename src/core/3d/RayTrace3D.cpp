@@ -34,10 +34,12 @@ namespace lsp
     };
 
 
-    RayTrace3D::TaskThread::TaskThread(RayTrace3D *trace)
+    RayTrace3D::TaskThread::TaskThread(RayTrace3D *trace, size_t id)
     {
         this->trace     = trace;
-        heavy_state     = S_SCAN_OBJECTS;
+        this->id        = id;
+        this->victim    = id;
+        this->scan_tag  = 0;
     }
 
     RayTrace3D::TaskThread::~TaskThread()
@@ -63,7 +65,9 @@ namespace lsp
         }
 
         destroy_objects(&objects);
+        destroy_tasks(&tasks);
         bindings.flush();
+        tasks.flush();
     }
 
     status_t RayTrace3D::TaskThread::run()
@@ -98,46 +102,42 @@ namespace lsp
                 break;
             }
 
-            // Try to fetch new task from internal queue
-            if (!tasks.pop(&ctx))
+            // Try to fetch new task from internal queue, then from the list of root tasks,
+            // then steal task from other threads
+            if ((ctx = tasks.pop()) != NULL)
+                ++stats.local_tasks;
+            else if ((ctx = fetch_root_task()) != NULL)
             {
-                // Are there any tasks left in global space?
-                trace->lkTasks.lock();
-                if (!trace->vTasks.pop(&ctx))
-                {
-                    trace->lkTasks.unlock();
-                    break;
-                }
-
-                // Update statistics
-                if (trace->nQueueSize > trace->vTasks.size())
-                {
-                    report      = true;
-                    trace->nQueueSize  = trace->vTasks.size();
-                }
+                report      = true;
                 ++stats.root_tasks;
-                trace->lkTasks.unlock();
             }
-            else
-                ++stats.local_tasks;
-
-            if (ctx == NULL)
+            else if ((ctx = steal_task()) != NULL)
+                ++stats.stolen_tasks;
+            else if (trace->nPending <= 0) // All tasks have been processed?
                 break;
+            else
+            {
+                // Other threads still process tasks and may generate new ones
+                ++stats.idle_loops;
+                ipc::Thread::yield();
+                continue;
+            }
 
             // Process context state
             res     = process_context(ctx);
+            atomic_add(&trace->nPending, -1);
 
             // Report status if required
             if ((res == STATUS_OK) && (report))
             {
                 report      = false;
 
-                trace->lkTasks.lock();
+                trace->lkProgress.lock();
                 float prg   = float(trace->nProgressPoints) / float(trace->nProgressMax);
                 lsp_trace("Reporting progress %d/%d = %.2f%%", int(trace->nProgressPoints), int(trace->nProgressMax), prg * 100.0f);
                 ++trace->nProgressPoints;
                 res         = trace->report_progress(prg);
-                trace->lkTasks.unlock();
+                trace->lkProgress.unlock();
             }
 
             if (res != STATUS_OK)
@@ -150,22 +150,60 @@ namespace lsp
         return res;
     }
 
-    status_t RayTrace3D::TaskThread::submit_task(rt_context_t *ctx)
+    rt_context_t *RayTrace3D::TaskThread::fetch_root_task()
+    {
+        size_t n            = trace->vTasks.size();
+        if (trace->nRootTask >= n)
+            return NULL;
+
+        size_t idx          = atomic_add(&trace->nRootTask, 1);
+        if (idx >= n)
+            return NULL;
+
+        // Each slot is accessed by one thread only, so it is safe to modify it
+        rt_context_t *ctx   = trace->vTasks.get(idx);
+        trace->vTasks.set(idx, NULL);
+        return ctx;
+    }
+
+    rt_context_t *RayTrace3D::TaskThread::steal_task()
     {
-        // 'Heavy' state and pretty high number of pending tasks - submit task to global queue
-        if (ctx->state == heavy_state)
+        rt_context_t *ctx   = NULL;
+        size_t n            = trace->vThreads.size();
+
+        // Start with the thread we have successfully stolen task from last time
+        for (size_t i=0; i<n; ++i)
         {
-            if (trace->vTasks.size() < TASK_LO_THRESH)
+            size_t idx          = (victim + i) % n;
+            if (idx == id)
+                continue;
+
+            TaskThread *t       = trace->vThreads.at(idx);
+            switch (t->tasks.steal(&ctx))
             {
-                trace->lkTasks.lock();
-                status_t res = (trace->vTasks.push(ctx)) ? STATUS_OK : STATUS_NO_MEM;
-                trace->lkTasks.unlock();
-                return res;
+                case cdeque<rt_context_t>::STEAL_OK:
+                    victim          = idx;
+                    return ctx;
+                case cdeque<rt_context_t>::STEAL_ABORT:
+                    ++stats.steal_contended;
+                    break;
+                default:
+                    break;
             }
         }
 
-        // Otherwise, submit to local task queue
-        return (tasks.push(ctx)) ? STATUS_OK : STATUS_NO_MEM;
+        return NULL;
+    }
+
+    status_t RayTrace3D::TaskThread::submit_task(rt_context_t *ctx)
+    {
+        // The task should be counted as pending before it becomes visible to other threads
+        atomic_add(&trace->nPending, 1);
+        if (tasks.push(ctx))
+            return STATUS_OK;
+
+        atomic_add(&trace->nPending, -1);
+        return STATUS_NO_MEM;
     }
 
     status_t RayTrace3D::TaskThread::process_context(rt_context_t *ctx)
@@ -524,6 +562,7 @@ namespace lsp
                         return STATUS_NO_MEM;
                     e->v[0]         = *(se->v[0]);
                     e->v[1]         = *(se->v[1]);
+                    e->itag         = -1;
                     se->itag        = itag++;
                 }
             }
@@ -545,7 +584,8 @@ namespace lsp
         for (size_t i=0; i<8; ++i)
             dsp::apply_matrix3d_mp2(&o->bbox.p[i], &bbox->p[i], m);
 
-        return STATUS_OK;
+        // Build bounding volume hierarchy of the mesh
+        return o->bvh.build(o->mesh.get_array(), o->mesh.size());
     }
 
     status_t RayTrace3D::TaskThread::scan_objects(rt_context_t *ctx)
@@ -685,7 +725,7 @@ namespace lsp
             }
 
             // Add object to context
-            res = ctx->add_object(rt->mesh.get_array(), rt->plan.get_array(), rt->mesh.size(), rt->plan.size());
+            res = ctx->add_object(rt->mesh.get_array(), &rt->bvh, ++scan_tag);
             if (res != STATUS_OK)
                 return res;
             ++n_objs;
@@ -1355,7 +1395,6 @@ namespace lsp
         }
 
         // Estimate the progress by doing set of steps
-        heavy_state = -1; // This guarantees that all tasks will be submitted to local task queue
         do
         {
             while (estimate.size() > 0)
@@ -1387,17 +1426,26 @@ namespace lsp
                 }
             }
 
-            // Perform swap: empty local tasks, fill 'estimate' with them
-            estimate.swap_data(&tasks);
+            // Move generated tasks from local task queue to 'estimate'
+            while ((ctx = tasks.pop()) != NULL)
+            {
+                if (!estimate.add(ctx))
+                {
+                    delete ctx;
+                    destroy_tasks(&tasks);
+                    destroy_tasks(&estimate);
+                    return STATUS_NO_MEM;
+                }
+            }
         } while ((estimate.size() > 0) && (estimate.size() < TASK_LO_THRESH));
 
-        heavy_state         = S_SCAN_OBJECTS; // Enable global task queue for this thread
-        trace->vTasks.swap_data(&estimate); // Now all generated tasks are global
+        trace->vTasks.swap_data(&estimate); // Now all generated tasks are root tasks
+        trace->nRootTask        = 0;
+        trace->nPending         = trace->vTasks.size();
 
         // Values to report progress
         trace->nProgressPoints  = 1;
-        trace->nQueueSize       = trace->vTasks.size();
-        trace->nProgressMax     = trace->nQueueSize + 2;
+        trace->nProgressMax     = trace->vTasks.size() + 2;
 
         // Report progress
         res         = trace->report_progress(float(trace->nProgressPoints++) / float(trace->nProgressMax));
@@ -1504,6 +1552,11 @@ namespace lsp
             if (!d->mesh.add_all(&s->mesh))
                 return STATUS_NO_MEM;
 
+            // Copy bounding volume hierarchy
+            status_t res = d->bvh.copy(&s->bvh);
+            if (res != STATUS_OK)
+                return res;
+
             // Patch pointers
             se = s->plan.get_array();
             de = d->plan.get_array();
@@ -1608,7 +1661,9 @@ namespace lsp
         fDetalization   = 1e-10f;
         bNormalize      = true;
         bCancelled      = false;
-        nQueueSize      = 0;
+        bFailed         = false;
+        nRootTask       = 0;
+        nPending        = 0;
         nProgressPoints = 0;
         nProgressMax    = 0;
     }
@@ -1622,6 +1677,9 @@ namespace lsp
     {
         stats->root_tasks       = 0;
         stats->local_tasks      = 0;
+        stats->stolen_tasks     = 0;
+        stats->steal_contended  = 0;
+        stats->idle_loops       = 0;
         stats->calls_scan       = 0;
         stats->calls_cull       = 0;
         stats->calls_split      = 0;
@@ -1635,6 +1693,9 @@ namespace lsp
         lsp_trace("%s:\n"
                 "  root tasks processed     : %lld\n"
                 "  local tasks processed    : %lld\n"
+                "  stolen tasks processed   : %lld\n"
+                "  contended steals         : %lld\n"
+                "  idle loops               : %lld\n"
                 "  scan_objects             : %lld\n"
                 "  cull_view                : %lld\n"
                 "  split_view               : %lld\n"
@@ -1644,6 +1705,9 @@ namespace lsp
             label,
             (long long)stats->root_tasks,
             (long long)stats->local_tasks,
+            (long long)stats->stolen_tasks,
+            (long long)stats->steal_contended,
+            (long long)stats->idle_loops,
             (long long)stats->calls_scan,
             (long long)stats->calls_cull,
             (long long)stats->calls_split,
@@ -1657,6 +1721,9 @@ namespace lsp
     {
         dst->root_tasks        += src->root_tasks;
         dst->local_tasks       += src->local_tasks;
+        dst->stolen_tasks      += src->stolen_tasks;
+        dst->steal_contended   += src->steal_contended;
+        dst->idle_loops        += src->idle_loops;
         dst->calls_scan        += src->calls_scan;
         dst->calls_cull        += src->calls_cull;
         dst->calls_split       += src->calls_split;
@@ -1677,6 +1744,13 @@ namespace lsp
         tasks->flush();
     }
 
+    void RayTrace3D::destroy_tasks(cdeque<rt_context_t> *tasks)
+    {
+        rt_context_t *ctx;
+        while ((ctx = tasks->pop()) != NULL)
+            delete ctx;
+    }
+
     void RayTrace3D::destroy_objects(cvector<rt_object_t> *objects)
     {
         for (size_t i=0, n=objects->size(); i<n; ++i)
@@ -1686,6 +1760,7 @@ namespace lsp
             {
                 obj->mesh.flush();
                 obj->plan.flush();
+                obj->bvh.flush();
                 delete obj;
             }
         }
@@ -1900,26 +1975,33 @@ namespace lsp
 #endif
 
         // Create main thread
-        TaskThread *root = new TaskThread(this);
+        TaskThread *root = new TaskThread(this, 0);
         if (root == NULL)
             return STATUS_NO_MEM;
+        else if (!vThreads.add(root))
+        {
+            delete root;
+            return STATUS_NO_MEM;
+        }
 
         // Launch prepare_main_loop in root thread's context
         res    = root->prepare_main_loop(initial);
         if (res != STATUS_OK)
         {
+            vThreads.flush();
             delete root;
             return res;
         }
 
-        // Launch supplementary threads
+        // Create supplementary threads. All threads should be registered
+        // before launch since each of them can steal tasks from any other
         cvector<TaskThread> workers;
         if (vTasks.size() > 0)
         {
             for (size_t i=1; i<threads; ++i)
             {
                 // Create thread object
-                TaskThread *t   = new TaskThread(this);
+                TaskThread *t   = new TaskThread(this, i);
                 if ((t == NULL) || (!workers.add(t)))
                 {
                     if (t != NULL)
@@ -1932,14 +2014,16 @@ namespace lsp
                 res = t->prepare_supplementary_loop(root);
                 if (res != STATUS_OK)
                     break;
-
-                // Launch thread
-                res = t->start();
-                if (res != STATUS_OK)
-                    break;
             }
+
+            if ((res == STATUS_OK) && (!vThreads.add_all(&workers)))
+                res = STATUS_NO_MEM;
         }
 
+        // Launch supplementary threads
+        for (size_t i=0,n=workers.size(); (res == STATUS_OK) && (i<n); ++i)
+            res = workers.at(i)->start();
+
         // If successful status, perform main loop
         if (res == STATUS_OK)
             res     = root->run();
@@ -1983,6 +2067,7 @@ namespace lsp
         }
         delete root;
         workers.flush();
+        vThreads.flush();
 
         // Dump overall statistics
         if (res != STATUS_BREAK_POINT)
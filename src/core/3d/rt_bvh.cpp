@@ -0,0 +1,173 @@
+/*
+ * rt_bvh.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <core/3d/rt_bvh.h>
+
+namespace lsp
+{
+    static inline float centroid(const rtx_triangle_t *t, size_t axis)
+    {
+        // We don't need to divide by 3 since only the order matters
+        const float *v0 = &t->v[0].x;
+        const float *v1 = &t->v[1].x;
+        const float *v2 = &t->v[2].x;
+        return v0[axis] + v1[axis] + v2[axis];
+    }
+
+    rt_bvh_t::rt_bvh_t()
+    {
+    }
+
+    rt_bvh_t::~rt_bvh_t()
+    {
+        flush();
+    }
+
+    void rt_bvh_t::select(const rtx_triangle_t *vt, size_t *idx, size_t count, size_t k, size_t axis)
+    {
+        size_t tmp;
+        size_t left = 0, right = count - 1;
+
+        // Hoare's selection: put k-th triangle at it's place, all triangles
+        // before k will have not greater centroid, all triangles after k - not less
+        while (left < right)
+        {
+            float pivot = centroid(&vt[idx[(left + right) >> 1]], axis);
+            size_t i = left, j = right;
+
+            while (i <= j)
+            {
+                while (centroid(&vt[idx[i]], axis) < pivot)
+                    ++i;
+                while (centroid(&vt[idx[j]], axis) > pivot)
+                    --j;
+                if (i > j)
+                    break;
+
+                tmp     = idx[i];
+                idx[i]  = idx[j];
+                idx[j]  = tmp;
+                ++i;
+                if (j-- == 0)
+                    break;
+            }
+
+            if (k <= j)
+                right   = j;
+            else if (k >= i)
+                left    = i;
+            else
+                break;
+        }
+    }
+
+    status_t rt_bvh_t::build_node(const rtx_triangle_t *vt, size_t first, size_t count, size_t depth)
+    {
+        size_t id           = nodes.size();
+        rt_bvh_node_t *node = nodes.add();
+        if (node == NULL)
+            return STATUS_NO_MEM;
+
+        // Compute bounding box of triangles and bounding box of centroids
+        point3d_t cmin, cmax;
+        size_t *idx         = index.get_array();
+        const rtx_triangle_t *t = &vt[idx[first]];
+
+        node->min           = t->v[0];
+        node->max           = t->v[0];
+        cmin.x              = centroid(t, 0);
+        cmin.y              = centroid(t, 1);
+        cmin.z              = centroid(t, 2);
+        cmax                = cmin;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            t                   = &vt[idx[first + i]];
+            for (size_t j=0; j<3; ++j)
+            {
+                const point3d_t *p  = &t->v[j];
+                if (node->min.x > p->x) node->min.x = p->x;
+                if (node->min.y > p->y) node->min.y = p->y;
+                if (node->min.z > p->z) node->min.z = p->z;
+                if (node->max.x < p->x) node->max.x = p->x;
+                if (node->max.y < p->y) node->max.y = p->y;
+                if (node->max.z < p->z) node->max.z = p->z;
+            }
+
+            float cx = centroid(t, 0), cy = centroid(t, 1), cz = centroid(t, 2);
+            if (cmin.x > cx) cmin.x = cx;
+            if (cmin.y > cy) cmin.y = cy;
+            if (cmin.z > cz) cmin.z = cz;
+            if (cmax.x < cx) cmax.x = cx;
+            if (cmax.y < cy) cmax.y = cy;
+            if (cmax.z < cz) cmax.z = cz;
+        }
+
+        // Small number of triangles or too deep hierarchy: make a leaf
+        if ((count <= RT_BVH_LEAF_SIZE) || (depth >= (RT_BVH_DEPTH_MAX - 1)))
+        {
+            node->first         = first;
+            node->count         = count;
+            return STATUS_OK;
+        }
+
+        // Split triangles by the median along the axis with the largest spread of centroids
+        float dx            = cmax.x - cmin.x;
+        float dy            = cmax.y - cmin.y;
+        float dz            = cmax.z - cmin.z;
+        size_t axis         = ((dx >= dy) && (dx >= dz)) ? 0 : (dy >= dz) ? 1 : 2;
+        size_t half         = count >> 1;
+        node->count         = 0;
+
+        select(vt, &idx[first], count, half, axis);
+
+        // Build children, the node pointer may become invalid after this call
+        status_t res        = build_node(vt, first, half, depth + 1);
+        if (res != STATUS_OK)
+            return res;
+
+        size_t right        = nodes.size();
+        res                 = build_node(vt, first + half, count - half, depth + 1);
+        if (res != STATUS_OK)
+            return res;
+
+        nodes.at(id)->first = right;
+        return STATUS_OK;
+    }
+
+    status_t rt_bvh_t::copy(const rt_bvh_t *src)
+    {
+        nodes.clear();
+        index.clear();
+        if ((!nodes.add_all(&src->nodes)) || (!index.add_all(&src->index)))
+        {
+            flush();
+            return STATUS_NO_MEM;
+        }
+        return STATUS_OK;
+    }
+
+    status_t rt_bvh_t::build(const rtx_triangle_t *vt, size_t n)
+    {
+        nodes.clear();
+        index.clear();
+        if (n <= 0)
+            return STATUS_OK;
+
+        // Initialize triangle index
+        size_t *idx     = index.append_n(n);
+        if (idx == NULL)
+            return STATUS_NO_MEM;
+        for (size_t i=0; i<n; ++i)
+            idx[i]          = i;
+
+        status_t res    = build_node(vt, 0, n, 0);
+        if (res != STATUS_OK)
+            flush();
+        return res;
+    }
+}
@@ -7,6 +7,7 @@
 
 #include <core/3d/common.h>
 #include <core/3d/rt_context.h>
+#include <stdlib.h>
 
 namespace lsp
 {
@@ -994,6 +995,83 @@ namespace lsp
         return STATUS_OK;
     }
 
+    static int compare_indexes(const void *p1, const void *p2)
+    {
+        size_t i1 = *reinterpret_cast<const size_t *>(p1);
+        size_t i2 = *reinterpret_cast<const size_t *>(p2);
+        return (i1 < i2) ? -1 : (i1 > i2) ? 1 : 0;
+    }
+
+    status_t rt_context_t::add_object(rtx_triangle_t *vt, const rt_bvh_t *bvh, ssize_t tag)
+    {
+        status_t res;
+        const rt_bvh_node_t *nodes  = bvh->nodes.get_array();
+        const size_t *index         = bvh->index.get_array();
+        if ((nodes == NULL) || (index == NULL))
+            return STATUS_OK;
+
+        // Traverse the hierarchy in the depth-first order and collect triangles of visible leafs
+        cstorage<size_t> visible;
+        size_t stack[RT_BVH_DEPTH_MAX + 1];
+        size_t top      = 0;
+        stack[top++]    = 0;
+
+        while (top > 0)
+        {
+            const rt_bvh_node_t *node = &nodes[stack[--top]];
+            if (!rt_bvh_t::visible(node, view.pl))
+                continue;
+
+            // Inner node: visit both children
+            if (node->count <= 0)
+            {
+                stack[top++]    = node->first;
+                stack[top++]    = (node - nodes) + 1;
+                continue;
+            }
+
+            // Leaf node: remember all triangles
+            if (!visible.add_all(&index[node->first], node->count))
+                return STATUS_NO_MEM;
+        }
+
+        // The result of ray tracing depends on the order of triangles,
+        // so keep the original order of triangles in the mesh
+        size_t n        = visible.size();
+        size_t *vi      = visible.get_array();
+        if (n > 1)
+            ::qsort(vi, n, sizeof(size_t), compare_indexes);
+
+        // Add all visible triangles
+        for (size_t i=0; i<n; ++i)
+        {
+            const rtx_triangle_t *t = &vt[vi[i]];
+            // Skip ignored triangles
+            if ((t->oid == view.oid) && (t->face == view.face))
+                continue;
+
+            // Add triangle
+            res = add_triangle(reinterpret_cast<const rt_triangle_t *>(t));
+            if (res == STATUS_SKIP)
+                continue;
+            else if (res != STATUS_OK)
+                return res;
+
+            // Add edges to plan
+            for (size_t j=0; j<3; ++j)
+            {
+                rtx_edge_t *e = t->e[j];
+                if (e->itag == tag)
+                    continue;
+                if ((res = add_edge(e)) != STATUS_OK)
+                    return res;
+                e->itag         = tag;
+            }
+        }
+
+        return STATUS_OK;
+    }
+
     status_t rt_context_t::cull_view()
     {
         vector3d_t pl[4]; // Split plane
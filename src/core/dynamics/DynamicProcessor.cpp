@@ -7,10 +7,12 @@
 
 #include <dsp/dsp.h>
 #include <core/dynamics/DynamicProcessor.h>
+#include <core/dynamics/follower.h>
 #include <core/interpolation.h>
 #include <core/debug.h>
 #include <core/units.h>
 #include <math.h>
+#include <float.h>
 
 namespace lsp
 {
@@ -300,6 +302,55 @@ namespace lsp
         reduction(out, out, samples);
     }
 
+    void DynamicProcessor::process(DynamicProcessor **p, float **out, float **env, const float **in, size_t n, size_t samples)
+    {
+        follower_t f[FOLLOWER_LANES_MAX];
+        DynamicProcessor *vp[FOLLOWER_LANES_MAX];
+        float *vout[FOLLOWER_LANES_MAX];
+        float *venv[FOLLOWER_LANES_MAX];
+        const float *vin[FOLLOWER_LANES_MAX];
+
+        for (size_t i=0; i<n; )
+        {
+            // Collect the group of processors, processors with level-dependent
+            // reactions can not be processed in SIMD lanes
+            size_t count    = 0;
+            for ( ; (i<n) && (count < FOLLOWER_LANES_MAX); ++i)
+            {
+                DynamicProcessor *c = p[i];
+                float *e            = (env != NULL) ? env[i] : NULL;
+                if ((c->fCount[CT_ATTACK] > 1) || (c->fCount[CT_RELEASE] > 1))
+                {
+                    c->process(out[i], e, in[i], samples);
+                    continue;
+                }
+
+                f[count].pEnvelope  = &c->fEnvelope;
+                f[count].fAttack    = c->vAttack[0].fTau;
+                f[count].fRelease   = c->vRelease[0].fTau;
+                f[count].fThresh    = -FLT_MAX;
+                vp[count]           = c;
+                vout[count]         = out[i];
+                venv[count]         = e;
+                vin[count]          = in[i];
+                ++count;
+            }
+
+            // Calculate envelopes
+            follow_envelopes(vout, vin, f, count, samples);
+
+            for (size_t j=0; j<count; ++j)
+            {
+                // Copy envelope to array if specified
+                if (venv[j] != NULL)
+                    dsp::copy(venv[j], vout[j], samples);
+
+                // Now calculate processor's curve
+                vp[j]->reduction(vout[j], vout[j], samples);
+            }
+        }
+    }
+
     float DynamicProcessor::process(float *env, float in)
     {
         fEnvelope  += (in > fEnvelope) ?
@@ -8,6 +8,7 @@
 #include <dsp/dsp.h>
 #include <core/interpolation.h>
 #include <core/dynamics/Expander.h>
+#include <core/dynamics/follower.h>
 #include <math.h>
 
 namespace lsp
@@ -87,6 +88,44 @@ namespace lsp
         amplification(out, out, samples);
     }
 
+    void Expander::process(Expander **p, float **out, float **env, const float **in, size_t n, size_t samples)
+    {
+        follower_t f[FOLLOWER_LANES_MAX];
+
+        while (n > 0)
+        {
+            // Calculate envelopes for the group of expanders
+            size_t count    = (n > FOLLOWER_LANES_MAX) ? FOLLOWER_LANES_MAX : n;
+            for (size_t i=0; i<count; ++i)
+            {
+                Expander *c     = p[i];
+                f[i].pEnvelope  = &c->fEnvelope;
+                f[i].fAttack    = c->fTauAttack;
+                f[i].fRelease   = c->fTauRelease;
+                f[i].fThresh    = c->fReleaseThresh;
+            }
+            follow_envelopes(out, in, f, count, samples);
+
+            for (size_t i=0; i<count; ++i)
+            {
+                // Copy envelope to array if specified
+                if ((env != NULL) && (env[i] != NULL))
+                    dsp::copy(env[i], out[i], samples);
+
+                // Now calculate expander's curve
+                p[i]->amplification(out[i], out[i], samples);
+            }
+
+            // Move to the next group
+            p              += count;
+            out            += count;
+            in             += count;
+            if (env != NULL)
+                env            += count;
+            n              -= count;
+        }
+    }
+
     float Expander::process(float *env, float s)
     {
         if (fEnvelope > fReleaseThresh)
@@ -9,7 +9,9 @@
 #include <core/interpolation.h>
 #include <core/debug.h>
 #include <core/dynamics/Gate.h>
+#include <core/dynamics/follower.h>
 #include <math.h>
+#include <float.h>
 
 namespace lsp
 {
@@ -130,27 +132,19 @@ namespace lsp
         return fReduction * in;
     }
 
-    void Gate::process(float *out, float *env, const float *in, size_t samples)
+    void Gate::process_gain(float *out, const float *env, size_t samples)
     {
-        // Calculate envelope of gate
         for (size_t i=0; i<samples; ++i)
         {
-            float s         = *(in++);
-
-            fEnvelope       += (s > fEnvelope) ? fTauAttack * (s - fEnvelope) : fTauRelease * (s - fEnvelope);
-
-            // Update result
-            if (env != NULL)
-                env[i]          = fEnvelope;
-            out[i]          = amplification(fEnvelope);
+            float e         = env[i];
 
             // Change state
             curve_t *c      = &sCurves[nCurve];
-            if (fEnvelope > c->fZS)
+            if (e > c->fZS)
             {
-                if (fEnvelope < c->fZE)
+                if (e < c->fZE)
                 {
-                    float lx    = logf(fEnvelope);
+                    float lx    = logf(e);
                     out[i]      = expf(((c->vHermite[0]*lx + c->vHermite[1])*lx + c->vHermite[2] - 1.0f)*lx + c->vHermite[3]);
                 }
                 else
@@ -167,6 +161,63 @@ namespace lsp
         }
     }
 
+    void Gate::process(float *out, float *env, const float *in, size_t samples)
+    {
+        // Calculate envelope of gate
+        for (size_t i=0; i<samples; ++i)
+        {
+            float s         = *(in++);
+
+            fEnvelope       += (s > fEnvelope) ? fTauAttack * (s - fEnvelope) : fTauRelease * (s - fEnvelope);
+            out[i]          = fEnvelope;
+        }
+
+        // Copy envelope to array if specified
+        if (env != NULL)
+            dsp::copy(env, out, samples);
+
+        // Now calculate gain
+        process_gain(out, out, samples);
+    }
+
+    void Gate::process(Gate **p, float **out, float **env, const float **in, size_t n, size_t samples)
+    {
+        follower_t f[FOLLOWER_LANES_MAX];
+
+        while (n > 0)
+        {
+            // Calculate envelopes for the group of gates, the gate has no release threshold
+            size_t count    = (n > FOLLOWER_LANES_MAX) ? FOLLOWER_LANES_MAX : n;
+            for (size_t i=0; i<count; ++i)
+            {
+                Gate *c         = p[i];
+                f[i].pEnvelope  = &c->fEnvelope;
+                f[i].fAttack    = c->fTauAttack;
+                f[i].fRelease   = c->fTauRelease;
+                f[i].fThresh    = -FLT_MAX;
+            }
+            follow_envelopes(out, in, f, count, samples);
+
+            for (size_t i=0; i<count; ++i)
+            {
+                // Copy envelope to array if specified
+                if ((env != NULL) && (env[i] != NULL))
+                    dsp::copy(env[i], out[i], samples);
+
+                // Now calculate gain
+                p[i]->process_gain(out[i], out[i], samples);
+            }
+
+            // Move to the next group
+            p              += count;
+            out            += count;
+            in             += count;
+            if (env != NULL)
+                env            += count;
+            n              -= count;
+        }
+    }
+
     float Gate::process(float *env, float s)
     {
         curve_t *c      = &sCurves[nCurve];
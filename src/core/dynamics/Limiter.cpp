@@ -13,6 +13,7 @@
 #define BUF_GRANULARITY         8192
 #define GAIN_LOWERING           0.891250938134 /* 0.944060876286 */
 #define MIN_LIMITER_RELEASE     5.0f
+#define SLIDE_GAP               16
 
 namespace lsp
 {
@@ -31,9 +32,41 @@ namespace lsp
         nUpdate         = UP_ALL;
         nMode           = LM_COMPRESSOR;
         nThresh         = 0;
+        bSliding        = false;
         vGainBuf        = NULL;
         vTmpBuf         = NULL;
         vData           = NULL;
+
+        sSlide.vValue       = NULL;
+        sSlide.vTime        = NULL;
+        sSlide.vRise        = NULL;
+        sSlide.vRelease     = NULL;
+        sSlide.nCapacity    = 0;
+        sSlide.nKernelCap   = 0;
+        sSlide.nHead        = 0;
+        sSlide.nTail        = 0;
+        sSlide.nTime        = 0;
+        sSlide.nWindow      = 1;
+        sSlide.nMiddle      = 0;
+        sSlide.nAttack      = 0;
+        sSlide.nRisePos     = 0;
+        sSlide.nRiseCount   = 0;
+        sSlide.nRiseTime    = 0;
+        sSlide.fHold        = 0.0f;
+        sSlide.nRelease     = 0;
+        sSlide.nRelTime     = 0;
+        sSlide.fRelPeak     = 0.0f;
+
+        for (size_t i=0; i<4; ++i)
+            sSlide.vKernel[i]   = 0.0;
+        sSlide.fExpGain     = 0.0;
+        sSlide.fExpUp       = 1.0;
+        sSlide.fExpDown     = 1.0;
+        sSlide.fExpWindow   = 1.0;
+        sSlide.fExpPos      = 1.0;
+        sSlide.fExpNeg      = 1.0;
+        for (size_t i=0; i<5; ++i)
+            sSlide.vMoment[i]   = 0.0;
     }
 
     Limiter::~Limiter()
@@ -43,7 +76,16 @@ namespace lsp
     bool Limiter::init(size_t max_sr, float max_lookahead)
     {
         nMaxLookahead       = millis_to_samples(max_sr, max_lookahead);
-        size_t alloc        = nMaxLookahead*4 + BUF_GRANULARITY*2;
+
+        // Sliding window covers attack and half of release (both limited by 8 samples at least),
+        // ring buffer of rises covers attack
+        size_t q_cap        = 1;
+        while (q_cap < (nMaxLookahead*2 + SLIDE_GAP*2))
+            q_cap             <<= 1;
+        size_t k_cap        = nMaxLookahead + SLIDE_GAP;
+        size_t r_len        = nMaxLookahead*2 + SLIDE_GAP;
+
+        size_t alloc        = nMaxLookahead*4 + BUF_GRANULARITY*2 + q_cap*2 + k_cap + r_len;
         float *ptr          = alloc_aligned<float>(vData, alloc, DEFAULT_ALIGN);
         if (ptr == NULL)
             return false;
@@ -52,11 +94,23 @@ namespace lsp
         ptr                += nMaxLookahead*4 + BUF_GRANULARITY;
         vTmpBuf             = ptr;
         ptr                += BUF_GRANULARITY;
+        sSlide.vValue       = ptr;
+        ptr                += q_cap;
+        sSlide.vTime        = reinterpret_cast<uint32_t *>(ptr);
+        ptr                += q_cap;
+        sSlide.vRise        = ptr;
+        ptr                += k_cap;
+        sSlide.vRelease     = ptr;
+        ptr                += r_len;
+        sSlide.nCapacity    = q_cap;
+        sSlide.nKernelCap   = k_cap;
 
         lsp_assert(reinterpret_cast<uint8_t *>(ptr) <= &vData[alloc*sizeof(float) + DEFAULT_ALIGN]);
 
         dsp::fill_one(vGainBuf, nMaxLookahead*4 + BUF_GRANULARITY);
         dsp::fill_zero(vTmpBuf, BUF_GRANULARITY);
+        dsp::fill_zero(sSlide.vRise, k_cap);
+        dsp::fill_zero(sSlide.vRelease, r_len);
 
         if (!sDelay.init(nMaxLookahead + BUF_GRANULARITY))
             return false;
@@ -78,6 +132,13 @@ namespace lsp
 
         vGainBuf    = NULL;
         vTmpBuf     = NULL;
+
+        sSlide.vValue       = NULL;
+        sSlide.vTime        = NULL;
+        sSlide.vRise        = NULL;
+        sSlide.vRelease     = NULL;
+        sSlide.nCapacity    = 0;
+        sSlide.nKernelCap   = 0;
     }
 
     void Limiter::reset_sat(sat_t *sat)
@@ -302,6 +363,189 @@ namespace lsp
         );
     }
 
+    void Limiter::init_slide(bool reset)
+    {
+        slide_t *sl         = &sSlide;
+        sat_t *sat          = NULL;
+        exp_t *exp          = NULL;
+        line_t *line        = NULL;
+
+        switch (nMode)
+        {
+            case LM_HERM_THIN:
+            case LM_HERM_WIDE:
+            case LM_HERM_TAIL:
+            case LM_HERM_DUCK:
+                sat     = &sSat;
+                break;
+            case LM_MIXED_HERM:
+                sat     = &sMixed.sSat;
+                break;
+
+            case LM_EXP_THIN:
+            case LM_EXP_WIDE:
+            case LM_EXP_TAIL:
+            case LM_EXP_DUCK:
+                exp     = &sExp;
+                break;
+            case LM_MIXED_EXP:
+                exp     = &sMixed.sExp;
+                break;
+
+            case LM_LINE_THIN:
+            case LM_LINE_WIDE:
+            case LM_LINE_TAIL:
+            case LM_LINE_DUCK:
+                line    = &sLine;
+                break;
+            case LM_MIXED_LINE:
+                line    = &sMixed.sLine;
+                break;
+
+            default:
+                return;
+        }
+
+        // Get patch parameters, attack kernel and release curve. The kernel is the part
+        // of the peak that is not yet reached by the attack curve: a cubic polynomial
+        // and an exponent of time elapsed since the rise
+        ssize_t attack, plane, release, middle;
+        double *k           = sl->vKernel;
+        double rate         = 0.0;
+
+        sl->fExpGain        = 0.0;
+
+        if (sat != NULL)
+        {
+            attack      = sat->nAttack;
+            plane       = sat->nPlane;
+            release     = sat->nRelease;
+            middle      = sat->nMiddle;
+
+            k[0]        = 1.0 - sat->vAttack[3];
+            k[1]        = - sat->vAttack[2];
+            k[2]        = - sat->vAttack[1];
+            k[3]        = - sat->vAttack[0];
+
+            for (ssize_t t=plane; t<release; ++t)
+            {
+                float x     = t;
+                sl->vRelease[t - plane] = (((sat->vRelease[0]*x + sat->vRelease[1])*x + sat->vRelease[2])*x + sat->vRelease[3]);
+            }
+        }
+        else if (exp != NULL)
+        {
+            attack      = exp->nAttack;
+            plane       = exp->nPlane;
+            release     = exp->nRelease;
+            middle      = exp->nMiddle;
+
+            k[0]        = 1.0 - exp->vAttack[0];
+            k[1]        = 0.0;
+            k[2]        = 0.0;
+            k[3]        = 0.0;
+            sl->fExpGain= - exp->vAttack[1];
+            rate        = exp->vAttack[2];
+
+            for (ssize_t t=plane; t<release; ++t)
+                sl->vRelease[t - plane] = exp->vRelease[0] + exp->vRelease[1] * expf(exp->vRelease[2] * t);
+        }
+        else
+        {
+            attack      = line->nAttack;
+            plane       = line->nPlane;
+            release     = line->nRelease;
+            middle      = line->nMiddle;
+
+            k[0]        = 1.0 - line->vAttack[1];
+            k[1]        = - line->vAttack[0];
+            k[2]        = 0.0;
+            k[3]        = 0.0;
+
+            for (ssize_t t=plane; t<release; ++t)
+                sl->vRelease[t - plane] = line->vRelease[0] * t + line->vRelease[1];
+        }
+
+        // The peak is held from 'middle' samples before it till the end of plane. Each rise
+        // of the held value is reached by the attack curve, so the part of the rise that is
+        // still pending is computed from the moments of rises. Drops are immediate, the release
+        // curve forms the decay instead
+        bool resize         = sl->nAttack != size_t(attack);
+
+        sl->nWindow         = plane + 1;
+        sl->nMiddle         = middle;
+        sl->nAttack         = attack;
+        sl->nRelease        = (release > plane) ? release - plane : 0;
+        sl->vRelease[0]     = 1.0f;
+        sl->fExpUp          = ::exp(rate);
+        sl->fExpDown        = ::exp(-rate);
+        sl->fExpWindow      = ::exp(rate * attack);
+
+        if ((reset) || (resize))
+        {
+            // Pending parts of rises can not be kept, the held value is reached immediately
+            sl->nRisePos        = 0;
+            sl->nRiseCount      = 0;
+            dsp::fill_zero(sl->vRise, sl->nKernelCap);
+        }
+
+        // Re-compute moments of rises with the new kernel
+        rebase_slide(sl);
+
+        if (reset)
+        {
+            sl->nHead           = 0;
+            sl->nTail           = 0;
+            sl->nTime           = 0;
+            sl->fHold           = 0.0f;
+            sl->nRelTime        = sl->nRelease;
+            sl->fRelPeak        = 0.0f;
+            return;
+        }
+
+        // Keep the held and pending gain reduction, it will be applied with the new settings
+        if (sl->nRelTime > sl->nRelease)
+            sl->nRelTime        = sl->nRelease;
+    }
+
+    void Limiter::rebase_slide(slide_t *sl)
+    {
+        // Move the origin of moments to the current sample, the ring buffer holds
+        // rises at times -len .. -1 starting at the current position
+        double *m           = sl->vMoment;
+        size_t len          = sl->nAttack;
+        const float *rise   = sl->vRise;
+        double e            = sl->fExpWindow;
+
+        for (size_t i=0; i<5; ++i)
+            m[i]                = 0.0;
+
+        for (size_t i=0, pos=sl->nRisePos; i<len; ++i)
+        {
+            double d            = rise[pos];
+            if (d > 0.0)
+            {
+                double x            = ssize_t(i - len);
+                m[4]               += d * e;
+                m[0]               += d;
+                d                  *= x;
+                m[1]               += d;
+                d                  *= x;
+                m[2]               += d;
+                d                  *= x;
+                m[3]               += d;
+            }
+
+            e                  *= sl->fExpDown;
+            if ((++pos) >= len)
+                pos                 = 0;
+        }
+
+        sl->nRiseTime       = 0;
+        sl->fExpPos         = 1.0;
+        sl->fExpNeg         = 1.0;
+    }
+
     void Limiter::update_settings()
     {
         // Update delay settings
@@ -414,6 +658,9 @@ namespace lsp
                 break;
         }
 
+        if (bSliding)
+            init_slide((nUpdate & (UP_SR | UP_MODE)) != 0);
+
         // Clear the update flag
         nUpdate         = 0;
     }
@@ -599,6 +846,39 @@ namespace lsp
         }
     }
 
+    void Limiter::apply_comp_reduction(comp_t *comp, float *dst, const float *env, size_t samples)
+    {
+        for (size_t i=0; i<samples; ++i)
+        {
+            float ls        = env[i] * dst[i];
+
+            if (comp->nCountdown > 0)
+            {
+                if (comp->fSample <= ls)
+                {
+                    comp->fSample       = ls;
+                    comp->nCountdown    = nLookahead;
+                }
+                else
+                {
+                    ls                  = comp->fSample; // * (1.0f + comp->fAmp*(nLookahead - comp->nCountdown));
+                    comp->nCountdown    --;
+                }
+            }
+            else if (ls >= fThreshold)
+            {
+                comp->fSample       = ls;
+                comp->nCountdown    = nLookahead;
+            }
+
+            // Calculate envelope and reduction
+            comp->fEnvelope    += (ls >= comp->fEnvelope) ?
+                                    comp->fTauAttack * (ls - comp->fEnvelope) :
+                                    comp->fTauRelease * (ls - comp->fEnvelope);
+            dst[i]             *= reduction(comp);
+        }
+    }
+
     void Limiter::process_patch(float *dst, float *gain, const float *src, const float *sc, size_t samples)
     {
         float *gbuf     = &vGainBuf[nMaxLookahead];
@@ -713,7 +993,6 @@ namespace lsp
     void Limiter::process_mixed(float *dst, float *gain, const float *src, const float *sc, size_t samples)
     {
         float *gbuf     = &vGainBuf[nMaxLookahead];
-        comp_t *comp    = &sMixed.sComp;
 
         while (samples > 0)
         {
@@ -724,35 +1003,7 @@ namespace lsp
             dsp::abs2(vTmpBuf, sc, to_do);
 
             // Issue compressor reaction
-            for (size_t i=0; i<to_do; ++i)
-            {
-                float ls        = vTmpBuf[i] * gbuf[i];
-
-                if (comp->nCountdown > 0)
-                {
-                    if (comp->fSample <= ls)
-                    {
-                        comp->fSample       = ls;
-                        comp->nCountdown    = nLookahead;
-                    }
-                    else
-                    {
-                        ls                  = comp->fSample; // * (1.0f + comp->fAmp*(nLookahead - comp->nCountdown));
-                        comp->nCountdown    --;
-                    }
-                }
-                else if (ls >= fThreshold)
-                {
-                    comp->fSample       = ls;
-                    comp->nCountdown    = nLookahead;
-                }
-
-                // Calculate envelope and reduction
-                comp->fEnvelope    += (ls >= comp->fEnvelope) ?
-                                        comp->fTauAttack * (ls - comp->fEnvelope) :
-                                        comp->fTauRelease * (ls - comp->fEnvelope);
-                gbuf[i]            *= reduction(comp);
-            }
+            apply_comp_reduction(&sMixed.sComp, gbuf, vTmpBuf, to_do);
 
             float thresh = 1.0f;
 
@@ -844,6 +1095,126 @@ namespace lsp
         }
     }
 
+    void Limiter::process_slide(float *dst, float *gain, const float *src, const float *sc, size_t samples)
+    {
+        slide_t *sl     = &sSlide;
+        float *gbuf     = &vGainBuf[nMaxLookahead];
+        float *vgain    = &gbuf[-ssize_t(sl->nMiddle)];
+        bool mixed      = (nMode == LM_MIXED_HERM) || (nMode == LM_MIXED_EXP) || (nMode == LM_MIXED_LINE);
+        float thresh    = (mixed) ? fThreshold - 0.000001f : fKnee * fThreshold - 0.000001f;
+
+        float th        = fThreshold;
+
+        size_t q_mask   = sl->nCapacity - 1;
+        size_t window   = sl->nWindow;
+        size_t rel_len  = sl->nRelease;
+        float *vvalue   = sl->vValue;
+        uint32_t *vtime = sl->vTime;
+        const float *vrelease = sl->vRelease;
+
+        while (samples > 0)
+        {
+            size_t to_do    = (samples > BUF_GRANULARITY) ? BUF_GRANULARITY : samples;
+
+            // Fill gain buffer
+            dsp::fill_one(&gbuf[nMaxLookahead*3], to_do);
+            dsp::abs2(vTmpBuf, sc, to_do);
+
+            // Issue compressor reaction
+            if (mixed)
+                apply_comp_reduction(&sMixed.sComp, gbuf, vTmpBuf, to_do);
+
+            // Load state of the peak detector
+            size_t head     = sl->nHead;
+            size_t tail     = sl->nTail;
+            uint32_t time   = sl->nTime;
+            float prev      = sl->fHold;
+            bool held       = prev > 0.0f;
+
+            // Replace the sidechain with the gain reduction held over the sliding window
+            for (size_t i=0; i<to_do; ++i, ++time)
+            {
+                // Compute gain reduction required for the sample
+                float s         = vTmpBuf[i] * gbuf[i];
+                float r         = (s > th) ? (s - thresh) / s : 0.0f;
+                float hold      = 0.0f;
+
+                // Nothing to hold if the deque contains only zeros
+                if ((r <= 0.0f) && ((head == tail) || (vvalue[head & q_mask] <= 0.0f)))
+                    head            = tail;
+                else
+                {
+                    // Push the reduction to the deque, the deque holds decreasing values
+                    while ((tail != head) && (vvalue[(tail - 1) & q_mask] <= r))
+                        --tail;
+                    vvalue[tail & q_mask]   = r;
+                    vtime[tail & q_mask]    = time;
+                    ++tail;
+
+                    // Remove values that left the sliding window, the head is the maximum
+                    while (uint32_t(time - vtime[head & q_mask]) >= window)
+                        ++head;
+                    hold            = vvalue[head & q_mask];
+                    held            = true;
+                }
+
+                // Subtract the part of rises that is not yet reached by the attack curve
+                vTmpBuf[i]      = hold - pending_slide(sl, (hold > prev) ? hold - prev : 0.0f);
+                prev            = hold;
+            }
+
+            // Store state of the peak detector
+            sl->nHead       = head;
+            sl->nTail       = tail;
+            sl->nTime       = time;
+            sl->fHold       = prev;
+
+            // Form the attack and apply the release curve, skip if there is no gain reduction in progress.
+            // Rises are held longer than the attack lasts, so there is nothing pending without held values
+            size_t rel_time = sl->nRelTime;
+            if ((held) || (rel_time < rel_len))
+            {
+                float rel_peak  = sl->fRelPeak;
+                for (size_t i=0; i<to_do; ++i)
+                {
+                    float h         = vTmpBuf[i];
+                    float rel       = (rel_time < rel_len) ? rel_peak * vrelease[rel_time] : 0.0f;
+                    if (h >= rel)
+                    {
+                        rel_peak        = h;
+                        rel_time        = 1;
+                    }
+                    else
+                    {
+                        h               = rel;
+                        ++rel_time;
+                    }
+
+                    // Apply gain reduction to the delayed position
+                    if (h > 1.0f)
+                        h               = 1.0f;
+                    vgain[i]       *= 1.0f - h;
+                }
+
+                sl->nRelTime    = rel_time;
+                sl->fRelPeak    = rel_peak;
+            }
+
+            // Copy gain value and shift gain buffer
+            dsp::copy(gain, &vGainBuf[nMaxLookahead - nLookahead], to_do);
+            dsp::move(vGainBuf, &vGainBuf[to_do], nMaxLookahead*4);
+
+            // Apply gain to delayed signal
+            sDelay.process(dst, src, to_do);
+
+            // Decrement number of samples and update pointers
+            dst            += to_do;
+            gain           += to_do;
+            src            += to_do;
+            sc             += to_do;
+            samples        -= to_do;
+        }
+    }
 
     void Limiter::process(float *dst, float *gain, const float *src, const float *sc, size_t samples)
     {
@@ -870,13 +1241,19 @@ namespace lsp
             case LM_LINE_WIDE:
             case LM_LINE_TAIL:
             case LM_LINE_DUCK:
-                process_patch(dst, gain, src, sc, samples);
+                if (bSliding)
+                    process_slide(dst, gain, src, sc, samples);
+                else
+                    process_patch(dst, gain, src, sc, samples);
                 break;
 
             case LM_MIXED_HERM:
             case LM_MIXED_EXP:
             case LM_MIXED_LINE:
-                process_mixed(dst, gain, src, sc, samples);
+                if (bSliding)
+                    process_slide(dst, gain, src, sc, samples);
+                else
+                    process_mixed(dst, gain, src, sc, samples);
                 break;
 
             default:
@@ -0,0 +1,92 @@
+/*
+ * follower.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <core/dynamics/follower.h>
+
+namespace lsp
+{
+    template <class bank_t>
+        static void follow_bank(
+                void (* process)(float *dst, const float *src, bank_t *e, size_t count),
+                size_t lanes, float **out, const float **in, const follower_t *f, size_t n, size_t samples
+            )
+        {
+            float buf[FOLLOWER_BUF_SIZE * FOLLOWER_LANES_MAX];
+            bank_t bank;
+
+            // Initialize the bank, unused lanes are kept silent
+            for (size_t j=0; j<lanes; ++j)
+            {
+                bool used           = j < n;
+                bank.env[j]         = (used) ? *(f[j].pEnvelope) : 0.0f;
+                bank.attack[j]      = (used) ? f[j].fAttack : 0.0f;
+                bank.release[j]     = (used) ? f[j].fRelease : 0.0f;
+                bank.thresh[j]      = (used) ? f[j].fThresh : 0.0f;
+            }
+            if (n < lanes)
+                dsp::fill_zero(buf, FOLLOWER_BUF_SIZE * lanes);
+
+            for (size_t off=0; off < samples; )
+            {
+                size_t to_do    = samples - off;
+                if (to_do > FOLLOWER_BUF_SIZE)
+                    to_do           = FOLLOWER_BUF_SIZE;
+
+                // Interleave sidechain signals
+                for (size_t j=0; j<n; ++j)
+                {
+                    const float *src    = &in[j][off];
+                    float *dst          = &buf[j];
+                    for (size_t i=0; i<to_do; ++i, dst += lanes)
+                        *dst                = src[i];
+                }
+
+                // Process envelopes
+                process(buf, buf, &bank, to_do);
+
+                // De-interleave envelopes
+                for (size_t j=0; j<n; ++j)
+                {
+                    const float *src    = &buf[j];
+                    float *dst          = &out[j][off];
+                    for (size_t i=0; i<to_do; ++i, src += lanes)
+                        dst[i]              = *src;
+                }
+
+                off            += to_do;
+            }
+
+            // Store the state
+            for (size_t j=0; j<n; ++j)
+                *(f[j].pEnvelope)   = bank.env[j];
+        }
+
+    void follow_envelopes(float **out, const float **in, const follower_t *f, size_t n, size_t samples)
+    {
+        if (n > 4)
+            follow_bank<envelope_x8_t>(dsp::envelope_process_x8, 8, out, in, f, n, samples);
+        else if (n > 1)
+            follow_bank<envelope_x4_t>(dsp::envelope_process_x4, 4, out, in, f, n, samples);
+        else if (n > 0)
+        {
+            // There is nothing to interleave, process the single follower
+            const float *src    = in[0];
+            float *dst          = out[0];
+            float e             = *(f->pEnvelope);
+
+            for (size_t i=0; i<samples; ++i)
+            {
+                float s             = src[i];
+                e                  += (((e > f->fThresh) && (s <= e)) ? f->fRelease : f->fAttack) * (s - e);
+                dst[i]              = e;
+            }
+
+            *(f->pEnvelope)     = e;
+        }
+    }
+}
@@ -39,5 +39,40 @@ namespace lsp
         for (size_t i=fade_len; i > 0; )
             *(dst++) = *(src++) * ((--i) * k);
     }
-}
 
+    void fade_in(float *dst, const float *src, size_t fade_len, size_t offset, size_t count)
+    {
+        if ((fade_len <= offset) || (count <= 0))
+            return;
+
+        float k = 1.0f / fade_len;
+        if (count > (fade_len - offset))
+            count = fade_len - offset;
+
+        for (size_t i=0; i < count; ++i)
+            dst[i] = src[i] * (offset + i) * k;
+    }
+
+    void fade_out(float *dst, const float *src, size_t fade_len, size_t buf_len, size_t offset, size_t count)
+    {
+        if ((fade_len <= 0) || (count <= 0))
+            return;
+
+        // Compute the start of fade-out
+        float k         = 1.0f / fade_len;
+        size_t start    = (fade_len > buf_len) ? 0 : buf_len - fade_len;
+        if (offset < start)
+        {
+            if ((offset + count) <= start)
+                return;
+            size_t skip     = start - offset;
+            dst            += skip;
+            src            += skip;
+            count          -= skip;
+            offset          = start;
+        }
+
+        for (size_t i=buf_len - offset; count > 0; --count)
+            *(dst++) = *(src++) * ((--i) * k);
+    }
+}
@@ -13,6 +13,9 @@
 #include <core/files/AudioFile.h>
 #include <core/files/lspc/LSPCAudioReader.h>
 #include <core/alloc.h>
+#include <core/ipc/Thread.h>
+#include <data/cstorage.h>
+#include <data/cvector.h>
 
 #ifdef PLATFORM_WINDOWS
 /*
@@ -64,14 +67,30 @@
 
 #else
     #include <sndfile.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
 #endif /* PLATFORM_WINDOWS */
 
 #define TMP_BUFFER_SIZE         1024
 #define RESAMPLING_PERIODS      8
+#define RESAMPLING_MAX_PHASES   0x1000      /* Maximum number of phases in polyphase kernel table   */
+#define RESAMPLING_BLOCK        0x4000      /* Number of output samples processed by one work item  */
+#define RESAMPLING_MAX_TASKS    8           /* Maximum number of parallel resampling tasks          */
 #define ACM_INPUT_BUFSIZE       0x1000
 
+#define WAV_FORMAT_IEEE_FLOAT   0x0003
+#define WAV_FORMAT_EXTENSIBLE   0xfffe
+
 namespace lsp
 {
+    typedef struct lspc_fragment_t
+    {
+        wsize_t     nOffset;    // Offset of the fragment data in file
+        size_t      nSize;      // Size of the fragment data
+    } lspc_fragment_t;
+
     static size_t gcd_euclid(size_t a, size_t b)
     {
         while (b)
@@ -123,6 +142,7 @@ namespace lsp
         ct->nChannels       = channels;
         ct->nSamples        = buffer_len;
         ct->nSampleRate     = 0;
+        ct->pMapping        = NULL;
         ptr                += header_size;
 
         for (size_t i=0; i < channels; ++i)
@@ -161,8 +181,135 @@ namespace lsp
 
     void AudioFile::destroy_file_content(file_content_t *content)
     {
-        if (content != NULL)
-            lsp_free(content);
+        if (content == NULL)
+            return;
+
+        // Release mapped file and channels unpacked from the mapped file
+        file_mapping_t *map = content->pMapping;
+        if (map != NULL)
+        {
+            for (size_t i=0; i<content->nChannels; ++i)
+            {
+                float *ptr = content->vChannels[i];
+                if ((ptr != NULL) && (!is_mapped(content, ptr)))
+                    lsp_free(ptr);
+            }
+
+            #ifndef PLATFORM_WINDOWS
+                ::munmap(map->pAddr, map->nSize);
+            #endif /* PLATFORM_WINDOWS */
+            lsp_free(map);
+        }
+
+        lsp_free(content);
+    }
+
+    AudioFile::file_content_t *AudioFile::create_mapped_content(file_mapping_t *mapping, size_t channels, size_t samples)
+    {
+        file_content_t *ct  = reinterpret_cast<file_content_t *>(lsp_tmalloc(uint8_t, sizeof(file_content_t) + sizeof(float *) * channels));
+        if (ct == NULL)
+            return NULL;
+
+        ct->nChannels       = channels;
+        ct->nSamples        = samples;
+        ct->nSampleRate     = 0;
+        ct->pMapping        = mapping;
+        for (size_t i=0; i<channels; ++i)
+            ct->vChannels[i]    = NULL;
+
+        // Single-channel data is used directly from the mapped file if it is contiguous and aligned
+        if ((channels == 1) && (mapping->nExtents > 0))
+        {
+            const file_extent_t *e = &mapping->vExtents[0];
+            if ((e->nSize >= samples * sizeof(float)) && (!(ptrdiff_t(e->pData) & (sizeof(float) - 1))))
+                ct->vChannels[0]    = reinterpret_cast<float *>(const_cast<uint8_t *>(e->pData));
+        }
+
+        return ct;
+    }
+
+    bool AudioFile::is_mapped(const file_content_t *content, const float *ptr)
+    {
+        const file_mapping_t *map = content->pMapping;
+        if (map == NULL)
+            return false;
+
+        const uint8_t *p = reinterpret_cast<const uint8_t *>(ptr);
+        return (p >= map->pAddr) && (p < &map->pAddr[map->nSize]);
+    }
+
+    float *AudioFile::unpack_channel(file_content_t *content, size_t channel)
+    {
+        float *dst = content->vChannels[channel];
+        if ((dst != NULL) || (content->pMapping == NULL))
+            return dst;
+
+        // Allocate channel data, keep the tail zeroed as for loaded files
+        size_t frames       = content->nSamples;
+        size_t buffer_len   = (frames + 0x03) & (~size_t(0x03));
+        dst                 = lsp_tmalloc(float, buffer_len);
+        if (dst == NULL)
+            return NULL;
+        dsp::fill_zero(&dst[frames], buffer_len - frames);
+
+        // De-interleave samples of the channel from mapped extents
+        const file_mapping_t *map   = content->pMapping;
+        const file_extent_t *e      = map->vExtents;
+        const file_extent_t *end    = &e[map->nExtents];
+        size_t fz                   = map->nFrameSize;
+        size_t off                  = channel * sizeof(float);
+        size_t e_off                = 0;
+
+        for (size_t i=0; (i < frames) && (e < end); )
+        {
+            size_t n    = lsp_min((e->nSize - e_off) / fz, frames - i);
+            if (n > 0)
+            {
+                // Copy frames that fully reside in the extent
+                const uint8_t *src  = &e->pData[e_off + off];
+                for (size_t j=0; j<n; ++j, src += fz)
+                    ::memcpy(&dst[i + j], src, sizeof(float));
+                i          += n;
+                e_off      += n * fz;
+            }
+            else
+            {
+                // The frame is split between extents, gather it byte by byte
+                uint8_t *b  = reinterpret_cast<uint8_t *>(&dst[i++]);
+                for (size_t j=0; j<fz; ++j, ++e_off)
+                {
+                    for ( ; (e < end) && (e_off >= e->nSize); e_off = 0)
+                        ++e;
+                    if (e >= end)
+                        break;
+                    if ((j >= off) && (j < off + sizeof(float)))
+                        b[j - off]  = e->pData[e_off];
+                }
+            }
+
+            if ((e < end) && (e_off >= e->nSize))
+            {
+                ++e;
+                e_off       = 0;
+            }
+        }
+
+        content->vChannels[channel] = dst;
+        return dst;
+    }
+
+    status_t AudioFile::unpack_channels()
+    {
+        if ((pData == NULL) || (pData->pMapping == NULL))
+            return STATUS_OK;
+
+        for (size_t i=0; i<pData->nChannels; ++i)
+        {
+            if (unpack_channel(pData, i) == NULL)
+                return STATUS_NO_MEM;
+        }
+
+        return STATUS_OK;
     }
 
     AudioFile::temporary_buffer_t *AudioFile::create_temporary_buffer(file_content_t *content, size_t from)
@@ -294,22 +441,15 @@ namespace lsp
         return create_samples(channels, sample_rate, count);
     }
 
-    status_t AudioFile::load_lspc(const LSPString *path, float max_duration)
+    status_t AudioFile::open_lspc(LSPCFile *fd, LSPCAudioReader *ar, size_t *skip)
     {
-        LSPCFile fd;
-        status_t res = fd.open(path->get_native());
-        if (res != STATUS_OK)
-        {
-            fd.close();
-            return res;
-        }
-
-        uint32_t chunk_id = 0;
+        status_t res        = STATUS_OK;
+        uint32_t chunk_id   = 0;
 
         // Read profile (if present)
-        size_t skip         = 0;
         size_t profVersion  = 1;
-        LSPCChunkReader *prof = fd.find_chunk(LSPC_CHUNK_PROFILE);
+        *skip               = 0;
+        LSPCChunkReader *prof = fd->find_chunk(LSPC_CHUNK_PROFILE);
         if (prof != NULL)
         {
             // Read profile header and check version
@@ -328,7 +468,7 @@ namespace lsp
             // Get skip value:
             profVersion = p.common.version;
             if (profVersion >= 2)
-                skip = BE_TO_CPU(p.skip);
+                *skip = BE_TO_CPU(p.skip);
 
             // Analyze final status
             status_t res2 = prof->close();
@@ -338,36 +478,24 @@ namespace lsp
 
             // Analyze status
             if (res != STATUS_OK)
-            {
-                fd.close();
                 return res;
-            }
         }
 
         // Try to open audio file chunk
-        LSPCAudioReader ar;
-        res = (chunk_id > 0) ? ar.open(&fd, chunk_id) : ar.open(&fd);
+        res = (chunk_id > 0) ? ar->open(fd, chunk_id) : ar->open(fd);
         if (res != STATUS_OK)
-        {
-            ar.close();
-            fd.close();
             return STATUS_BAD_FORMAT;
-        }
 
         // Read audio chunk header and check its size
         lspc_audio_parameters_t aparams;
-        res = ar.get_parameters(&aparams);
+        res = ar->get_parameters(&aparams);
         if (res != STATUS_OK)
-        {
-            ar.close();
-            fd.close();
             return res;
-        }
 
         // Setting up skip value for version 1 headers
         if (profVersion < 2)
         {
-            LSPCChunkReader *rd     = fd.read_chunk(ar.unique_id()); // Read the chunk with same ID as audio stream reader found
+            LSPCChunkReader *rd     = fd->read_chunk(ar->unique_id()); // Read the chunk with same ID as audio stream reader found
             lspc_chunk_audio_header_t hdr;
 
             ssize_t res = rd->read_header(&hdr, sizeof(lspc_chunk_audio_header_t));
@@ -383,13 +511,13 @@ namespace lsp
                 {
                     size_t nOffset  = offset;
                     nOffset         = (nOffset > maxAhead)? maxAhead : nOffset;
-                    skip            = skipNoOffset + nOffset;
+                    *skip           = skipNoOffset + nOffset;
                 }
                 else
                 {
                     size_t nOffset  = -offset;
                     nOffset         = (nOffset > skipNoOffset)? skipNoOffset : nOffset;
-                    skip            = skipNoOffset - nOffset;
+                    *skip           = skipNoOffset - nOffset;
                 }
             }
 
@@ -399,23 +527,48 @@ namespace lsp
             {
                 rd->close();
                 delete rd;
-                ar.close();
-                fd.close();
                 return res;
             }
             delete rd;
             rd = NULL;
         }
 
-        skip                = (skip > aparams.frames)? aparams.frames : skip;
-        size_t max_samples  = (max_duration >= 0.0f) ? seconds_to_samples(aparams.sample_rate, max_duration) : -1;
+        *skip               = (*skip > aparams.frames)? aparams.frames : *skip;
+        return STATUS_OK;
+    }
+
+    status_t AudioFile::load_lspc(const LSPString *path, float max_duration)
+    {
+        LSPCFile fd;
+        status_t res = fd.open(path->get_native());
+        if (res != STATUS_OK)
+        {
+            fd.close();
+            return res;
+        }
+
+        // Open audio chunk
+        LSPCAudioReader ar;
+        size_t skip         = 0;
+        res                 = open_lspc(&fd, &ar, &skip);
+        if (res != STATUS_OK)
+        {
+            ar.close();
+            fd.close();
+            return res;
+        }
+
+        lspc_audio_parameters_t aparams;
+        ar.get_parameters(&aparams);
+
+        ssize_t max_samples = (max_duration >= 0.0f) ? seconds_to_samples(aparams.sample_rate, max_duration) : -1;
         lsp_trace("file parameters: frames=%d, channels=%d, sample_rate=%d max_duration=%.3f, max_samples=%d",
                     int(aparams.frames), int(aparams.channels), int(aparams.sample_rate), max_duration, int(max_samples));
 
         aparams.frames     -= skip; // Remove number of frames to skip from audio parameters
 
         // Patch audio header
-        if ((max_samples >= 0) && (aparams.frames > max_samples))
+        if ((max_samples >= 0) && (aparams.frames > size_t(max_samples)))
             aparams.frames     = max_samples;
 
         // Skip set of frames
@@ -553,11 +706,328 @@ namespace lsp
         return res;
     }
 
+    status_t AudioFile::map(const char *path, float max_duration)
+    {
+        if (path == NULL)
+            return STATUS_BAD_ARGUMENTS;
+
+        LSPString spath;
+        if (!spath.set_utf8(path))
+            return STATUS_NO_MEM;
+
+        return map(&spath, max_duration);
+    }
+
+    status_t AudioFile::map(const LSPString *path, float max_duration)
+    {
+        if (path == NULL)
+            return STATUS_BAD_ARGUMENTS;
+
+        #ifndef PLATFORM_WINDOWS
+            // Fall back to regular load if the file can not be mapped
+            if (map_lspc(path, max_duration) == STATUS_OK)
+                return STATUS_OK;
+            if (map_wav(path, max_duration) == STATUS_OK)
+                return STATUS_OK;
+        #endif /* PLATFORM_WINDOWS */
+
+        return load(path, max_duration);
+    }
+
+    status_t AudioFile::map(const io::Path *path, float max_duration)
+    {
+        if (path == NULL)
+            return STATUS_BAD_ARGUMENTS;
+        return map(path->as_string(), max_duration);
+    }
+
+    bool AudioFile::mapped() const
+    {
+        return (pData != NULL) && (pData->pMapping != NULL);
+    }
+
+#ifndef PLATFORM_WINDOWS
+    status_t AudioFile::map_file(const LSPString *path, uint8_t **addr, size_t *size)
+    {
+        int fd = ::open(path->get_native(), O_RDONLY);
+        if (fd < 0)
+            return (errno == ENOENT) ? STATUS_NOT_FOUND : STATUS_IO_ERROR;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return STATUS_IO_ERROR;
+        }
+        else if (st.st_size <= 0)
+        {
+            ::close(fd);
+            return STATUS_BAD_FORMAT;
+        }
+
+        // Private mapping allows to modify data without affecting the file
+        void *ptr = ::mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (ptr == MAP_FAILED)
+            return STATUS_NO_MEM;
+
+        *addr   = reinterpret_cast<uint8_t *>(ptr);
+        *size   = st.st_size;
+        return STATUS_OK;
+    }
+
+    status_t AudioFile::map_lspc(const LSPString *path, float max_duration)
+    {
+        LSPCFile fd;
+        status_t res = fd.open(path->get_native());
+        if (res != STATUS_OK)
+        {
+            fd.close();
+            return res;
+        }
+
+        // Open audio chunk
+        LSPCAudioReader ar;
+        lspc_audio_parameters_t aparams;
+        size_t skip         = 0;
+        res                 = open_lspc(&fd, &ar, &skip);
+        if (res == STATUS_OK)
+            res                 = ar.get_parameters(&aparams);
+        uint32_t uid        = ar.unique_id();
+        ar.close();
+        if (res != STATUS_OK)
+        {
+            fd.close();
+            return res;
+        }
+
+        // Only native floating-point samples can be accessed directly
+        if ((aparams.codec != LSPC_CODEC_PCM) ||
+            (aparams.sample_format != __IF_LEBE(LSPC_SAMPLE_FMT_F32LE, LSPC_SAMPLE_FMT_F32BE)))
+        {
+            fd.close();
+            return STATUS_UNSUPPORTED_FORMAT;
+        }
+
+        // Obtain location of audio data fragments in the file
+        LSPCChunkReader *rd = fd.read_chunk(uid);
+        if (rd == NULL)
+        {
+            fd.close();
+            return STATUS_CORRUPTED_FILE;
+        }
+
+        cstorage<lspc_fragment_t> fragments;
+        lspc_chunk_audio_header_t hdr;
+        wsize_t total       = 0;
+        ssize_t n           = rd->read_header(&hdr, sizeof(lspc_chunk_audio_header_t));
+        while (n >= 0)
+        {
+            lspc_fragment_t *f  = fragments.add();
+            if (f == NULL)
+            {
+                n                   = -STATUS_NO_MEM;
+                break;
+            }
+
+            n                   = rd->skip_fragment(&f->nOffset);
+            if (n <= 0)
+                break;
+            f->nSize            = n;
+            total              += n;
+        }
+
+        rd->close();
+        delete rd;
+        fd.close();
+        if (n < 0)
+            return status_t(-n);
+
+        // Estimate number of frames
+        size_t fz           = aparams.channels * sizeof(float);
+        wsize_t skip_bytes  = wsize_t(skip) * fz;
+        wsize_t avail       = (total > skip_bytes) ? (total - skip_bytes) / fz : 0;
+        size_t frames       = lsp_min(aparams.frames - skip, avail);
+        if (max_duration >= 0.0f)
+            frames              = lsp_min(frames, size_t(seconds_to_samples(aparams.sample_rate, max_duration)));
+
+        // Map the file
+        uint8_t *addr       = NULL;
+        size_t size         = 0;
+        res                 = map_file(path, &addr, &size);
+        if (res != STATUS_OK)
+            return res;
+
+        size_t count        = fragments.size() - 1;
+        file_mapping_t *map = reinterpret_cast<file_mapping_t *>(lsp_tmalloc(uint8_t, sizeof(file_mapping_t) + sizeof(file_extent_t) * count));
+        if (map == NULL)
+        {
+            ::munmap(addr, size);
+            return STATUS_NO_MEM;
+        }
+
+        map->pAddr          = addr;
+        map->nSize          = size;
+        map->nFrameSize     = fz;
+        map->nExtents       = 0;
+
+        // Convert fragments into extents, drop skipped data
+        for (size_t i=0; i<count; ++i)
+        {
+            lspc_fragment_t *f  = fragments.at(i);
+            if ((f->nOffset + f->nSize) > size)
+            {
+                lsp_free(map);
+                ::munmap(addr, size);
+                return STATUS_CORRUPTED_FILE;
+            }
+
+            if (skip_bytes >= f->nSize)
+            {
+                skip_bytes         -= f->nSize;
+                continue;
+            }
+
+            file_extent_t *e    = &map->vExtents[map->nExtents++];
+            e->pData            = &addr[f->nOffset + skip_bytes];
+            e->nSize            = f->nSize - skip_bytes;
+            skip_bytes          = 0;
+        }
+
+        file_content_t *fc  = create_mapped_content(map, aparams.channels, frames);
+        if (fc == NULL)
+        {
+            lsp_free(map);
+            ::munmap(addr, size);
+            return STATUS_NO_MEM;
+        }
+        fc->nSampleRate     = aparams.sample_rate;
+
+        lsp_trace("mapped file: frames=%d, channels=%d, sample_rate=%d, extents=%d, direct=%s",
+                int(fc->nSamples), int(fc->nChannels), int(fc->nSampleRate), int(map->nExtents),
+                (fc->vChannels[0] != NULL) ? "true" : "false");
+
+        // Destroy previously used content and store new
+        if (pData != NULL)
+            destroy_file_content(pData);
+        pData               = fc;
+
+        return STATUS_OK;
+    }
+
+    status_t AudioFile::map_wav(const LSPString *path, float max_duration)
+    {
+        uint8_t *addr       = NULL;
+        size_t size         = 0;
+        status_t res        = map_file(path, &addr, &size);
+        if (res != STATUS_OK)
+            return res;
+
+        // Check RIFF header
+        if ((size < 12) || (::memcmp(addr, "RIFF", 4) != 0) || (::memcmp(&addr[8], "WAVE", 4) != 0))
+        {
+            ::munmap(addr, size);
+            return STATUS_BAD_FORMAT;
+        }
+
+        // Lookup format and data chunks
+        uint16_t tag = 0, channels = 0, align = 0, bits = 0;
+        uint32_t sample_rate = 0;
+        const uint8_t *data = NULL;
+        size_t data_size    = 0;
+
+        for (size_t off = 12; (off + 8) <= size; )
+        {
+            uint32_t ck_size;
+            ::memcpy(&ck_size, &addr[off + 4], sizeof(uint32_t));
+            ck_size             = LE_TO_CPU(ck_size);
+            const uint8_t *ck   = &addr[off + 8];
+            size_t ck_avail     = size - off - 8;
+
+            if ((::memcmp(&addr[off], "fmt ", 4) == 0) && (ck_size >= 16) && (ck_avail >= 16))
+            {
+                ::memcpy(&tag, &ck[0], sizeof(uint16_t));
+                ::memcpy(&channels, &ck[2], sizeof(uint16_t));
+                ::memcpy(&sample_rate, &ck[4], sizeof(uint32_t));
+                ::memcpy(&align, &ck[12], sizeof(uint16_t));
+                ::memcpy(&bits, &ck[14], sizeof(uint16_t));
+                tag                 = LE_TO_CPU(tag);
+                channels            = LE_TO_CPU(channels);
+                sample_rate         = LE_TO_CPU(sample_rate);
+                align               = LE_TO_CPU(align);
+                bits                = LE_TO_CPU(bits);
+
+                // Sub-format of extensible format is stored in the first two bytes of GUID
+                if ((tag == WAV_FORMAT_EXTENSIBLE) && (ck_size >= 40) && (ck_avail >= 40))
+                {
+                    ::memcpy(&tag, &ck[24], sizeof(uint16_t));
+                    tag                 = LE_TO_CPU(tag);
+                }
+            }
+            else if (::memcmp(&addr[off], "data", 4) == 0)
+            {
+                data                = ck;
+                data_size           = lsp_min(size_t(ck_size), ck_avail);
+                break;
+            }
+
+            off                += 8 + ck_size + (ck_size & 1);
+        }
+
+        // Only native floating-point samples can be accessed directly
+        if ((data == NULL) || (tag != WAV_FORMAT_IEEE_FLOAT) || (bits != 32) ||
+            (channels <= 0) || (sample_rate <= 0) || (align != channels * sizeof(float)) ||
+            (!__IF_LEBE(true, false)))
+        {
+            ::munmap(addr, size);
+            return STATUS_UNSUPPORTED_FORMAT;
+        }
+
+        size_t frames       = data_size / align;
+        if (max_duration >= 0.0f)
+            frames              = lsp_min(frames, size_t(seconds_to_samples(sample_rate, max_duration)));
+
+        file_mapping_t *map = reinterpret_cast<file_mapping_t *>(lsp_tmalloc(uint8_t, sizeof(file_mapping_t) + sizeof(file_extent_t)));
+        if (map == NULL)
+        {
+            ::munmap(addr, size);
+            return STATUS_NO_MEM;
+        }
+
+        map->pAddr          = addr;
+        map->nSize          = size;
+        map->nFrameSize     = align;
+        map->nExtents       = 1;
+        map->vExtents[0].pData  = data;
+        map->vExtents[0].nSize  = data_size;
+
+        file_content_t *fc  = create_mapped_content(map, channels, frames);
+        if (fc == NULL)
+        {
+            lsp_free(map);
+            ::munmap(addr, size);
+            return STATUS_NO_MEM;
+        }
+        fc->nSampleRate     = sample_rate;
+
+        // Destroy previously used content and store new
+        if (pData != NULL)
+            destroy_file_content(pData);
+        pData               = fc;
+
+        return STATUS_OK;
+    }
+#endif /* PLATFORM_WINDOWS */
+
     status_t AudioFile::store_samples(const LSPString *path, size_t from, size_t max_count)
     {
         if (pData == NULL)
             return STATUS_NO_DATA;
 
+        status_t xres = unpack_channels();
+        if (xres != STATUS_OK)
+            return xres;
+
         #ifdef PLATFORM_WINDOWS
             status_t res = save_mfapi(path, from, max_count);
             if (res == STATUS_BAD_FORMAT)
@@ -652,6 +1122,8 @@ namespace lsp
     {
         if (pData == NULL)
             return false;
+        if (unpack_channels() != STATUS_OK)
+            return false;
 
         if (track_id >= 0)
         {
@@ -690,178 +1162,131 @@ namespace lsp
         return (pData != NULL) ? pData->nSampleRate : 0;
     }
 
-    status_t AudioFile::resample(size_t new_sample_rate)
+    status_t AudioFile::resample(size_t new_sample_rate, ipc::IExecutor *executor)
     {
-        // Check that resampling is actually needed
-        if (new_sample_rate > pData->nSampleRate)
-        {
-            // Need to up-sample data
-            if ((new_sample_rate % pData->nSampleRate) == 0)
-                return fast_upsample(new_sample_rate);
-            else
-                return complex_upsample(new_sample_rate);
-        }
-        else if (new_sample_rate < pData->nSampleRate)
-        {
-            // Need to down-sample data
-            if ((pData->nSampleRate % new_sample_rate) == 0)
-                return fast_downsample(new_sample_rate);
-            else
-                return complex_downsample(new_sample_rate);
-        }
-
-        // Return OK status
-        return STATUS_OK;
-    }
-
-    status_t AudioFile::fast_downsample(size_t new_sample_rate)
-    {
-        size_t rkf          = pData->nSampleRate / new_sample_rate;
-        size_t new_samples  = pData->nSamples / rkf;
-
-        // Prepare new data structure to store resampled data
-        file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
-        if (fc == NULL)
-            return STATUS_NO_MEM;
-        fc->nSampleRate     = new_sample_rate;
-
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
-        {
-            const float *src    = pData->vChannels[c];
-            float *dst          = fc->vChannels[c];
-
-            for (size_t i=0, p=0; i < pData->nSamples; i += rkf, p++)
-                dst[p]              = src[i];
-        }
+        if (pData == NULL)
+            return STATUS_NO_DATA;
 
-        // Destroy old data content
-        destroy_file_content(pData);
+        // Check that resampling is actually needed, keep mapped data packed otherwise
+        if (new_sample_rate == pData->nSampleRate)
+            return STATUS_OK;
 
-        // Store new file content
-        pData       = fc;
+        status_t res = unpack_channels();
+        if (res != STATUS_OK)
+            return res;
 
-        return STATUS_OK;
+        // Integer ratios are the special case of the polyphase resampling
+        return polyphase_resample(new_sample_rate, executor);
     }
 
-    status_t AudioFile::fast_upsample(size_t new_sample_rate)
+    void AudioFile::resample_block(resampler_t *r, size_t item)
     {
-        // Calculate parameters of transformation
-        ssize_t kf          = new_sample_rate / pData->nSampleRate;
-        float rkf           = 1.0f / kf;
+        size_t c            = item / r->nBlocks;
+        size_t first        = (item % r->nBlocks) * RESAMPLING_BLOCK;
+        size_t last         = lsp_min(first + RESAMPLING_BLOCK, r->nSamples);
 
-        // Prepare kernel for resampling
-        ssize_t k_periods   = RESAMPLING_PERIODS; // * (kf >> 1);
-        ssize_t k_base      = k_periods * kf;
-        ssize_t k_center    = k_base + 1;
-        ssize_t k_len       = (k_center << 1) + 1;
-        ssize_t k_size      = ALIGN_SIZE(k_len + 1, 4); // Additional sample for time offset
-        float *k            = lsp_tmalloc(float, k_size);
-        if (k == NULL)
-            return STATUS_NO_MEM;
+        const float *src    = r->vSrc[c];
+        float *dst          = r->vDst[c];
 
-        // Prepare temporary buffer for resampling
-        size_t new_samples  = kf * pData->nSamples;
-        size_t b_len        = new_samples + k_size;
-        size_t b_size       = ALIGN_SIZE(b_len, 4);
-        float *b            = lsp_tmalloc(float, b_size);
-        if (b == NULL)
-        {
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
+        // Compute position of the first sample in the source signal
+        wsize_t pos         = wsize_t(first) * r->nSrcStep;
+        size_t m            = pos / r->nDstStep;        // Integer part of position
+        size_t phase        = pos % r->nDstStep;        // Fractional part of position
+        size_t dm           = r->nSrcStep / r->nDstStep;
+        size_t dphase       = r->nSrcStep % r->nDstStep;
 
-        // Prepare new data structure to store resampled data
-        file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
-        if (fc == NULL)
+        if (r->nPhases == r->nDstStep)
         {
-            lsp_free(b);
-            lsp_free(k);
-            return STATUS_NO_MEM;
+            // Each phase has it's own kernel
+            for (size_t i=first; i<last; ++i)
+            {
+                dst[i]          = dsp::h_dotp(&src[m], &r->vKernel[phase * r->nTaps], r->nTaps);
+                m              += dm;
+                if ((phase += dphase) >= r->nDstStep)
+                {
+                    phase          -= r->nDstStep;
+                    ++m;
+                }
+            }
         }
-        fc->nSampleRate     = new_sample_rate;
-
-        // Generate Lanczos kernel
-        for (ssize_t j=0; j<k_size; ++j)
+        else
         {
-            float t         = (j - k_center) * rkf;
-
-            if ((t > -k_periods) && (t < k_periods))
+            // Phases are quantized to the nearest kernel
+            for (size_t i=first; i<last; ++i)
             {
-                if (t != 0)
+                size_t k        = (wsize_t(phase) * r->nPhases + (r->nDstStep >> 1)) / r->nDstStep;
+                dst[i]          = (k < r->nPhases) ?
+                                    dsp::h_dotp(&src[m], &r->vKernel[k * r->nTaps], r->nTaps) :
+                                    dsp::h_dotp(&src[m+1], r->vKernel, r->nTaps);
+                m              += dm;
+                if ((phase += dphase) >= r->nDstStep)
                 {
-                    float t2    = M_PI * t;
-                    k[j]        = k_periods * sinf(t2) * sinf(t2 / k_periods) / (t2 * t2);
+                    phase          -= r->nDstStep;
+                    ++m;
                 }
-                else
-                    k[j]        = 1.0f;
             }
-            else
-                k[j]        = 0.0f;
         }
+    }
 
-        // Output dump
-//        printf("----------------------\n");
-//        printf("j;t;k(j);\n");
-//        for (ssize_t j=0; j<k_len; ++j)
-//        {
-//            float t         = (j - k_center) * rkf;
-//            printf("%d;%f;%f;\n", int(j), t, k[j]);
-//        }
-//        printf("----------------------\n");
-
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
+    void AudioFile::resample_blocks(resampler_t *r)
+    {
+        while (true)
         {
-            const float *src    = pData->vChannels[c];
-            dsp::fill_zero(b, b_size);  // Clear the temporary buffer
-
-            // Perform convolutions
-            for (size_t i=0, p=0; i<pData->nSamples; i++, p += kf)
-                dsp::fmadd_k3(&b[p], k, src[i], k_size);
-
-            // Copy the data to the file content
-            dsp::copy(fc->vChannels[c], &b[k_center], fc->nSamples);
+            size_t item         = atomic_add(&r->nNext, 1);
+            if (item >= r->nItems)
+                break;
+            resample_block(r, item);
         }
+    }
 
-        // Delete  temporary buffers
-        destroy_file_content(pData);
-        lsp_free(b);
-        lsp_free(k);
+    AudioFile::ResampleTask::ResampleTask(resampler_t *r)
+    {
+        pResampler      = r;
+    }
 
-        // Store new file content
-        pData       = fc;
+    AudioFile::ResampleTask::~ResampleTask()
+    {
+        pResampler      = NULL;
+    }
 
+    status_t AudioFile::ResampleTask::run()
+    {
+        resample_blocks(pResampler);
         return STATUS_OK;
     }
 
-    status_t AudioFile::complex_upsample(size_t new_sample_rate)
+    status_t AudioFile::polyphase_resample(size_t new_sample_rate, ipc::IExecutor *executor)
     {
-        // Calculate parameters of transformation
-        ssize_t gcd         = gcd_euclid(new_sample_rate, pData->nSampleRate);
-        ssize_t src_step    = pData->nSampleRate / gcd;
-        ssize_t dst_step    = new_sample_rate / gcd;
-        float kf            = float(dst_step) / float(src_step);
-        float rkf           = float(src_step) / float(dst_step);
-
-        // Prepare kernel for resampling
-        ssize_t k_periods   = RESAMPLING_PERIODS; // Number of periods
-        ssize_t k_base      = k_periods * kf;
-        ssize_t k_center    = k_base + 1;
-        ssize_t k_len       = (k_center << 1) + 1; // Centered impulse response
-        ssize_t k_size      = ALIGN_SIZE(k_len + 1, 4); // Additional sample for time offset
-        float *k            = lsp_tmalloc(float, k_size);
-        if (k == NULL)
+        // Calculate parameters of transformation: new_sample_rate / sample_rate = dst_step / src_step
+        size_t gcd          = gcd_euclid(new_sample_rate, pData->nSampleRate);
+        size_t src_step     = pData->nSampleRate / gcd;
+        size_t dst_step     = new_sample_rate / gcd;
+        size_t new_samples  = (wsize_t(pData->nSamples) * dst_step) / src_step;
+
+        // Compute kernel parameters. When downsampling, the cut-off frequency of the
+        // kernel should match the Nyquist frequency of the new sample rate
+        float kc            = (dst_step < src_step) ? float(dst_step) / float(src_step) : 1.0f;
+        size_t k_half       = (dst_step < src_step) ?
+                                (RESAMPLING_PERIODS * src_step + dst_step - 1) / dst_step :
+                                RESAMPLING_PERIODS;
+        size_t k_taps       = ALIGN_SIZE((k_half << 1) + 1, 4);
+        size_t k_phases     = lsp_min(dst_step, size_t(RESAMPLING_MAX_PHASES));
+
+        // Compute size of zero-padded source channels, the content of the file is
+        // aligned to 4 samples, so keep enough space for computing tail samples
+        size_t s_tail       = k_taps + (4 * src_step) / dst_step + 2;
+        size_t s_stride     = ALIGN_SIZE(k_half + pData->nSamples + s_tail, 4);
+        size_t s_size       = s_stride * pData->nChannels;
+        size_t k_size       = k_phases * k_taps;
+
+        uint8_t *data       = NULL;
+        float *buf          = alloc_aligned<float>(data, s_size + k_size);
+        if (buf == NULL)
             return STATUS_NO_MEM;
-
-        // Prepare temporary buffer for resampling
-        size_t new_samples  = kf * pData->nSamples;
-        size_t b_len        = new_samples + k_size;
-        size_t b_size       = ALIGN_SIZE(b_len, 4);
-        float *b            = lsp_tmalloc(float, b_size);
-        if (b == NULL)
+        float **vsrc        = reinterpret_cast<float **>(lsp_malloc(sizeof(float *) * pData->nChannels));
+        if (vsrc == NULL)
         {
-            lsp_free(k);
+            free_aligned(data);
             return STATUS_NO_MEM;
         }
 
@@ -869,173 +1294,112 @@ namespace lsp
         file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
         if (fc == NULL)
         {
-            lsp_free(b);
-            lsp_free(k);
+            lsp_free(vsrc);
+            free_aligned(data);
             return STATUS_NO_MEM;
         }
         fc->nSampleRate     = new_sample_rate;
 
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
+        // Generate windowed sinc kernel for each phase of the output sample
+        float *k            = &buf[s_size];
+        for (size_t i=0; i<k_phases; ++i)
         {
-            const float *src    = pData->vChannels[c];
-            dsp::fill_zero(b, b_size);  // Clear the temporary buffer
+            float *row          = &k[i * k_taps];
+            float dt            = float(k_half) + float(i) / float(k_phases);
+            float sum           = 0.0f;
 
-            for (ssize_t i=0; i<src_step; ++i)
+            for (size_t j=0; j<k_taps; ++j)
             {
-                // calculate the offset between nearest samples
-                ssize_t p       = kf * i;
-                float dt        = i*kf - p;
-
-                // Generate Lanczos kernel
-                for (ssize_t j=0; j<k_size; ++j)
+                float t             = (dt - j) * kc;
+                if ((t > -RESAMPLING_PERIODS) && (t < RESAMPLING_PERIODS))
                 {
-                    float t         = (j - k_center - dt) * rkf;
-
-                    if ((t > -k_periods) && (t < k_periods))
+                    if (t != 0.0f)
                     {
-                        if (t != 0.0f)
-                        {
-                            float t2    = M_PI * t;
-                            k[j]        = k_periods * sinf(t2) * sinf(t2 / k_periods) / (t2 * t2);
-                        }
-                        else
-                            k[j]        = 1.0f;
+                        float t2            = M_PI * t;
+                        row[j]              = RESAMPLING_PERIODS * sinf(t2) * sinf(t2 / RESAMPLING_PERIODS) / (t2 * t2);
                     }
                     else
-                        k[j]        = 0.0f;
-                }
-
-                // Output dump
-//                printf("----------------------\n");
-//                printf("j;t;k(j);\n");
-//                for (ssize_t j=0; j<k_len; ++j)
-//                {
-//                    float t         = (j - k_center - dt) * kt;
-//                    printf("%d;%f;%f;\n", int(j), t, k[j]);
-//                }
-//                printf("----------------------\n");
-
-                // Perform convolutions
-                for (size_t j=i; j<pData->nSamples; j += src_step)
-                {
-                    dsp::fmadd_k3(&b[p], k, src[j], k_size);
-                    p   += dst_step;
+                        row[j]              = 1.0f;
                 }
+                else
+                    row[j]              = 0.0f;
+                sum                += row[j];
             }
 
-            // Copy the data to the file content
-            dsp::copy(fc->vChannels[c], &b[k_center], fc->nSamples);
+            // Normalize the gain of each phase
+            dsp::mul_k2(row, 1.0f / sum, k_taps);
+        }
+
+        // Prepare zero-padded copies of source channels
+        for (size_t c=0; c<pData->nChannels; ++c)
+        {
+            float *src          = &buf[c * s_stride];
+            dsp::fill_zero(src, k_half);
+            dsp::copy(&src[k_half], pData->vChannels[c], pData->nSamples);
+            dsp::fill_zero(&src[k_half + pData->nSamples], s_stride - k_half - pData->nSamples);
+            vsrc[c]             = src;
+        }
+
+        // Prepare the resampler
+        resampler_t r;
+        r.vKernel           = k;
+        r.nTaps             = k_taps;
+        r.nPhases           = k_phases;
+        r.nSrcStep          = src_step;
+        r.nDstStep          = dst_step;
+        r.nSamples          = fc->nSamples;
+        r.nBlocks           = (fc->nSamples + RESAMPLING_BLOCK - 1) / RESAMPLING_BLOCK;
+        r.nItems            = r.nBlocks * fc->nChannels;
+        r.nNext             = 0;
+        r.vSrc              = vsrc;
+        r.vDst              = fc->vChannels;
+
+        // Submit helper tasks to the executor, the current thread also processes blocks.
+        // Executors that can not cancel tasks are not used: helpers that have not been
+        // started until all blocks are processed get cancelled instead of waiting for them
+        cvector<ResampleTask> helpers;
+        size_t n_helpers    = ((executor != NULL) && (r.nItems > 1)) ? lsp_min(size_t(RESAMPLING_MAX_TASKS - 1), r.nItems - 1) : 0;
+        for (size_t i=0; i<n_helpers; ++i)
+        {
+            ResampleTask *t     = new ResampleTask(&r);
+            if (t == NULL)
+                break;
+            if ((!executor->cancel(t)) || (!helpers.add(t)))
+            {
+                delete t;
+                break;
+            }
+            if (!executor->submit(t))
+            {
+                helpers.remove(t);
+                delete t;
+                break;
+            }
         }
 
-        // Delete  temporary buffers
-        destroy_file_content(pData);
-        lsp_free(b);
-        lsp_free(k);
-
-        // Store new file content
-        pData       = fc;
-
-        return STATUS_OK;
-    }
-
-    status_t AudioFile::complex_downsample(size_t new_sample_rate)
-    {
-        // Calculate parameters of transformation
-        ssize_t gcd         = gcd_euclid(new_sample_rate, pData->nSampleRate);
-        ssize_t src_step    = pData->nSampleRate / gcd;
-        ssize_t dst_step    = new_sample_rate / gcd;
-        float kf            = float(dst_step) / float(src_step);
-        float rkf           = float(src_step) / float(dst_step);
+        lsp_trace("resampling %d -> %d, taps=%d, phases=%d, blocks=%d, helpers=%d",
+                int(pData->nSampleRate), int(new_sample_rate), int(k_taps), int(k_phases),
+                int(r.nItems), int(helpers.size()));
 
-        // Prepare kernel for resampling
-        ssize_t k_base      = RESAMPLING_PERIODS;
-        ssize_t k_periods   = k_base * rkf; // Number of periods
-        ssize_t k_center    = k_base + 1;
-        ssize_t k_len       = (k_center << 1) + rkf + 1; // Centered impulse response
-        ssize_t k_size      = ALIGN_SIZE(k_len + 1, 4); // Additional sample for time offset
-        float *k            = lsp_tmalloc(float, k_size);
-        if (k == NULL)
-            return STATUS_NO_MEM;
+        resample_blocks(&r);
 
-        // Prepare temporary buffer for resampling
-        size_t new_samples  = kf * pData->nSamples;
-        size_t b_len        = new_samples + k_size;
-        size_t b_size       = ALIGN_SIZE(b_len, 4);
-        float *b            = lsp_tmalloc(float, b_size);
-        if (b == NULL)
+        // Cancel helpers that have not been started, wait for running helpers
+        for (size_t i=0, n=helpers.size(); i<n; ++i)
         {
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
-
-        // Prepare new data structure to store resampled data
-        file_content_t *fc  = create_file_content(pData->nChannels, new_samples);
-        if (fc == NULL)
-        {
-            lsp_free(b);
-            lsp_free(k);
-            return STATUS_NO_MEM;
-        }
-        fc->nSampleRate     = new_sample_rate;
-
-        // Iterate each channel
-        for (size_t c=0; c<fc->nChannels; ++c)
-        {
-            const float *src    = pData->vChannels[c];
-            dsp::fill_zero(b, b_size);  // Clear the temporary buffer
-
-            for (ssize_t i=0; i<src_step; ++i)
+            ResampleTask *t     = helpers.at(i);
+            if (!executor->cancel(t))
             {
-                // calculate the offset between nearest samples
-                ssize_t p       = kf * i;
-                float dt        = i*kf - p; // Always positive, in range of [0..1]
-
-                // Generate Lanczos kernel
-                for (ssize_t j=0; j<k_size; ++j)
-                {
-                    float t         = (j - k_center - dt) * rkf;
-
-                    if ((t > -k_periods) && (t < k_periods))
-                    {
-                        if (t != 0.0f)
-                        {
-                            float t2    = M_PI * t;
-                            k[j]        = k_periods * sinf(t2) * sinf(t2 / k_periods) / (t2 * t2);
-                        }
-                        else
-                            k[j]        = 1.0f;
-                    }
-                    else
-                        k[j]        = 0.0f;
-                }
-
-                // Output dump
-//                printf("----------------------\n");
-//                printf("j;t;k(j);\n");
-//                for (ssize_t j=0; j<k_size; ++j)
-//                {
-//                    float t         = (j - k_center - dt) * kt;
-//                    printf("%d;%f;%f;\n", int(j), t, k[j]);
-//                }
-//                printf("----------------------\n");
-
-                // Perform convolutions
-                for (size_t j=i; j<pData->nSamples; j += src_step)
-                {
-                    dsp::fmadd_k3(&b[p], k, src[j], k_size);
-                    p   += dst_step;
-                }
+                while (!t->completed())
+                    ipc::Thread::yield();
             }
-
-            // Copy the data to the file content
-            dsp::copy(fc->vChannels[c], &b[k_center], fc->nSamples);
+            delete t;
         }
+        helpers.flush();
 
-        // Delete  temporary buffers
+        // Delete temporary buffers
         destroy_file_content(pData);
-        lsp_free(b);
-        lsp_free(k);
+        lsp_free(vsrc);
+        free_aligned(data);
 
         // Store new file content
         pData       = fc;
@@ -1049,7 +1413,7 @@ namespace lsp
             return NULL;
         if (track >= pData->nChannels)
             return NULL;
-        return pData->vChannels[track];
+        return unpack_channel(pData, track);
     }
 
     status_t AudioFile::convert_to_sample(Sample *dst)
@@ -1059,6 +1423,10 @@ namespace lsp
         if (pData == NULL)
             return STATUS_BAD_STATE;
 
+        status_t res = unpack_channels();
+        if (res != STATUS_OK)
+            return res;
+
         // Create and initialize temorary sample instance
         Sample tmp;
         if (!tmp.init(pData->nChannels, pData->nSamples, pData->nSamples))
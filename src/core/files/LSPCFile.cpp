@@ -9,6 +9,8 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
 
 #include <dsp/endian.h>
 #include <core/debug.h>
@@ -41,6 +43,10 @@ namespace lsp
         res->bufsize    = 0x10000;
         res->chunk_id   = 0;
         res->length     = 0;
+        res->toc        = NULL;
+        res->toc_items  = 0;
+        res->toc_cap    = 0;
+        res->toc_valid  = false;
 
         return res;
     }
@@ -115,6 +121,87 @@ namespace lsp
         pFile               = res;
         bWrite              = false;
 
+        // Load table of contents, the file is scanned for chunks if it is not present
+        wsize_t toc_offset  = BE_TO_CPU(hdr.toc_offset);
+        if ((toc_offset > 0) && (load_toc(toc_offset) != STATUS_OK))
+            lsp_trace("Could not load table of contents, falling back to linear scan");
+
+        return STATUS_OK;
+    }
+
+    status_t LSPCFile::load_toc(wsize_t offset)
+    {
+        // Read header of the table of contents chunk
+        lspc_chunk_header_t hdr;
+        ssize_t n = pFile->read(offset, &hdr, sizeof(lspc_chunk_header_t));
+        if (n != sizeof(lspc_chunk_header_t))
+            return STATUS_CORRUPTED_FILE;
+        if (BE_TO_CPU(hdr.magic) != LSPC_CHUNK_TOC)
+            return STATUS_CORRUPTED_FILE;
+
+        LSPCChunkReader *rd = new LSPCChunkReader(pFile, LSPC_CHUNK_TOC, BE_TO_CPU(hdr.uid));
+        if (rd == NULL)
+            return STATUS_NO_MEM;
+        rd->nFileOff        = offset + sizeof(lspc_chunk_header_t);
+        rd->nUnread         = BE_TO_CPU(hdr.size);
+        rd->bLast           = BE_TO_CPU(hdr.flags) & LSPC_CHUNK_FLAG_LAST;
+
+        // Read the header and entries
+        lspc_chunk_toc_header_t thdr;
+        lspc_toc_entry_t *toc   = NULL;
+        size_t items            = 0;
+        status_t res            = STATUS_OK;
+
+        n       = rd->read_header(&thdr, sizeof(lspc_chunk_toc_header_t));
+        if (n < 0)
+            res     = status_t(-n);
+        else if ((thdr.common.version < 1) || (thdr.common.size < sizeof(lspc_chunk_toc_header_t)))
+            res     = STATUS_CORRUPTED_FILE;
+        else
+        {
+            items   = BE_TO_CPU(thdr.entries);
+            toc     = (items > 0) ? static_cast<lspc_toc_entry_t *>(malloc(items * sizeof(lspc_toc_entry_t))) : NULL;
+            if ((items > 0) && (toc == NULL))
+                res     = STATUS_NO_MEM;
+        }
+
+        if (res == STATUS_OK)
+        {
+            n       = rd->read(toc, items * sizeof(lspc_toc_entry_t));
+            if (n != ssize_t(items * sizeof(lspc_toc_entry_t)))
+                res     = STATUS_CORRUPTED_FILE;
+        }
+
+        // The table of contents should be the last chunk in the file,
+        // otherwise it does not list the chunks written after it
+        uint8_t tail;
+        if ((res == STATUS_OK) && ((!rd->bLast) || (rd->nUnread > 0) || (pFile->read(rd->nFileOff, &tail, sizeof(tail)) != 0)))
+            res     = STATUS_CORRUPTED_FILE;
+
+        rd->close();
+        delete rd;
+
+        if (res != STATUS_OK)
+        {
+            if (toc != NULL)
+                free(toc);
+            return res;
+        }
+
+        // Convert entries and commit the table
+        for (size_t i=0; i<items; ++i)
+        {
+            toc[i].uid      = BE_TO_CPU(toc[i].uid);
+            toc[i].magic    = BE_TO_CPU(toc[i].magic);
+            toc[i].offset   = BE_TO_CPU(toc[i].offset);
+        }
+
+        pFile->toc          = toc;
+        pFile->toc_items    = items;
+        pFile->toc_cap      = items;
+        pFile->toc_valid    = true;
+        pFile->sort_toc();
+
         return STATUS_OK;
     }
 
@@ -190,21 +277,82 @@ namespace lsp
         }
 
         res->length         = sizeof(hdr);
+        res->toc_valid      = true;
         pFile               = res;
         bWrite              = true;
 
         return STATUS_OK;
     }
 
+    status_t LSPCFile::write_toc()
+    {
+        // Serialize the entries, the writer of the table of contents chunk also updates the table
+        size_t items            = pFile->toc_items;
+        lspc_toc_entry_t *toc   = NULL;
+        if (items > 0)
+        {
+            pFile->sort_toc();
+            toc     = static_cast<lspc_toc_entry_t *>(malloc(items * sizeof(lspc_toc_entry_t)));
+            if (toc == NULL)
+                return STATUS_NO_MEM;
+
+            for (size_t i=0; i<items; ++i)
+            {
+                toc[i].uid      = CPU_TO_BE(pFile->toc[i].uid);
+                toc[i].magic    = CPU_TO_BE(pFile->toc[i].magic);
+                toc[i].offset   = CPU_TO_BE(uint64_t(pFile->toc[i].offset));
+            }
+        }
+
+        // Write the chunk
+        wsize_t offset      = pFile->length;
+        LSPCChunkWriter *wr = write_chunk(LSPC_CHUNK_TOC);
+        if (wr == NULL)
+        {
+            if (toc != NULL)
+                free(toc);
+            return STATUS_NO_MEM;
+        }
+
+        lspc_chunk_toc_header_t hdr;
+        memset(&hdr, 0, sizeof(lspc_chunk_toc_header_t));
+        hdr.common.size     = sizeof(lspc_chunk_toc_header_t);
+        hdr.common.version  = 1;
+        hdr.entries         = CPU_TO_BE(uint32_t(items));
+
+        status_t res        = wr->write_header(&hdr);
+        if ((res == STATUS_OK) && (items > 0))
+            res                 = wr->write(toc, items * sizeof(lspc_toc_entry_t));
+        status_t res2       = wr->close();
+        delete wr;
+        if (toc != NULL)
+            free(toc);
+
+        if (res == STATUS_OK)
+            res                 = res2;
+        if (res != STATUS_OK)
+            return res;
+
+        // Store the position of the table of contents in the root header
+        uint64_t toc_offset = CPU_TO_BE(uint64_t(offset));
+        return pFile->write(offsetof(lspc_root_header_t, toc_offset), &toc_offset, sizeof(toc_offset));
+    }
+
     status_t LSPCFile::close()
     {
         if (pFile == NULL)
             return STATUS_BAD_STATE;
-        status_t res = pFile->release();
+
+        // Write table of contents if there are no active chunk writers
+        status_t res = STATUS_OK;
+        if ((bWrite) && (pFile->toc_valid) && (pFile->refs <= 1))
+            res     = write_toc();
+
+        status_t res2 = pFile->release();
         if (pFile->refs <= 0)
             delete pFile;
         pFile   = NULL;
-        return res;
+        return (res == STATUS_OK) ? res2 : res;
     }
 
     LSPCChunkWriter *LSPCFile::write_chunk(uint32_t magic)
@@ -224,6 +372,14 @@ namespace lsp
         // Find the initial position of the chunk in file
         lspc_chunk_header_t hdr;
         wsize_t pos         = nHdrSize;
+        if (pFile->toc_valid)
+        {
+            const lspc_toc_entry_t *e = pFile->lookup(uid);
+            if (e == NULL)
+                return NULL;
+            pos                 = e->offset;
+        }
+
         while (true)
         {
             ssize_t res = pFile->read(pos, &hdr, sizeof(lspc_chunk_header_t));
@@ -249,6 +405,7 @@ namespace lsp
             return NULL;
         rd->nFileOff        = pos;
         rd->nUnread         = hdr.size;
+        rd->bLast           = hdr.flags & LSPC_CHUNK_FLAG_LAST;
         return rd;
     }
 
@@ -260,6 +417,14 @@ namespace lsp
         // Find the initial position of the chunk in file
         lspc_chunk_header_t hdr;
         wsize_t pos         = nHdrSize;
+        if (pFile->toc_valid)
+        {
+            const lspc_toc_entry_t *e = pFile->lookup(uid);
+            if ((e == NULL) || (e->magic != magic))
+                return NULL;
+            pos                 = e->offset;
+        }
+
         while (true)
         {
             ssize_t res = pFile->read(pos, &hdr, sizeof(lspc_chunk_header_t));
@@ -283,6 +448,7 @@ namespace lsp
             return NULL;
         rd->nFileOff        = pos;
         rd->nUnread         = hdr.size;
+        rd->bLast           = hdr.flags & LSPC_CHUNK_FLAG_LAST;
         return rd;
     }
 
@@ -294,6 +460,23 @@ namespace lsp
         // Find the initial position of the chunk in file
         lspc_chunk_header_t hdr;
         wsize_t pos         = nHdrSize;
+        if (pFile->toc_valid)
+        {
+            const lspc_toc_entry_t *e = NULL;
+            for (size_t i=0; i<pFile->toc_items; ++i)
+            {
+                const lspc_toc_entry_t *xe = &pFile->toc[i];
+                if ((xe->uid >= start_id) && (xe->magic == magic))
+                {
+                    e                   = xe;
+                    break;
+                }
+            }
+            if (e == NULL)
+                return NULL;
+            pos                 = e->offset;
+        }
+
         while (true)
         {
             ssize_t res = pFile->read(pos, &hdr, sizeof(lspc_chunk_header_t));
@@ -319,6 +502,7 @@ namespace lsp
             *id                 = rd->unique_id();
         rd->nFileOff        = pos;
         rd->nUnread         = hdr.size;
+        rd->bLast           = hdr.flags & LSPC_CHUNK_FLAG_LAST;
         return rd;
     }
 
@@ -5,11 +5,13 @@
  *      Author: sadko
  */
 
+#include <dsp/dsp.h>
 #include <dsp/endian.h>
 #include <string.h>
 #include <stdlib.h>
 #include <core/debug.h>
 #include <core/files/lspc/LSPCAudioReader.h>
+#include <core/files/lspc/lossless.h>
 
 #define BUFFER_SIZE     0x2000
 #define BUFFER_FRAMES   0x400
@@ -39,9 +41,7 @@ namespace lsp
 
     void LSPCAudioReader::decode_s16(float *vp, const void *src, size_t ns)
     {
-        const int16_t *p = reinterpret_cast<const int16_t *>(src);
-        while (ns--)
-            *(vp++) = float(*(p++)) / 0x7fff;
+        dsp::pcm_s16_to_f32(vp, reinterpret_cast<const int16_t *>(src), ns);
     }
 
     void LSPCAudioReader::decode_u24le(float *vp, const void *src, size_t ns)
@@ -49,11 +49,7 @@ namespace lsp
         const uint8_t *p = reinterpret_cast<const uint8_t *>(src);
         while (ns--)
         {
-            int32_t v =
-               __IF_LEBE(
-                   p[0] | (p[1] << 8) | (p[2] << 16),
-                   p[2] | (p[1] << 8) | (p[0] << 16)
-               );
+            int32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
 
             *(vp++) = float(v - 0x800000) / 0x7fffff;
             p += 3;
@@ -65,11 +61,7 @@ namespace lsp
         const uint8_t *p = reinterpret_cast<const uint8_t *>(src);
         while (ns--)
         {
-            int32_t v =
-               __IF_LEBE(
-                   p[2] | (p[1] << 8) | (p[0] << 16),
-                   p[0] | (p[1] << 8) | (p[2] << 16)
-               );
+            int32_t v = p[2] | (p[1] << 8) | (p[0] << 16);
 
             *(vp++) = float(v - 0x800000) / 0x7fffff;
             p += 3;
@@ -78,34 +70,12 @@ namespace lsp
 
     void LSPCAudioReader::decode_s24le(float *vp, const void *src, size_t ns)
     {
-        const uint8_t *p = reinterpret_cast<const uint8_t *>(src);
-        while (ns--)
-        {
-            int32_t v =
-               __IF_LEBE(
-                   p[0] | (p[1] << 8) | (p[2] << 16),
-                   p[2] | (p[1] << 8) | (p[0] << 16)
-               );
-            v = (v << 8) >> 8; // Sign-extend value
-            *(vp++) = float(v) / 0x7fffff;
-            p += 3;
-        }
+        dsp::pcm_s24le_to_f32(vp, reinterpret_cast<const uint8_t *>(src), ns);
     }
 
     void LSPCAudioReader::decode_s24be(float *vp, const void *src, size_t ns)
     {
-        const uint8_t *p = reinterpret_cast<const uint8_t *>(src);
-        while (ns--)
-        {
-            int32_t v =
-               __IF_LEBE(
-                   p[2] | (p[1] << 8) | (p[0] << 16),
-                   p[0] | (p[1] << 8) | (p[2] << 16)
-               );
-            v = (v << 8) >> 8; // Sign-extend value
-            *(vp++) = float(v) / 0x7fffff;
-            p += 3;
-        }
+        dsp::pcm_s24be_to_f32(vp, reinterpret_cast<const uint8_t *>(src), ns);
     }
 
     void LSPCAudioReader::decode_u32(float *vp, const void *src, size_t ns)
@@ -120,26 +90,17 @@ namespace lsp
 
     void LSPCAudioReader::decode_s32(float *vp, const void *src, size_t ns)
     {
-        const int32_t *p = reinterpret_cast<const int32_t *>(src);
-        while (ns--)
-        {
-            int32_t v = *(p++);
-            *(vp++) = double(v) / 0x7fffffff;
-        }
+        dsp::pcm_s32_to_f32(vp, reinterpret_cast<const int32_t *>(src), ns);
     }
 
     void LSPCAudioReader::decode_f32(float *vp, const void *src, size_t ns)
     {
-        const float *p = reinterpret_cast<const float *>(src);
-        while (ns--)
-            *(vp++) = *(p++);
+        dsp::copy(vp, reinterpret_cast<const float *>(src), ns);
     }
 
     void LSPCAudioReader::decode_f64(float *vp, const void *src, size_t ns)
     {
-        const double *p = reinterpret_cast<const double *>(src);
-        while (ns--)
-            *(vp++) = *(p++);
+        dsp::pcm_f64_to_f32(vp, reinterpret_cast<const double *>(src), ns);
     }
     
     LSPCAudioReader::LSPCAudioReader()
@@ -161,6 +122,15 @@ namespace lsp
         sBuf.nSize              = 0;
         pDecode                 = NULL;
         pFBuffer                = NULL;
+
+        sBlock.vSamples         = NULL;
+        sBlock.nFrames          = 0;
+        sBlock.nOff             = 0;
+        sBlock.fRange           = 0.0f;
+        nIndexId                = 0;
+        vIndex                  = NULL;
+        nIndexItems             = 0;
+        nFramePos               = 0;
     }
     
     LSPCAudioReader::~LSPCAudioReader()
@@ -209,6 +179,18 @@ namespace lsp
             pFBuffer        = NULL;
         }
 
+        if (sBlock.vSamples != NULL)
+        {
+            delete [] sBlock.vSamples;
+            sBlock.vSamples = NULL;
+        }
+
+        if (vIndex != NULL)
+        {
+            ::free(vIndex);
+            vIndex          = NULL;
+        }
+
         nFlags          = 0;
         nBPS            = 0;
         nFrameSize      = 0;
@@ -216,6 +198,11 @@ namespace lsp
         sBuf.nOff       = 0;
         sBuf.nSize      = 0;
         pDecode         = NULL;
+        sBlock.nFrames  = 0;
+        sBlock.nOff     = 0;
+        nIndexId        = 0;
+        nIndexItems     = 0;
+        nFramePos       = 0;
         return res;
     }
 
@@ -240,17 +227,106 @@ namespace lsp
         p.sample_rate       = BE_TO_CPU(hdr.sample_rate);
         p.codec             = BE_TO_CPU(hdr.codec);
         p.frames            = BE_TO_CPU(hdr.frames);
+        nIndexId            = BE_TO_CPU(hdr.index_id);
 
         return apply_params(&p);
     }
 
+    status_t LSPCAudioReader::load_index(LSPCFile *lspc, uint32_t chunk_id)
+    {
+        // Read index header
+        LSPCChunkReader *rd = lspc->read_chunk(nIndexId, LSPC_CHUNK_AUDIO_INDEX);
+        if (rd == NULL)
+            return STATUS_NOT_FOUND;
+
+        lspc_chunk_audio_index_header_t hdr;
+        ssize_t n           = rd->read_header(&hdr, sizeof(lspc_chunk_audio_index_header_t));
+        status_t res        = (n < 0) ? status_t(-n) : STATUS_OK;
+        if ((res == STATUS_OK) && ((hdr.common.version < 1) || (BE_TO_CPU(hdr.chunk_id) != chunk_id)))
+            res                 = STATUS_CORRUPTED_FILE;
+
+        // Read entries until the end of chunk
+        size_t cap          = 0;
+        lspc_audio_index_entry_t *v = NULL;
+        nIndexItems         = 0;
+
+        while (res == STATUS_OK)
+        {
+            if (nIndexItems >= cap)
+            {
+                cap                += 0x400;
+                lspc_audio_index_entry_t *nv = reinterpret_cast<lspc_audio_index_entry_t *>(::realloc(v, cap * sizeof(lspc_audio_index_entry_t)));
+                if (nv == NULL)
+                {
+                    res                 = STATUS_NO_MEM;
+                    break;
+                }
+                v                   = nv;
+            }
+
+            lspc_audio_index_entry_t *e = &v[nIndexItems];
+            n                   = rd->read(e, sizeof(lspc_audio_index_entry_t));
+            if (n <= 0)
+                break;
+            else if (n != sizeof(lspc_audio_index_entry_t))
+            {
+                res                 = STATUS_CORRUPTED_FILE;
+                break;
+            }
+
+            e->frame            = BE_TO_CPU(e->frame);
+            e->offset           = BE_TO_CPU(e->offset);
+
+            // Entries should be ordered by frame number
+            if ((nIndexItems > 0) && (e->frame <= v[nIndexItems-1].frame))
+            {
+                res                 = STATUS_CORRUPTED_FILE;
+                break;
+            }
+            ++nIndexItems;
+        }
+
+        rd->close();
+        delete rd;
+
+        if ((res != STATUS_OK) || (nIndexItems <= 0))
+        {
+            if (v != NULL)
+                ::free(v);
+            nIndexItems         = 0;
+            return res;
+        }
+
+        vIndex              = v;
+        return STATUS_OK;
+    }
+
+    const lspc_audio_index_entry_t *LSPCAudioReader::find_block(wsize_t frame) const
+    {
+        // Find the last block that starts at the specified frame or before it
+        ssize_t first = 0, last = nIndexItems - 1;
+        if ((vIndex == NULL) || (vIndex[0].frame > frame))
+            return NULL;
+
+        while (first < last)
+        {
+            ssize_t mid = (first + last + 1) >> 1;
+            if (vIndex[mid].frame <= frame)
+                first       = mid;
+            else
+                last        = mid - 1;
+        }
+
+        return &vIndex[first];
+    }
+
     status_t LSPCAudioReader::apply_params(const lspc_audio_parameters_t *p)
     {
         if (p->channels <= 0)
             return STATUS_BAD_FORMAT;
         if (p->sample_rate == 0)
             return STATUS_BAD_FORMAT;
-        if (p->codec != LSPC_CODEC_PCM)
+        if ((p->codec != LSPC_CODEC_PCM) && (p->codec != LSPC_CODEC_LOSSLESS))
             return STATUS_UNSUPPORTED_FORMAT;
 
         // Check sample format support
@@ -342,12 +418,19 @@ namespace lsp
                 return STATUS_UNSUPPORTED_FORMAT;
         }
 
+        // Lossless codec supports integer samples up to 24 bits and floating-point samples
+        bool lossless           = p->codec == LSPC_CODEC_LOSSLESS;
+        bool int_sample         = (df != decode_f32) && (df != decode_f64);
+        if ((lossless) && (int_sample) && (sb > 3))
+            return STATUS_UNSUPPORTED_FORMAT;
+
         // Estimate number of bytes to read
         size_t fz               = sb * p->channels;
         size_t bytes_left       = fz * p->frames;
 
-        // Allocate buffers
-        sBuf.vData      = new uint8_t[BUFFER_SIZE];
+        // Allocate buffers, the buffer holds the whole compressed block for lossless codec
+        size_t buf_size         = (lossless) ? lossless_block_size(p->channels, LSPC_LOSSLESS_BLOCK_FRAMES) : BUFFER_SIZE;
+        sBuf.vData      = new uint8_t[buf_size];
         if (sBuf.vData == NULL)
             return STATUS_NO_MEM;
 
@@ -359,6 +442,24 @@ namespace lsp
             return STATUS_NO_MEM;
         }
 
+        if (lossless)
+        {
+            // Floating-point samples require additional space for the decoder
+            size_t count    = (int_sample) ? p->channels : p->channels + 1;
+            sBlock.vSamples = new int32_t[count * LSPC_LOSSLESS_BLOCK_FRAMES];
+            if (sBlock.vSamples == NULL)
+            {
+                delete [] pFBuffer;
+                pFBuffer    = NULL;
+                delete [] sBuf.vData;
+                sBuf.vData  = NULL;
+                return STATUS_NO_MEM;
+            }
+            sBlock.fRange   = (!int_sample) ? 0.0f : (sb == 1) ? 0x7f : (sb == 2) ? 0x7fff : 0x7fffff;
+        }
+        sBlock.nFrames  = 0;
+        sBlock.nOff     = 0;
+
         if (le != arch_le)
             nFlags     |= F_REV_BYTES; // Set-up byte-reversal flag
 
@@ -390,6 +491,10 @@ namespace lsp
             return res;
         }
 
+        // The block index is optional, load it only if it can be found fast
+        if ((sParams.codec == LSPC_CODEC_LOSSLESS) && (nIndexId != 0) && (lspc->indexed()))
+            load_index(lspc, rd->unique_id());
+
         pFD         = lspc;
         pRD         = rd;
         nFlags     |= F_OPENED | F_CLOSE_READER | F_DROP_READER;
@@ -420,6 +525,10 @@ namespace lsp
             return res;
         }
 
+        // The block index is optional, load it only if it can be found fast
+        if ((sParams.codec == LSPC_CODEC_LOSSLESS) && (nIndexId != 0) && (lspc->indexed()))
+            load_index(lspc, rd->unique_id());
+
         pFD         = lspc;
         pRD         = rd;
         nFlags     |= F_OPENED | F_CLOSE_READER | F_DROP_READER;
@@ -588,10 +697,169 @@ namespace lsp
         return n_read;
     }
 
+    status_t LSPCAudioReader::read_block_header(lspc_audio_block_header_t *hdr)
+    {
+        uint8_t *dst    = reinterpret_cast<uint8_t *>(hdr);
+        size_t count    = 0;
+        while (count < sizeof(lspc_audio_block_header_t))
+        {
+            ssize_t n       = pRD->read(&dst[count], sizeof(lspc_audio_block_header_t) - count);
+            if (n < 0)
+                return status_t(-n);
+            else if (n == 0)
+                return (count > 0) ? STATUS_CORRUPTED_FILE : STATUS_EOF;
+            count          += n;
+        }
+
+        hdr->size       = BE_TO_CPU(hdr->size);
+        hdr->frames     = BE_TO_CPU(hdr->frames);
+        if ((hdr->frames <= 0) || (hdr->frames > LSPC_LOSSLESS_BLOCK_FRAMES))
+            return STATUS_CORRUPTED_FILE;
+        if (hdr->size > lossless_block_size(sParams.channels, hdr->frames))
+            return STATUS_CORRUPTED_FILE;
+
+        return STATUS_OK;
+    }
+
+    status_t LSPCAudioReader::read_block(const lspc_audio_block_header_t *hdr)
+    {
+        // Read compressed data
+        size_t count    = 0;
+        while (count < hdr->size)
+        {
+            ssize_t n       = pRD->read(&sBuf.vData[count], hdr->size - count);
+            if (n < 0)
+                return status_t(-n);
+            else if (n == 0)
+                return STATUS_CORRUPTED_FILE;
+            count          += n;
+        }
+
+        // Decode block
+        size_t nc       = sParams.channels;
+        int32_t **vs    = reinterpret_cast<int32_t **>(alloca(nc * sizeof(int32_t *)));
+        for (size_t i=0; i<nc; ++i)
+            vs[i]           = &sBlock.vSamples[i * LSPC_LOSSLESS_BLOCK_FRAMES];
+
+        status_t res    = (sBlock.fRange > 0.0f) ?
+            lossless_decode_block(vs, sBuf.vData, hdr->size, nc, hdr->frames, nBPS * 8) :
+            lossless_decode_float_block(reinterpret_cast<float **>(vs), sBuf.vData, hdr->size, nc, hdr->frames,
+                &sBlock.vSamples[nc * LSPC_LOSSLESS_BLOCK_FRAMES]);
+        if (res != STATUS_OK)
+            return res;
+
+        sBlock.nFrames  = hdr->frames;
+        sBlock.nOff     = 0;
+        return STATUS_OK;
+    }
+
+    ssize_t LSPCAudioReader::read_lossless_frames(float *data, size_t frames)
+    {
+        size_t nc       = sParams.channels;
+        size_t n_read   = 0;
+        float k         = sBlock.fRange;
+
+        while (n_read < frames)
+        {
+            // Decode next block if current one is over
+            if (sBlock.nOff >= sBlock.nFrames)
+            {
+                lspc_audio_block_header_t hdr;
+                status_t st     = read_block_header(&hdr);
+                if (st == STATUS_OK)
+                    st              = read_block(&hdr);
+                if (st != STATUS_OK)
+                    return (n_read > 0) ? n_read : -st;
+            }
+
+            // Interleave samples
+            size_t avail    = lsp_min(sBlock.nFrames - sBlock.nOff, frames - n_read);
+            for (size_t i=0; i<nc; ++i)
+            {
+                const int32_t *src  = &sBlock.vSamples[i * LSPC_LOSSLESS_BLOCK_FRAMES + sBlock.nOff];
+                float *dst          = &data[i];
+                if (k > 0.0f)
+                {
+                    for (size_t j=0; j<avail; ++j, dst += nc)
+                        *dst                = float(src[j]) / k;
+                }
+                else
+                {
+                    const float *fsrc   = reinterpret_cast<const float *>(src);
+                    for (size_t j=0; j<avail; ++j, dst += nc)
+                        *dst                = fsrc[j];
+                }
+            }
+
+            n_read         += avail;
+            nFramePos      += avail;
+            sBlock.nOff    += avail;
+            data           += avail * nc;
+        }
+
+        return n_read;
+    }
+
+    ssize_t LSPCAudioReader::skip_lossless_frames(size_t frames)
+    {
+        size_t n_skip   = 0;
+
+        // Jump to the indexed block that contains the target frame if it is beyond current block
+        const lspc_audio_index_entry_t *e = find_block(nFramePos + frames);
+        if ((e != NULL) && (e->frame > nFramePos + (sBlock.nFrames - sBlock.nOff)))
+        {
+            status_t st     = pRD->seek_fragment(e->offset);
+            if (st != STATUS_OK)
+                return -st;
+
+            n_skip          = e->frame - nFramePos;
+            nFramePos       = e->frame;
+            sBlock.nFrames  = 0;
+            sBlock.nOff     = 0;
+        }
+
+        while (n_skip < frames)
+        {
+            if (sBlock.nOff >= sBlock.nFrames)
+            {
+                lspc_audio_block_header_t hdr;
+                status_t st     = read_block_header(&hdr);
+                if (st != STATUS_OK)
+                    return (n_skip > 0) ? n_skip : -st;
+
+                // Skip the whole block without decoding
+                if ((frames - n_skip) >= hdr.frames)
+                {
+                    ssize_t n       = pRD->skip(hdr.size);
+                    if (n < 0)
+                        return (n_skip > 0) ? n_skip : n;
+                    else if (size_t(n) != hdr.size)
+                        return (n_skip > 0) ? n_skip : -STATUS_CORRUPTED_FILE;
+                    n_skip         += hdr.frames;
+                    nFramePos      += hdr.frames;
+                    continue;
+                }
+
+                st              = read_block(&hdr);
+                if (st != STATUS_OK)
+                    return (n_skip > 0) ? n_skip : -st;
+            }
+
+            size_t avail    = lsp_min(sBlock.nFrames - sBlock.nOff, frames - n_skip);
+            n_skip         += avail;
+            nFramePos      += avail;
+            sBlock.nOff    += avail;
+        }
+
+        return n_skip;
+    }
+
     ssize_t LSPCAudioReader::read_frames(float *data, size_t frames)
     {
         if (!(nFlags & F_OPENED))
             return STATUS_CLOSED;
+        if (sParams.codec == LSPC_CODEC_LOSSLESS)
+            return read_lossless_frames(data, frames);
 
         size_t n_read   = 0;
         while (n_read < frames)
@@ -653,6 +921,8 @@ namespace lsp
     {
         if (!(nFlags & F_OPENED))
             return STATUS_CLOSED;
+        if (sParams.codec == LSPC_CODEC_LOSSLESS)
+            return skip_lossless_frames(frames);
 
         size_t n_skip   = 0;
         while (n_skip < frames)
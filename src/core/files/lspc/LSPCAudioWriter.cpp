@@ -8,6 +8,7 @@
 #include <dsp/dsp.h>
 #include <dsp/endian.h>
 #include <core/files/lspc/LSPCAudioWriter.h>
+#include <core/files/lspc/lossless.h>
 #include <stdlib.h>
 
 #define BUFFER_FRAMES   0x400
@@ -37,9 +38,7 @@ namespace lsp
 
     void LSPCAudioWriter::encode_s16(void *vp, const float *src, size_t ns)
     {
-        int16_t *p = reinterpret_cast<int16_t *>(vp);
-        while (ns--)
-            *(p++)  = int16_t((*src++) * 0x7fff);
+        dsp::pcm_f32_to_s16(reinterpret_cast<int16_t *>(vp), src, ns);
     }
 
     void LSPCAudioWriter::encode_u24le(void *vp, const float *src, size_t ns)
@@ -48,8 +47,9 @@ namespace lsp
         while (ns--)
         {
             uint32_t s = int32_t(*(src++) * 0x7fffff) + 0x800000;
-            __IF_LE(p[0] = uint8_t(s); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s >> 16));
-            __IF_BE(p[0] = uint8_t(s >> 16); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s));
+            p[0]    = uint8_t(s);
+            p[1]    = uint8_t(s >> 8);
+            p[2]    = uint8_t(s >> 16);
             p += 3;
         }
     }
@@ -60,34 +60,21 @@ namespace lsp
         while (ns--)
         {
             uint32_t s = int32_t(*(src++) * 0x7fffff) + 0x800000;
-            __IF_BE(p[0] = uint8_t(s); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s >> 16));
-            __IF_LE(p[0] = uint8_t(s >> 16); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s));
+            p[0]    = uint8_t(s >> 16);
+            p[1]    = uint8_t(s >> 8);
+            p[2]    = uint8_t(s);
             p += 3;
         }
     }
 
     void LSPCAudioWriter::encode_s24le(void *vp, const float *src, size_t ns)
     {
-        uint8_t *p = reinterpret_cast<uint8_t *>(vp);
-        while (ns--)
-        {
-            int32_t s   = int32_t(*(src++) * 0x7fffff);
-            __IF_LE(p[0] = uint8_t(s); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s >> 16));
-            __IF_BE(p[0] = uint8_t(s >> 16); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s));
-            p += 3;
-        }
+        dsp::pcm_f32_to_s24le(reinterpret_cast<uint8_t *>(vp), src, ns);
     }
 
     void LSPCAudioWriter::encode_s24be(void *vp, const float *src, size_t ns)
     {
-        uint8_t *p = reinterpret_cast<uint8_t *>(vp);
-        while (ns--)
-        {
-            int32_t s   = int32_t(*(src++) * 0x7fffff);
-            __IF_BE(p[0] = uint8_t(s); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s >> 16));
-            __IF_LE(p[0] = uint8_t(s >> 16); p[1] = uint8_t(s >> 8); p[2] = uint8_t(s));
-            p += 3;
-        }
+        dsp::pcm_f32_to_s24be(reinterpret_cast<uint8_t *>(vp), src, ns);
     }
 
     void LSPCAudioWriter::encode_u32(void *vp, const float *src, size_t ns)
@@ -102,9 +89,7 @@ namespace lsp
 
     void LSPCAudioWriter::encode_s32(void *vp, const float *src, size_t ns)
     {
-        int32_t *p = reinterpret_cast<int32_t *>(vp);
-        while (ns--)
-            *(p++)  = double(*(src++)) * 0x7fffffff;
+        dsp::pcm_f32_to_s32(reinterpret_cast<int32_t *>(vp), src, ns);
     }
 
     void LSPCAudioWriter::encode_f32(void *vp, const float *src, size_t ns)
@@ -115,9 +100,7 @@ namespace lsp
 
     void LSPCAudioWriter::encode_f64(void *vp, const float *src, size_t ns)
     {
-        double *p = reinterpret_cast<double *>(vp);
-        while (ns--)
-            *(p++)  = *(src++);
+        dsp::pcm_f32_to_f64(reinterpret_cast<double *>(vp), src, ns);
     }
 
     LSPCAudioWriter::LSPCAudioWriter()
@@ -136,6 +119,17 @@ namespace lsp
         pEncode                 = NULL;
         pBuffer                 = NULL;
         pFBuffer                = NULL;
+        bDither                 = false;
+
+        sBlock.vSamples         = NULL;
+        sBlock.nFrames          = 0;
+        sBlock.vData            = NULL;
+        sBlock.vTmp             = NULL;
+        sBlock.fRange           = 0.0f;
+        pIndex                  = NULL;
+        nBlockFrame             = 0;
+
+        sDither.init();
     }
     
     LSPCAudioWriter::~LSPCAudioWriter()
@@ -160,6 +154,16 @@ namespace lsp
                 res     = xr;
         }
 
+        if (pIndex != NULL)
+        {
+            status_t xr = pIndex->close();
+            delete pIndex;
+            pIndex      = NULL;
+
+            if (res == STATUS_OK)
+                res     = xr;
+        }
+
         if (pFD != NULL)
         {
             if (nFlags & F_CLOSE_FILE)
@@ -186,6 +190,26 @@ namespace lsp
             pBuffer = NULL;
         }
 
+        if (sBlock.vSamples != NULL)
+        {
+            delete [] sBlock.vSamples;
+            sBlock.vSamples = NULL;
+        }
+
+        if (sBlock.vData != NULL)
+        {
+            delete [] sBlock.vData;
+            sBlock.vData    = NULL;
+        }
+
+        if (sBlock.vTmp != NULL)
+        {
+            delete [] sBlock.vTmp;
+            sBlock.vTmp     = NULL;
+        }
+
+        sBlock.nFrames          = 0;
+        nBlockFrame             = 0;
         nFlags                  = 0;
         nBPS                    = 0;
         nFrameChannels          = 0;
@@ -199,7 +223,11 @@ namespace lsp
         // Check open status first
         if (!(nFlags & F_OPENED))
             return STATUS_CLOSED;
-        return free_resources();
+
+        // Flush pending block of lossless codec
+        status_t res = (sParams.codec == LSPC_CODEC_LOSSLESS) ? flush_block() : STATUS_OK;
+        status_t xr  = free_resources();
+        return (res == STATUS_OK) ? xr : res;
     }
 
     status_t LSPCAudioWriter::parse_parameters(const lspc_audio_parameters_t *p)
@@ -210,7 +238,7 @@ namespace lsp
             return STATUS_BAD_FORMAT;
         else if (p->sample_rate == 0)
             return STATUS_BAD_FORMAT;
-        else if (p->codec != LSPC_CODEC_PCM)
+        else if ((p->codec != LSPC_CODEC_PCM) && (p->codec != LSPC_CODEC_LOSSLESS))
             return STATUS_BAD_FORMAT;
 
         size_t sb           = 0;
@@ -304,6 +332,10 @@ namespace lsp
                 return STATUS_UNSUPPORTED_FORMAT;
         }
 
+        // Lossless codec supports integer samples up to 24 bits and floating-point samples
+        if ((p->codec == LSPC_CODEC_LOSSLESS) && (int_sample) && (sb > 3))
+            return STATUS_UNSUPPORTED_FORMAT;
+
         // Estimate number of bytes to read
         size_t fz               = sb * p->channels;
 
@@ -315,15 +347,30 @@ namespace lsp
         pBuffer         = new float[p->channels * BUFFER_FRAMES];
         if (pBuffer == NULL)
         {
-            delete [] pFBuffer;
-            pFBuffer    = NULL;
+            free_resources();
             return STATUS_NO_MEM;
         }
 
+        if (p->codec == LSPC_CODEC_LOSSLESS)
+        {
+            sBlock.vSamples = new int32_t[p->channels * LSPC_LOSSLESS_BLOCK_FRAMES];
+            sBlock.vData    = new uint8_t[sizeof(lspc_audio_block_header_t) + lossless_block_size(p->channels, LSPC_LOSSLESS_BLOCK_FRAMES)];
+            sBlock.vTmp     = new uint8_t[lossless_tmp_size(LSPC_LOSSLESS_BLOCK_FRAMES)];
+            if ((sBlock.vSamples == NULL) || (sBlock.vData == NULL) || (sBlock.vTmp == NULL))
+            {
+                free_resources();
+                return STATUS_NO_MEM;
+            }
+            sBlock.nFrames  = 0;
+            nBlockFrame     = 0;
+            sBlock.fRange   = (!int_sample) ? 0.0f : (sb == 1) ? 0x7f : (sb == 2) ? 0x7fff : 0x7fffff;
+        }
+
         if (le != arch_le)
             nFlags     |= F_REV_BYTES; // Set-up byte-reversal flag
         if (int_sample)
             nFlags     |= F_INTEGER_SAMPLE;
+        sDither.set_bits((int_sample) ? sb * 8 : 0);
 
         sParams         = *p;
         nBPS            = sb;
@@ -346,6 +393,7 @@ namespace lsp
         hdr.codec           = sParams.codec;
         hdr.frames          = sParams.frames;
         hdr.offset          = 0;
+        hdr.index_id        = (pIndex != NULL) ? pIndex->unique_id() : 0;
 
         hdr.channels        = CPU_TO_BE(hdr.channels);
         hdr.sample_format   = CPU_TO_BE(hdr.sample_format);
@@ -353,10 +401,79 @@ namespace lsp
         hdr.codec           = CPU_TO_BE(hdr.codec);
         hdr.frames          = CPU_TO_BE(hdr.frames);
         hdr.offset          = CPU_TO_BE(hdr.offset);
+        hdr.index_id        = CPU_TO_BE(hdr.index_id);
 
         return wr->write_header(&hdr);
     }
 
+    status_t LSPCAudioWriter::create_index(LSPCFile *lspc)
+    {
+        // Only blocks of lossless codec are indexed
+        if (sParams.codec != LSPC_CODEC_LOSSLESS)
+            return STATUS_OK;
+
+        pIndex              = lspc->write_chunk(LSPC_CHUNK_AUDIO_INDEX);
+        return (pIndex != NULL) ? STATUS_OK : STATUS_NO_MEM;
+    }
+
+    status_t LSPCAudioWriter::write_index_header(LSPCChunkWriter *wr)
+    {
+        if (pIndex == NULL)
+            return STATUS_OK;
+
+        lspc_chunk_audio_index_header_t hdr;
+
+        ::memset(&hdr, 0, sizeof(hdr));
+        hdr.common.size     = sizeof(lspc_chunk_audio_index_header_t);
+        hdr.common.version  = 1;
+        hdr.chunk_id        = CPU_TO_BE(uint32_t(wr->unique_id()));
+
+        return pIndex->write_header(&hdr);
+    }
+
+    status_t LSPCAudioWriter::flush_block()
+    {
+        if (sBlock.nFrames <= 0)
+            return STATUS_OK;
+
+        int32_t **vs = reinterpret_cast<int32_t **>(alloca(nFrameChannels * sizeof(int32_t *)));
+        for (size_t i=0; i<nFrameChannels; ++i)
+            vs[i]       = &sBlock.vSamples[i * LSPC_LOSSLESS_BLOCK_FRAMES];
+
+        size_t size;
+        if (nFlags & F_INTEGER_SAMPLE)
+        {
+            size_t bits = (sBlock.fRange > 0x7fff) ? 24 : (sBlock.fRange > 0x7f) ? 16 : 8;
+            size        = lossless_encode_block(&sBlock.vData[sizeof(lspc_audio_block_header_t)], vs,
+                            nFrameChannels, sBlock.nFrames, bits, sBlock.vTmp);
+        }
+        else
+            size        = lossless_encode_float_block(&sBlock.vData[sizeof(lspc_audio_block_header_t)],
+                            reinterpret_cast<float **>(vs), nFrameChannels, sBlock.nFrames, sBlock.vTmp);
+
+        lspc_audio_block_header_t *hdr = reinterpret_cast<lspc_audio_block_header_t *>(sBlock.vData);
+        hdr->size           = CPU_TO_BE(uint32_t(size));
+        hdr->frames         = CPU_TO_BE(uint32_t(sBlock.nFrames));
+        size               += sizeof(lspc_audio_block_header_t);
+
+        lspc_audio_index_entry_t entry;
+        entry.frame         = CPU_TO_BE(uint64_t(nBlockFrame));
+        nBlockFrame        += sBlock.nFrames;
+        sBlock.nFrames      = 0;
+
+        // Write indexed block as a separate fragment of the chunk
+        if (pIndex == NULL)
+            return pWD->write(sBlock.vData, size);
+
+        wsize_t offset      = 0;
+        status_t res        = pWD->append_fragment(sBlock.vData, size, &offset);
+        if (res != STATUS_OK)
+            return res;
+        entry.offset        = CPU_TO_BE(uint64_t(offset));
+
+        return pIndex->write(&entry, sizeof(entry));
+    }
+
     status_t LSPCAudioWriter::create(const char *path, const lspc_audio_parameters_t *params)
     {
         LSPString tmp;
@@ -408,7 +525,11 @@ namespace lsp
         if (wr == NULL)
             return STATUS_NO_MEM;
 
-        res = write_header(wr);
+        res = create_index(lspc);
+        if (res == STATUS_OK)
+            res = write_header(wr);
+        if (res == STATUS_OK)
+            res = write_index_header(wr);
         if (res != STATUS_OK)
         {
             free_resources();
@@ -461,7 +582,11 @@ namespace lsp
         if (wr == NULL)
             return STATUS_NO_MEM;
 
-        res = write_header(wr);
+        res = create_index(lspc);
+        if (res == STATUS_OK)
+            res = write_header(wr);
+        if (res == STATUS_OK)
+            res = write_index_header(wr);
         if (res != STATUS_OK)
         {
             free_resources();
@@ -517,6 +642,7 @@ namespace lsp
             return res;
         }
 
+        pWD         = wr;
         nFlags     |= F_OPENED;
         if (auto_close)
             nFlags     |= F_CLOSE_WRITER;
@@ -533,6 +659,7 @@ namespace lsp
         if (res != STATUS_OK)
             return res;
 
+        pWD         = wr;
         nFlags     |= F_OPENED;
         if (auto_close)
             nFlags     |= F_CLOSE_WRITER;
@@ -586,11 +713,68 @@ namespace lsp
             if (to_write > BUFFER_FRAMES)
                 to_write = BUFFER_FRAMES;
 
+            // Lossless codec accumulates samples into block
+            if (sParams.codec == LSPC_CODEC_LOSSLESS)
+                to_write    = lsp_min(to_write, size_t(LSPC_LOSSLESS_BLOCK_FRAMES - sBlock.nFrames));
+
             // Copy frames to buffer
             size_t floats = to_write * nFrameChannels;
-            if (nFlags & F_INTEGER_SAMPLE)
+            if (sParams.codec == LSPC_CODEC_LOSSLESS)
+            {
+                if (nFlags & F_INTEGER_SAMPLE)
+                {
+                    if (bDither)
+                    {
+                        sDither.process(pBuffer, data, floats);
+                        dsp::limit_saturate1(pBuffer, floats);
+                    }
+                    else
+                        dsp::limit_saturate2(pBuffer, data, floats);
+
+                    // Convert samples to integers and de-interleave them
+                    const float *p  = pBuffer;
+                    float k         = sBlock.fRange;
+                    for (size_t i=0; i<to_write; ++i)
+                    {
+                        int32_t *dst    = &sBlock.vSamples[sBlock.nFrames + i];
+                        for (size_t j=0; j<nFrameChannels; ++j, dst += LSPC_LOSSLESS_BLOCK_FRAMES)
+                            *dst            = int32_t(*(p++) * k);
+                    }
+                }
+                else
+                {
+                    // De-interleave floating-point samples as is
+                    const float *p  = data;
+                    float *vf       = reinterpret_cast<float *>(sBlock.vSamples);
+                    for (size_t i=0; i<to_write; ++i)
+                    {
+                        float *dst      = &vf[sBlock.nFrames + i];
+                        for (size_t j=0; j<nFrameChannels; ++j, dst += LSPC_LOSSLESS_BLOCK_FRAMES)
+                            *dst            = *(p++);
+                    }
+                }
+
+                sBlock.nFrames += to_write;
+                if (sBlock.nFrames >= LSPC_LOSSLESS_BLOCK_FRAMES)
+                {
+                    status_t res = flush_block();
+                    if (res != STATUS_OK)
+                        return res;
+                }
+
+                data       += floats;
+                n_written  += to_write;
+                continue;
+            }
+            else if (nFlags & F_INTEGER_SAMPLE)
             {
-                dsp::limit_saturate2(pBuffer, data, floats);
+                if (bDither)
+                {
+                    sDither.process(pBuffer, data, floats);
+                    dsp::limit_saturate1(pBuffer, floats);
+                }
+                else
+                    dsp::limit_saturate2(pBuffer, data, floats);
                 pEncode(pFBuffer, pBuffer, floats);
             }
             else
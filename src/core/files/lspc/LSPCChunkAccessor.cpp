@@ -40,6 +40,15 @@ namespace lsp
             close(fd);
             fd      = -1;
 #endif /* PLATFORM_WINDOWS */
+
+            if (toc != NULL)
+            {
+                free(toc);
+                toc     = NULL;
+            }
+            toc_items   = 0;
+            toc_cap     = 0;
+            toc_valid   = false;
         }
 
         return STATUS_OK;
@@ -98,6 +107,69 @@ namespace lsp
         return STATUS_OK;
     }
 
+    status_t LSPCResource::write(wsize_t pos, const void *buf, size_t count)
+    {
+        if (FD_INVALID(fd))
+            return STATUS_CLOSED;
+
+        // Overwrite data at the specified position
+        const uint8_t *bptr = static_cast<const uint8_t *>(buf);
+
+#if defined(PLATFORM_WINDOWS)
+        LARGE_INTEGER set_pos;
+        LARGE_INTEGER seek_pos;
+
+        set_pos.QuadPart    = pos;
+        if (!SetFilePointerEx(fd, set_pos, &seek_pos, FILE_BEGIN))
+            return STATUS_IO_ERROR;
+        else if (seek_pos.QuadPart != set_pos.QuadPart)
+            return STATUS_IO_ERROR;
+#endif /* PLATFORM_WINDOWS */
+
+        while (count > 0)
+        {
+#if defined(PLATFORM_WINDOWS)
+            DWORD written = 0;
+            if (!WriteFile(fd, bptr, count, &written, NULL))
+            {
+                DWORD error = GetLastError();
+                if (error != ERROR_IO_PENDING)
+                {
+                    lsp_trace("Error write: GetLastError()=%d", int(error));
+                    return STATUS_IO_ERROR;
+                }
+                written = 0;
+            }
+#else
+            errno       = 0;
+
+            ssize_t written  = pwrite(fd, bptr, count, pos);
+            if (written < ssize_t(count))
+            {
+                int error = errno;
+                if (error != 0)
+                {
+                    lsp_trace("Error write: errno=%d", error);
+                    return STATUS_IO_ERROR;
+                }
+            }
+#endif /* PLATFORM_WINDOWS */
+
+            bptr       += written;
+            pos        += written;
+            count      -= written;
+        }
+
+#if defined(PLATFORM_WINDOWS)
+        // Restore the position for appending data
+        set_pos.QuadPart    = length;
+        if (!SetFilePointerEx(fd, set_pos, &seek_pos, FILE_BEGIN))
+            return STATUS_IO_ERROR;
+#endif /* PLATFORM_WINDOWS */
+
+        return STATUS_OK;
+    }
+
     ssize_t LSPCResource::read(wsize_t pos, void *buf, size_t count)
     {
         if (FD_INVALID(fd))
@@ -143,6 +215,69 @@ namespace lsp
         return total;
     }
 
+    void LSPCResource::index(uint32_t uid, uint32_t magic, wsize_t offset)
+    {
+        if (!toc_valid)
+            return;
+
+        // Grow the table of contents
+        if (toc_items >= toc_cap)
+        {
+            size_t cap              = (toc_cap > 0) ? toc_cap << 1 : 0x20;
+            lspc_toc_entry_t *ntoc  = static_cast<lspc_toc_entry_t *>(realloc(toc, cap * sizeof(lspc_toc_entry_t)));
+            if (ntoc == NULL)
+            {
+                // The table of contents will not be written
+                toc_valid       = false;
+                return;
+            }
+            toc             = ntoc;
+            toc_cap         = cap;
+        }
+
+        lspc_toc_entry_t *e     = &toc[toc_items++];
+        e->uid          = uid;
+        e->magic        = magic;
+        e->offset       = offset;
+    }
+
+    static int cmp_toc_entries(const void *a, const void *b)
+    {
+        uint32_t ua = static_cast<const lspc_toc_entry_t *>(a)->uid;
+        uint32_t ub = static_cast<const lspc_toc_entry_t *>(b)->uid;
+        return (ua < ub) ? -1 : (ua > ub) ? 1 : 0;
+    }
+
+    void LSPCResource::sort_toc()
+    {
+        if (toc_items > 1)
+            qsort(toc, toc_items, sizeof(lspc_toc_entry_t), cmp_toc_entries);
+    }
+
+    const lspc_toc_entry_t *LSPCResource::lookup(uint32_t uid) const
+    {
+        // Chunk identifiers are allocated sequentially, so usually
+        // the entry is located at the position defined by the identifier
+        if ((uid > 0) && (uid <= toc_items) && (toc[uid - 1].uid == uid))
+            return &toc[uid - 1];
+
+        // Perform binary search
+        ssize_t first = 0, last = ssize_t(toc_items) - 1;
+        while (first <= last)
+        {
+            ssize_t mid = (first + last) >> 1;
+            uint32_t v  = toc[mid].uid;
+            if (v == uid)
+                return &toc[mid];
+            else if (v < uid)
+                first       = mid + 1;
+            else
+                last        = mid - 1;
+        }
+
+        return NULL;
+    }
+
     LSPCChunkAccessor::LSPCChunkAccessor(LSPCResource *fd, uint32_t magic)
     {
         pFile           = fd;
@@ -253,4 +253,89 @@ namespace lsp
         return total;
     }
 
+    ssize_t LSPCChunkReader::skip_fragment(wsize_t *offset)
+    {
+        if (pFile == NULL)
+            return -set_error(STATUS_CLOSED);
+        else if (offset == NULL)
+            return -set_error(STATUS_BAD_ARGUMENTS);
+
+        lspc_chunk_header_t hdr;
+
+        while (true)
+        {
+            // Buffered data and unread data belong to the same fragment
+            size_t buffered = nBufTail - nBufPos;
+            if ((buffered > 0) || (nUnread > 0))
+            {
+                ssize_t total   = buffered + nUnread;
+                *offset         = nFileOff - buffered;
+                nBufPos         = nBufTail;
+                nFileOff       += nUnread;
+                nUnread         = 0;
+                return total;
+            }
+
+            // There is no chunk after current
+            if (bLast)
+            {
+                set_error(STATUS_EOF);
+                return 0;
+            }
+
+            // Read chunk header
+            ssize_t n   = pFile->read(nFileOff, &hdr, sizeof(lspc_chunk_header_t));
+            if (n < ssize_t(sizeof(lspc_chunk_header_t)))
+            {
+                set_error(STATUS_EOF);
+                return 0;
+            }
+            nFileOff   += sizeof(lspc_chunk_header_t);
+
+            hdr.magic       = BE_TO_CPU(hdr.magic);
+            hdr.flags       = BE_TO_CPU(hdr.flags);
+            hdr.size        = BE_TO_CPU(hdr.size);
+            hdr.uid         = BE_TO_CPU(hdr.uid);
+
+            // Validate chunk header
+            if ((hdr.magic == nMagic) && (hdr.uid == nUID)) // We've found our chunk, remember unread bytes count
+            {
+                bLast           = hdr.flags & LSPC_CHUNK_FLAG_LAST;
+                nUnread         = hdr.size;
+            }
+            else // Skip this chunk
+                nFileOff       += hdr.size;
+        }
+    }
+
+    status_t LSPCChunkReader::seek_fragment(wsize_t offset)
+    {
+        if (pFile == NULL)
+            return set_error(STATUS_CLOSED);
+
+        // Read chunk header
+        lspc_chunk_header_t hdr;
+        ssize_t n   = pFile->read(offset, &hdr, sizeof(lspc_chunk_header_t));
+        if (n < ssize_t(sizeof(lspc_chunk_header_t)))
+            return set_error(STATUS_CORRUPTED_FILE);
+
+        hdr.magic       = BE_TO_CPU(hdr.magic);
+        hdr.flags       = BE_TO_CPU(hdr.flags);
+        hdr.size        = BE_TO_CPU(hdr.size);
+        hdr.uid         = BE_TO_CPU(hdr.uid);
+
+        // The fragment should belong to our chunk
+        if ((hdr.magic != nMagic) || (hdr.uid != nUID))
+            return set_error(STATUS_CORRUPTED_FILE);
+
+        // Drop buffered data and start reading from the fragment
+        nBufPos         = 0;
+        nBufTail        = 0;
+        nFileOff        = offset + sizeof(lspc_chunk_header_t);
+        nUnread         = hdr.size;
+        bLast           = hdr.flags & LSPC_CHUNK_FLAG_LAST;
+
+        return set_error(STATUS_OK);
+    }
+
 } /* namespace lsp */
@@ -25,6 +25,35 @@ namespace lsp
     {
     }
 
+    status_t LSPCChunkWriter::write_fragment(const void *buf, size_t count, uint32_t flags)
+    {
+        // Register the first fragment of the chunk in the table of contents
+        if (nChunksOut <= 0)
+            pFile->index(nUID, nMagic, pFile->length);
+
+        lspc_chunk_header_t hdr;
+        hdr.magic       = nMagic;
+        hdr.size        = count;
+        hdr.flags       = flags;
+        hdr.uid         = nUID;
+
+        // Convert CPU -> BE
+        hdr.magic       = CPU_TO_BE(hdr.magic);
+        hdr.size        = CPU_TO_BE(hdr.size);
+        hdr.flags       = CPU_TO_BE(hdr.flags);
+        hdr.uid         = CPU_TO_BE(hdr.uid);
+
+        // Write buffer header and data to file
+        status_t res    = pFile->write(&hdr, sizeof(lspc_chunk_header_t));
+        if ((res == STATUS_OK) && (count > 0))
+            res             = pFile->write(buf, count);
+        if (set_error(res) != STATUS_OK)
+            return res;
+
+        nChunksOut      ++;
+        return STATUS_OK;
+    }
+
     status_t LSPCChunkWriter::do_flush(size_t flags)
     {
         if (pFile == NULL)
@@ -32,28 +61,13 @@ namespace lsp
 
         if ((nBufPos > 0) || ((flags & F_FORCE) && (nChunksOut <= 0)) || (flags & F_LAST))
         {
-            lspc_chunk_header_t hdr;
-            hdr.magic       = nMagic;
-            hdr.size        = nBufPos;
-            hdr.flags       = (flags & F_LAST) ? LSPC_CHUNK_FLAG_LAST : 0;
-            hdr.uid         = nUID;
-
-            // Convert CPU -> BE
-            hdr.magic       = CPU_TO_BE(hdr.magic);
-            hdr.size        = CPU_TO_BE(hdr.size);
-            hdr.flags       = CPU_TO_BE(hdr.flags);
-            hdr.uid         = CPU_TO_BE(hdr.uid);
-
             // Write buffer header and data to file
-            status_t res    = pFile->write(&hdr, sizeof(lspc_chunk_header_t));
-            if (res == STATUS_OK)
-                pFile->write(pBuffer, nBufPos);
-            if (set_error(res) != STATUS_OK)
+            status_t res    = write_fragment(pBuffer, nBufPos, (flags & F_LAST) ? LSPC_CHUNK_FLAG_LAST : 0);
+            if (res != STATUS_OK)
                 return res;
 
             // Flush the buffer
             nBufPos         = 0;
-            nChunksOut      ++;
         }
 
         return STATUS_OK;
@@ -64,7 +78,6 @@ namespace lsp
         if (pFile == NULL)
             return set_error(STATUS_CLOSED);
 
-        lspc_chunk_header_t hdr;
         const uint8_t *src = static_cast<const uint8_t *>(buf);
 
         while (count > 0)
@@ -85,59 +98,46 @@ namespace lsp
                 // Check buffer size
                 if (nBufPos >= nBufSize)
                 {
-                    hdr.magic       = nMagic;
-                    hdr.size        = nBufSize;
-                    hdr.flags       = 0;
-                    hdr.uid         = nUID;
-
-                    // Convert CPU -> BE
-                    hdr.magic       = CPU_TO_BE(hdr.magic);
-                    hdr.size        = CPU_TO_BE(hdr.size);
-                    hdr.flags       = CPU_TO_BE(hdr.flags);
-                    hdr.uid         = CPU_TO_BE(hdr.uid);
-
                     // Write buffer header and data to file
-                    status_t res    = pFile->write(&hdr, sizeof(lspc_chunk_header_t));
-                    if (res == STATUS_OK)
-                        res             = pFile->write(pBuffer, nBufSize);
-                    if (set_error(res) != STATUS_OK)
+                    status_t res    = write_fragment(pBuffer, nBufSize, 0);
+                    if (res != STATUS_OK)
                         return res;
 
-                    // Update position and counter
+                    // Update position
                     nBufPos         = 0;
-                    nChunksOut     ++;
                 }
             }
             else // Write directly avoiding buffer
             {
-                hdr.magic       = nMagic;
-                hdr.size        = can_write;
-                hdr.flags       = 0;
-                hdr.uid         = nUID;
-
-                // Convert CPU -> BE
-                hdr.magic       = CPU_TO_BE(hdr.magic);
-                hdr.size        = CPU_TO_BE(hdr.size);
-                hdr.flags       = CPU_TO_BE(hdr.flags);
-                hdr.uid         = CPU_TO_BE(hdr.uid);
-
                 // Write buffer header and data to file
-                status_t res    = pFile->write(&hdr, sizeof(lspc_chunk_header_t));
-                if (res == STATUS_OK)
-                    pFile->write(src, can_write);
-                if (set_error(res) != STATUS_OK)
+                status_t res    = write_fragment(src, can_write, 0);
+                if (res != STATUS_OK)
                     return res;
 
-                // Update position and counter
+                // Update position
                 count          -= can_write;
                 src            += can_write;
-                nChunksOut     ++;
             }
         }
 
         return set_error(STATUS_OK);
     }
 
+    status_t LSPCChunkWriter::append_fragment(const void *buf, size_t count, wsize_t *offset)
+    {
+        if (pFile == NULL)
+            return set_error(STATUS_CLOSED);
+
+        // Write buffered data first
+        status_t res    = do_flush(0);
+        if (res != STATUS_OK)
+            return res;
+
+        if (offset != NULL)
+            *offset         = pFile->length;
+        return write_fragment(buf, count, 0);
+    }
+
     status_t LSPCChunkWriter::write_header(const void *buf)
     {
         if (pFile == NULL)
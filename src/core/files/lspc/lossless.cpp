@@ -0,0 +1,759 @@
+/*
+ * lossless.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/bits.h>
+#include <math.h>
+#include <core/files/lspc/lossless.h>
+
+#define COEF_BITS           16
+#define COEF_PRECISION      (COEF_BITS - 1)
+#define ORDER_BITS          4
+#define SHIFT_BITS          5
+#define RICE_BITS           5
+#define RICE_MAX            30
+#define RESIDUAL_MAX        (int64_t(1) << 30)
+#define FIXED_ORDERS        5
+#define WORST_BITS          33
+#define ORDER_RAW           15      /* Order code of the channel stored without prediction */
+#define FLOAT_BITS          31      /* Bits per sample of the integer representation of floats */
+#define SCALE_BITS          5
+#define SCALE_MAX           31
+
+namespace lsp
+{
+    typedef struct predictor_t
+    {
+        size_t      order;                              // Predictor order
+        size_t      shift;                              // Shift of coefficients
+        int32_t     coef[LSPC_LOSSLESS_MAX_ORDER];      // Predictor coefficients
+    } predictor_t;
+
+    typedef struct bit_writer_t
+    {
+        uint8_t    *p;          // Current output position
+        uint64_t    acc;        // Bit accumulator
+        size_t      bits;       // Number of bits in accumulator
+    } bit_writer_t;
+
+    typedef struct bit_reader_t
+    {
+        const uint8_t  *p;      // Current input position
+        const uint8_t  *end;    // End of input
+        uint64_t        cache;  // Left-aligned bit cache
+        size_t          bits;   // Number of valid bits in cache
+    } bit_reader_t;
+
+    // Fixed polynomial predictors of orders 0 to 4
+    static const int32_t fixed_coefs[FIXED_ORDERS][4] =
+    {
+        { 0, 0, 0, 0 },
+        { 1, 0, 0, 0 },
+        { 2, -1, 0, 0 },
+        { 3, -3, 1, 0 },
+        { 4, -6, 4, -1 }
+    };
+
+    // LPC orders tried by the encoder
+    static const size_t lpc_orders[] = { 4, 8, LSPC_LOSSLESS_MAX_ORDER };
+
+    //-------------------------------------------------------------------------
+    // Bit stream
+    static inline void bw_put(bit_writer_t *w, uint32_t v, size_t n)
+    {
+        w->acc      = (w->acc << n) | (v & ((uint64_t(1) << n) - 1));
+        w->bits    += n;
+        while (w->bits >= 8)
+        {
+            w->bits    -= 8;
+            *(w->p++)   = uint8_t(w->acc >> w->bits);
+        }
+    }
+
+    static inline void bw_rice(bit_writer_t *w, uint32_t u, size_t k)
+    {
+        // Unary-coded quotient followed by k low bits
+        uint32_t q  = u >> k;
+        for ( ; q >= 32; q -= 32)
+            bw_put(w, 0, 32);
+        bw_put(w, 1, q + 1);
+        bw_put(w, u, k);
+    }
+
+    static inline void bw_flush(bit_writer_t *w)
+    {
+        if (w->bits > 0)
+            *(w->p++)   = uint8_t(w->acc << (8 - w->bits));
+        w->bits     = 0;
+    }
+
+    static inline void br_fill(bit_reader_t *r)
+    {
+        while ((r->bits <= 56) && (r->p < r->end))
+        {
+            r->cache   |= uint64_t(*(r->p++)) << (56 - r->bits);
+            r->bits    += 8;
+        }
+    }
+
+    static inline bool br_get(bit_reader_t *r, uint32_t *v, size_t n)
+    {
+        if (n == 0)
+        {
+            *v          = 0;
+            return true;
+        }
+        if (r->bits < n)
+        {
+            br_fill(r);
+            if (r->bits < n)
+                return false;
+        }
+
+        *v          = uint32_t(r->cache >> (64 - n));
+        r->cache  <<= n;
+        r->bits    -= n;
+        return true;
+    }
+
+    static inline bool br_get_signed(bit_reader_t *r, int32_t *v, size_t n)
+    {
+        uint32_t x;
+        if (!br_get(r, &x, n))
+            return false;
+        *v          = int32_t(x << (32 - n)) >> (32 - n); // Sign-extend value
+        return true;
+    }
+
+    static inline bool br_rice(bit_reader_t *r, uint32_t *u, size_t k)
+    {
+        // Count leading zeros of the unary-coded quotient
+        uint32_t q  = 0;
+        while (true)
+        {
+            if (r->bits == 0)
+            {
+                br_fill(r);
+                if (r->bits == 0)
+                    return false;
+            }
+            if (r->cache != 0)
+                break;
+            q          += r->bits;
+            r->bits     = 0;
+        }
+
+        size_t lz   = 63 - int_log2(r->cache);
+        q          += lz;
+        r->cache    = (r->cache << lz) << 1;
+        r->bits    -= lz + 1;
+
+        uint32_t lo;
+        if (!br_get(r, &lo, k))
+            return false;
+        *u          = (q << k) | lo;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Floating-point samples
+    static inline uint32_t float_to_bits(float v)
+    {
+        union { float f; uint32_t u; } x;
+        x.f         = v;
+        return x.u;
+    }
+
+    static inline float bits_to_float(uint32_t v)
+    {
+        union { float f; uint32_t u; } x;
+        x.u         = v;
+        return x.f;
+    }
+
+    static inline int32_t map_float(uint32_t v)
+    {
+        // Map sign and magnitude to two's complement, the order of values is kept
+        return (v & 0x80000000) ? -int32_t(v & 0x7fffffff) - 1 : int32_t(v);
+    }
+
+    static inline uint32_t unmap_float(int32_t v)
+    {
+        return (v < 0) ? uint32_t(-(v + 1)) | 0x80000000 : uint32_t(v);
+    }
+
+    /**
+     * Find the power of 2 that turns all samples into integers that fit into
+     * the range of residuals, it is found for samples converted from integers
+     * @return scale exponent or negative value if samples can not be scaled
+     */
+    static ssize_t float_scale(const float *s, size_t n)
+    {
+        ssize_t scale   = 0;
+        ssize_t top     = 0;
+
+        for (size_t i=0; i<n; ++i)
+        {
+            uint32_t v      = float_to_bits(s[i]);
+            uint32_t mag    = v & 0x7fffffff;
+            if (mag == 0)
+            {
+                if (v != 0) // -0.0 has no integer representation
+                    return -1;
+                continue;
+            }
+
+            // Decompose the value into odd mantissa and exponent
+            uint32_t exp    = mag >> 23;
+            if (exp >= 0xff) // Infinity or NaN
+                return -1;
+            uint32_t mant   = mag & 0x7fffff;
+            ssize_t e       = -149;
+            if (exp > 0)
+            {
+                mant           |= 0x800000;
+                e               = ssize_t(exp) - 150;
+            }
+            ssize_t tz      = int_log2(uint32_t(mant & (-mant)));
+            mant          >>= tz;
+            e              += tz;
+
+            scale           = lsp_max(scale, -e);
+            top             = lsp_max(top, e + int_log2(mant) + 1);
+            if (scale > SCALE_MAX)
+                return -1;
+        }
+
+        return ((top + scale) <= 30) ? scale : -1;
+    }
+
+    //-------------------------------------------------------------------------
+    // Encoder
+    static inline uint32_t zigzag(int32_t v)
+    {
+        return (uint32_t(v) << 1) ^ uint32_t(v >> 31);
+    }
+
+    static inline size_t rice_param(uint64_t sum, size_t n)
+    {
+        size_t k = 0;
+        while ((k < RICE_MAX) && ((uint64_t(n) << (k + 1)) <= sum))
+            ++k;
+        return k;
+    }
+
+    /**
+     * Compute residual of the predictor
+     * @return false if residual does not fit into the allowed range
+     */
+    static bool compute_residual(int32_t *r, const int32_t *s, size_t n, const predictor_t *p)
+    {
+        const size_t order  = p->order;
+        for (size_t i=order; i<n; ++i)
+        {
+            int64_t sum     = 0;
+            for (size_t j=0; j<order; ++j)
+                sum            += int64_t(p->coef[j]) * s[i - j - 1];
+            int64_t v       = int64_t(s[i]) - (sum >> p->shift);
+            if ((v >= RESIDUAL_MAX) || (v <= -RESIDUAL_MAX))
+                return false;
+            r[i]            = int32_t(v);
+        }
+        return true;
+    }
+
+    static size_t residual_bits(const int32_t *r, size_t n, size_t order)
+    {
+        size_t bits     = 0;
+        for (size_t i=order; i<n; )
+        {
+            size_t count    = lsp_min(n - i, size_t(LSPC_LOSSLESS_PARTITION));
+            uint64_t sum    = 0;
+            for (size_t j=0; j<count; ++j)
+                sum            += zigzag(r[i+j]);
+
+            size_t k        = rice_param(sum, count);
+            bits           += RICE_BITS + count * (k + 1) + size_t(sum >> k);
+            i              += count;
+        }
+        return bits;
+    }
+
+    static size_t predictor_bits(const predictor_t *p, size_t sbits)
+    {
+        size_t bits     = 1 + ORDER_BITS + p->order * (sbits + 1);
+        if (p->order > 0)
+            bits           += SHIFT_BITS + p->order * COEF_BITS;
+        return bits;
+    }
+
+    static void compute_lpc(double *lpc, const double *ac, size_t max_order)
+    {
+        // Levinson-Durbin recursion, lpc contains coefficients for all orders
+        double v[LSPC_LOSSLESS_MAX_ORDER];
+        double err      = ac[0];
+
+        for (size_t i=0; i<max_order; ++i)
+        {
+            double r        = -ac[i+1];
+            for (size_t j=0; j<i; ++j)
+                r              -= v[j] * ac[i-j];
+            r              /= err;
+
+            v[i]            = r;
+            size_t j        = 0;
+            for ( ; j < (i >> 1); ++j)
+            {
+                double tmp      = v[j];
+                v[j]           += r * v[i-1-j];
+                v[i-1-j]       += r * tmp;
+            }
+            if (i & 1)
+                v[j]           += v[j] * r;
+
+            err            *= 1.0 - r * r;
+            for (j=0; j<=i; ++j)
+                lpc[i * LSPC_LOSSLESS_MAX_ORDER + j] = -v[j];
+
+            if (err <= 0.0)
+            {
+                // Replicate last valid set of coefficients
+                for (size_t k=i+1; k<max_order; ++k)
+                    for (j=0; j<=k; ++j)
+                        lpc[k * LSPC_LOSSLESS_MAX_ORDER + j] = (j <= i) ? -v[j] : 0.0;
+                break;
+            }
+        }
+    }
+
+    static bool quantize_lpc(predictor_t *p, const double *lpc, size_t order)
+    {
+        double cmax     = 0.0;
+        for (size_t i=0; i<order; ++i)
+            cmax            = lsp_max(cmax, fabs(lpc[i]));
+        if (cmax <= 0.0)
+            return false;
+
+        int e;
+        frexp(cmax, &e);
+        ssize_t shift   = COEF_PRECISION - e;
+        if (shift < 0)
+            return false;
+        else if (shift >= (1 << SHIFT_BITS))
+            shift           = (1 << SHIFT_BITS) - 1;
+
+        // Quantize with error feedback
+        double k        = double(int64_t(1) << shift);
+        double err      = 0.0;
+        for (size_t i=0; i<order; ++i)
+        {
+            double v        = lpc[i] * k + err;
+            int32_t q       = int32_t(lrint(v));
+            q               = lsp_max(-(1 << COEF_PRECISION), lsp_min(q, (1 << COEF_PRECISION) - 1));
+            err             = v - q;
+            p->coef[i]      = q;
+        }
+
+        p->order        = order;
+        p->shift        = shift;
+        return true;
+    }
+
+    static size_t analyze_predictors(predictor_t *best, const int32_t *s, size_t n, size_t sbits, int32_t *r, double *w)
+    {
+        predictor_t p;
+        size_t best_bits    = size_t(-1);
+
+        // Order 0 always fits, try fixed polynomial predictors
+        for (size_t order=0; (order < FIXED_ORDERS) && (order < n); ++order)
+        {
+            p.order         = order;
+            p.shift         = 0;
+            for (size_t j=0; j<order; ++j)
+                p.coef[j]       = fixed_coefs[order][j];
+
+            if (!compute_residual(r, s, n, &p))
+                continue;
+            size_t bits     = predictor_bits(&p, sbits) + residual_bits(r, n, order);
+            if (bits < best_bits)
+            {
+                best_bits       = bits;
+                *best           = p;
+            }
+        }
+
+        if (n <= LSPC_LOSSLESS_MAX_ORDER * 4)
+            return best_bits;
+
+        // Apply Welch window and compute autocorrelation
+        double ac[LSPC_LOSSLESS_MAX_ORDER + 1];
+        double lpc[LSPC_LOSSLESS_MAX_ORDER * LSPC_LOSSLESS_MAX_ORDER];
+        double c            = 0.5 * (n - 1);
+        for (size_t i=0; i<n; ++i)
+        {
+            double x            = (i - c) / c;
+            w[i]                = s[i] * (1.0 - x * x);
+        }
+
+        for (size_t l=0; l<=LSPC_LOSSLESS_MAX_ORDER; ++l)
+        {
+            double sum          = 0.0;
+            for (size_t i=l; i<n; ++i)
+                sum                += w[i] * w[i-l];
+            ac[l]               = sum;
+        }
+        if (ac[0] <= 0.0)
+            return best_bits;
+
+        compute_lpc(lpc, ac, LSPC_LOSSLESS_MAX_ORDER);
+
+        // Try LPC predictors of different orders
+        for (size_t i=0; i<sizeof(lpc_orders)/sizeof(size_t); ++i)
+        {
+            size_t order        = lpc_orders[i];
+            if (!quantize_lpc(&p, &lpc[(order - 1) * LSPC_LOSSLESS_MAX_ORDER], order))
+                continue;
+            if (!compute_residual(r, s, n, &p))
+                continue;
+            size_t bits     = predictor_bits(&p, sbits) + residual_bits(r, n, order);
+            if (bits < best_bits)
+            {
+                best_bits       = bits;
+                *best           = p;
+            }
+        }
+
+        return best_bits;
+    }
+
+    /**
+     * Find the best predictor for the channel
+     * @return estimated number of bits required to store the channel
+     */
+    static size_t analyze_channel(predictor_t *best, const int32_t *s, size_t n, size_t sbits, int32_t *r, double *w)
+    {
+        size_t bits     = analyze_predictors(best, s, n, sbits, r, w);
+
+        // Store samples as is if no predictor fits or prediction does not pay off
+        size_t raw_bits = 1 + ORDER_BITS + n * (sbits + 1);
+        if (bits > raw_bits)
+        {
+            best->order     = ORDER_RAW;
+            best->shift     = 0;
+            bits            = raw_bits;
+        }
+
+        return bits;
+    }
+
+    static void write_channel(bit_writer_t *bw, bool diff, const predictor_t *p,
+            const int32_t *s, size_t n, size_t sbits, int32_t *r)
+    {
+        // Write predictor
+        bw_put(bw, (diff) ? 1 : 0, 1);
+        bw_put(bw, p->order, ORDER_BITS);
+        if (p->order == ORDER_RAW)
+        {
+            for (size_t i=0; i<n; ++i)
+                bw_put(bw, s[i], sbits + 1);
+            return;
+        }
+        if (p->order > 0)
+        {
+            bw_put(bw, p->shift, SHIFT_BITS);
+            for (size_t j=0; j<p->order; ++j)
+                bw_put(bw, p->coef[j], COEF_BITS);
+        }
+
+        // Write warm-up samples
+        for (size_t i=0; i<p->order; ++i)
+            bw_put(bw, s[i], sbits + 1);
+
+        // Write residual
+        compute_residual(r, s, n, p);
+        for (size_t i=p->order; i<n; )
+        {
+            size_t count    = lsp_min(n - i, size_t(LSPC_LOSSLESS_PARTITION));
+            uint64_t sum    = 0;
+            for (size_t j=0; j<count; ++j)
+                sum            += zigzag(r[i+j]);
+
+            size_t k        = rice_param(sum, count);
+            bw_put(bw, k, RICE_BITS);
+            for (size_t j=0; j<count; ++j)
+                bw_rice(bw, zigzag(r[i+j]), k);
+            i              += count;
+        }
+    }
+
+    size_t lossless_block_size(size_t channels, size_t frames)
+    {
+        size_t partitions   = frames / LSPC_LOSSLESS_PARTITION + 1;
+        size_t bits         = 1 + SCALE_BITS + 1 + ORDER_BITS + SHIFT_BITS +
+                              LSPC_LOSSLESS_MAX_ORDER * (COEF_BITS + WORST_BITS) +
+                              partitions * RICE_BITS + frames * WORST_BITS;
+        return ((channels * bits) >> 3) + 8;
+    }
+
+    size_t lossless_tmp_size(size_t frames)
+    {
+        return frames * (sizeof(int32_t) * 3 + sizeof(double));
+    }
+
+    size_t lossless_encode_block(uint8_t *dst, const int32_t * const *src,
+            size_t channels, size_t frames, size_t bits, void *tmp)
+    {
+        int32_t *r          = reinterpret_cast<int32_t *>(tmp);
+        int32_t *d          = &r[frames];
+        double *w           = reinterpret_cast<double *>(&d[frames]);
+
+        bit_writer_t bw;
+        bw.p                = dst;
+        bw.acc              = 0;
+        bw.bits             = 0;
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            const int32_t *s    = src[i];
+            predictor_t p;
+            size_t p_bits       = analyze_channel(&p, s, frames, bits, r, w);
+
+            // Try to store channel as difference with previous channel
+            if (i > 0)
+            {
+                const int32_t *prev = src[i-1];
+                for (size_t j=0; j<frames; ++j)
+                    d[j]                = s[j] - prev[j];
+
+                predictor_t dp;
+                size_t d_bits       = analyze_channel(&dp, d, frames, bits, r, w);
+                if (d_bits < p_bits)
+                {
+                    write_channel(&bw, true, &dp, d, frames, bits, r);
+                    continue;
+                }
+            }
+
+            write_channel(&bw, false, &p, s, frames, bits, r);
+        }
+
+        bw_flush(&bw);
+        return bw.p - dst;
+    }
+
+    size_t lossless_encode_float_block(uint8_t *dst, const float * const *src,
+            size_t channels, size_t frames, void *tmp)
+    {
+        int32_t *r          = reinterpret_cast<int32_t *>(tmp);
+        int32_t *v          = &r[frames];
+        double *w           = reinterpret_cast<double *>(&v[frames * 2]);
+
+        bit_writer_t bw;
+        bw.p                = dst;
+        bw.acc              = 0;
+        bw.bits             = 0;
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            const float *s      = src[i];
+
+            // Store scaled integers if possible, otherwise the ordered bit patterns
+            ssize_t scale       = float_scale(s, frames);
+            if (scale >= 0)
+            {
+                float k             = ldexpf(1.0f, scale);
+                for (size_t j=0; j<frames; ++j)
+                    v[j]                = int32_t(s[j] * k);
+                bw_put(&bw, 1, 1);
+                bw_put(&bw, scale, SCALE_BITS);
+            }
+            else
+            {
+                for (size_t j=0; j<frames; ++j)
+                    v[j]                = map_float(float_to_bits(s[j]));
+                bw_put(&bw, 0, 1);
+            }
+
+            predictor_t p;
+            analyze_channel(&p, v, frames, FLOAT_BITS, r, w);
+            write_channel(&bw, false, &p, v, frames, FLOAT_BITS, r);
+        }
+
+        bw_flush(&bw);
+        return bw.p - dst;
+    }
+
+    //-------------------------------------------------------------------------
+    // Decoder
+    static void restore_channel(int32_t *s, size_t n, const predictor_t *p)
+    {
+        const size_t order  = p->order;
+        const size_t shift  = p->shift;
+        const int32_t *c    = p->coef;
+
+        switch (order)
+        {
+            case 0:
+                break;
+            case 1:
+                for (size_t i=1; i<n; ++i)
+                    s[i]           += int32_t((int64_t(c[0]) * s[i-1]) >> shift);
+                break;
+            case 2:
+                for (size_t i=2; i<n; ++i)
+                    s[i]           += int32_t((int64_t(c[0]) * s[i-1] + int64_t(c[1]) * s[i-2]) >> shift);
+                break;
+            default:
+                for (size_t i=order; i<n; ++i)
+                {
+                    int64_t sum     = 0;
+                    for (size_t j=0; j<order; ++j)
+                        sum            += int64_t(c[j]) * s[i - j - 1];
+                    s[i]           += int32_t(sum >> shift);
+                }
+                break;
+        }
+    }
+
+    static status_t read_channel(bit_reader_t *br, int32_t *s, size_t frames, size_t bits, uint32_t *diff)
+    {
+        predictor_t p;
+        uint32_t v;
+
+        // Read predictor
+        if (!br_get(br, diff, 1))
+            return STATUS_CORRUPTED_FILE;
+        if (!br_get(br, &v, ORDER_BITS))
+            return STATUS_CORRUPTED_FILE;
+
+        // Read samples stored as is
+        if (v == ORDER_RAW)
+        {
+            for (size_t j=0; j<frames; ++j)
+            {
+                if (!br_get_signed(br, &s[j], bits + 1))
+                    return STATUS_CORRUPTED_FILE;
+            }
+            return STATUS_OK;
+        }
+
+        p.order             = v;
+        p.shift             = 0;
+        if ((p.order > LSPC_LOSSLESS_MAX_ORDER) || (p.order > frames))
+            return STATUS_CORRUPTED_FILE;
+
+        if (p.order > 0)
+        {
+            if (!br_get(br, &v, SHIFT_BITS))
+                return STATUS_CORRUPTED_FILE;
+            p.shift             = v;
+            for (size_t j=0; j<p.order; ++j)
+            {
+                if (!br_get_signed(br, &p.coef[j], COEF_BITS))
+                    return STATUS_CORRUPTED_FILE;
+            }
+        }
+
+        // Read warm-up samples
+        for (size_t j=0; j<p.order; ++j)
+        {
+            if (!br_get_signed(br, &s[j], bits + 1))
+                return STATUS_CORRUPTED_FILE;
+        }
+
+        // Read residual
+        for (size_t j=p.order; j<frames; )
+        {
+            size_t count        = lsp_min(frames - j, size_t(LSPC_LOSSLESS_PARTITION));
+            uint32_t k;
+            if (!br_get(br, &k, RICE_BITS))
+                return STATUS_CORRUPTED_FILE;
+
+            for (size_t l=0; l<count; ++l, ++j)
+            {
+                uint32_t u;
+                if (!br_rice(br, &u, k))
+                    return STATUS_CORRUPTED_FILE;
+                s[j]                = int32_t(u >> 1) ^ -int32_t(u & 1);
+            }
+        }
+
+        // Restore samples
+        restore_channel(s, frames, &p);
+        return STATUS_OK;
+    }
+
+    status_t lossless_decode_block(int32_t * const *dst, const uint8_t *src, size_t size,
+            size_t channels, size_t frames, size_t bits)
+    {
+        bit_reader_t br;
+        br.p                = src;
+        br.end              = &src[size];
+        br.cache            = 0;
+        br.bits             = 0;
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            int32_t *s          = dst[i];
+            uint32_t diff;
+
+            status_t res        = read_channel(&br, s, frames, bits, &diff);
+            if (res != STATUS_OK)
+                return res;
+            if (diff)
+            {
+                if (i == 0)
+                    return STATUS_CORRUPTED_FILE;
+                const int32_t *prev = dst[i-1];
+                for (size_t j=0; j<frames; ++j)
+                    s[j]               += prev[j];
+            }
+        }
+
+        return STATUS_OK;
+    }
+
+    status_t lossless_decode_float_block(float * const *dst, const uint8_t *src, size_t size,
+            size_t channels, size_t frames, int32_t *tmp)
+    {
+        bit_reader_t br;
+        br.p                = src;
+        br.end              = &src[size];
+        br.cache            = 0;
+        br.bits             = 0;
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            float *s            = dst[i];
+            uint32_t scaled, scale = 0, diff;
+
+            if (!br_get(&br, &scaled, 1))
+                return STATUS_CORRUPTED_FILE;
+            if ((scaled) && (!br_get(&br, &scale, SCALE_BITS)))
+                return STATUS_CORRUPTED_FILE;
+
+            status_t res        = read_channel(&br, tmp, frames, FLOAT_BITS, &diff);
+            if (res != STATUS_OK)
+                return res;
+            if (diff)
+                return STATUS_CORRUPTED_FILE;
+
+            if (scaled)
+            {
+                float k             = ldexpf(1.0f, -ssize_t(scale));
+                for (size_t j=0; j<frames; ++j)
+                    s[j]                = float(tmp[j]) * k;
+            }
+            else
+            {
+                for (size_t j=0; j<frames; ++j)
+                    s[j]                = bits_to_float(unmap_float(tmp[j]));
+            }
+        }
+
+        return STATUS_OK;
+    }
+}
@@ -6,11 +6,15 @@
  */
 
 #include <core/filters/DynamicFilters.h>
+#include <core/debug.h>
 #include <math.h>
 
 #define BLD_BUF_SIZE    8
 #define BUF_SIZE        0x400       /* 1024 samples at one time */
 #define FBUF_SIZE       ((BLD_BUF_SIZE * (BUF_SIZE - BLD_BUF_SIZE) * sizeof(f_cascade_t)) / sizeof(float))
+#define ABUF_SIZE       (BUF_SIZE / DYNAMIC_FILTERS_INTERP_MIN + 1) /* Maximum number of anchor points at one time */
+#define INTERP_GAIN_RANGE   0.25f   /* Maximum relative gain change between anchor points */
+#define INTERP_GAIN_ERROR   1e-3f   /* Maximum relative deviation of the gain curve from the line between anchor points */
 
 namespace lsp
 {
@@ -26,9 +30,13 @@ namespace lsp
         vFilters        = NULL;
         vMemory         = NULL;
         vCascades       = NULL;
+        vAnchors        = NULL;
+        vAnchorGain     = NULL;
+        vAnchorStep     = NULL;
         vBiquads.ptr    = NULL;
         nFilters        = 0;
         nSampleRate     = 0;
+        nInterp         = 0;
         pData           = NULL;
         bClearMem       = false;
     }
@@ -44,9 +52,13 @@ namespace lsp
         size_t b_per_filter_t       = ALIGN_SIZE(sizeof(filter_t) * filters, ALIGN64);
         size_t b_per_memory         = FILTER_CHAINS_MAX * 2 * filters * sizeof(float);
         size_t b_per_cascades       = ALIGN_SIZE(BLD_BUF_SIZE * (BUF_SIZE + BLD_BUF_SIZE) * sizeof(f_cascade_t), ALIGN64);
+        size_t b_per_anchors        = ALIGN_SIZE(BLD_BUF_SIZE * (ABUF_SIZE + BLD_BUF_SIZE) * sizeof(f_cascade_t), ALIGN64);
+        size_t b_per_anchor_gain    = ALIGN_SIZE(ABUF_SIZE * sizeof(float), ALIGN64);
+        size_t b_per_anchor_step    = ALIGN_SIZE(ABUF_SIZE * sizeof(size_t), ALIGN64);
         size_t b_per_biquad         = sizeof(biquad_x8_t) * (BUF_SIZE + BLD_BUF_SIZE);
 
-        size_t to_alloc             = b_per_filter_t + b_per_memory + b_per_cascades + b_per_biquad;
+        size_t to_alloc             = b_per_filter_t + b_per_memory + b_per_cascades + b_per_anchors +
+                                      b_per_anchor_gain + b_per_anchor_step + b_per_biquad;
 
         // Allocate memory
         uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, ALIGN64);
@@ -60,6 +72,12 @@ namespace lsp
         ptr            += b_per_memory;
         vCascades       = reinterpret_cast<f_cascade_t *>(ptr);
         ptr            += b_per_cascades;
+        vAnchors        = reinterpret_cast<f_cascade_t *>(ptr);
+        ptr            += b_per_anchors;
+        vAnchorGain     = reinterpret_cast<float *>(ptr);
+        ptr            += b_per_anchor_gain;
+        vAnchorStep     = reinterpret_cast<size_t *>(ptr);
+        ptr            += b_per_anchor_step;
         vBiquads.ptr    = ptr;
         nFilters        = filters;
 
@@ -89,6 +107,16 @@ namespace lsp
         nSampleRate         = sr;
     }
 
+    void DynamicFilters::set_interpolation(size_t step)
+    {
+        if (step <= 1)
+            nInterp             = 0;
+        else if (step < DYNAMIC_FILTERS_INTERP_MIN)
+            nInterp             = DYNAMIC_FILTERS_INTERP_MIN;
+        else
+            nInterp             = (step > DYNAMIC_FILTERS_INTERP_MAX) ? DYNAMIC_FILTERS_INTERP_MAX : step;
+    }
+
     void DynamicFilters::destroy()
     {
         if (pData != NULL)
@@ -96,6 +124,8 @@ namespace lsp
 
         vFilters        = NULL;
         vCascades       = NULL;
+        vAnchors        = NULL;
+        vAnchorGain     = NULL;
         vMemory         = NULL;
         vBiquads.ptr    = NULL;
         nFilters        = 0;
@@ -216,7 +246,9 @@ namespace lsp
             while (true)
             {
                 // Generate cascades
-                size_t nj               = build_filter_bank(vCascades, &f->sParams, cj, gain, to_process);
+                size_t nj               = (nInterp > 0) ?
+                        interpolate_filter_bank(vCascades, &f->sParams, cj, gain, to_process) :
+                        build_filter_bank(vCascades, &f->sParams, cj, gain, to_process);
                 if (nj <= 0)
                     break;
 
@@ -295,6 +327,94 @@ namespace lsp
         }
     }
 
+    bool DynamicFilters::linear_gain(const float *g, size_t n)
+    {
+        // Limit the gain change between anchor points, cascades depend on the gain non-linearly
+        float g0            = g[0];
+        float g1            = g[n];
+        float tol           = lsp_min(g0, g1);
+        if (fabs(g1 - g0) > tol * INTERP_GAIN_RANGE)
+            return false;
+
+        // Check deviation of the gain curve from the line
+        float dg            = (g1 - g0) / n;
+        tol                *= INTERP_GAIN_ERROR;
+        for (size_t i=1; i<n; ++i)
+        {
+            if (fabs(g[i] - g0 - dg * i) > tol)
+                return false;
+        }
+
+        return true;
+    }
+
+    size_t DynamicFilters::interpolate_filter_bank(f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples)
+    {
+        // Place anchor points, the distance is halved until the gain curve between
+        // anchor points is close to linear. The last sample is an anchor point itself
+        size_t anchors          = 0;
+        for (size_t i=0; ; ++anchors)
+        {
+            // There is no room for anchor points, compute cascades for each sample
+            if (anchors >= (ABUF_SIZE - 1))
+                return build_filter_bank(dst, fp, cj, sfg, samples);
+
+            vAnchorGain[anchors]    = sfg[i];
+            if (i >= (samples - 1))
+            {
+                vAnchorGain[anchors+1]  = sfg[i];
+                vAnchorStep[anchors++]  = 1;
+                break;
+            }
+
+            size_t n                = lsp_min(nInterp, samples - 1 - i);
+            while ((n > 1) && (!linear_gain(&sfg[i], n)))
+                n                     >>= 1;
+            vAnchorStep[anchors]    = n;
+            i                      += n;
+        }
+
+        // Compute exact cascades at anchor points
+        size_t nc               = build_filter_bank(vAnchors, fp, cj, vAnchorGain, anchors + 1);
+        if (nc <= 0)
+            return nc;
+
+        // Interpolation keeps the filter stable only if denominators of both anchors have
+        // the same sign. Coefficients of a stable denominator share the sign, so make them
+        // positive by negating the whole cascade which does not change the transfer function
+        for (size_t j=0; j<nc; ++j)
+        {
+            f_cascade_t *a          = &vAnchors[(nc+1)*j];
+            for (size_t i=0; i<=anchors; ++i, a += nc)
+            {
+                if ((a->b[0] + a->b[1] + a->b[2]) < 0.0f)
+                {
+                    a->t[0] = -a->t[0]; a->t[1] = -a->t[1]; a->t[2] = -a->t[2];
+                    a->b[0] = -a->b[0]; a->b[1] = -a->b[1]; a->b[2] = -a->b[2];
+                }
+                lsp_assert((a->b[0] >= 0.0f) && (a->b[1] >= 0.0f) && (a->b[2] >= 0.0f));
+            }
+        }
+
+        // Interpolate cascades between anchor points, cascade j of sample i is stored
+        // in the row (i+j) of the matrix for both anchor and target cascades
+        for (size_t j=0; j<nc; ++j)
+        {
+            f_cascade_t *c          = &dst[(nc+1)*j];
+            const f_cascade_t *a    = &vAnchors[(nc+1)*j];
+
+            for (size_t i=0; i<anchors; ++i)
+            {
+                size_t n                = vAnchorStep[i];
+                dsp::interpolate_cascades(c, a, &a[nc], nc, n);
+                c                      += n * nc;
+                a                      += nc;
+            }
+        }
+
+        return nc;
+    }
+
     size_t DynamicFilters::precalc_lrx_ladder_filter_bank(f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples)
     {
         size_t slope            = fp->nSlope * 4;
@@ -10,15 +10,54 @@
 #include <core/filters/Equalizer.h>
 #include <core/debug.h>
 
+#define EQ_PART_RANK_MIN        5       /* Minimum rank of the convolution partition */
+
 namespace lsp
 {
-    Equalizer::Equalizer()
+    Equalizer::KernelTask::KernelTask(Equalizer *core)
+    {
+        pCore       = core;
+    }
+
+    Equalizer::KernelTask::~KernelTask()
+    {
+        pCore       = NULL;
+    }
+
+    status_t Equalizer::KernelTask::run()
+    {
+        // The equalizer holds the lock while destroying the data
+        pCore->sKLock.lock();
+        if (pCore->bKernelCancel)
+        {
+            pCore->sKLock.unlock();
+            return STATUS_CANCELLED;
+        }
+
+        // Initialize DSP context
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+
+        pCore->build_kernel();
+
+        // Finalize DSP context
+        dsp::finish(&ctx);
+        pCore->sKLock.unlock();
+
+        return STATUS_OK;
+    }
+
+    Equalizer::Equalizer(): sKTask(this)
     {
         vFilters        = NULL;
         nFilters        = 0;
         nSampleRate     = 0;
         nConvSize       = 0;
         nFftRank        = 0;
+        nPartSize       = 0;
+        nPartRank       = 0;
+        nParts          = 0;
+        nFdlHead        = 0;
         nLatency        = 0;
         nBufSize        = 0;
         nMode           = EQM_BYPASS;
@@ -26,10 +65,26 @@ namespace lsp
         vFftIm          = NULL;
         vConvRe         = NULL;
         vConvIm         = NULL;
+        vConv           = NULL;
+        vFdl            = NULL;
+        vInput          = NULL;
         vBuffer         = NULL;
         vTmp            = NULL;
+        vNewConv        = NULL;
+        vTail           = NULL;
         pData           = NULL;
         nFlags          = EF_REBUILD | EF_CLEAR;
+
+        vKFilters       = NULL;
+        vKParams        = NULL;
+        nKSampleRate    = 0;
+        nKMode          = EQM_BYPASS;
+        pExecutor       = NULL;
+        nXFade          = 0;
+        bKernelDirty    = false;
+        bKernelClear    = false;
+        bKernelStale    = false;
+        bKernelCancel   = true;
     }
 
     Equalizer::~Equalizer()
@@ -37,12 +92,13 @@ namespace lsp
         destroy();
     }
 
-    bool Equalizer::init(size_t filters, size_t conv_rank)
+    bool Equalizer::init(size_t filters, size_t conv_rank, size_t part_rank)
     {
         destroy();
 
-        // Initialize filter bank
+        // Initialize filter banks
         sBank.init(filters * FILTER_CHAINS_MAX);
+        sKBank.init(filters * FILTER_CHAINS_MAX);
 
         // Initialize filters
         nSampleRate     = 0;
@@ -54,22 +110,47 @@ namespace lsp
         }
         nFilters        = filters;
 
-        // Allocate buffers
+        vKFilters       = new Filter[filters];
+        vKParams        = new filter_params_t[filters];
+        if ((vKFilters == NULL) || (vKParams == NULL))
+        {
+            destroy();
+            return false;
+        }
+
+        // Compute convolution partitioning
+        if (part_rank <= 0)
+            part_rank           = conv_rank - 1;
+        if (part_rank > conv_rank)
+            part_rank           = conv_rank;
+        if (part_rank < EQ_PART_RANK_MIN)
+            part_rank           = EQ_PART_RANK_MIN;
+        if (conv_rank < part_rank)
+            conv_rank           = part_rank;
+
         nConvSize           = 1 << conv_rank;
         nFftRank            = conv_rank;
+        nPartSize           = 1 << part_rank;
+        nPartRank           = part_rank + 1;
+        nParts              = nConvSize / nPartSize;
+        nFdlHead            = 0;
+
+        // Allocate buffers
         size_t conv_size    = nConvSize * 2;
-        size_t allocate     = conv_size * 6; // fft + conv*2 + buffer + tmp*2
-        pData               = new float[allocate];
-        if (pData == NULL)
+        size_t img_size     = nPartSize * 4;
+        size_t allocate     = conv_size * 4 +       // fft + conv for building the impulse response
+                              img_size * nParts * 3 + // convolution images (current and new) + frequency-domain delay line
+                              nPartSize * 12;       // tmp + buffer + input + tail
+        float *ptr          = alloc_aligned<float>(pData, allocate);
+        if (ptr == NULL)
         {
             destroy();
             return false;
         }
 
-        dsp::fill_zero(pData, allocate);
+        dsp::fill_zero(ptr, allocate);
 
         // Assign pointers
-        float *ptr          = pData;
         vFftRe              = ptr;
         ptr                += conv_size;
         vFftIm              = ptr;
@@ -78,29 +159,71 @@ namespace lsp
         ptr                += conv_size;
         vConvIm             = ptr;
         ptr                += conv_size;
-        vBuffer             = ptr;
-        ptr                += conv_size;
+        vConv               = ptr;
+        ptr                += img_size * nParts;
+        vNewConv            = ptr;
+        ptr                += img_size * nParts;
+        vFdl                = ptr;
+        ptr                += img_size * nParts;
         vTmp                = ptr;
-        ptr                += conv_size;
+        ptr                += nPartSize * 8;
+        vBuffer             = ptr;
+        ptr                += nPartSize * 2;
+        vInput              = ptr;
+        ptr                += nPartSize;
+        vTail               = ptr;
+        ptr                += nPartSize;
 
         // Initialize filters
         for (size_t i=0; i<filters; ++i)
         {
-            if (!vFilters[i].init(&sBank))
+            if ((!vFilters[i].init(&sBank)) || (!vKFilters[i].init(&sKBank)))
             {
                 destroy();
                 return false;
             }
+            vFilters[i].get_params(&vKParams[i]);
         }
 
         // Mark equalizer for rebuild
         nFlags              = EF_REBUILD | EF_CLEAR;
+        nXFade              = 0;
+        bKernelDirty        = false;
+        bKernelClear        = false;
+        bKernelStale        = !sKTask.idle();
+
+        // Allow the kernel task to build the impulse response
+        sKLock.lock();
+        bKernelCancel       = false;
+        sKLock.unlock();
 
         return true;
     }
 
     void Equalizer::destroy()
     {
+        // Wait for the kernel task only if it is currently running. The task that has been
+        // submitted but not launched yet will not touch the data. It is never launched after
+        // the shutdown of the executor, some executors (LV2) just drop it
+        sKLock.lock();
+        bKernelCancel       = true;
+        sKLock.unlock();
+        sKTask.reset();
+
+        if (vKFilters != NULL)
+        {
+            for (size_t i=0; i<nFilters; ++i)
+                vKFilters[i].destroy();
+            delete [] vKFilters;
+            vKFilters       = NULL;
+        }
+
+        if (vKParams != NULL)
+        {
+            delete [] vKParams;
+            vKParams        = NULL;
+        }
+
         if (vFilters != NULL)
         {
             for (size_t i=0; i<nFilters; ++i)
@@ -112,17 +235,23 @@ namespace lsp
 
         if (pData != NULL)
         {
-            delete [] pData;
+            free_aligned(pData);
             vFftRe          = NULL;
             vFftIm          = NULL;
             vConvRe         = NULL;
             vConvIm         = NULL;
+            vConv           = NULL;
+            vFdl            = NULL;
+            vInput          = NULL;
             vBuffer         = NULL;
             vTmp            = NULL;
+            vNewConv        = NULL;
+            vTail           = NULL;
             pData           = NULL;
         }
 
         sBank.destroy();
+        sKBank.destroy();
     }
 
     void Equalizer::set_sample_rate(size_t sr)
@@ -138,6 +267,8 @@ namespace lsp
             vFilters[i].get_params(&fp);
             vFilters[i].update(nSampleRate, &fp);
         }
+
+        nFlags         |= EF_REBUILD;
     }
 
     bool Equalizer::set_params(size_t id, const filter_params_t *params)
@@ -169,6 +300,21 @@ namespace lsp
         for (size_t i=0; i<nFilters; ++i)
             vFilters[i].rebuild();
         sBank.end(nFlags & EF_CLEAR);
+
+        // Clear the convolution state
+        if (nFlags & EF_CLEAR)
+        {
+            dsp::fill_zero(vFdl, nPartSize * 4 * nParts);
+            dsp::fill_zero(vBuffer, nPartSize * 2);
+            nFdlHead            = 0;
+            nBufSize            = 0;
+
+            // Mute the convolution until the new impulse response becomes available
+            dsp::fill_zero(vConv, nPartSize * 4 * nParts);
+            nXFade              = 0;
+            bKernelClear        = true;
+            bKernelStale        = !sKTask.idle();
+        }
         nFlags              = 0;
 
         // Quit if working in IIR mode
@@ -178,24 +324,38 @@ namespace lsp
             return;
         }
 
-        size_t conv_len     = nConvSize << 1;
+        // Request the rebuild of the impulse response
+        bKernelDirty        = true;
+
+        // The impulse response is centered at the half of the convolution size
+        nLatency            = nPartSize + (nConvSize >> 1);
+    }
+
+    void Equalizer::build_kernel()
+    {
+        // Initialize bank
+        sKBank.begin();
+        for (size_t i=0; i<nFilters; ++i)
+        {
+            vKFilters[i].update(nKSampleRate, &vKParams[i]);
+            vKFilters[i].rebuild();
+        }
+        sKBank.end(true);
+
         size_t half_size    = nConvSize >> 1;
         float *conv_re      = vConvRe;
         float *conv_im      = vConvIm;
 
-        // Backup input buffer
-        dsp::copy(vTmp, vFftRe, conv_len);
-
         // Init convolution
         dsp::fill_one(conv_re, nConvSize);
 
-        if (nMode == EQM_FIR)
+        if (nKMode == EQM_FIR)
         {
             // Clear buffers
             windows::window(conv_im, nConvSize*2, windows::BLACKMAN_NUTTALL);
 
             // Get impulse response
-            sBank.impulse_response(vFftRe, nConvSize);
+            sKBank.impulse_response(vFftRe, nConvSize);
             dsp::fill_zero(vFftIm, nConvSize);
             dsp::mul2(vFftRe, &conv_im[nConvSize], nConvSize);  // Apply window function to the impulse response
 
@@ -204,22 +364,22 @@ namespace lsp
             dsp::complex_mod(vFftRe, vFftRe, vFftIm, nConvSize);
             dsp::mul2(conv_re, vFftRe, nConvSize);             // Apply the frequency chart relative to the IR
         }
-        else if (nMode == EQM_FFT)
+        else if (nKMode == EQM_FFT)
         {
             // Initialize frequencies
             ssize_t n_freqs         = nConvSize >> 1;
-            float kf                = float(nSampleRate) / nConvSize;
+            float kf                = float(nKSampleRate) / nConvSize;
             for (ssize_t i=0; i<=n_freqs; ++i)
                 conv_im[i]              = i * kf;
 
             // Build frequency chart for all filters
             for (size_t i=0; i<nFilters; ++i)
             {
-                if (vFilters[i].inactive())
+                if (vKFilters[i].inactive())
                     continue;
 
                 // Get the frequency chart of the filter
-                vFilters[i].freq_chart(vFftRe, vFftIm, conv_im, n_freqs+1);
+                vKFilters[i].freq_chart(vFftRe, vFftIm, conv_im, n_freqs+1);
                 dsp::complex_mod(vFftRe, vFftRe, vFftIm, n_freqs+1);
                 dsp::mul2(conv_re, vFftRe, n_freqs+1);
             }
@@ -240,14 +400,59 @@ namespace lsp
         windows::window(conv_im, nConvSize, windows::BLACKMAN_NUTTALL);
         dsp::mul3(vFftRe, vFftIm, conv_im, nConvSize);              // Apply window to the impulse response
 
-        // Get the final convolution spectrum
-        dsp::fill_zero(&vFftRe[nConvSize], nConvSize);
-        dsp::fill_zero(vFftIm, conv_len);
-        dsp::direct_fft(conv_re, conv_im, vFftRe, vFftIm, nFftRank+1);
+        // Get the fast convolution images of the impulse response partitions
+        for (size_t i=0; i<nParts; ++i)
+            dsp::fastconv_parse(&vNewConv[i * nPartSize * 4], &vFftRe[i * nPartSize], nPartRank);
+    }
 
-        // Restore input buffer
-        dsp::copy(vFftRe, vTmp, conv_len);
-        nLatency    = nConvSize;
+    void Equalizer::apply_kernel(bool crossfade)
+    {
+        // Swap the current and the new convolution images, the old images are kept for the crossfade
+        float *conv         = vConv;
+        vConv               = vNewConv;
+        vNewConv            = conv;
+        nXFade              = (crossfade) ? 2 : 0;
+    }
+
+    void Equalizer::update_kernel()
+    {
+        // Apply the impulse response built by the kernel task. The impulse response
+        // built for parameters before the reset of the state is outdated, drop it
+        if (sKTask.completed())
+        {
+            bool success        = (sKTask.successful()) && (!bKernelStale);
+            sKTask.reset();
+            bKernelStale        = false;
+            if (success)
+            {
+                apply_kernel(!bKernelClear);
+                bKernelClear        = false;
+            }
+        }
+
+        // Check that the kernel task can be launched
+        if ((!bKernelDirty) || (!sKTask.idle()))
+            return;
+        bool sync           = (pExecutor == NULL);
+        if ((!bKernelClear) && (nXFade > 0))
+            return;
+
+        // Make the snapshot of the parameters for the kernel task
+        for (size_t i=0; i<nFilters; ++i)
+            vFilters[i].get_params(&vKParams[i]);
+        nKSampleRate        = nSampleRate;
+        nKMode              = nMode;
+
+        if (sync)
+        {
+            // There is no executor, build the impulse response immediately
+            build_kernel();
+            apply_kernel(false);
+            bKernelDirty        = false;
+            bKernelClear        = false;
+        }
+        else if (pExecutor->submit(&sKTask))
+            bKernelDirty        = false;
     }
 
     void Equalizer::set_mode(equalizer_mode_t mode)
@@ -280,6 +485,72 @@ namespace lsp
         return true;
     }
 
+    void Equalizer::convolve(float *dst, const float *conv)
+    {
+        size_t img_size     = nPartSize * 4;
+        float *acc          = vTmp;
+
+        // Accumulate the products of delayed input images and impulse response images
+        dsp::fill_zero(acc, img_size);
+        for (size_t i=0; i<nParts; ++i)
+        {
+            size_t fdl          = (nFdlHead + nParts - i) % nParts;
+            dsp::fastconv_mul_add(acc, &vFdl[fdl * img_size], &conv[i * img_size], nPartRank);
+        }
+        dsp::fastconv_restore(dst, acc, nPartRank);
+    }
+
+    void Equalizer::process_block()
+    {
+        if ((nParts <= 1) && (nXFade <= 0))
+        {
+            // Shift the buffer and apply the convolution to the input data
+            dsp::copy(vBuffer, &vBuffer[nPartSize], nPartSize);
+            dsp::fill_zero(&vBuffer[nPartSize], nPartSize);
+            dsp::fastconv_parse_apply(vBuffer, vTmp, vConv, vInput, nPartRank);
+            return;
+        }
+
+        // Store the image of the input data to the frequency-domain delay line
+        nFdlHead            = (nFdlHead + 1) % nParts;
+        dsp::fastconv_parse(&vFdl[nFdlHead * nPartSize * 4], vInput, nPartRank);
+
+        float *res          = &vTmp[nPartSize * 4];
+        convolve(res, vConv);
+
+        if (nXFade <= 0)
+        {
+            // Apply previous convolution tail and update the buffer
+            dsp::add3(vBuffer, res, &vBuffer[nPartSize], nPartSize);
+            dsp::copy(&vBuffer[nPartSize], &res[nPartSize], nPartSize);
+            return;
+        }
+
+        // Compute the convolution with the old impulse response
+        float *old          = &vTmp[nPartSize * 6];
+        convolve(old, vNewConv);
+        dsp::add2(old, &vBuffer[nPartSize], nPartSize);
+
+        if (nXFade > 1)
+        {
+            // Emit the old signal and remember the tail of the new convolution
+            dsp::copy(vBuffer, old, nPartSize);
+            dsp::copy(&vBuffer[nPartSize], &old[nPartSize], nPartSize);
+            dsp::copy(vTail, &res[nPartSize], nPartSize);
+        }
+        else
+        {
+            // Crossfade between the old and the new signal
+            dsp::add2(res, vTail, nPartSize);
+            float k             = 1.0f / nPartSize;
+            for (size_t i=0; i<nPartSize; ++i)
+                vBuffer[i]          = old[i] + (res[i] - old[i]) * (i * k);
+            dsp::copy(&vBuffer[nPartSize], &res[nPartSize], nPartSize);
+        }
+
+        --nXFade;
+    }
+
     void Equalizer::process(float *out, const float *in, size_t samples)
     {
         if (nFlags != 0)
@@ -303,41 +574,25 @@ namespace lsp
             case EQM_FFT:
             default:
             {
+                update_kernel();
+
                 while (samples > 0)
                 {
-                    if (nBufSize >= nConvSize)
+                    if (nBufSize >= nPartSize)
                     {
-                        size_t conv_len = nConvSize * 2;
-
-                        dsp::fill_zero(&vFftRe[nConvSize], nConvSize);
-
-                        // Perform the direct FFT of the input signal
-                        dsp::fill_zero(vFftIm, conv_len);
-                        dsp::direct_fft(vFftRe, vFftIm, vFftRe, vFftIm, nFftRank + 1);
-
-                        // Perform convolution
-                        dsp::complex_mul2(vFftRe, vFftIm, vConvRe, vConvIm, conv_len);
-
-                        // Perform the reverse FFT
-                        dsp::reverse_fft(vFftRe, vFftIm, vFftRe, vFftIm, nFftRank + 1);
-
-                        // Apply previous convolution tail
-                        dsp::add2(vFftRe, &vBuffer[nConvSize], nConvSize);
-
-                        // Update the buffer
-                        dsp::copy(vBuffer, vFftRe, conv_len);
+                        process_block();
 
                         // Reset the buffer size
                         nBufSize    = 0;
                     }
 
                     // Determine number of samples to process
-                    size_t to_process = nConvSize - nBufSize;
+                    size_t to_process = nPartSize - nBufSize;
                     if (to_process > samples)
                         to_process      = samples;
 
                     // Push new data for processing and emit processed data
-                    dsp::copy(&vFftRe[nBufSize], in, to_process);
+                    dsp::copy(&vInput[nBufSize], in, to_process);
                     dsp::copy(out, &vBuffer[nBufSize], to_process);
 
                     // Update pointers and counters
@@ -352,4 +607,41 @@ namespace lsp
         }
     }
 
+    void Equalizer::process(Equalizer **eq, float **out, const float **in, size_t n, size_t samples)
+    {
+        FilterBank *fb[FILTER_BANK_LANES_MAX];
+
+        while (n > 0)
+        {
+            size_t count    = (n > FILTER_BANK_LANES_MAX) ? FILTER_BANK_LANES_MAX : n;
+
+            // Only IIR equalizers with the same filters can be linked
+            bool linked     = true;
+            for (size_t i=0; i<count; ++i)
+            {
+                Equalizer *e    = eq[i];
+                if (e->nFlags != 0)
+                    e->reconfigure();
+
+                fb[i]           = &e->sBank;
+                if ((e->nMode != EQM_IIR) || (!e->sBank.same_chains(&eq[0]->sBank)))
+                    linked          = false;
+            }
+
+            if (linked)
+                FilterBank::process(fb, out, in, count, samples);
+            else
+            {
+                for (size_t i=0; i<count; ++i)
+                    eq[i]->process(out[i], in[i], samples);
+            }
+
+            // Move to the next group
+            eq             += count;
+            out            += count;
+            in             += count;
+            n              -= count;
+        }
+    }
+
 } /* namespace lsp */
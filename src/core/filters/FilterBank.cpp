@@ -272,6 +272,268 @@ namespace lsp
             dsp::biquad_process_x1(out, in, samples, f);
     }
 
+    void FilterBank::chain_delays(size_t k, float **d0, float **d1)
+    {
+        biquad_t *f         = &vFilters[k >> 3];
+        size_t base         = k & ~size_t(7);
+
+        // Cascade is stored in the 8x filter bank
+        if (base < (nItems & ~size_t(7)))
+        {
+            k                  &= 7;
+            *d0                 = &f->d[k];
+            *d1                 = &f->d[8 + k];
+            return;
+        }
+
+        // Cascade is stored in one of the tail filter banks
+        size_t items        = nItems & 7;
+        k                  -= base;
+        if (items & 4)
+        {
+            if (k < 4)
+            {
+                *d0                 = &f->d[k];
+                *d1                 = &f->d[4 + k];
+                return;
+            }
+            k                  -= 4;
+            f                  ++;
+        }
+        if (items & 2)
+        {
+            if (k < 2)
+            {
+                *d0                 = &f->d[k];
+                *d1                 = &f->d[2 + k];
+                return;
+            }
+            k                  -= 2;
+            f                  ++;
+        }
+
+        *d0                 = &f->d[0];
+        *d1                 = &f->d[1];
+    }
+
+    void FilterBank::process_lanes(FilterBank **fb, float **out, const float **in, size_t n, size_t samples)
+    {
+        biquad_t banks[8];
+        float buf[FILTER_BANK_BUF_SIZE * FILTER_BANK_LANES_MAX];
+        float *d0, *d1;
+
+        const biquad_x1_t *c    = fb[0]->vChains;
+        size_t items            = fb[0]->nItems;
+        size_t first            = items & ~size_t(7);
+        size_t tail             = items - first;
+
+        // 8x filter banks already fill SIMD registers, process them for each channel separately
+        for (size_t i=0; i<n; ++i)
+        {
+            FilterBank *b       = fb[i];
+            const float *src    = in[i];
+            biquad_t *f         = b->vFilters;
+            for (size_t j=0; j<first; j += 8)
+            {
+                dsp::biquad_process_x8(out[i], src, samples, f++);
+                src                 = out[i];
+            }
+            if ((tail == 0) && (src != out[i]))
+                dsp::copy(out[i], src, samples);
+        }
+        if (tail == 0)
+            return;
+
+        // Source data for the tail cascades
+        const float *vsrc[FILTER_BANK_LANES_MAX];
+        for (size_t i=0; i<n; ++i)
+            vsrc[i]             = (first > 0) ? out[i] : in[i];
+        c                      += first;
+
+        // Gather coefficients and memory of tail cascades into interleaved filter banks
+        size_t lanes, nbanks;
+        void (* process)(float *dst, const float *src, size_t count, biquad_t *f);
+
+        if (n == 2)
+        {
+            // Two channels: each bank holds two cascades for both channels
+            lanes               = 2;
+            nbanks              = (tail + 1) >> 1;
+            process             = dsp::biquad_process_i2;
+
+            for (size_t k=0; k<nbanks; ++k)
+            {
+                biquad_x4_t *x  = &banks[k].x4;
+                float *d        = banks[k].d;
+                dsp::fill_zero(d, BIQUAD_D_ITEMS);
+
+                for (size_t j=0; j<2; ++j)
+                {
+                    size_t chain        = 2*k + j;
+                    const biquad_x1_t *bq = (chain < tail) ? &c[chain] : NULL;
+
+                    for (size_t i=0; i<2; ++i)
+                    {
+                        size_t l            = j*2 + i;
+                        x->b0[l]            = (bq != NULL) ? bq->b0 : 1.0f; // Padding lanes bypass the signal
+                        x->b1[l]            = (bq != NULL) ? bq->b1 : 0.0f;
+                        x->b2[l]            = (bq != NULL) ? bq->b2 : 0.0f;
+                        x->a1[l]            = (bq != NULL) ? bq->a1 : 0.0f;
+                        x->a2[l]            = (bq != NULL) ? bq->a2 : 0.0f;
+                        if (bq == NULL)
+                            continue;
+
+                        fb[i]->chain_delays(first + chain, &d0, &d1);
+                        d[l]                = *d0;
+                        d[4 + l]            = *d1;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Three or more channels: each bank holds one cascade for all channels
+            lanes               = (n > 4) ? 8 : 4;
+            nbanks              = tail;
+            process             = (n > 4) ? dsp::biquad_process_i8 : dsp::biquad_process_i4;
+
+            // Coefficient arrays of the bank are stored sequentially: b0, b1, b2, a1, a2
+            for (size_t k=0; k<nbanks; ++k)
+            {
+                const biquad_x1_t *bq = &c[k];
+                float *d        = banks[k].d;
+                float *x        = (lanes > 4) ? banks[k].x8.b0 : banks[k].x4.b0;
+                dsp::fill_zero(d, BIQUAD_D_ITEMS);
+
+                for (size_t i=0; i<lanes; ++i)
+                {
+                    bool used           = i < n;
+                    x[i]                = (used) ? bq->b0 : 0.0f;
+                    x[i + lanes]        = (used) ? bq->b1 : 0.0f;
+                    x[i + lanes*2]      = (used) ? bq->b2 : 0.0f;
+                    x[i + lanes*3]      = (used) ? bq->a1 : 0.0f;
+                    x[i + lanes*4]      = (used) ? bq->a2 : 0.0f;
+                    if (!used)
+                        continue;
+
+                    fb[i]->chain_delays(first + k, &d0, &d1);
+                    d[i]                = *d0;
+                    d[i + lanes]        = *d1;
+                }
+            }
+
+            // Unused lanes are kept silent
+            if (n < lanes)
+                dsp::fill_zero(buf, FILTER_BANK_BUF_SIZE * lanes);
+        }
+
+        // Process data
+        for (size_t off=0; off < samples; )
+        {
+            size_t to_do    = samples - off;
+            if (to_do > FILTER_BANK_BUF_SIZE)
+                to_do           = FILTER_BANK_BUF_SIZE;
+
+            // Interleave signals
+            for (size_t i=0; i<n; ++i)
+            {
+                const float *src    = &vsrc[i][off];
+                float *dst          = &buf[i];
+                for (size_t j=0; j<to_do; ++j, dst += lanes)
+                    *dst                = src[j];
+            }
+
+            // Apply filters
+            for (size_t k=0; k<nbanks; ++k)
+                process(buf, buf, to_do, &banks[k]);
+
+            // De-interleave signals
+            for (size_t i=0; i<n; ++i)
+            {
+                const float *src    = &buf[i];
+                float *dst          = &out[i][off];
+                for (size_t j=0; j<to_do; ++j, src += lanes)
+                    dst[j]              = *src;
+            }
+
+            off            += to_do;
+        }
+
+        // Store the filter memory
+        for (size_t k=0; k<nbanks; ++k)
+        {
+            const float *d      = banks[k].d;
+
+            if (lanes == 2)
+            {
+                for (size_t l=0; l<4; ++l)
+                {
+                    size_t chain        = 2*k + (l >> 1);
+                    if (chain >= tail)
+                        break;
+                    fb[l & 1]->chain_delays(first + chain, &d0, &d1);
+                    *d0                 = d[l];
+                    *d1                 = d[4 + l];
+                }
+            }
+            else
+            {
+                for (size_t i=0; i<n; ++i)
+                {
+                    fb[i]->chain_delays(first + k, &d0, &d1);
+                    *d0                 = d[i];
+                    *d1                 = d[i + lanes];
+                }
+            }
+        }
+    }
+
+    bool FilterBank::same_chains(const FilterBank *fb) const
+    {
+        if (fb == this)
+            return true;
+        if (nItems != fb->nItems)
+            return false;
+
+        const biquad_x1_t *a    = vChains;
+        const biquad_x1_t *b    = fb->vChains;
+        for (size_t i=0; i<nItems; ++i, ++a, ++b)
+        {
+            if ((a->b0 != b->b0) || (a->b1 != b->b1) || (a->b2 != b->b2) ||
+                (a->a1 != b->a1) || (a->a2 != b->a2))
+                return false;
+        }
+
+        return true;
+    }
+
+    void FilterBank::process(FilterBank **fb, float **out, const float **in, size_t n, size_t samples)
+    {
+        while (n > 0)
+        {
+            size_t count    = (n > FILTER_BANK_LANES_MAX) ? FILTER_BANK_LANES_MAX : n;
+
+            // Interleaved cascades use coefficients of the first bank, so all banks should match
+            bool linked     = count > 1;
+            for (size_t i=1; (linked) && (i<count); ++i)
+                linked          = fb[i]->same_chains(fb[0]);
+
+            if (linked)
+                process_lanes(fb, out, in, count, samples);
+            else
+            {
+                for (size_t i=0; i<count; ++i)
+                    fb[i]->process(out[i], in[i], samples);
+            }
+
+            // Move to the next group
+            fb             += count;
+            out            += count;
+            in             += count;
+            n              -= count;
+        }
+    }
+
     void FilterBank::impulse_response(float *out, size_t samples)
     {
         // Backup and clean all delays
@@ -25,6 +25,11 @@ namespace lsp
             return false;
         }
 
+        bool IExecutor::cancel(ITask *task)
+        {
+            return false;
+        }
+
         void IExecutor::shutdown()
         {
         }
@@ -16,6 +16,7 @@ namespace lsp
         {
             nState  = TS_IDLE;
             nCode   = 0;
+            nPriority = TP_NORMAL;
             pNext   = NULL;
         }
 
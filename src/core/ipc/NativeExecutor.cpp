@@ -57,6 +57,42 @@ namespace lsp
             return true;
         }
 
+        bool NativeExecutor::cancel(ITask *task)
+        {
+            // Check task state
+            if (task->idle())
+                return true;
+            else if (!task->submitted())
+                return false;
+
+            // Acquire critical section
+            while (!atomic_trylock(nLock))
+                ipc::Thread::yield();
+
+            // Remove task from the queue if it is still there
+            bool found      = false;
+            for (ITask *prev = NULL, *curr = pHead; curr != NULL; prev = curr, curr = peek_task(curr))
+            {
+                if (curr != task)
+                    continue;
+
+                if (prev != NULL)
+                    unlink_task(prev, task);
+                else
+                    pHead           = next_task(task);
+                if (pTail == task)
+                    pTail           = prev;
+
+                change_task_state(task, ITask::TS_IDLE);
+                found           = true;
+                break;
+            }
+
+            // Release critical section
+            atomic_unlock(nLock);
+            return found;
+        }
+
         void NativeExecutor::shutdown()
         {
             lsp_trace("start shutdown");
@@ -13,6 +13,10 @@
 #include <errno.h>
 #include <unistd.h>
 
+#ifndef PLATFORM_WINDOWS
+    #include <sched.h>
+#endif /* PLATFORM_WINDOWS */
+
 namespace lsp
 {
     namespace ipc
@@ -190,6 +194,11 @@ namespace lsp
             return STATUS_OK;
         }
 
+        void Thread::yield()
+        {
+            SwitchToThread();
+        }
+
         size_t Thread::system_cores()
         {
             SYSTEM_INFO     os_sysinfo;
@@ -303,6 +312,11 @@ namespace lsp
             return STATUS_OK;
         }
 
+        void Thread::yield()
+        {
+            ::sched_yield();
+        }
+
         size_t Thread::system_cores()
         {
             return sysconf(_SC_NPROCESSORS_ONLN);
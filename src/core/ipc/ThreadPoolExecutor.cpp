@@ -0,0 +1,329 @@
+/*
+ * ThreadPoolExecutor.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <core/debug.h>
+#include <core/ipc/ThreadPoolExecutor.h>
+
+namespace lsp
+{
+    namespace ipc
+    {
+        ThreadPoolExecutor::ThreadPoolExecutor()
+        {
+            vWorkers    = NULL;
+            nWorkers    = 0;
+            nNext       = 0;
+            nPending    = 0;
+        }
+
+        ThreadPoolExecutor::~ThreadPoolExecutor()
+        {
+            destroy();
+        }
+
+        void ThreadPoolExecutor::destroy()
+        {
+            if (vWorkers == NULL)
+                return;
+
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                worker_t *w     = &vWorkers[i];
+                if (w->pThread != NULL)
+                {
+                    delete w->pThread;
+                    w->pThread      = NULL;
+                }
+            }
+
+            delete [] vWorkers;
+            vWorkers    = NULL;
+            nWorkers    = 0;
+        }
+
+        status_t ThreadPoolExecutor::start(size_t workers)
+        {
+            if (vWorkers != NULL)
+                return STATUS_BAD_STATE;
+
+            // Estimate number of workers
+            if (workers <= 0)
+            {
+                workers         = Thread::system_cores();
+                if (workers > THREAD_POOL_DFL_WORKERS)
+                    workers         = THREAD_POOL_DFL_WORKERS;
+            }
+            if (workers <= 0)
+                workers         = 1;
+            else if (workers > THREAD_POOL_MAX_WORKERS)
+                workers         = THREAD_POOL_MAX_WORKERS;
+
+            // Allocate workers
+            vWorkers        = new worker_t[workers];
+            if (vWorkers == NULL)
+                return STATUS_NO_MEM;
+            nWorkers        = workers;
+
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                worker_t *w     = &vWorkers[i];
+
+                w->pExecutor    = this;
+                w->pThread      = NULL;
+                atomic_init(w->nLock);
+                for (size_t j=0; j<ITask::TP_TOTAL; ++j)
+                {
+                    w->vQueues[j].pHead = NULL;
+                    w->vQueues[j].pTail = NULL;
+                }
+                w->nExecuted    = 0;
+                w->nStolen      = 0;
+            }
+
+            // Create threads
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                worker_t *w     = &vWorkers[i];
+                w->pThread      = new Thread(execute, w);
+                if (w->pThread == NULL)
+                {
+                    shutdown();
+                    return STATUS_NO_MEM;
+                }
+            }
+
+            // Launch threads
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                status_t res    = vWorkers[i].pThread->start();
+                if (res != STATUS_OK)
+                {
+                    shutdown();
+                    return res;
+                }
+            }
+
+            lsp_trace("Started thread pool executor with %d workers", int(nWorkers));
+            return STATUS_OK;
+        }
+
+        size_t ThreadPoolExecutor::executed(size_t worker) const
+        {
+            return (worker < nWorkers) ? vWorkers[worker].nExecuted : 0;
+        }
+
+        size_t ThreadPoolExecutor::stolen(size_t worker) const
+        {
+            return (worker < nWorkers) ? vWorkers[worker].nStolen : 0;
+        }
+
+        bool ThreadPoolExecutor::submit(ITask *task)
+        {
+            lsp_trace("submit task=%p", task);
+
+            // Check executor and task state
+            if ((vWorkers == NULL) || (!task->idle()))
+                return false;
+
+            // Select the worker in round-robin manner and try to submit task
+            // to it's queue. If the queue is locked, try the next worker.
+            // This never blocks the caller.
+            size_t first    = atomic_add(&nNext, 1);
+            size_t priority = task->priority();
+
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                worker_t *w     = &vWorkers[(first + i) % nWorkers];
+                if (!atomic_trylock(w->nLock))
+                    continue;
+
+                // Update task state to SUBMITTED
+                atomic_add(&nPending, 1);
+                change_task_state(task, ITask::TS_SUBMITTED);
+
+                // Critical section acquired, bind new task
+                queue_t *q      = &w->vQueues[priority];
+                if (q->pTail != NULL)
+                    link_task(q->pTail, task);
+                else
+                    q->pHead        = task;
+                q->pTail        = task;
+
+                // Release critical section
+                atomic_unlock(w->nLock);
+                return true;
+            }
+
+            return false;
+        }
+
+        bool ThreadPoolExecutor::cancel(ITask *task)
+        {
+            // Check executor and task state
+            if (task->idle())
+                return true;
+            else if ((vWorkers == NULL) || (!task->submitted()))
+                return false;
+
+            // The task is not known to be in a particular queue, lookup all queues
+            // of the same priority. Workers take the task from the queue under lock,
+            // so the task that is not found is already running or about to run
+            size_t priority = task->priority();
+
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                worker_t *w     = &vWorkers[i];
+                queue_t *q      = &w->vQueues[priority];
+
+                // Fast check without acquiring lock
+                if (q->pHead == NULL)
+                    continue;
+                while (!atomic_trylock(w->nLock))
+                    ipc::Thread::yield();
+
+                // Remove task from queue
+                for (ITask *prev = NULL, *curr = q->pHead; curr != NULL; prev = curr, curr = peek_task(curr))
+                {
+                    if (curr != task)
+                        continue;
+
+                    if (prev != NULL)
+                        unlink_task(prev, task);
+                    else
+                        q->pHead        = next_task(task);
+                    if (q->pTail == task)
+                        q->pTail        = prev;
+
+                    change_task_state(task, ITask::TS_IDLE);
+                    atomic_add(&nPending, -1);
+                    atomic_unlock(w->nLock);
+                    return true;
+                }
+
+                // Release critical section
+                atomic_unlock(w->nLock);
+            }
+
+            return false;
+        }
+
+        void ThreadPoolExecutor::shutdown()
+        {
+            lsp_trace("start shutdown");
+            if (vWorkers == NULL)
+                return;
+
+            // Wait until all submitted tasks have been completed
+            while (nPending > 0)
+                ipc::Thread::sleep(THREAD_POOL_IDLE_MAX);
+
+            // Now there are no pending tasks, terminate threads
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                Thread *t       = vWorkers[i].pThread;
+                if (t != NULL)
+                    t->cancel();
+            }
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                Thread *t       = vWorkers[i].pThread;
+                if ((t != NULL) && (t->state() != TS_CREATED))
+                    t->join();
+            }
+
+            destroy();
+
+            lsp_trace("shutdown complete");
+        }
+
+        ITask *ThreadPoolExecutor::pop_task(worker_t *w, size_t priority)
+        {
+            queue_t *q      = &w->vQueues[priority];
+
+            // Fast check without acquiring lock
+            if (q->pHead == NULL)
+                return NULL;
+            if (!atomic_trylock(w->nLock))
+                return NULL;
+
+            // Remove task from queue
+            ITask *task     = q->pHead;
+            if (task != NULL)
+            {
+                q->pHead        = next_task(task);
+                if (q->pHead == NULL)
+                    q->pTail        = NULL;
+            }
+
+            // Release critical section
+            atomic_unlock(w->nLock);
+            return task;
+        }
+
+        ITask *ThreadPoolExecutor::fetch_task(worker_t *w)
+        {
+            size_t self     = w - vWorkers;
+
+            for (size_t i=0; i<ITask::TP_TOTAL; ++i)
+            {
+                // Lookup own queue first
+                ITask *task     = pop_task(w, i);
+                if (task != NULL)
+                    return task;
+
+                // Try to steal task of the same priority from other workers
+                for (size_t j=1; j<nWorkers; ++j)
+                {
+                    task            = pop_task(&vWorkers[(self + j) % nWorkers], i);
+                    if (task != NULL)
+                    {
+                        ++w->nStolen;
+                        return task;
+                    }
+                }
+            }
+
+            return NULL;
+        }
+
+        void ThreadPoolExecutor::run(worker_t *w)
+        {
+            wsize_t delay   = THREAD_POOL_IDLE_MIN;
+
+            while (!ipc::Thread::is_cancelled())
+            {
+                ITask *task     = fetch_task(w);
+                if (task == NULL)
+                {
+                    // Wait for a while, increase the delay while there is nothing to do
+                    if (ipc::Thread::sleep(delay) == STATUS_CANCELLED)
+                        return;
+                    delay     <<= 1;
+                    if (delay > THREAD_POOL_IDLE_MAX)
+                        delay       = THREAD_POOL_IDLE_MAX;
+                    continue;
+                }
+
+                // Execute task
+                lsp_trace("executing task %p", task);
+                run_task(task);
+                lsp_trace("executed task %p with code %d", task, int(task->code()));
+
+                ++w->nExecuted;
+                atomic_add(&nPending, -1);
+                delay           = THREAD_POOL_IDLE_MIN;
+            }
+        }
+
+        status_t ThreadPoolExecutor::execute(void *params)
+        {
+            worker_t *w     = reinterpret_cast<worker_t *>(params);
+            w->pExecutor->run(w);
+            return STATUS_OK;
+        }
+    }
+}
@@ -18,6 +18,7 @@ namespace lsp
         nLength     = 0;
         nMaxLength  = 0;
         nChannels   = 0;
+        pStream     = NULL;
     }
 
     Sample::~Sample()
@@ -117,6 +118,7 @@ namespace lsp
         ::swap(nMaxLength, dst->nMaxLength);
         ::swap(nLength, dst->nLength);
         ::swap(nChannels, dst->nChannels);
+        ::swap(pStream, dst->pStream);
     }
 
 } /* namespace lsp */
@@ -7,11 +7,71 @@
 
 #include <dsp/dsp.h>
 #include <core/debug.h>
+#include <core/fade.h>
+#include <core/sugar.h>
+#include <core/windows.h>
 #include <core/sampling/SamplePlayer.h>
 
+#define PITCH_BUFFER_SIZE       256
+#define PITCH_RATE_MIN          0.125f
+#define PITCH_RATE_MAX          8.0f
+#define PITCH_KERNEL_LOBES      14      /* Half-length of anti-aliasing kernel in output samples */
+#define PITCH_KERNEL_SIZE       (size_t(PITCH_KERNEL_LOBES * PITCH_RATE_MAX) * 2 + 4)
+#define PITCH_DECIM_SIZE        (PITCH_BUFFER_SIZE * 2 + 8)
+#define PITCH_FETCH_SIZE        (PITCH_DECIM_SIZE * size_t(PITCH_RATE_MAX) + PITCH_KERNEL_SIZE)
+
 namespace lsp
 {
-    SamplePlayer::SamplePlayer()
+    static inline size_t pitch_kernel_half(float rate)
+    {
+        return ceilf(PITCH_KERNEL_LOBES * rate);
+    }
+
+    static inline ssize_t pitch_history(float rate)
+    {
+        // Number of source samples before the current position required for interpolation
+        return (rate > 1.0f) ? ssize_t(rate) * 2 + ssize_t(pitch_kernel_half(rate)) + 1 : 1;
+    }
+
+    static inline ssize_t consumed_samples(ssize_t offset, float rate)
+    {
+        // Position of the first source sample that is still required by the playback
+        return (rate != 1.0f) ? ssize_t(double(offset) * rate) - pitch_history(rate) : offset;
+    }
+
+    static inline ssize_t stream_length(Sample *s)
+    {
+        // Length of the sample including the data provided by the stream
+        SampleStream *ss    = s->stream();
+        ssize_t s_len       = s->length();
+        return ((ss != NULL) && (ssize_t(ss->length()) > s_len)) ? ss->length() : s_len;
+    }
+
+    SamplePlayer::StreamTask::StreamTask(SamplePlayer *player)
+    {
+        pPlayer     = player;
+        set_priority(TP_HIGH);
+    }
+
+    SamplePlayer::StreamTask::~StreamTask()
+    {
+        pPlayer     = NULL;
+    }
+
+    status_t SamplePlayer::StreamTask::run()
+    {
+        // Initialize DSP context
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+
+        pPlayer->fill_streams();
+
+        // Finalize DSP context and return result
+        dsp::finish(&ctx);
+        return STATUS_OK;
+    }
+
+    SamplePlayer::SamplePlayer(): sTask(this)
     {
         vSamples        = NULL;
         nSamples        = 0;
@@ -22,8 +82,21 @@ namespace lsp
         sInactive.pHead = NULL;
         sInactive.pTail = NULL;
         fGain           = 1.0f;
+
+        vStreams        = NULL;
+        nStreams        = 0;
+        nStreamTop      = 0;
+        nStreamBuffer   = 0;
+        nUnderruns      = 0;
+        vBuffer         = NULL;
+        vFetch          = NULL;
+        vDecim          = NULL;
+        vKernel         = NULL;
+        fKernelRate     = 0.0f;
+        nKernelHalf     = 0;
+        pData           = NULL;
     }
-    
+
     SamplePlayer::~SamplePlayer()
     {
         destroy(true);
@@ -100,23 +173,95 @@ namespace lsp
         prev->pNext         = pb;
     }
 
+    inline void SamplePlayer::release_stream(playback_t *pb)
+    {
+        stream_t *st        = pb->pStream;
+        if (st == NULL)
+            return;
+
+        // The slot may be still accessed by the I/O task, it will be recycled later
+        st->nState          = SS_RELEASED;
+        pb->pStream         = NULL;
+    }
+
     inline void SamplePlayer::cleanup(playback_t *pb)
     {
+        release_stream(pb);
         pb->pSample         = NULL;
         pb->nID             = -1;
         pb->nChannel        = 0;
         pb->nFadeout        = -1;
         pb->nFadeOffset     = 0;
         pb->nVolume         = 0.0f;
+        pb->fRate           = 1.0f;
         pb->nOffset         = 0;
     }
 
-    bool SamplePlayer::init(size_t max_samples, size_t max_playbacks)
+    bool SamplePlayer::init(size_t max_samples, size_t max_playbacks, size_t max_streams, size_t stream_buffer)
     {
         // Check arguments
         if ((max_samples <= 0) || (max_playbacks <= 0))
             return false;
 
+        // Compute the size of ring buffer of stream slots, it should be power of 2
+        size_t buf_size     = 0;
+        if ((max_streams > 0) && (stream_buffer > 0))
+        {
+            buf_size            = DEFAULT_ALIGN / sizeof(float);
+            while (buf_size < stream_buffer)
+                buf_size          <<= 1;
+        }
+        else
+            max_streams         = 0;
+
+        // Allocate buffers for interpolation, ring buffers are allocated by the I/O task
+        float *ptr          = alloc_aligned<float>(pData,
+                PITCH_BUFFER_SIZE + PITCH_FETCH_SIZE + PITCH_DECIM_SIZE + PITCH_KERNEL_SIZE);
+        if (ptr == NULL)
+            return false;
+
+        vBuffer             = ptr;
+        ptr                += PITCH_BUFFER_SIZE;
+        vFetch              = ptr;
+        ptr                += PITCH_FETCH_SIZE;
+        vDecim              = ptr;
+        ptr                += PITCH_DECIM_SIZE;
+        vKernel             = ptr;
+        ptr                += PITCH_KERNEL_SIZE;
+        fKernelRate         = 0.0f;
+        nKernelHalf         = 0;
+
+        // Allocate stream slots
+        if (max_streams > 0)
+        {
+            vStreams            = new stream_t[max_streams];
+            if (vStreams == NULL)
+            {
+                free_aligned(pData);
+                return false;
+            }
+
+            for (size_t i=0; i<max_streams; ++i)
+            {
+                stream_t *st        = &vStreams[i];
+                st->pStream         = NULL;
+                st->nChannel        = 0;
+                st->nHead           = 0;
+                st->nStart          = 0;
+                st->nLength         = 0;
+                st->nFadeIn         = 0;
+                st->nFadeOut        = 0;
+                st->nRead           = 0;
+                st->nWrite          = 0;
+                st->nState          = SS_FREE;
+                st->vData           = NULL;
+                st->pData           = NULL;
+            }
+
+            nStreams            = max_streams;
+            nStreamBuffer       = buf_size;
+        }
+
         // Allocate array of samples
         vSamples            = new Sample *[max_samples];
         if (vSamples == NULL)
@@ -149,6 +294,7 @@ namespace lsp
             playback_t *curr = &vPlayback[i];
 
             // Initialize fields
+            curr->pStream   = NULL;
             cleanup(curr);
 
             // Link
@@ -200,6 +346,24 @@ namespace lsp
         sActive.pTail   = NULL;
         sInactive.pHead = NULL;
         sInactive.pTail = NULL;
+
+        if (vStreams != NULL)
+        {
+            for (size_t i=0; i<nStreams; ++i)
+                free_aligned(vStreams[i].pData);
+            delete [] vStreams;
+            vStreams        = NULL;
+        }
+        free_aligned(pData);
+        vBuffer         = NULL;
+        vFetch          = NULL;
+        vDecim          = NULL;
+        vKernel         = NULL;
+        fKernelRate     = 0.0f;
+        nKernelHalf     = 0;
+        nStreams        = 0;
+        nStreamTop      = 0;
+        nStreamBuffer   = 0;
     }
 
     bool SamplePlayer::bind(size_t id, Sample **sample)
@@ -213,6 +377,14 @@ namespace lsp
             Sample     *ns  = *sample;
             if (old == ns)
             {
+                // The stream of the sample may be changed, stream slots will be
+                // re-assigned to the playbacks on the next submit() call
+                for (playback_t *pb = sActive.pHead; pb != NULL; pb = pb->pNext)
+                {
+                    if (pb->pSample == old)
+                        release_stream(pb);
+                }
+
                 *sample     = NULL;
                 return true;
             }
@@ -228,6 +400,7 @@ namespace lsp
             playback_t *next    = pb->pNext;
             if (pb->pSample == old)
             {
+                release_stream(pb);
                 pb->pSample     = NULL;
                 list_remove(&sActive, pb);
                 list_add_first(&sInactive, pb);
@@ -278,6 +451,229 @@ namespace lsp
         do_process(dst, samples);
     }
 
+    void SamplePlayer::add_samples(playback_t *pb, float *dst, const float *src, size_t count)
+    {
+        float gain          = pb->nVolume * fGain;
+
+        if (pb->nFadeout < 0)
+        {
+            if (src != NULL)
+                dsp::fmadd_k3(dst, src, gain, count);
+            return;
+        }
+
+        ssize_t fade_head   = pb->nFadeOffset;
+        float fgain         = gain / (pb->nFadeout + 1);
+
+        if (src == NULL)
+        {
+            // Silence, just update the fadeout position
+            if (fade_head < pb->nFadeout)
+                pb->nFadeOffset     = lsp_min(fade_head + ssize_t(count), pb->nFadeout);
+            return;
+        }
+
+        for (size_t i=0; (i<count) && (fade_head < pb->nFadeout); ++i, ++fade_head)
+        {
+            if (fade_head < 0)
+                *(dst++)       += *(src++) * gain;
+            else
+                *(dst++)       += *(src++) * fgain * (pb->nFadeout - fade_head);
+        }
+
+        pb->nFadeOffset     = fade_head;
+    }
+
+    void SamplePlayer::stream_samples(playback_t *pb, float *dst, size_t offset, size_t count)
+    {
+        stream_t *st        = pb->pStream;
+
+        // The data between the sample and the stream is not available
+        if (offset < st->nStart)
+        {
+            size_t n            = lsp_min(count, st->nStart - offset);
+            add_samples(pb, dst, NULL, n);
+            dst                += n;
+            offset             += n;
+            count              -= n;
+        }
+
+        // Read the data from the ring buffer
+        size_t pos          = offset - st->nStart;
+        size_t tail         = atomic_add(&st->nWrite, 0);
+        size_t avail        = (tail > pos) ? tail - pos : 0;
+
+        while ((count > 0) && (avail > 0))
+        {
+            size_t off          = pos & (nStreamBuffer - 1);
+            size_t n            = lsp_min(lsp_min(count, avail), nStreamBuffer - off);
+            add_samples(pb, dst, &st->vData[off], n);
+            dst                += n;
+            pos                += n;
+            avail              -= n;
+            count              -= n;
+        }
+
+        // Underrun: the I/O task did not provide the data in time
+        if (count > 0)
+        {
+            add_samples(pb, dst, NULL, count);
+            ++nUnderruns;
+        }
+    }
+
+    void SamplePlayer::fetch_samples(playback_t *pb, float *dst, ssize_t offset, size_t count)
+    {
+        Sample *s           = pb->pSample;
+        stream_t *st        = pb->pStream;
+        ssize_t s_len       = s->length();
+        ssize_t p_len       = (st != NULL) ? st->nLength : stream_length(s);
+
+        // Silence before the sample
+        if (offset < 0)
+        {
+            size_t n            = lsp_min(count, size_t(-offset));
+            dsp::fill_zero(dst, n);
+            dst                += n;
+            offset             += n;
+            count              -= n;
+        }
+
+        // Data stored in the sample
+        if ((count > 0) && (offset < s_len))
+        {
+            size_t n            = lsp_min(count, size_t(s_len - offset));
+            dsp::copy(dst, s->getBuffer(pb->nChannel, offset), n);
+            dst                += n;
+            offset             += n;
+            count              -= n;
+        }
+
+        // The stream slot is not assigned to the playback yet
+        if ((count > 0) && (st == NULL) && (offset < p_len))
+        {
+            size_t n            = lsp_min(count, size_t(p_len - offset));
+            dsp::fill_zero(dst, n);
+            dst                += n;
+            count              -= n;
+            ++nUnderruns;
+        }
+
+        // Data provided by the stream
+        if ((count > 0) && (st != NULL) && (offset < p_len))
+        {
+            size_t n            = lsp_min(count, size_t(p_len - offset));
+            count              -= n;
+
+            // The data between the sample and the stream is not available
+            if (offset < ssize_t(st->nStart))
+            {
+                size_t k            = lsp_min(n, st->nStart - offset);
+                dsp::fill_zero(dst, k);
+                dst                += k;
+                offset             += k;
+                n                  -= k;
+            }
+
+            // Read the data from the ring buffer
+            size_t pos          = offset - st->nStart;
+            size_t tail         = atomic_add(&st->nWrite, 0);
+            size_t avail        = (tail > pos) ? tail - pos : 0;
+
+            while ((n > 0) && (avail > 0))
+            {
+                size_t off          = pos & (nStreamBuffer - 1);
+                size_t k            = lsp_min(lsp_min(n, avail), nStreamBuffer - off);
+                dsp::copy(dst, &st->vData[off], k);
+                dst                += k;
+                pos                += k;
+                avail              -= k;
+                n                  -= k;
+            }
+
+            // Underrun: the I/O task did not provide the data in time
+            if (n > 0)
+            {
+                dsp::fill_zero(dst, n);
+                dst                += n;
+                ++nUnderruns;
+            }
+        }
+
+        // Silence after the sample
+        if (count > 0)
+            dsp::fill_zero(dst, count);
+    }
+
+    void SamplePlayer::design_kernel(float rate)
+    {
+        if (fKernelRate == rate)
+            return;
+
+        // Windowed sinc with the cut-off frequency at the Nyquist frequency of the output
+        size_t half         = pitch_kernel_half(rate);
+        size_t len          = half * 2 + 1;
+        float k             = M_PI / rate;
+        float sum           = 0.0f;
+
+        windows::window(vKernel, len, windows::BLACKMAN_HARRIS);
+        for (size_t i=0; i<len; ++i)
+        {
+            ssize_t off         = ssize_t(i) - ssize_t(half);
+            if (off != 0)
+                vKernel[i]         *= sinf(off * k) / (off * k);
+            sum                += vKernel[i];
+        }
+        dsp::mul_k2(vKernel, 1.0f / sum, len);
+
+        fKernelRate         = rate;
+        nKernelHalf         = half;
+    }
+
+    void SamplePlayer::pitch_samples(playback_t *pb, float *dst, size_t offset, size_t count)
+    {
+        float rate          = pb->fRate;
+
+        // The cubic interpolation does not band-limit the signal. When pitching up,
+        // each step-th sample of the source signal is computed with anti-aliasing
+        // filter, so the interpolated signal is sampled with step less than 2
+        size_t step         = (rate > 1.0f) ? size_t(rate) : 1;
+        float drate         = rate / step;
+        if (rate > 1.0f)
+            design_kernel(rate);
+
+        while (count > 0)
+        {
+            // Compute the position of the first sample in the (decimated) source signal
+            size_t n            = lsp_min(count, size_t(PITCH_BUFFER_SIZE));
+            double x            = double(offset) * drate;
+            ssize_t head        = x;
+            float pos           = x - head;
+
+            // Fetch one sample before and two samples after the interpolated range
+            // and interpolate the data
+            size_t span         = size_t(pos + (n - 1) * drate) + 5;
+            if (rate > 1.0f)
+            {
+                size_t len          = nKernelHalf * 2 + 1;
+                fetch_samples(pb, vFetch, (head - 1) * ssize_t(step) - ssize_t(nKernelHalf), (span - 1) * step + len);
+                for (size_t i=0; i<span; ++i)
+                    vDecim[i]           = dsp::h_dotp(&vFetch[i * step], vKernel, len);
+                dsp::cubic_interpolate(vBuffer, vDecim, pos + 1.0f, drate, n);
+            }
+            else
+            {
+                fetch_samples(pb, vFetch, head - 1, span);
+                dsp::cubic_interpolate(vBuffer, vFetch, pos + 1.0f, drate, n);
+            }
+            add_samples(pb, dst, vBuffer, n);
+
+            dst                += n;
+            offset             += n;
+            count              -= n;
+        }
+    }
+
     void SamplePlayer::do_process(float *dst, size_t samples)
     {
         playback_t *pb      = sActive.pHead;
@@ -292,7 +688,11 @@ namespace lsp
             ssize_t src_head    = pb->nOffset;
             pb->nOffset        += samples;
             Sample *s           = pb->pSample;
+            stream_t *st        = pb->pStream;
             ssize_t s_len       = s->length();
+            ssize_t p_len       = (st != NULL) ? st->nLength : stream_length(s);
+            bool pitched        = pb->fRate != 1.0f;
+            ssize_t o_len       = (pitched) ? ssize_t(ceil(p_len / double(pb->fRate))) : p_len;
 
             // Handle sample if active
             if (pb->nOffset > 0)
@@ -307,38 +707,48 @@ namespace lsp
                     dst_off     = samples - pb->nOffset;
                     count       = pb->nOffset;
                 }
-                if (pb->nOffset > s_len)
-                    count      += s_len - pb->nOffset;
+                if (pb->nOffset > o_len)
+                    count      += o_len - pb->nOffset;
 
+                // Add interpolated sample data to the output buffer
+                if ((count > 0) && (pitched))
+                    pitch_samples(pb, &dst[dst_off], src_head, count);
                 // Add sample data to the output buffer
-                if (count > 0)
+                else if (count > 0)
                 {
 //                    lsp_trace("add_multiplied dst_off=%d, src_head=%d, volume=%f, count=%d", int(dst_off), int(src_head), pb->nVolume, int(count));
-                    if (pb->nFadeout < 0)
-                        dsp::fmadd_k3(&dst[dst_off], s->getBuffer(pb->nChannel, src_head), pb->nVolume * fGain, count);
-                    else
+                    float *dp           = &dst[dst_off];
+
+                    // Data stored in the sample
+                    if (src_head < s_len)
+                    {
+                        ssize_t n           = lsp_min(count, s_len - src_head);
+                        add_samples(pb, dp, s->getBuffer(pb->nChannel, src_head), n);
+                        dp                 += n;
+                        src_head           += n;
+                        count              -= n;
+                    }
+
+                    // Data provided by the stream
+                    if ((count > 0) && (st != NULL))
+                        stream_samples(pb, dp, src_head, count);
+                    // The stream slot is not assigned to the playback yet
+                    else if (count > 0)
                     {
-                        ssize_t fade_head   = pb->nFadeOffset;
-                        float gain          = pb->nVolume * fGain;
-                        float *sp           = s->getBuffer(pb->nChannel, src_head);
-                        float *dp           = &dst[dst_off];
-
-                        float fgain         = gain / (pb->nFadeout + 1);
-                        for (ssize_t i=0; (i<count) && (fade_head < pb->nFadeout); ++i, ++fade_head)
-                        {
-                            if (fade_head < 0)
-                                *(dp++)        += *(sp++) * gain;
-                            else
-                                *(dp++)        += *(sp++) * fgain * (pb->nFadeout - fade_head);
-                        }
-
-                        pb->nFadeOffset     = fade_head;
+                        add_samples(pb, dp, NULL, count);
+                        ++nUnderruns;
                     }
                 }
+
+                // Notify the I/O task about consumed data, the interpolation
+                // needs previous samples of the source signal
+                ssize_t consumed    = consumed_samples(pb->nOffset, pb->fRate);
+                if ((st != NULL) && (consumed > ssize_t(st->nStart)))
+                    atomic_swap(&st->nRead, uatomic_t(lsp_min(consumed, p_len) - st->nStart));
             }
 
             // Check that there are no samples to process in the future
-            if ((pb->nOffset >= s_len) ||
+            if ((pb->nOffset >= o_len) ||
                 ((pb->nFadeout >= 0) && (pb->nFadeOffset >= pb->nFadeout)))
             {
                 // Cleanup playback
@@ -356,7 +766,7 @@ namespace lsp
         }
     }
 
-    bool SamplePlayer::play(size_t id, size_t channel, float volume, ssize_t delay)
+    bool SamplePlayer::play(size_t id, size_t channel, float volume, ssize_t delay, float rate)
     {
         // Check that ID of the sample is correct
         if (id >= nSamples)
@@ -377,6 +787,7 @@ namespace lsp
             pb              = list_remove_first(&sActive);
         if (pb == NULL)
             return false;
+        release_stream(pb);
 
 //        lsp_trace("acquired playback %p", pb);
 
@@ -385,6 +796,7 @@ namespace lsp
         pb->nID         = id;
         pb->nChannel    = channel;
         pb->nVolume     = volume;
+        pb->fRate       = lsp_max(lsp_min(rate, PITCH_RATE_MAX), PITCH_RATE_MIN);
         pb->nOffset     = -delay;
         pb->nFadeout    = -1;  // No fadeout
         pb->nFadeOffset = -1; // No cancellation
@@ -463,4 +875,125 @@ namespace lsp
         sActive.pHead       = NULL;
         sActive.pTail       = NULL;
     }
+
+    bool SamplePlayer::idle()
+    {
+        if (sTask.completed())
+            sTask.reset();
+        return sTask.idle();
+    }
+
+    bool SamplePlayer::submit(ipc::IExecutor *executor)
+    {
+        if ((nStreams <= 0) || (!idle()))
+            return false;
+
+        // The I/O task is idle, recycle released stream slots
+        size_t active       = 0;
+        for (size_t i=0; i<nStreamTop; ++i)
+        {
+            stream_t *st        = &vStreams[i];
+            if (st->nState == SS_RELEASED)
+            {
+                st->pStream         = NULL;
+                st->nState          = SS_FREE;
+            }
+            else if (st->nState == SS_ACTIVE)
+                ++active;
+        }
+
+        // Assign stream slots to the playbacks that need them
+        stream_t *st        = vStreams;
+        stream_t *last      = &vStreams[nStreams];
+        for (playback_t *pb = sActive.pHead; pb != NULL; pb = pb->pNext)
+        {
+            if (pb->pStream != NULL)
+                continue;
+
+            // The stream should provide the data beyond the sample, until the slot
+            // is assigned the playback gets silence and underruns instead of the data
+            Sample *s           = pb->pSample;
+            SampleStream *ss    = s->stream();
+            ssize_t s_len       = s->length();
+            ssize_t consumed    = consumed_samples(pb->nOffset, pb->fRate);
+            if ((ss == NULL) || (ssize_t(ss->length()) <= s_len) || (consumed >= ssize_t(ss->length())))
+                continue;
+
+            // Find free slot
+            while ((st < last) && (st->nState != SS_FREE))
+                ++st;
+            if (st >= last)
+                break;
+
+            st->pStream         = ss;
+            st->nChannel        = pb->nChannel;
+            st->nHead           = ss->head();
+            st->nStart          = s_len;
+            st->nLength         = ss->length();
+            st->nFadeIn         = ss->fade_in();
+            st->nFadeOut        = ss->fade_out();
+            st->nRead           = (consumed > s_len) ? consumed - s_len : 0; // Skip the data already played
+            st->nWrite          = st->nRead;
+            st->nState          = SS_ACTIVE;
+            pb->pStream         = st;
+            ++active;
+
+            // Slots are taken from the start of the list, track the range of used slots
+            size_t top          = (st - vStreams) + 1;
+            if (nStreamTop < top)
+                nStreamTop          = top;
+        }
+
+        return (active > 0) ? executor->submit(&sTask) : false;
+    }
+
+    void SamplePlayer::fill_streams()
+    {
+        for (size_t i=0; i<nStreamTop; ++i)
+        {
+            stream_t *st        = &vStreams[i];
+            if (st->nState != SS_ACTIVE)
+                continue;
+
+            // Allocate the ring buffer when the slot is used for the first time,
+            // the playback gets underruns until the allocation succeeds
+            if (st->vData == NULL)
+            {
+                st->vData           = alloc_aligned<float>(st->pData, nStreamBuffer);
+                if (st->vData == NULL)
+                    continue;
+            }
+
+            // The playback may skip the data on underrun
+            size_t head         = atomic_add(&st->nRead, 0);
+            size_t tail         = st->nWrite;
+            if (tail < head)
+                tail                = head;
+
+            size_t end          = lsp_min(head + nStreamBuffer, st->nLength - st->nStart);
+            while (tail < end)
+            {
+                size_t off          = tail & (nStreamBuffer - 1);
+                size_t n            = lsp_min(end - tail, nStreamBuffer - off);
+                size_t pos          = st->nStart + tail;
+                float *dst          = &st->vData[off];
+
+                // Read the data and apply fade-in and fade-out of the rendered sample
+                if (st->pStream->read(st->nChannel, dst, st->nHead + pos, n) < 0)
+                    dsp::fill_zero(dst, n);
+                fade_in(dst, dst, st->nFadeIn, pos, n);
+                fade_out(dst, dst, st->nFadeOut, st->nLength, pos, n);
+
+                tail               += n;
+                atomic_swap(&st->nWrite, uatomic_t(tail));
+            }
+        }
+    }
+
+    size_t SamplePlayer::fetch_underruns()
+    {
+        size_t underruns    = nUnderruns;
+        nUnderruns          = 0;
+        return underruns;
+    }
 } /* namespace lsp */
@@ -0,0 +1,214 @@
+/*
+ * SampleStream.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <core/debug.h>
+#include <core/units.h>
+#include <core/LSPString.h>
+#include <core/sampling/SampleStream.h>
+
+#ifndef PLATFORM_WINDOWS
+    #include <stdio.h>
+    #include <sndfile.h>
+#endif /* PLATFORM_WINDOWS */
+
+#define STREAM_BUFFER_FRAMES        1024
+
+namespace lsp
+{
+    SampleStream::SampleStream()
+    {
+        hHandle         = NULL;
+        nChannels       = 0;
+        nSampleRate     = 0;
+        nFrames         = 0;
+        vBuffer         = NULL;
+
+        nHead           = 0;
+        nLength         = 0;
+        nFadeIn         = 0;
+        nFadeOut        = 0;
+    }
+
+    SampleStream::~SampleStream()
+    {
+        close();
+    }
+
+#ifdef PLATFORM_WINDOWS
+    status_t SampleStream::open(const char *path, float max_duration)
+    {
+        // Streaming is not supported, the caller should load the whole file
+        return STATUS_NOT_SUPPORTED;
+    }
+
+    void SampleStream::close()
+    {
+        nChannels       = 0;
+        nSampleRate     = 0;
+        nFrames         = 0;
+    }
+
+    ssize_t SampleStream::read_frames(size_t offset, size_t count)
+    {
+        return -STATUS_NOT_SUPPORTED;
+    }
+#else
+    status_t SampleStream::open(const char *path, float max_duration)
+    {
+        if (path == NULL)
+            return STATUS_BAD_ARGUMENTS;
+        if (hHandle != NULL)
+            return STATUS_OPENED;
+
+        LSPString spath;
+        if (!spath.set_utf8(path))
+            return STATUS_NO_MEM;
+
+        // Open sound file
+        SF_INFO sf_info;
+        SNDFILE *sf_obj = sf_open(spath.get_native(), SFM_READ, &sf_info);
+        if (sf_obj == NULL)
+            return STATUS_NOT_SUPPORTED;
+        if ((!sf_info.seekable) || (sf_info.channels <= 0))
+        {
+            sf_close(sf_obj);
+            return STATUS_NOT_SUPPORTED;
+        }
+
+        // Allocate buffer for interleaved data
+        float *buf = new float[STREAM_BUFFER_FRAMES * sf_info.channels];
+        if (buf == NULL)
+        {
+            sf_close(sf_obj);
+            return STATUS_NO_MEM;
+        }
+
+        // Limit the number of frames
+        ssize_t max_samples     = (max_duration >= 0.0f) ? seconds_to_samples(sf_info.samplerate, max_duration) : -1;
+        if ((max_samples >= 0) && (sf_info.frames > sf_count_t(max_samples)))
+            sf_info.frames  = max_samples;
+
+        lsp_trace("opened stream: %s, frames=%d, channels=%d, sample_rate=%d",
+                path, int(sf_info.frames), int(sf_info.channels), int(sf_info.samplerate));
+
+        hHandle         = sf_obj;
+        vBuffer         = buf;
+        nChannels       = sf_info.channels;
+        nSampleRate     = sf_info.samplerate;
+        nFrames         = sf_info.frames;
+
+        return STATUS_OK;
+    }
+
+    void SampleStream::close()
+    {
+        sMutex.lock();
+
+        if (hHandle != NULL)
+        {
+            sf_close(reinterpret_cast<SNDFILE *>(hHandle));
+            hHandle         = NULL;
+        }
+
+        if (vBuffer != NULL)
+        {
+            delete [] vBuffer;
+            vBuffer         = NULL;
+        }
+
+        nChannels       = 0;
+        nSampleRate     = 0;
+        nFrames         = 0;
+
+        sMutex.unlock();
+    }
+
+    ssize_t SampleStream::read_frames(size_t offset, size_t count)
+    {
+        SNDFILE *sf_obj = reinterpret_cast<SNDFILE *>(hHandle);
+        if (sf_seek(sf_obj, offset, SEEK_SET) < 0)
+            return -STATUS_IO_ERROR;
+
+        sf_count_t amount = sf_readf_float(sf_obj, vBuffer, count);
+        return (amount < 0) ? -STATUS_IO_ERROR : amount;
+    }
+#endif /* PLATFORM_WINDOWS */
+
+    ssize_t SampleStream::read(size_t channel, float *dst, size_t offset, size_t count)
+    {
+        if (channel >= nChannels)
+            return -STATUS_BAD_ARGUMENTS;
+        return read_channels(&dst, channel, 1, offset, count);
+    }
+
+    ssize_t SampleStream::read(float **dst, size_t offset, size_t count)
+    {
+        return read_channels(dst, 0, nChannels, offset, count);
+    }
+
+    ssize_t SampleStream::read_channels(float **dst, size_t first, size_t channels, size_t offset, size_t count)
+    {
+        if (!sMutex.lock())
+            return -STATUS_UNKNOWN_ERR;
+
+        ssize_t done    = 0;
+        while (count > 0)
+        {
+            // Determine the number of frames to read
+            ssize_t to_read = (offset < nFrames) ? nFrames - offset : 0;
+            if (to_read > STREAM_BUFFER_FRAMES)
+                to_read         = STREAM_BUFFER_FRAMES;
+            if (to_read > ssize_t(count))
+                to_read         = count;
+
+            // Read the data
+            ssize_t amount  = (to_read > 0) ? read_frames(offset, to_read) : 0;
+            if (amount < 0)
+            {
+                sMutex.unlock();
+                return amount;
+            }
+            else if (amount == 0) // End of file: fill the rest with zeros
+            {
+                for (size_t i=0; i<channels; ++i)
+                    if (dst[i] != NULL)
+                        dsp::fill_zero(&dst[i][done], count);
+                break;
+            }
+
+            // De-interleave the data
+            for (size_t i=0; i<channels; ++i)
+            {
+                float *p        = dst[i];
+                if (p == NULL)
+                    continue;
+
+                p              += done;
+                const float *s  = &vBuffer[first + i];
+                for (ssize_t j=0; j<amount; ++j, s += nChannels)
+                    p[j]            = *s;
+            }
+
+            done           += amount;
+            offset         += amount;
+            count          -= amount;
+        }
+
+        sMutex.unlock();
+        return done;
+    }
+
+    void SampleStream::set_window(size_t head, size_t length, size_t fade_in, size_t fade_out)
+    {
+        nHead           = head;
+        nLength         = length;
+        nFadeIn         = fade_in;
+        nFadeOut        = fade_out;
+    }
+
+} /* namespace lsp */
@@ -94,6 +94,7 @@ namespace lsp
             abuf               += fft_size;
 
             // Counters
+            c->nHead            = 0;
             c->nCounter         = 0;
             c->bFreeze          = false;
             c->bActive          = true;
@@ -134,11 +135,16 @@ namespace lsp
         if (nReconfigure & R_ANALYSIS)
         {
             for (size_t i=0; i<nChannels; ++i)
-                dsp::fill_zero(vChannels[i].vAmp, fft_size);
+            {
+                channel_t *c        = &vChannels[i];
+                dsp::fill_zero(c->vBuffer, fft_size);
+                dsp::fill_zero(c->vAmp, fft_size);
+                c->nHead            = 0;
+            }
         }
         // Update window
         if (nReconfigure & R_WINDOW)
-            windows::window(vWindow, fft_size, windows::window_t(nEnvelope));
+            windows::window(vWindow, fft_size, windows::window_t(nWindow));
         // Update reactivity
         if (nReconfigure & R_TAU)
             fTau    = 1.0f - expf(logf(1.0f - M_SQRT1_2) / seconds_to_samples(float(nSampleRate) / float(nFftPeriod), fReactivity));
@@ -157,19 +163,65 @@ namespace lsp
         nReconfigure    = 0;
     }
 
-    void Analyzer::process(size_t channel, const float *in, size_t samples)
+    void Analyzer::analyze_channel(channel_t *c)
     {
-        if ((vChannels == NULL) || (channel >= nChannels))
+        size_t fft_size     = 1 << nRank;
+        size_t fft_csize    = (fft_size >> 1) + 1;
+        size_t tail         = fft_size - c->nHead;
+
+        // Apply window to the ring buffer, the oldest sample is at the head position
+        dsp::mul3(vSigRe, &c->vBuffer[c->nHead], vWindow, tail);
+        if (c->nHead > 0)
+            dsp::mul3(&vSigRe[tail], c->vBuffer, &vWindow[tail], c->nHead);
+
+        // Do Real->complex conversion and FFT
+        dsp::pcomplex_r2c(vFftReIm, vSigRe, fft_size);
+        dsp::packed_direct_fft(vFftReIm, vFftReIm, nRank);
+        // Get complex argument
+        dsp::pcomplex_mod(vFftReIm, vFftReIm, fft_csize);
+        // Mix with the previous value
+        dsp::mix2(c->vAmp, vFftReIm, 1.0 - fTau, fTau, fft_csize);
+    }
+
+    void Analyzer::skip_channel(channel_t *c, const float *in, size_t samples)
+    {
+        // Frozen and inactive channels are not analyzed but still keep the ring buffer
+        // up to date, so the analysis resumes with actual data. Only the last FFT window
+        // of the input is stored since older samples would be overwritten anyway
+        size_t fft_size     = 1 << nRank;
+        size_t fft_mask     = fft_size - 1;
+        size_t to_copy      = (samples > fft_size) ? fft_size : samples;
+        size_t head         = (c->nHead + samples - to_copy) & fft_mask;
+        size_t count        = fft_size - head;
+        const float *src    = &in[samples - to_copy];
+
+        if (count > to_copy)
+            count               = to_copy;
+        dsp::copy(&c->vBuffer[head], src, count);
+        if (count < to_copy)
+            dsp::copy(c->vBuffer, &src[count], to_copy - count);
+        c->nHead            = (head + to_copy) & fft_mask;
+
+        // Keep the counter to preserve the phase of analysis between channels
+        c->nCounter        += samples;
+        if ((nFftPeriod <= 0) || (c->nCounter < nFftPeriod))
             return;
 
-        if (nReconfigure)
-            reconfigure();
+        if (!c->bFreeze)
+            dsp::fill_zero(c->vAmp, fft_size);
+        c->nCounter        %= nFftPeriod;
+    }
+
+    void Analyzer::process_channel(channel_t *c, const float *in, size_t samples)
+    {
+        if ((c->bFreeze) || (!bActive) || (!c->bActive))
+        {
+            skip_channel(c, in, samples);
+            return;
+        }
 
-        // Process single channel
-        // Get channel pointer
         size_t fft_size     = 1 << nRank;
-        ssize_t fft_csize   = (fft_size >> 1) + 1;
-        channel_t *c        = &vChannels[channel];
+        size_t fft_mask     = fft_size - 1;
 
         // Process signal by channel
         while (samples > 0)
@@ -178,46 +230,59 @@ namespace lsp
             ssize_t to_process  = nFftPeriod - c->nCounter;
             if (to_process <= 0)
             {
-                // Perform FFT only for active channels
-                if (!c->bFreeze)
-                {
-                    if ((bActive) && (c->bActive))
-                    {
-                        // Apply window to the temporary buffer
-                        dsp::mul3(vSigRe, c->vBuffer, vWindow, fft_size);
-                        // Do Real->complex conversion and FFT
-                        dsp::pcomplex_r2c(vFftReIm, vSigRe, fft_size);
-                        dsp::packed_direct_fft(vFftReIm, vFftReIm, nRank);
-                        // Get complex argument
-                        dsp::pcomplex_mod(vFftReIm, vFftReIm, fft_csize);
-                        // Mix with the previous value
-                        dsp::mix2(c->vAmp, vFftReIm, 1.0 - fTau, fTau, fft_csize);
-                    }
-                    else
-                        dsp::fill_zero(c->vAmp, fft_size);
-                }
-
-                // Update counter
+                // Perform FFT and update counter
+                analyze_channel(c);
                 c->nCounter        -= nFftPeriod;
+                continue;
             }
-            else
-            {
-                // Limit number of samples to be processed
-                if (to_process > ssize_t(samples))
-                    to_process      = samples;
-                // Add limitation of processed data according to the FFT window size
-                if (to_process > ssize_t(fft_size))
-                    to_process      = fft_size;
-
-                // Move data in the buffer
-                dsp::move(c->vBuffer, &c->vBuffer[to_process], fft_size - to_process);
-                dsp::copy(&c->vBuffer[fft_size - to_process], in, to_process);
-
-                // Update counter and pointers
-                c->nCounter        += to_process;
-                in                 += to_process;
-                samples            -= to_process;
-            }
+
+            // Limit number of samples to be processed
+            if (to_process > ssize_t(samples))
+                to_process      = samples;
+            // Add limitation of processed data according to the FFT window size
+            if (to_process > ssize_t(fft_size))
+                to_process      = fft_size;
+
+            // Append data to the ring buffer
+            size_t head         = c->nHead;
+            size_t count        = fft_size - head;
+            if (count > size_t(to_process))
+                count               = to_process;
+            dsp::copy(&c->vBuffer[head], in, count);
+            if (count < size_t(to_process))
+                dsp::copy(c->vBuffer, &in[count], to_process - count);
+            c->nHead            = (head + to_process) & fft_mask;
+
+            // Update counter and pointers
+            c->nCounter        += to_process;
+            in                 += to_process;
+            samples            -= to_process;
+        }
+    }
+
+    void Analyzer::process(size_t channel, const float *in, size_t samples)
+    {
+        if ((vChannels == NULL) || (channel >= nChannels))
+            return;
+
+        if (nReconfigure)
+            reconfigure();
+
+        process_channel(&vChannels[channel], in, samples);
+    }
+
+    void Analyzer::process(const float * const *in, size_t samples)
+    {
+        if (vChannels == NULL)
+            return;
+
+        if (nReconfigure)
+            reconfigure();
+
+        for (size_t i=0; i<nChannels; ++i)
+        {
+            if (in[i] != NULL)
+                process_channel(&vChannels[i], in[i], samples);
         }
     }
 
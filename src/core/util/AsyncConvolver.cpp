@@ -0,0 +1,246 @@
+/*
+ * AsyncConvolver.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <core/debug.h>
+#include <core/util/AsyncConvolver.h>
+
+namespace lsp
+{
+    AsyncConvolver::LateTask::LateTask(AsyncConvolver *core)
+    {
+        pCore       = core;
+        set_priority(TP_HIGH);
+    }
+
+    AsyncConvolver::LateTask::~LateTask()
+    {
+        pCore       = NULL;
+    }
+
+    status_t AsyncConvolver::LateTask::run()
+    {
+        // Initialize DSP context
+        dsp::context_t ctx;
+        dsp::start(&ctx);
+
+        status_t res = pCore->process_late();
+
+        // Finalize DSP context and return result
+        dsp::finish(&ctx);
+        return res;
+    }
+
+    AsyncConvolver::AsyncConvolver(): sTask(this)
+    {
+        vInBuf          = NULL;
+        vOutBuf         = NULL;
+        nCapacity       = 0;
+        nDelay          = 0;
+        nConvSize       = 0;
+        nWritePos       = 0;
+        nReadPos        = 0;
+        nLate           = 0;
+        bLate           = false;
+        pData           = NULL;
+    }
+
+    AsyncConvolver::~AsyncConvolver()
+    {
+        destroy();
+    }
+
+    bool AsyncConvolver::init(const float *data, size_t count, size_t rank, float phase, size_t delay)
+    {
+        destroy();
+
+        // Check that there is a late part to be processed in background
+        if ((delay <= 0) || (count <= delay))
+        {
+            if (!sEarly.init(data, count, rank, phase))
+                return false;
+            nConvSize       = count;
+            return true;
+        }
+
+        // The ring buffer should store enough data for the delay and the processed block
+        size_t capacity     = 1;
+        while (capacity < (delay << 2))
+            capacity      <<= 1;
+
+        float *ptr          = alloc_aligned<float>(pData, capacity * 2);
+        if (ptr == NULL)
+            return false;
+
+        vInBuf              = ptr;
+        ptr                += capacity;
+        vOutBuf             = ptr;
+        ptr                += capacity;
+        dsp::fill_zero(vInBuf, capacity * 2);
+
+        // Initialize convolvers
+        size_t e_rank       = (rank > ASYNC_CONVOLVER_RANK_EARLY) ? ASYNC_CONVOLVER_RANK_EARLY : rank;
+        if ((!sEarly.init(data, delay, e_rank, phase)) ||
+            (!sLate.init(&data[delay], count - delay, rank, phase)))
+        {
+            destroy();
+            return false;
+        }
+
+        // The first 'delay' samples of the late part are silence
+        nCapacity           = capacity;
+        nDelay              = delay;
+        nConvSize           = count;
+        nWritePos           = delay;
+        nReadPos            = delay;
+        nLate               = 0;
+        bLate               = true;
+
+        return true;
+    }
+
+    void AsyncConvolver::destroy()
+    {
+        sEarly.destroy();
+        sLate.destroy();
+
+        free_aligned(pData);
+        vInBuf          = NULL;
+        vOutBuf         = NULL;
+        nCapacity       = 0;
+        nDelay          = 0;
+        nConvSize       = 0;
+        nWritePos       = 0;
+        nReadPos        = 0;
+        nLate           = 0;
+        bLate           = false;
+    }
+
+    void AsyncConvolver::process(float *dst, const float *src, size_t count)
+    {
+        if (!bLate)
+        {
+            sEarly.process(dst, src, count);
+            return;
+        }
+
+        size_t mask         = nCapacity - 1;
+
+        while (count > 0)
+        {
+            size_t to_do        = (count > nDelay) ? nDelay : count;
+            uatomic_t pos       = nWritePos;
+
+            // Pass input data to the background task
+            size_t off          = pos & mask;
+            size_t n            = nCapacity - off;
+            if (n >= to_do)
+                dsp::copy(&vInBuf[off], src, to_do);
+            else
+            {
+                dsp::copy(&vInBuf[off], src, n);
+                dsp::copy(vInBuf, &src[n], to_do - n);
+            }
+            atomic_swap(&nWritePos, uatomic_t(pos + to_do));
+
+            // Process the early part
+            sEarly.process(dst, src, to_do);
+
+            // Apply the late part that has been processed by the background task
+            uatomic_t tail      = pos - nDelay;
+            atomic_t avail      = atomic_add(&nReadPos, 0) - tail;
+            if (avail < atomic_t(to_do))
+            {
+                ++nLate;
+                if (avail < 0)
+                    avail           = 0;
+            }
+            else
+                avail           = to_do;
+
+            off                 = tail & mask;
+            n                   = nCapacity - off;
+            if (n >= size_t(avail))
+                dsp::add2(dst, &vOutBuf[off], avail);
+            else
+            {
+                dsp::add2(dst, &vOutBuf[off], n);
+                dsp::add2(&dst[n], vOutBuf, avail - n);
+            }
+
+            // Update pointers
+            dst                += to_do;
+            src                += to_do;
+            count              -= to_do;
+        }
+    }
+
+    status_t AsyncConvolver::process_late()
+    {
+        size_t mask         = nCapacity - 1;
+        uatomic_t pos       = nReadPos;
+
+        while (true)
+        {
+            uatomic_t tail      = atomic_add(&nWritePos, 0);
+            size_t pending      = uatomic_t(tail - pos);
+            if (pending <= 0)
+                break;
+
+            // Drop the data that can not be processed in time, the ring buffer
+            // may be overwritten by the real-time thread
+            bool drop           = pending > (nCapacity >> 1);
+            if (drop)
+                lsp_trace("Dropping %d samples", int(pending));
+
+            while (pending > 0)
+            {
+                size_t off          = pos & mask;
+                size_t to_do        = nCapacity - off;
+                if (to_do > nDelay)
+                    to_do               = nDelay;
+                if (to_do > pending)
+                    to_do               = pending;
+
+                if (drop)
+                    dsp::fill_zero(&vOutBuf[off], to_do);
+                else
+                    sLate.process(&vOutBuf[off], &vInBuf[off], to_do);
+
+                pos                += to_do;
+                pending            -= to_do;
+                atomic_swap(&nReadPos, pos);
+            }
+        }
+
+        return STATUS_OK;
+    }
+
+    bool AsyncConvolver::idle()
+    {
+        if (sTask.completed())
+            sTask.reset();
+        return sTask.idle();
+    }
+
+    bool AsyncConvolver::submit(ipc::IExecutor *executor)
+    {
+        if (!idle())
+            return true;
+        if ((!bLate) || (nWritePos == nReadPos))
+            return false;
+        return executor->submit(&sTask);
+    }
+
+    size_t AsyncConvolver::fetch_late()
+    {
+        size_t late     = nLate;
+        nLate           = 0;
+        return late;
+    }
+
+} /* namespace lsp */
@@ -31,15 +31,17 @@ namespace lsp
         vBufferPtr      = NULL;
         vBufferEnd      = NULL;
         vConvFirst      = NULL;
-        vTask           = NULL;
+        vAccum          = NULL;
+        vHistory        = NULL;
 
         nRank           = 0;
         nSteps          = 0;
         nBlocks         = 0;
         nBlocksDone     = 0;
         nDirectSize     = CONVOLVER_SMALL_FRM_SIZE;
+        nHistory        = 0;
+        nHistHead       = 0;
         pConv           = NULL;
-        pTargetPtr      = NULL;
         vData           = NULL;
     }
 
@@ -105,6 +107,8 @@ namespace lsp
         size_t fft_buf_size     = 1 << rank;
         size_t data_buf_size    = fft_buf_size >> 1;
         size_t bins             = (count + data_buf_size - 1) >> (rank - 1);
+        size_t blocks           = (count > data_buf_size) ? (count - 1) >> (rank - 1) : 0; // Number of tail blocks
+        size_t history          = (blocks > 1) ? blocks - 1 : blocks; // Number of frames in history
 
 //        lsp_trace("count = 0x%x, rank=%d, phase=%.3f, bins=%d",
 //                int(count), int(rank), phase, int(bins));
@@ -113,8 +117,9 @@ namespace lsp
         allocate               += bins * fft_buf_size * 2; // FFT of the convolution
         allocate               += fft_buf_size * 2; // Temporary buffer (real and imaginary)
         allocate               += fft_buf_size * 2; // Frame buffer (real only, two frames)
-        allocate               += fft_buf_size * 2; // Task buffer (real and imaginary)
-        allocate               += bins * data_buf_size * 9 + data_buf_size * 6; // Buffer for convolution tail
+        allocate               += fft_buf_size * 2; // Accumulator (real and imaginary)
+        allocate               += history * fft_buf_size * 2; // History of input frames (real and imaginary)
+        allocate               += fft_buf_size * 3; // Buffer for convolution tail
 
         uint8_t *pdata          = NULL;
         float *fptr             = alloc_aligned<float>(pdata, allocate);
@@ -132,12 +137,12 @@ namespace lsp
         dsp::fill_zero(fptr, allocate); // Drop all previously used data
 
         vBufferHead         = fptr;
-        fptr               += bins * data_buf_size * 8;
-//        lsp_trace("vBufferHead = %p x 0x%x", vBufferHead, int(bins * data_buf_size * 8));
+        fptr               += fft_buf_size * 2;
+//        lsp_trace("vBufferHead = %p x 0x%x", vBufferHead, int(fft_buf_size * 2));
 
         vBufferTail         = fptr;
-        fptr               += bins * data_buf_size + data_buf_size * 6;
-//        lsp_trace("vBufferTail = %p x 0x%x", vBufferTail, int(bins * data_buf_size * 6));
+        fptr               += fft_buf_size;
+//        lsp_trace("vBufferTail = %p x 0x%x", vBufferTail, int(fft_buf_size));
 
         vBufferEnd          = fptr;
 //        lsp_trace("vBufferEnd = %p", vBufferEnd);
@@ -149,10 +154,13 @@ namespace lsp
         fptr               += CONVOLVER_SMALL_FRM_SIZE;
 //        lsp_trace("vConvFirst = %p x 0x%x", vConvFirst, CONVOLVER_SMALL_FRM_SIZE);
 
-        vTask               = fptr;
+        vAccum              = fptr;
         fptr               += fft_buf_size * 2;
+//        lsp_trace("vAccum = %p x 0x%x", vAccum, int(fft_buf_size * 2));
 
-//        lsp_trace("vTask = %p x 0x%x", vTask, int(fft_buf_size * 2));
+        vHistory            = fptr;
+        fptr               += history * fft_buf_size * 2;
+//        lsp_trace("vHistory = %p x 0x%x", vHistory, int(history * fft_buf_size * 2));
 
 //        lsp_trace("vFrame(prev) = %p x 0x%x", fptr, int(fft_buf_size));
         fptr               += fft_buf_size; // previous frame (re)
@@ -187,6 +195,9 @@ namespace lsp
         nFrameMax           = frame_size;
         nDirectSize         = (count > frame_size) ? frame_size : count;
         nConvSize           = count;
+        nHistory            = history;
+        nHistHead           = 0;
+        pConv               = NULL;
 
 //        dump(data, count, "DATA");
 
@@ -219,6 +230,8 @@ namespace lsp
         {
             size_t to_do        = (count > frame_size) ? frame_size : count;
             nFrameMax           = frame_size;
+            if ((bin_rank >= rank) && (pConv == NULL))
+                pConv               = conv_re;
 
             // Calculate FFT
             dsp::fill_zero(vTempBuf, bin_size*2);
@@ -258,6 +271,7 @@ namespace lsp
         if (nFrameSize >= nFrameMax)
             nFrameSize          = 0;
         nBlocksDone         = nBlocks;
+        lsp_assert(nBlocks == blocks);
 
 //        lsp_trace("nSteps   = 0x%x", int(nSteps));
 //        lsp_trace("nBlocks  = 0x%x", int(nBlocks));
@@ -285,15 +299,17 @@ namespace lsp
         vBufferPtr      = NULL;
         vBufferEnd      = NULL;
         vConvFirst      = NULL;
-        vTask           = NULL;
+        vAccum          = NULL;
+        vHistory        = NULL;
         pConv           = NULL;
-        pTargetPtr      = NULL;
 
         nRank           = 0;
         nSteps          = 0;
         nBlocks         = 0;
         nBlocksDone     = 0;
         nDirectSize     = 0;
+        nHistory        = 0;
+        nHistHead       = 0;
     }
 
     void Convolver::process(float *dst, const float *src, size_t count)
@@ -358,48 +374,39 @@ namespace lsp
                 // Start of frame and need to perform tail convolution?
                 if ((nFrameSize == 0) && (nBlocks > 0))
                 {
-                    // Apply convolution
-//                    lsp_trace("dsp::fastconv_parse dst=%p, src=%p, rank=0x%x",
-//                            vTask, vFrame - nFrameMax, int(nRank));
-                    dsp::fastconv_parse(vTask, vFrame - nFrameMax, nRank);
-
-                    // Set number of blocks done
-                    nBlocksDone     = 0;
-                    pConv           = conv_re;
-                    pTargetPtr      = vBufferPtr;
+                    // Store the spectrum of previous frame in the history
+                    if ((++nHistHead) >= nHistory)
+                        nHistHead           = 0;
+                    float *hptr         = &vHistory[nHistHead << (nRank + 1)];
+                    dsp::fastconv_parse(hptr, vFrame - nFrameMax, nRank);
+
+                    // Complete the accumulated tail convolution with the first block,
+                    // do the reverse FFT and apply it to the history buffer
+                    dsp::fastconv_mul_add(vAccum, hptr, pConv, nRank);
+                    dsp::fastconv_restore(vTempBuf, vAccum, nRank);
+                    dsp::add2(vBufferPtr, vTempBuf, 1 << nRank);
+                    dsp::fill_zero(vAccum, 2 << nRank);
+
+                    // Other blocks will be accumulated for the next frame
+                    nBlocksDone         = 1;
                 }
 
-                // Do tail convolution
+                // Accumulate tail convolution for the next frame
                 if (nBlocksDone < nBlocks)
                 {
-                    size_t tgt_block    = ((nFrameSize + CONVOLVER_SMALL_FRM_SIZE) * nBlocks) / nFrameMax;
+                    size_t tgt_block    = 1 + ((nFrameSize + CONVOLVER_SMALL_FRM_SIZE) * (nBlocks - 1)) / nFrameMax;
                     if (tgt_block > nBlocks)
                         tgt_block           = nBlocks;
 
                     while (nBlocksDone < tgt_block)
                     {
-                        // Do multiplication in frequency domain, reverse FFT and apply it to the history buffer
-//                        lsp_trace("fastconv_apply_block dst=0x%x, conv=0x%x, fptr=-0x%x, n=%d %d/%d",
-//                                    (pTargetPtr-vBufferHead)/CONVOLVER_SMALL_FRM_SIZE,
-//                                    (pConv-vConv)/CONVOLVER_SMALL_FFT_SIZE,
-//                                    0, 1 << (nRank - CONVOLVER_RANK_FFT_SMALL),
-//                                    nBlocksDone, nBlocks
-//                                    );
-//                        lsp_trace("dsp::fastconv_apply dst=%p, tmp=%p, conv1=%p, conv2=%p, rank=0x%x",
-//                                pTargetPtr, vTempBuf, vTask, pConv, int(nRank));
-//                        if (vBufferEnd < &pTargetPtr[1 << nRank])
-//                        {
-//                            lsp_error("Failed assertion: vBufferEnd >= &pTargetPtr[1 << nRank]");
-//                        }
-                        dsp::fastconv_apply(pTargetPtr, vTempBuf, vTask, pConv, nRank);
-
-                        // Update pointers
-                        pConv              += nFrameMax << 2;
-                        pTargetPtr         += nFrameMax;
+                        // The block is applied to the frame that was stored (nBlocksDone - 1) frames ago
+                        size_t idx          = (nHistHead + nHistory - nBlocksDone + 1) % nHistory;
+                        dsp::fastconv_mul_add(vAccum,
+                                &vHistory[idx << (nRank + 1)],
+                                &pConv[nBlocksDone << (nRank + 1)],
+                                nRank);
                         nBlocksDone        ++;
-
-//                        if (pTargetPtr >= vBufferEnd)
-//                            lsp_trace("pTargetPtr(%p) >= vBufferEnd(%p)", pTargetPtr, vBufferEnd);
                     }
                 }
             }
@@ -453,24 +460,14 @@ namespace lsp
             // Check that buffer head is required to be moved
             if (vBufferPtr >= vBufferTail)
             {
-                float *sptr = ((pTargetPtr == NULL) || (pTargetPtr >= vBufferPtr)) ?
-                        vBufferPtr : pTargetPtr;
-
-                size_t hist_size    = vBufferEnd - sptr;
-                size_t free_size    = sptr - vBufferHead;
+                size_t hist_size    = vBufferEnd - vBufferPtr;
+                size_t free_size    = vBufferPtr - vBufferHead;
 
 //                lsp_trace("dsp::move dst=%p src=%p, count=0x%x", vBufferHead, vBufferPtr, int(hist_size));
-                dsp::move(vBufferHead, sptr, hist_size);
-//                lsp_trace("dsp::fill_zero dst=%p, count=0x%x", &vBufferHead[hist_size], int(vBufferPtr - vBufferHead));
+                dsp::move(vBufferHead, vBufferPtr, hist_size);
+//                lsp_trace("dsp::fill_zero dst=%p, count=0x%x", &vBufferHead[hist_size], int(free_size));
                 dsp::fill_zero(&vBufferHead[hist_size], free_size);
-                if (pTargetPtr != NULL)
-                    pTargetPtr         -= free_size;
-                vBufferPtr         -= free_size;
-
-//                if ((vBufferPtr < vBufferHead) || (pTargetPtr < vBufferHead))
-//                {
-//                    lsp_error("Failed assertion: (vBufferPtr >= vBufferHead) && (pTargetPtr >= vBufferHead)");
-//                }
+                vBufferPtr          = vBufferHead;
             }
         }
 
@@ -7,6 +7,7 @@
 
 #include <dsp/dsp.h>
 #include <core/debug.h>
+#include <core/windows.h>
 
 #include <core/util/Oversampler.h>
 
@@ -14,6 +15,10 @@
 #define OS_DOWN_BUFFER_SIZE     (12 * 1024)   /* Multiple of 3 and 4 */
 #define OS_CUTOFF               21000.0f
 
+#define OS_HB_CHUNK             256             /* Number of base samples processed by half-band stages at once */
+#define OS_HB_UP_SIZE(s)        (OS_HALFBAND_TAPS_MAX + (OS_HB_CHUNK << (s)))
+#define OS_HB_DOWN_SIZE(s)      (OS_HALFBAND_TAPS_MAX*2 + 16 + (OS_HB_CHUNK << ((s) + 1)))
+
 namespace lsp
 {
     IOversamplerCallback::~IOversamplerCallback()
@@ -36,6 +41,19 @@ namespace lsp
         nUpdate     = UP_ALL;
         bData       = NULL;
         bFilter     = true;
+        nStages     = 0;
+        nLatency    = 0;
+
+        for (size_t i=0; i<OS_HALFBAND_STAGES_MAX; ++i)
+        {
+            halfband_t *hb      = &vStages[i];
+            hb->vUp             = NULL;
+            hb->vDown           = NULL;
+            hb->nUpHistory      = 0;
+            hb->nDownHistory    = 0;
+            hb->nTaps           = 0;
+            hb->nCoefs          = 0;
+        }
     }
     
     Oversampler::~Oversampler()
@@ -50,6 +68,8 @@ namespace lsp
         if (bData == NULL)
         {
             size_t samples  = OS_UP_BUFFER_SIZE + OS_DOWN_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES;
+            for (size_t i=0; i<OS_HALFBAND_STAGES_MAX; ++i)
+                samples        += OS_HB_UP_SIZE(i) + OS_HB_DOWN_SIZE(i);
             bData           = new uint8_t[samples * sizeof(float) + DEFAULT_ALIGN];
             if (bData == NULL)
                 return false;
@@ -59,6 +79,14 @@ namespace lsp
             fUpBuffer       = reinterpret_cast<float *>(ptr);
             ptr            += OS_UP_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES;
 
+            for (size_t i=0; i<OS_HALFBAND_STAGES_MAX; ++i)
+            {
+                vStages[i].vUp      = ptr;
+                ptr                += OS_HB_UP_SIZE(i);
+                vStages[i].vDown    = ptr;
+                ptr                += OS_HB_DOWN_SIZE(i);
+            }
+
             lsp_assert(reinterpret_cast<uint8_t *>(ptr) <= &bData[samples * sizeof(float) + DEFAULT_ALIGN]);
         }
 
@@ -66,6 +94,7 @@ namespace lsp
         dsp::fill_zero(fUpBuffer, OS_UP_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES);
         dsp::fill_zero(fDownBuffer, OS_DOWN_BUFFER_SIZE);
         nUpHead       = 0;
+        configure_halfband();
 
         return true;
     }
@@ -76,8 +105,15 @@ namespace lsp
         if (bData != NULL)
         {
             delete [] bData;
+            bData       = NULL;
             fUpBuffer   = NULL;
             fDownBuffer = NULL;
+
+            for (size_t i=0; i<OS_HALFBAND_STAGES_MAX; ++i)
+            {
+                vStages[i].vUp      = NULL;
+                vStages[i].vDown    = NULL;
+            }
         }
         pCallback = NULL;
     }
@@ -109,6 +145,7 @@ namespace lsp
             dsp::fill_zero(fUpBuffer, OS_UP_BUFFER_SIZE + RESAMPLING_RESERVED_SAMPLES);
             nUpHead       = 0;
             sFilter.clear();
+            configure_halfband();
         }
 
         size_t os       = get_oversampling();
@@ -126,6 +163,10 @@ namespace lsp
         {
             case OM_LANCZOS_2X2:
             case OM_LANCZOS_2X3:
+            case OM_HALFBAND_2X_FAST:
+            case OM_HALFBAND_2X_NORMAL:
+            case OM_HALFBAND_2X_HIGH:
+            case OM_HALFBAND_IIR_2X:
                 return 2;
 
             case OM_LANCZOS_3X2:
@@ -134,6 +175,10 @@ namespace lsp
 
             case OM_LANCZOS_4X2:
             case OM_LANCZOS_4X3:
+            case OM_HALFBAND_4X_FAST:
+            case OM_HALFBAND_4X_NORMAL:
+            case OM_HALFBAND_4X_HIGH:
+            case OM_HALFBAND_IIR_4X:
                 return 4;
 
             case OM_LANCZOS_6X2:
@@ -142,6 +187,10 @@ namespace lsp
 
             case OM_LANCZOS_8X2:
             case OM_LANCZOS_8X3:
+            case OM_HALFBAND_8X_FAST:
+            case OM_HALFBAND_8X_NORMAL:
+            case OM_HALFBAND_8X_HIGH:
+            case OM_HALFBAND_IIR_8X:
                 return 8;
 
             default:
@@ -320,6 +369,20 @@ namespace lsp
                 break;
             }
 
+            case OM_HALFBAND_2X_FAST:
+            case OM_HALFBAND_2X_NORMAL:
+            case OM_HALFBAND_2X_HIGH:
+            case OM_HALFBAND_4X_FAST:
+            case OM_HALFBAND_4X_NORMAL:
+            case OM_HALFBAND_4X_HIGH:
+            case OM_HALFBAND_8X_FAST:
+            case OM_HALFBAND_8X_NORMAL:
+            case OM_HALFBAND_8X_HIGH:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+                halfband_upsample(dst, src, samples);
+                break;
 
             case OM_NONE:
             default:
@@ -459,6 +522,21 @@ namespace lsp
                 break;
             }
 
+            case OM_HALFBAND_2X_FAST:
+            case OM_HALFBAND_2X_NORMAL:
+            case OM_HALFBAND_2X_HIGH:
+            case OM_HALFBAND_4X_FAST:
+            case OM_HALFBAND_4X_NORMAL:
+            case OM_HALFBAND_4X_HIGH:
+            case OM_HALFBAND_8X_FAST:
+            case OM_HALFBAND_8X_NORMAL:
+            case OM_HALFBAND_8X_HIGH:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+                halfband_downsample(dst, src, samples);
+                break;
+
             case OM_NONE:
             default:
                 dsp::copy(dst, src, samples);
@@ -504,7 +582,7 @@ namespace lsp
 
                     // Update pointers
                     nUpHead        += to_do << 1;
-                    dst            += to_do << 1;
+                    dst            += to_do;
                     src            += to_do;
                     samples        -= to_do;
                 }
@@ -675,6 +753,43 @@ namespace lsp
                 break;
             }
 
+            case OM_HALFBAND_2X_FAST:
+            case OM_HALFBAND_2X_NORMAL:
+            case OM_HALFBAND_2X_HIGH:
+            case OM_HALFBAND_4X_FAST:
+            case OM_HALFBAND_4X_NORMAL:
+            case OM_HALFBAND_4X_HIGH:
+            case OM_HALFBAND_8X_FAST:
+            case OM_HALFBAND_8X_NORMAL:
+            case OM_HALFBAND_8X_HIGH:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+            {
+                while (samples > 0)
+                {
+                    size_t to_do    = OS_UP_BUFFER_SIZE >> nStages;
+                    if (to_do > samples)
+                        to_do           = samples;
+
+                    // Do oversampling
+                    halfband_upsample(fUpBuffer, src, to_do);
+
+                    // Call handler
+                    if (callback != NULL)
+                        callback->process(fUpBuffer, fUpBuffer, to_do << nStages);
+
+                    // Do downsampling
+                    halfband_downsample(dst, fUpBuffer, to_do);
+
+                    // Update pointers
+                    dst            += to_do;
+                    src            += to_do;
+                    samples        -= to_do;
+                }
+                break;
+            }
+
             case OM_NONE:
             default:
                 if (callback != NULL)
@@ -703,6 +818,20 @@ namespace lsp
             case OM_LANCZOS_8X3:
                 return 3;
 
+            case OM_HALFBAND_2X_FAST:
+            case OM_HALFBAND_2X_NORMAL:
+            case OM_HALFBAND_2X_HIGH:
+            case OM_HALFBAND_4X_FAST:
+            case OM_HALFBAND_4X_NORMAL:
+            case OM_HALFBAND_4X_HIGH:
+            case OM_HALFBAND_8X_FAST:
+            case OM_HALFBAND_8X_NORMAL:
+            case OM_HALFBAND_8X_HIGH:
+            case OM_HALFBAND_IIR_2X:
+            case OM_HALFBAND_IIR_4X:
+            case OM_HALFBAND_IIR_8X:
+                return nLatency;
+
             default:
                 break;
         }
@@ -710,4 +839,297 @@ namespace lsp
         return 0;
     }
 
+    void Oversampler::configure_halfband()
+    {
+        // Number of taps for each stage, the first stage is the most critical
+        static const size_t fir_fast[]      = { 16, 12, 8 };
+        static const size_t fir_normal[]    = { 32, 16, 12 };
+        static const size_t fir_high[]      = { 64, 16, 12 };
+
+        // Number of all-pass coefficients and transition band for each IIR stage
+        static const size_t iir_coefs[]     = { 8, 4, 3 };
+        static const double iir_trans[]     = { 0.04, 0.145, 0.1975 };
+
+        const size_t *taps  = NULL;
+        bool high           = false;
+
+        switch (nMode)
+        {
+            case OM_HALFBAND_2X_FAST:   nStages = 1; taps = fir_fast;   break;
+            case OM_HALFBAND_2X_NORMAL: nStages = 1; taps = fir_normal; break;
+            case OM_HALFBAND_2X_HIGH:   nStages = 1; taps = fir_high;   high = true; break;
+            case OM_HALFBAND_4X_FAST:   nStages = 2; taps = fir_fast;   break;
+            case OM_HALFBAND_4X_NORMAL: nStages = 2; taps = fir_normal; break;
+            case OM_HALFBAND_4X_HIGH:   nStages = 2; taps = fir_high;   high = true; break;
+            case OM_HALFBAND_8X_FAST:   nStages = 3; taps = fir_fast;   break;
+            case OM_HALFBAND_8X_NORMAL: nStages = 3; taps = fir_normal; break;
+            case OM_HALFBAND_8X_HIGH:   nStages = 3; taps = fir_high;   high = true; break;
+            case OM_HALFBAND_IIR_2X:    nStages = 1; break;
+            case OM_HALFBAND_IIR_4X:    nStages = 2; break;
+            case OM_HALFBAND_IIR_8X:    nStages = 3; break;
+            default:
+                nStages     = 0;
+                nLatency    = 0;
+                return;
+        }
+
+        if (taps != NULL)
+        {
+            // Each FIR stage delays the signal by (taps - 1) samples of its low rate
+            // for the round trip. To keep the overall latency integer, the innermost
+            // downsampling stage gets extra delay
+            size_t acc      = 0;
+            size_t mask     = (1 << (nStages - 1)) - 1;
+            for (size_t i=0; i<nStages; ++i)
+            {
+                halfband_t *hb      = &vStages[i];
+                design_fir(hb, taps[i], high);
+                acc                += (taps[i] - 1) << (nStages - 1 - i);
+            }
+
+            size_t extra    = (mask + 1 - (acc & mask)) & mask;
+            vStages[nStages-1].nDownHistory    += extra << 1;
+            nLatency        = (acc + extra) >> (nStages - 1);
+        }
+        else
+        {
+            // The group delay of the IIR stages is not constant, estimate it at low frequencies:
+            // the round trip delays the signal by the sum of path delays at the high rate
+            float delay     = 0.0f;
+            for (size_t i=0; i<nStages; ++i)
+            {
+                halfband_t *hb      = &vStages[i];
+                design_iir(hb, iir_coefs[i], iir_trans[i]);
+
+                float gd            = 0.0f;
+                for (size_t j=0; j<hb->nCoefs; ++j)
+                    gd                 += 2.0f * (1.0f - hb->vCoefs[j]) / (1.0f + hb->vCoefs[j]);
+                delay              += 0.5f * gd / (1 << i);
+            }
+
+            nLatency        = size_t(delay + 0.5f);
+        }
+
+        // Clear state of stages
+        for (size_t i=0; i<nStages; ++i)
+        {
+            halfband_t *hb      = &vStages[i];
+            if (hb->vUp != NULL)
+                dsp::fill_zero(hb->vUp, OS_HB_UP_SIZE(i));
+            if (hb->vDown != NULL)
+                dsp::fill_zero(hb->vDown, OS_HB_DOWN_SIZE(i));
+            dsp::fill_zero(hb->vUpX, OS_HALFBAND_COEFS_MAX);
+            dsp::fill_zero(hb->vUpY, OS_HALFBAND_COEFS_MAX);
+            dsp::fill_zero(hb->vDownX, OS_HALFBAND_COEFS_MAX);
+            dsp::fill_zero(hb->vDownY, OS_HALFBAND_COEFS_MAX);
+        }
+    }
+
+    void Oversampler::design_fir(halfband_t *hb, size_t taps, bool high)
+    {
+        float w[OS_HALFBAND_TAPS_MAX * 2 + 1];
+        float *k            = hb->vKernel;
+
+        // Windowed sinc, only odd taps of the half-band filter are non-zero
+        windows::window(w, taps * 2 + 1, (high) ? windows::BLACKMAN_HARRIS : windows::BLACKMAN);
+        float sum           = 0.0f;
+        for (size_t i=0; i<taps; ++i)
+        {
+            ssize_t off         = ssize_t(i << 1) - ssize_t(taps - 1);
+            float x             = off * M_PI * 0.5f;
+            k[i]                = w[off + taps] * sinf(x) / x;
+            sum                += k[i];
+        }
+        dsp::mul_k2(k, 1.0f / sum, taps);
+
+        hb->nTaps           = taps;
+        hb->nCoefs          = 0;
+        hb->nUpHistory      = taps - 1;
+        hb->nDownHistory    = (taps - 1) << 1;
+    }
+
+    void Oversampler::design_iir(halfband_t *hb, size_t coefs, double transition)
+    {
+        // Polyphase IIR half-band filter designed as elliptic filter
+        double k            = tan((1.0 - transition * 2.0) * M_PI * 0.25);
+        k                  *= k;
+        double kksqrt       = pow(1.0 - k * k, 0.25);
+        double e            = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+        double e4           = e * e * e * e;
+        double q            = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+        double order        = coefs * 2 + 1;
+
+        for (size_t i=0; i<coefs; ++i)
+        {
+            double c            = i + 1;
+            double num          = 0.0, den = 0.0, term;
+            double sign         = 1.0;
+
+            for (size_t j=0; ; ++j)
+            {
+                term                = pow(q, double(j * (j + 1))) * sin((j * 2 + 1) * c * M_PI / order) * sign;
+                num                += term;
+                sign                = -sign;
+                if (fabs(term) <= 1e-100)
+                    break;
+            }
+
+            sign                = -1.0;
+            for (size_t j=1; ; ++j)
+            {
+                term                = pow(q, double(j * j)) * cos(j * 2 * c * M_PI / order) * sign;
+                den                += term;
+                sign                = -sign;
+                if (fabs(term) <= 1e-100)
+                    break;
+            }
+
+            double ww           = (num * pow(q, 0.25)) / (den + 0.5);
+            double wwsq         = ww * ww;
+            double x            = sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+            hb->vCoefs[i]       = (1.0 - x) / (1.0 + x);
+        }
+
+        hb->nTaps           = 0;
+        hb->nCoefs          = coefs;
+        hb->nUpHistory      = 0;
+        hb->nDownHistory    = 0;
+    }
+
+    void Oversampler::iir_upsample(halfband_t *hb, float *dst, const float *src, size_t count)
+    {
+        const float *c  = hb->vCoefs;
+        float *x        = hb->vUpX;
+        float *y        = hb->vUpY;
+        size_t n        = hb->nCoefs;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float even      = src[i];
+            float odd       = src[i];
+
+            // Even coefficients form the first path, odd coefficients form the second path
+            for (size_t j=0; j<n; j += 2)
+            {
+                float t         = (even - y[j]) * c[j] + x[j];
+                x[j]            = even;
+                y[j]            = t;
+                even            = t;
+
+                if ((j + 1) >= n)
+                    break;
+                t               = (odd - y[j+1]) * c[j+1] + x[j+1];
+                x[j+1]          = odd;
+                y[j+1]          = t;
+                odd             = t;
+            }
+
+            dst[0]          = even;
+            dst[1]          = odd;
+            dst            += 2;
+        }
+    }
+
+    void Oversampler::iir_downsample(halfband_t *hb, float *dst, const float *src, size_t count)
+    {
+        const float *c  = hb->vCoefs;
+        float *x        = hb->vDownX;
+        float *y        = hb->vDownY;
+        size_t n        = hb->nCoefs;
+
+        for (size_t i=0; i<count; ++i)
+        {
+            float even      = src[1];
+            float odd       = src[0];
+
+            for (size_t j=0; j<n; j += 2)
+            {
+                float t         = (even - y[j]) * c[j] + x[j];
+                x[j]            = even;
+                y[j]            = t;
+                even            = t;
+
+                if ((j + 1) >= n)
+                    break;
+                t               = (odd - y[j+1]) * c[j+1] + x[j+1];
+                x[j+1]          = odd;
+                y[j+1]          = t;
+                odd             = t;
+            }
+
+            dst[i]          = 0.5f * (even + odd);
+            src            += 2;
+        }
+    }
+
+    void Oversampler::halfband_upsample(float *dst, const float *src, size_t samples)
+    {
+        while (samples > 0)
+        {
+            size_t to_do    = (samples > OS_HB_CHUNK) ? OS_HB_CHUNK : samples;
+            const float *in = src;
+
+            // Each stage writes its output directly after the history of the next stage
+            for (size_t i=0; i<nStages; ++i)
+            {
+                halfband_t *hb  = &vStages[i];
+                size_t count    = to_do << i;
+                float *out      = ((i + 1) < nStages) ? &vStages[i+1].vUp[vStages[i+1].nUpHistory] : dst;
+
+                if (hb->nTaps > 0)
+                {
+                    float *buf      = &hb->vUp[hb->nUpHistory];
+                    if (in != buf)
+                        dsp::copy(buf, in, count);
+                    dsp::halfband_upsample_2x(out, hb->vUp, hb->vKernel, hb->nTaps, count);
+                    dsp::move(hb->vUp, &hb->vUp[count], hb->nUpHistory);
+                }
+                else
+                    iir_upsample(hb, out, in, count);
+
+                in              = out;
+            }
+
+            // Update pointers
+            dst            += to_do << nStages;
+            src            += to_do;
+            samples        -= to_do;
+        }
+    }
+
+    void Oversampler::halfband_downsample(float *dst, const float *src, size_t samples)
+    {
+        while (samples > 0)
+        {
+            size_t to_do    = (samples > OS_HB_CHUNK) ? OS_HB_CHUNK : samples;
+            const float *in = src;
+
+            // Stages are applied in reverse order, starting from the highest sample rate
+            for (size_t i=nStages; i > 0; )
+            {
+                halfband_t *hb  = &vStages[--i];
+                size_t count    = to_do << i;
+                float *out      = (i > 0) ? &vStages[i-1].vDown[vStages[i-1].nDownHistory] : dst;
+
+                if (hb->nTaps > 0)
+                {
+                    float *buf      = &hb->vDown[hb->nDownHistory];
+                    if (in != buf)
+                        dsp::copy(buf, in, count << 1);
+                    dsp::halfband_downsample_2x(out, hb->vDown, hb->vKernel, hb->nTaps, count);
+                    dsp::move(hb->vDown, &hb->vDown[count << 1], hb->nDownHistory);
+                }
+                else
+                    iir_downsample(hb, out, in, count);
+
+                in              = out;
+            }
+
+            // Update pointers
+            dst            += to_do;
+            src            += to_do << nStages;
+            samples        -= to_do;
+        }
+    }
+
 } /* namespace lsp */
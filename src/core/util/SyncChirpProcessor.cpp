@@ -8,12 +8,14 @@
 #include <dsp/dsp.h>
 #include <dsp/endian.h>
 #include <core/debug.h>
+#include <core/ipc/Thread.h>
 #include <core/util/SyncChirpProcessor.h>
 #include <math.h>
 #include <stdlib.h>
 #include <core/files/LSPCFile.h>
 #include <core/files/lspc/LSPCAudioWriter.h>
 #include <core/files/lspc/LSPCAudioReader.h>
+#include <data/cvector.h>
 
 #define MIN_AMPLITUDE               1.0e-6f         // Chirp Minimal Amplitude
 #define DFL_TAIL                    1.0f;           // Default tail acquisition time [s]
@@ -32,6 +34,9 @@
 #define ENVELOPE_BUF_LIMIT_SIZE     65536           // Maximum size for post processing envelope follower
 #define BG_NOISE_LIMIT             -10.0            // Threshold level to consider postprocessing data reliable (relative to RT low regression line fitting limit)
 #define MAX_WINDOW_RANK             16               // Maximum window rank for higher order responses windowing
+#define MAX_THREADS                 16              // Maximum number of worker threads
+#define TASKS_PER_THREAD            8               // Number of convolution work items per worker thread
+#define SOLVE_BLOCK                 1024            // Number of frequency bins processed by single identification work item
 
 namespace lsp
 {
@@ -79,11 +84,17 @@ namespace lsp
         sConvParams.vConvLengths        = NULL;
         sConvParams.vAlignOffsets       = NULL;
         sConvParams.pData				= NULL;
+        sConvParams.vInParts            = NULL;
+        sConvParams.vInvFirst           = NULL;
+        sConvParams.vBlocks             = NULL;
+        sConvParams.vInImages           = NULL;
+        sConvParams.vInvImages          = NULL;
+        sConvParams.nBlockParts         = 0;
+        sConvParams.nItems              = 0;
+        sConvParams.vCarry              = NULL;
+        sConvParams.pImageData          = NULL;
         sConvParams.vInPart 			= NULL;
         sConvParams.vInvPart 			= NULL;
-        sConvParams.vInImage 			= NULL;
-        sConvParams.vInvImage 			= NULL;
-        sConvParams.vTemp 				= NULL;
         sConvParams.pTempData 			= NULL;
         sConvParams.bReallocateTemp 	= true;
 
@@ -113,6 +124,10 @@ namespace lsp
         sCRPostProc.vTemprow2Re         = NULL;
         sCRPostProc.vTemprow2Im         = NULL;
         sCRPostProc.pData               = NULL;
+        sCRPostProc.nChannel            = 0;
+        sCRPostProc.bInnerSmoothing     = false;
+        sCRPostProc.nFadeIn             = 0;
+        sCRPostProc.nFadeOut            = 0;
 
         pChirp                          = NULL;
         pInverseFilter                  = NULL;
@@ -126,6 +141,8 @@ namespace lsp
         vEnvelopeBuffer                 = NULL;
         pData                           = NULL;
 
+        nThreads                        = 0;
+
         bSync                           = true;
     }
 
@@ -414,6 +431,30 @@ namespace lsp
         sCRPostProc.mCoeffsImDet = determinantIm;
     }
 
+    /** Fill the range of vector with complex value for positive frequencies
+     * and it's conjugate for negative frequencies, so the vector is Hermitian
+     *
+     * @param re real part of vector
+     * @param im imaginary part of vector
+     * @param cre real part of value
+     * @param cim imaginary part of value
+     * @param first index of the first frequency bin in vector
+     * @param count number of frequency bins
+     * @param nyquist index of the Nyquist frequency bin
+     */
+    static void fill_hermitian(float *re, float *im, float cre, float cim, size_t first, size_t count, size_t nyquist)
+    {
+        size_t last         = first + count;
+        size_t posEnd       = lsp_min(lsp_max(nyquist, first), last);
+        size_t negStart     = lsp_min(lsp_max(nyquist + 1, first), last);
+
+        dsp::fill(re, cre, count);
+        dsp::fill(im, cim, posEnd - first);
+        if (posEnd < negStart)
+            im[posEnd - first]  = 0.0f; // Nyquist frequency bin is real
+        dsp::fill(&im[negStart - first], -cim, last - negStart);
+    }
+
     void SyncChirpProcessor::solve()
     {
         if (
@@ -432,15 +473,25 @@ namespace lsp
            )
             return;
 
-        // Fill with zeros all the kernels matrices and temp vectors
+        // Fill with zeros all the kernels matrices
         dsp::fill_zero(sCRPostProc.mKernelsRe, sCRPostProc.nHamOrder * sCRPostProc.nHwinSize);
         dsp::fill_zero(sCRPostProc.mKernelsIm, sCRPostProc.nHamOrder * sCRPostProc.nHwinSize);
 
-        dsp::fill_zero(sCRPostProc.vTemprow1Re, sCRPostProc.nHwinSize);
-        dsp::fill_zero(sCRPostProc.vTemprow1Im, sCRPostProc.nHwinSize);
+        // The linear systems are independent for each frequency bin, so blocks of bins are solved concurrently.
+        // Each block uses its own part of temporary rows.
+        run_tasks(&SyncChirpProcessor::solve_task, (sCRPostProc.nHwinSize + SOLVE_BLOCK - 1) / SOLVE_BLOCK, 0);
+    }
+
+    void SyncChirpProcessor::solve_task(size_t item, float *buf)
+    {
+        size_t first    = item * SOLVE_BLOCK;
+        size_t count    = lsp_min(size_t(SOLVE_BLOCK), sCRPostProc.nHwinSize - first);
+        size_t nyquist  = sCRPostProc.nHwinSize / 2;
 
-        dsp::fill_zero(sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize);
-        dsp::fill_zero(sCRPostProc.vTemprow2Im, sCRPostProc.nHwinSize);
+        float *temp1Re  = &sCRPostProc.vTemprow1Re[first];
+        float *temp1Im  = &sCRPostProc.vTemprow1Im[first];
+        float *temp2Re  = &sCRPostProc.vTemprow2Re[first];
+        float *temp2Im  = &sCRPostProc.vTemprow2Im[first];
 
         // We aim to solve the linear systems Coeffs * Kernels = Higher for the unknown matrix Kernels (a linear system per column of Kernels and Higher)
         // Coeffs is upper triangular. So we use backward substitution.
@@ -453,9 +504,6 @@ namespace lsp
         // To be noted: the equation above is valid only for positive frequenc. The negative ones need to be calculated by conjugating the Coeff elements,
         // so that we preserve Hermitian symmetry.
 
-        size_t nyquist  = sCRPostProc.nHwinSize / 2;
-        size_t negStart = (sCRPostProc.nHwinSize - nyquist + 1) % sCRPostProc.nHwinSize; // Negative samples start here.
-
         // This in the index witch which we step through the rows, bottom to top.
         ssize_t r = sCRPostProc.nHamOrder - 1;
 
@@ -469,40 +517,40 @@ namespace lsp
             //                Higher is a HamOrder by WinSize matrix.
 
             // We start by copying Higher[r, :] over to Kernels[r, :]
-            size_t rowSelect    = sub2ind_Data(r, 0);
-            dsp::copy(&sCRPostProc.mKernelsRe[rowSelect], &sCRPostProc.mHigherRe[rowSelect], sCRPostProc.nHwinSize);
-            dsp::copy(&sCRPostProc.mKernelsIm[rowSelect], &sCRPostProc.mHigherIm[rowSelect], sCRPostProc.nHwinSize);
+            size_t rowSelect    = sub2ind_Data(r, first);
+            float *kernelRe     = &sCRPostProc.mKernelsRe[rowSelect];
+            float *kernelIm     = &sCRPostProc.mKernelsIm[rowSelect];
+            dsp::copy(kernelRe, &sCRPostProc.mHigherRe[rowSelect], count);
+            dsp::copy(kernelIm, &sCRPostProc.mHigherIm[rowSelect], count);
 
             // We will then accumulate the sum into Temprow1
-            dsp::fill_zero(sCRPostProc.vTemprow1Re, sCRPostProc.nHwinSize);
-            dsp::fill_zero(sCRPostProc.vTemprow1Im, sCRPostProc.nHwinSize);
+            dsp::fill_zero(temp1Re, count);
+            dsp::fill_zero(temp1Im, count);
 
             for (size_t c = r + 1; c < sCRPostProc.nHamOrder; ++c)
             {
                 size_t coeffIdx     = sub2ind_Coeffs(r, c);
-                size_t kRowSelect   = sub2ind_Data(c, 0);
+                size_t kRowSelect   = sub2ind_Data(c, first);
 
                 // We fill Temprow2 with Coeffs[r, c], so that we can do element-wise complex multiplication of Coeffs[r, c]
                 // and Kernels[c, :]. We do the multiplication in place into Temprow2.
                 // Make Hermitian Vector.
-                dsp::fill(sCRPostProc.vTemprow2Re, sCRPostProc.mCoeffsRe[coeffIdx], sCRPostProc.nHwinSize);
-                dsp::fill(sCRPostProc.vTemprow2Im, sCRPostProc.mCoeffsIm[coeffIdx], negStart - 1);
-                dsp::fill(&sCRPostProc.vTemprow2Im[negStart], -sCRPostProc.mCoeffsIm[coeffIdx], sCRPostProc.nHwinSize - negStart);
+                fill_hermitian(temp2Re, temp2Im, sCRPostProc.mCoeffsRe[coeffIdx], sCRPostProc.mCoeffsIm[coeffIdx], first, count, nyquist);
 
                 dsp::complex_mul2(
-                        sCRPostProc.vTemprow2Re, sCRPostProc.vTemprow2Im,
+                        temp2Re, temp2Im,
                         &sCRPostProc.mKernelsRe[kRowSelect], &sCRPostProc.mKernelsIm[kRowSelect],
-                        sCRPostProc.nHwinSize
+                        count
                         );
 
-                dsp::add2(sCRPostProc.vTemprow1Re, sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize);
-                dsp::add2(sCRPostProc.vTemprow1Im, sCRPostProc.vTemprow2Im, sCRPostProc.nHwinSize);
+                dsp::add2(temp1Re, temp2Re, count);
+                dsp::add2(temp1Im, temp2Im, count);
             }
 
             // Now we can subtract in place the accumulated sum from Kernels[r, :] which, being initialized to
             // Higher[r, :], yields to the numerator of the expression.
-            dsp::sub2(&sCRPostProc.mKernelsRe[rowSelect], sCRPostProc.vTemprow1Re, sCRPostProc.nHwinSize);
-            dsp::sub2(&sCRPostProc.mKernelsIm[rowSelect], sCRPostProc.vTemprow1Im, sCRPostProc.nHwinSize);
+            dsp::sub2(kernelRe, temp1Re, count);
+            dsp::sub2(kernelIm, temp1Im, count);
 
             // We just need to element-wise divide this numerator by Coeffs[r, r], which is the same as
             // element-wise multiplying with the complex inverse of Coeffs[r, r]
@@ -512,16 +560,9 @@ namespace lsp
             dsp::complex_rcp2(&coeffRe, &coeffIm, &sCRPostProc.mCoeffsRe[coeffIdx], &sCRPostProc.mCoeffsIm[coeffIdx], 1);
 
             // Make Hermitian vector
-            dsp::fill(sCRPostProc.vTemprow2Re, coeffRe, sCRPostProc.nHwinSize);
-            dsp::fill(sCRPostProc.vTemprow2Im, coeffIm, negStart - 1);
-            dsp::fill(&sCRPostProc.vTemprow2Im[negStart], -coeffIm, sCRPostProc.nHwinSize - negStart);
+            fill_hermitian(temp2Re, temp2Im, coeffRe, coeffIm, first, count, nyquist);
 
-            dsp::complex_mul3(
-                    &sCRPostProc.mKernelsRe[rowSelect], &sCRPostProc.mKernelsIm[rowSelect],
-                    &sCRPostProc.mKernelsRe[rowSelect], &sCRPostProc.mKernelsIm[rowSelect],
-                    sCRPostProc.vTemprow2Re, sCRPostProc.vTemprow2Im,
-                    sCRPostProc.nHwinSize
-                    );
+            dsp::complex_mul2(kernelRe, kernelIm, temp2Re, temp2Im, count);
 
             --r;
         }
@@ -576,16 +617,9 @@ namespace lsp
         if (dataLength == 0)
             return;
 
-        float *vResult          = pConvResult->channel(channel);
-        if (vResult == NULL)
+        if (pConvResult->channel(channel) == NULL)
         	return;
 
-        // We locate the center of the convolution result, that acts as a
-        // reference point (origin of time). Beware that for linear phase
-        // systems we will see a linear impulse response -centered- around this.
-        size_t timeOrigin       = (dataLength / 2) - 1;
-        size_t maxCount         = dataLength - timeOrigin;
-
         // We will fill the matrix of higher order responses with the higher
         // order frequency responses. So, we first fill everything with zero,
         // just in case there was some rubbish.
@@ -602,10 +636,30 @@ namespace lsp
         dsp::fill_zero(sCRPostProc.mHigherRe, sCRPostProc.nHamOrder * sCRPostProc.nHwinSize);
         dsp::fill_zero(sCRPostProc.mHigherIm, sCRPostProc.nHamOrder * sCRPostProc.nHwinSize);
 
-        dsp::fill_zero(sCRPostProc.vTemprow1Re, sCRPostProc.nHwinSize);
-        dsp::fill_zero(sCRPostProc.vTemprow1Im, sCRPostProc.nHwinSize);
-        dsp::fill_zero(sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize);
-        dsp::fill_zero(sCRPostProc.vTemprow2Im, sCRPostProc.nHwinSize);;
+        // The smoothing window is the same for all the responses. The rows of
+        // kernel matrices are used as temporary storage for each response, so
+        // the responses are processed concurrently.
+        windows::window(sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize, windowType);
+
+        sCRPostProc.nChannel        = channel;
+        sCRPostProc.bInnerSmoothing = doInnerSmoothing;
+        sCRPostProc.nFadeIn         = nFadeIn;
+        sCRPostProc.nFadeOut        = nFadeOut;
+
+        run_tasks(&SyncChirpProcessor::windowing_task, sCRPostProc.nHamOrder, 0);
+    }
+
+    void SyncChirpProcessor::windowing_task(size_t item, float *buf)
+    {
+        size_t m                = item + 1;
+        size_t dataLength       = pConvResult->samples();
+        const float *vResult    = pConvResult->channel(sCRPostProc.nChannel);
+
+        // We locate the center of the convolution result, that acts as a
+        // reference point (origin of time). Beware that for linear phase
+        // systems we will see a linear impulse response -centered- around this.
+        size_t timeOrigin       = (dataLength / 2) - 1;
+        size_t maxCount         = dataLength - timeOrigin;
 
         // Nyquist sample of the higher order frequency responses
         size_t nyquist              = sCRPostProc.nHwinSize / 2;
@@ -613,96 +667,93 @@ namespace lsp
         double gap2prev             = maxCount;
         double halfWindowWidth      = 0.5 * sCRPostProc.nHwinSize;
 
-        for (size_t m = 1; m <= sCRPostProc.nHamOrder; ++m)
-        {
-            double higherOrigin     = timeOrigin - seconds_to_samples(nSampleRate, sChirpParams.gamma * log(m));
-            double gap2next         = seconds_to_samples(nSampleRate, sChirpParams.gamma * log(1.0 + 1.0 / m));
-            if (m > 1)
-                gap2prev            = seconds_to_samples(nSampleRate, sChirpParams.gamma * log(m / (m - 1.0)));
+        // Rows of kernel matrices are used as temporary storage
+        size_t rowSelect            = sub2ind_Data(m - 1, 0);
+        float *tempRe               = &sCRPostProc.mKernelsRe[rowSelect];
+        float *tempIm               = &sCRPostProc.mKernelsIm[rowSelect];
 
-            double maxAhead         = 0.5 * gap2next;
-            double maxBehind        = 0.5 * gap2prev;
+        double higherOrigin     = timeOrigin - seconds_to_samples(nSampleRate, sChirpParams.gamma * log(m));
+        double gap2next         = seconds_to_samples(nSampleRate, sChirpParams.gamma * log(1.0 + 1.0 / m));
+        if (m > 1)
+            gap2prev            = seconds_to_samples(nSampleRate, sChirpParams.gamma * log(m / (m - 1.0)));
 
-            double headGap          = (maxAhead > halfWindowWidth) ? halfWindowWidth : maxAhead;
-            double tailGap          = (maxBehind > halfWindowWidth) ? halfWindowWidth : maxBehind;
+        double maxAhead         = 0.5 * gap2next;
+        double maxBehind        = 0.5 * gap2prev;
 
-            double dCopyHead        = higherOrigin - headGap;
-
-            if (dCopyHead < 0)
-                break;
+        double headGap          = (maxAhead > halfWindowWidth) ? halfWindowWidth : maxAhead;
+        double tailGap          = (maxBehind > halfWindowWidth) ? halfWindowWidth : maxBehind;
 
-            size_t nCopyHead    = dCopyHead;
+        double dCopyHead        = higherOrigin - headGap;
 
-            size_t copyCount    = headGap + tailGap;
+        // Responses of this and all higher orders do not fit into the convolution result
+        if (dCopyHead < 0)
+            return;
 
-            double dWindowHead  = halfWindowWidth - headGap;
-            size_t nWindowHead  = dWindowHead;
+        size_t nCopyHead    = dCopyHead;
 
-            dsp::fill_zero(sCRPostProc.vTemprow1Re, sCRPostProc.nHwinSize);
-            dsp::fill_zero(sCRPostProc.vTemprow1Im, sCRPostProc.nHwinSize);
-            dsp::copy(&sCRPostProc.vTemprow1Re[nWindowHead], &vResult[nCopyHead], copyCount);
+        size_t copyCount    = headGap + tailGap;
 
-            // Applying the smoothing fade-in and fade out to the data.
-            if (doInnerSmoothing)
-            {
-                size_t fadeInLength     = (nFadeIn < headGap) ? nFadeIn: headGap;
-                size_t fadeOutLength    = (nFadeOut < tailGap) ? nFadeOut : tailGap;
+        double dWindowHead  = halfWindowWidth - headGap;
+        size_t nWindowHead  = dWindowHead;
 
-                float *fadeHead         = &sCRPostProc.vTemprow1Re[nWindowHead];
+        dsp::fill_zero(tempRe, sCRPostProc.nHwinSize);
+        dsp::fill_zero(tempIm, sCRPostProc.nHwinSize);
+        dsp::copy(&tempRe[nWindowHead], &vResult[nCopyHead], copyCount);
 
-                for (size_t n = 0; n < fadeInLength; ++n)
-                {
-                    fadeHead[n] *= 0.5f * (sin(M_PI * (double(n) / fadeInLength - 0.5)) + 1.0f);
-                }
+        // Applying the smoothing fade-in and fade out to the data.
+        if (sCRPostProc.bInnerSmoothing)
+        {
+            size_t fadeInLength     = (sCRPostProc.nFadeIn < headGap) ? sCRPostProc.nFadeIn: headGap;
+            size_t fadeOutLength    = (sCRPostProc.nFadeOut < tailGap) ? sCRPostProc.nFadeOut : tailGap;
 
-                fadeHead                = &sCRPostProc.vTemprow1Re[nWindowHead + copyCount - fadeOutLength - 1];
+            float *fadeHead         = &tempRe[nWindowHead];
 
-                for (size_t n = 1; n <= fadeOutLength; ++n)
-                {
-                    fadeHead[n] *= 0.5f * (sin(-M_PI * (double(n) / fadeOutLength - 0.5)) + 1.0f);
-                }
+            for (size_t n = 0; n < fadeInLength; ++n)
+            {
+                fadeHead[n] *= 0.5f * (sin(M_PI * (double(n) / fadeInLength - 0.5)) + 1.0f);
             }
 
-            // Applying overall smoothing window
-            windows::window(sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize, windowType);
+            fadeHead                = &tempRe[nWindowHead + copyCount - fadeOutLength - 1];
 
-            dsp::mul2(sCRPostProc.vTemprow1Re, sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize);
+            for (size_t n = 1; n <= fadeOutLength; ++n)
+            {
+                fadeHead[n] *= 0.5f * (sin(-M_PI * (double(n) / fadeOutLength - 0.5)) + 1.0f);
+            }
+        }
 
-            dsp::direct_fft(
-                    sCRPostProc.vTemprow2Re, sCRPostProc.vTemprow2Im,
-                    sCRPostProc.vTemprow1Re, sCRPostProc.vTemprow1Im,
-                    sCRPostProc.nWinRank
-                    );
+        // Applying overall smoothing window
+        dsp::mul2(tempRe, sCRPostProc.vTemprow2Re, sCRPostProc.nHwinSize);
 
-            double shift        = nCopyHead - dCopyHead + dWindowHead - nWindowHead;
+        float *higherRe     = &sCRPostProc.mHigherRe[rowSelect];
+        float *higherIm     = &sCRPostProc.mHigherIm[rowSelect];
 
-            size_t rowSelect    = sub2ind_Data(m - 1, 0);
+        dsp::direct_fft(
+                higherRe, higherIm,
+                tempRe, tempIm,
+                sCRPostProc.nWinRank
+                );
 
-            for (size_t k = 0; k <= nyquist; ++k)
-            {
-                size_t p            = (sCRPostProc.nHwinSize - k) % sCRPostProc.nHwinSize;
+        double shift        = nCopyHead - dCopyHead + dWindowHead - nWindowHead;
 
-                double delayFactor  = shift * double(k) / sCRPostProc.nHwinSize;
-                double angle        = 2.0 * M_PI * (delayFactor - floor(delayFactor)); // Wrapped within [0, 2 * M_PI]
+        for (size_t k = 0; k <= nyquist; ++k)
+        {
+            size_t p            = (sCRPostProc.nHwinSize - k) % sCRPostProc.nHwinSize;
 
-                sCRPostProc.vTemprow1Re[k] = cos(angle);
-                sCRPostProc.vTemprow1Im[k] = -sin(angle);
+            double delayFactor  = shift * double(k) / sCRPostProc.nHwinSize;
+            double angle        = 2.0 * M_PI * (delayFactor - floor(delayFactor)); // Wrapped within [0, 2 * M_PI]
 
-                if ((k != 0) && k != nyquist)
-                {
-                    sCRPostProc.vTemprow1Re[p] = sCRPostProc.vTemprow1Re[k];
-                    sCRPostProc.vTemprow1Im[p] = -sCRPostProc.vTemprow1Im[k];
-                }
+            tempRe[k]       = cos(angle);
+            tempIm[k]       = -sin(angle);
 
+            if ((k != 0) && k != nyquist)
+            {
+                tempRe[p]       = tempRe[k];
+                tempIm[p]       = -tempIm[k];
             }
 
-            dsp::complex_mul3(
-                    &sCRPostProc.mHigherRe[rowSelect], &sCRPostProc.mHigherIm[rowSelect],
-                    sCRPostProc.vTemprow2Re, sCRPostProc.vTemprow2Im,
-                    sCRPostProc.vTemprow1Re, sCRPostProc.vTemprow1Im,
-                    sCRPostProc.nHwinSize
-                    );
         }
+
+        dsp::complex_mul2(higherRe, higherIm, tempRe, tempIm, sCRPostProc.nHwinSize);
     }
 
     status_t SyncChirpProcessor::fill_with_kernel_taps(float *dst)
@@ -1258,7 +1309,7 @@ namespace lsp
     		destroyConvolutionParameters();
 
         	// Each pointer in conv_t points to an array that holds one value per channel.
-        	size_t samples = 5 * nchannels;
+        	size_t samples = 8 * nchannels + 2 * nchannels * sizeof(float *) / sizeof(size_t);
 
     		size_t *ptr              		= alloc_aligned<size_t>(sConvParams.pData, samples);
 			if (ptr == NULL)
@@ -1275,8 +1326,20 @@ namespace lsp
 			ptr                    		   += nchannels;
 			sConvParams.vAlignOffsets       = ptr;
 			ptr                            += nchannels;
+			sConvParams.vInParts            = ptr;
+			ptr                            += nchannels;
+			sConvParams.vInvFirst           = ptr;
+			ptr                            += nchannels;
+			sConvParams.vBlocks             = ptr;
+			ptr                            += nchannels;
+
+			float **fptr                    = reinterpret_cast<float **>(ptr);
+			sConvParams.vInImages           = fptr;
+			fptr                           += nchannels;
+			sConvParams.vInvImages          = fptr;
+			fptr                           += nchannels;
 
-			lsp_assert(ptr <= &save[samples]);
+			lsp_assert(reinterpret_cast<size_t *>(fptr) <= &save[samples]);
 
 			sConvParams.nChannels 			= nchannels;
     	}
@@ -1293,6 +1356,11 @@ namespace lsp
         sConvParams.vInversePrepends    = NULL;
         sConvParams.vConvLengths        = NULL;
         sConvParams.vAlignOffsets       = NULL;
+        sConvParams.vInParts            = NULL;
+        sConvParams.vInvFirst           = NULL;
+        sConvParams.vBlocks             = NULL;
+        sConvParams.vInImages           = NULL;
+        sConvParams.vInvImages          = NULL;
     }
 
     void SyncChirpProcessor::calculateConvolutionParameters(Sample **data, size_t *offset)
@@ -1336,8 +1404,8 @@ namespace lsp
 
     	destroyConvolutionTempArrays();
 
-        // Allocate 2X Partition temp buffers + 2X Partition Image temp buffers 1X Temporary buffer
-        size_t samples          = 2 * sConvParams.nPartitionSize + 3 * sConvParams.nImage;
+        // Allocate 2X Partition temp buffers, images are stored separately for all partitions
+        size_t samples          = 2 * sConvParams.nPartitionSize;
 
 		float *ptr        		= alloc_aligned<float>(sConvParams.pTempData, samples);
 		if (ptr == NULL)
@@ -1348,12 +1416,6 @@ namespace lsp
         ptr                    += sConvParams.nPartitionSize;
         sConvParams.vInvPart    = ptr;
         ptr                    += sConvParams.nPartitionSize;
-        sConvParams.vInImage    = ptr;
-        ptr                    += sConvParams.nImage;
-        sConvParams.vInvImage   = ptr;
-        ptr                    += sConvParams.nImage;
-        sConvParams.vTemp       = ptr;
-        ptr                    += sConvParams.nImage;
 
         lsp_assert(ptr <= &save[samples]);
 
@@ -1368,9 +1430,6 @@ namespace lsp
     	sConvParams.pTempData 	= NULL;
     	sConvParams.vInPart     = NULL;
     	sConvParams.vInvPart    = NULL;
-    	sConvParams.vInImage    = NULL;
-    	sConvParams.vInvImage   = NULL;
-    	sConvParams.vTemp       = NULL;
     }
 
     status_t SyncChirpProcessor::do_linear_convolutions(Sample **data, size_t *offset, size_t nchannels, size_t partSizeLimit)
@@ -1396,122 +1455,291 @@ namespace lsp
 		if (status != STATUS_OK)
 			return status;
 
-    	for (size_t ch = 0; ch < nchannels; ++ch)
-    	{
-    		status = do_linear_convolution(data[ch], offset[ch], ch);
+        if (pInverseFilter == NULL)
+            return STATUS_NO_DATA;
 
-    		if (status != STATUS_OK)
-    			return status;
-    	}
+        size_t ps               = sConvParams.nPartitionSize;
+        size_t nImage           = sConvParams.nImage;
 
-    	return STATUS_OK;
-    }
+        // Estimate the number of partition images and the overall number of output partitions.
+        // Partitions that consist of zero pad only are not transformed at all.
+        size_t images           = 0;
+        size_t outParts         = 0;
 
-    status_t SyncChirpProcessor::do_linear_convolution(Sample *data, size_t offset, size_t channel)
-    {
-        if ((pInverseFilter == NULL) || (data == NULL))
-            return STATUS_NO_DATA;
+        for (size_t ch = 0; ch < nchannels; ++ch)
+        {
+            if ((data[ch] == NULL) || (pConvResult->channel(ch) == NULL))
+                return STATUS_NO_DATA;
 
-        if (channel >= sConvParams.nChannels)
-        	return STATUS_BAD_ARGUMENTS;
+            size_t nInputData           = data[ch]->length() - offset[ch];
+            size_t prepend              = sConvParams.vInversePrepends[ch];
+            size_t parts                = sConvParams.vPartitions[ch];
 
-        dsp::fill_zero(sConvParams.vInPart, 	sConvParams.nPartitionSize);
-        dsp::fill_zero(sConvParams.vInvPart, 	sConvParams.nPartitionSize);
-        dsp::fill_zero(sConvParams.vInImage, 	sConvParams.nImage);
-        dsp::fill_zero(sConvParams.vInvImage, 	sConvParams.nImage);
-        dsp::fill_zero(sConvParams.vTemp, 		sConvParams.nImage);
+            sConvParams.vInParts[ch]    = (nInputData + ps - 1) / ps;
+            sConvParams.vInvFirst[ch]   = prepend / ps;
+            outParts                   += 2 * parts - 1;
+            images                     += sConvParams.vInParts[ch];
 
-        // Results
-		float *vInputData       = data->getBuffer(0, offset);
-		size_t nInputData       = data->length() - offset;
+            // Inverse filter images are shared between channels with the same prepend
+            if (find_inverse_images(ch) < 0)
+                images                     += parts - sConvParams.vInvFirst[ch];
+        }
 
-		float *vInverseFilter   = pInverseFilter->getBuffer(0);
+        // Each work item computes a block of consecutive output partitions
+        size_t threads          = get_num_threads();
+        sConvParams.nBlockParts = lsp_max(size_t(1), outParts / (threads * TASKS_PER_THREAD));
+        sConvParams.nItems      = 0;
+        for (size_t ch = 0; ch < nchannels; ++ch)
+        {
+            sConvParams.vBlocks[ch] = (2 * sConvParams.vPartitions[ch] - 1 + sConvParams.nBlockParts - 1) / sConvParams.nBlockParts;
+            sConvParams.nItems     += sConvParams.vBlocks[ch];
+        }
 
-        float *vResult 			= pConvResult->channel(channel);
-        if (vResult == NULL)
-        	return STATUS_BAD_ARGUMENTS;
+        float *ptr              = alloc_aligned<float>(sConvParams.pImageData, images * nImage + sConvParams.nItems * ps);
+        if (ptr == NULL)
+            return STATUS_NO_MEM;
 
-        // Do the convolution.
-        bool bNullInputPart     = false; // If one of the operands of the convolution is zeros, set to true and avoid convolution
-        bool bNullInversePart   = false;
+        // Convolution result may be left from the previous call
+        for (size_t ch = 0; ch < nchannels; ++ch)
+            dsp::fill_zero(pConvResult->channel(ch), pConvResult->samples());
 
-        for (size_t inp = 0; inp < sConvParams.vPartitions[channel]; ++inp) // Cycle through input partitions
-        {
-            // Scanning through the input data: current position is inputHead.
-            size_t inputHead    = inp * sConvParams.nPartitionSize;
+        for (size_t ch = 0; ch < nchannels; ++ch)
+            prepare_linear_convolution(data[ch], offset[ch], ch, ptr);
+        sConvParams.vCarry      = ptr;
 
-            // Evaluate distance of head from end of data
-            ssize_t inSamplesAhead = ssize_t(nInputData) - ssize_t(inputHead);
+        // Compute the output partitions
+        status = run_tasks(&SyncChirpProcessor::convolution_task, sConvParams.nItems, 2 * nImage);
 
-            if (inSamplesAhead > ssize_t(sConvParams.nPartitionSize)) // The whole current partition is within the input data
+        if (status == STATUS_OK)
+        {
+            // Apply the tails of the last partitions in each block to the result
+            const float *carry      = sConvParams.vCarry;
+
+            for (size_t ch = 0; ch < nchannels; ++ch)
             {
-                bNullInputPart  = false;
-                dsp::fastconv_parse(sConvParams.vInImage, &vInputData[inputHead], sConvParams.nConvRank);
+                float *vResult      = &pConvResult->channel(ch)[sConvParams.vAlignOffsets[ch]];
+                size_t outLast      = 2 * sConvParams.vPartitions[ch] - 1;
+
+                for (size_t b = 0; b < sConvParams.vBlocks[ch]; ++b, carry += ps)
+                {
+                    size_t next         = lsp_min((b + 1) * sConvParams.nBlockParts, outLast);
+                    dsp::add2(&vResult[next * ps], carry, ps);
+                }
+
+                // Normalising by square sample rate to recover physical units.
+                dsp::mul_k2(vResult, sChirpParams.fConvScale / (nSampleRate * nSampleRate), sConvParams.vConvLengths[ch]);
             }
-            else if (inSamplesAhead > 0) // The current partition is across the end of input data and the beginning of the pad
+        }
+
+        free_aligned(sConvParams.pImageData);
+        sConvParams.pImageData  = NULL;
+        sConvParams.vCarry      = NULL;
+        for (size_t ch = 0; ch < nchannels; ++ch)
+        {
+            sConvParams.vInImages[ch]   = NULL;
+            sConvParams.vInvImages[ch]  = NULL;
+        }
+
+        return status;
+    }
+
+    ssize_t SyncChirpProcessor::find_inverse_images(size_t channel) const
+    {
+        for (size_t i = 0; i < channel; ++i)
+            if (sConvParams.vInversePrepends[i] == sConvParams.vInversePrepends[channel])
+                return i;
+        return -1;
+    }
+
+    void SyncChirpProcessor::prepare_linear_convolution(Sample *data, size_t offset, size_t channel, float * &images)
+    {
+        size_t ps               = sConvParams.nPartitionSize;
+        size_t nImage           = sConvParams.nImage;
+        size_t rank             = sConvParams.nConvRank;
+
+		const float *vInputData = data->getBuffer(0, offset);
+		size_t nInputData       = data->length() - offset;
+
+        // Imaging the input data: the input is imagined as padded in the tail
+        sConvParams.vInImages[channel]  = images;
+        for (size_t inp = 0; inp < sConvParams.vInParts[channel]; ++inp, images += nImage)
+        {
+            size_t inputHead    = inp * ps;
+            size_t inSamplesAhead = nInputData - inputHead;
+
+            if (inSamplesAhead > ps) // The whole current partition is within the input data
+                dsp::fastconv_parse(images, &vInputData[inputHead], rank);
+            else // The current partition is across the end of input data and the beginning of the pad
             {
-                bNullInputPart  = false;
                 dsp::copy(sConvParams.vInPart, &vInputData[inputHead], inSamplesAhead);
-                dsp::fill_zero(&sConvParams.vInPart[inSamplesAhead], sConvParams.nPartitionSize - inSamplesAhead);
-                dsp::fastconv_parse(sConvParams.vInImage, sConvParams.vInPart, sConvParams.nConvRank);
+                dsp::fill_zero(&sConvParams.vInPart[inSamplesAhead], ps - inSamplesAhead);
+                dsp::fastconv_parse(images, sConvParams.vInPart, rank);
             }
-            else // The current partition is completely in the pad
+        }
+
+        // Images of inverse filter may be already computed for another channel
+        ssize_t shared          = find_inverse_images(channel);
+        if (shared >= 0)
+        {
+            sConvParams.vInvImages[channel] = sConvParams.vInvImages[shared];
+            return;
+        }
+
+        // Imaging the inverse filter: the filter is imagined as padded at the beginning
+		const float *vInverseFilter = pInverseFilter->getBuffer(0);
+        size_t prepend          = sConvParams.vInversePrepends[channel];
+
+        sConvParams.vInvImages[channel] = images;
+        for (size_t invp = sConvParams.vInvFirst[channel]; invp < sConvParams.vPartitions[channel]; ++invp, images += nImage)
+        {
+            size_t virtualHead  = invp * ps;
+
+            if (virtualHead < prepend) // The partition is across the end of the pad and the beginning of data
             {
-                bNullInputPart  = true;
+                size_t pad          = prepend - virtualHead;
+                dsp::fill_zero(sConvParams.vInvPart, pad);
+                dsp::copy(&sConvParams.vInvPart[pad], vInverseFilter, ps - pad);
+                dsp::fastconv_parse(images, sConvParams.vInvPart, rank);
             }
+            else // The partition is inside the inverse filter
+                dsp::fastconv_parse(images, &vInverseFilter[virtualHead - prepend], rank);
+        }
+    }
 
-            // Initialise the position tracker for the inverse filter.
-            // This will be bumped as the loop scans through the pad first
-            // and the actual inverse filter data later.
-            size_t inverseHead  = 0;
+    void SyncChirpProcessor::convolution_task(size_t item, float *buf)
+    {
+        size_t ps               = sConvParams.nPartitionSize;
+        size_t nImage           = sConvParams.nImage;
+        size_t rank             = sConvParams.nConvRank;
 
-            for (size_t invp = 0; invp < sConvParams.vPartitions[channel]; ++invp) // Cycle through inverse filter partitions
-            {
-                // Scanning through the imaginary array made of prepend pad followed by inverse filter:
-                // current position is virtualHead
-                size_t virtualHead = invp * sConvParams.nPartitionSize;
+        // Find the channel and the block of output partitions
+        size_t channel          = 0;
+        size_t block            = item;
+        while (block >= sConvParams.vBlocks[channel])
+            block                  -= sConvParams.vBlocks[channel++];
 
-                // Evaluate distance of head from end of prepend pad
-                ssize_t viSamplesAhead = ssize_t(sConvParams.vInversePrepends[channel]) - ssize_t(virtualHead);
+        size_t parts            = sConvParams.vPartitions[channel];
+        size_t inParts          = sConvParams.vInParts[channel];
+        size_t invFirst         = sConvParams.vInvFirst[channel];
+        const float *vInImages  = sConvParams.vInImages[channel];
+        const float *vInvImages = sConvParams.vInvImages[channel];
+        float *vResult          = &pConvResult->channel(channel)[sConvParams.vAlignOffsets[channel]];
+        float *vCarry           = &sConvParams.vCarry[item * ps];
 
-                if (viSamplesAhead > ssize_t(sConvParams.nPartitionSize)) // The whole partition is within the pad
-                {
-                    bNullInversePart = true;
-                }
-                else if (viSamplesAhead > 0) // The partition is across the end of the pad and the beginning of data
-                {
-                    bNullInversePart    = false;
-                    size_t toCopy       = sConvParams.nPartitionSize - viSamplesAhead;
-                    dsp::fill_zero(sConvParams.vInvPart, viSamplesAhead);
-                    dsp::copy(&sConvParams.vInvPart[viSamplesAhead], &vInverseFilter[inverseHead], toCopy);
-                    dsp::fastconv_parse(sConvParams.vInvImage, sConvParams.vInvPart, sConvParams.nConvRank);
-                    inverseHead += toCopy;
-                }
-                else // The partition is inside the inverse filter
-                {
-                    bNullInversePart    = false;
-                    dsp::fastconv_parse(sConvParams.vInvImage, &vInverseFilter[inverseHead], sConvParams.nConvRank);
-                    inverseHead += sConvParams.nPartitionSize;
-                }
+        float *acc              = buf;
+        float *tmp              = &buf[nImage];
+
+        size_t first            = block * sConvParams.nBlockParts;
+        size_t last             = lsp_min(first + sConvParams.nBlockParts, 2 * parts - 1);
+
+        dsp::fill_zero(vCarry, ps);
+
+        for (size_t k = first; k < last; ++k)
+        {
+            float *dst              = &vResult[k * ps];
 
-                if (bNullInputPart || bNullInversePart)
-                    continue; // Result is zero, nothing to do.
+            // Accumulate all products that fall into the output partition in frequency domain,
+            // so only one inverse transform is required per output partition
+            size_t inpFirst         = (k >= parts) ? k - parts + 1 : 0;
+            ssize_t inpLast         = lsp_min(ssize_t(inParts) - 1, ssize_t(k) - ssize_t(invFirst));
 
-                dsp::fastconv_apply(&vResult[sConvParams.nPartitionSize * (inp + invp) + sConvParams.vAlignOffsets[channel]],
-                            sConvParams.vTemp,
-                            sConvParams.vInImage,
-                            sConvParams.vInvImage,
-                            sConvParams.nConvRank
-                            );
+            if (ssize_t(inpFirst) <= inpLast)
+            {
+                dsp::fill_zero(acc, nImage);
+                for (ssize_t inp = inpFirst; inp <= inpLast; ++inp)
+                    dsp::fastconv_mul_add(acc,
+                            &vInImages[inp * nImage],
+                            &vInvImages[(k - inp - invFirst) * nImage],
+                            rank);
+                dsp::fastconv_restore(tmp, acc, rank);
             }
+            else
+                dsp::fill_zero(tmp, 2 * ps);
+
+            // The head of partition is added to the result, the tail overlaps the next partition
+            dsp::add2(dst, tmp, ps);
+            if ((k + 1) < last)
+                dsp::add2(&dst[ps], &tmp[ps], ps);
+            else
+                dsp::add2(vCarry, &tmp[ps], ps);
         }
+    }
 
-        // Normalising by square sample rate to recover physical units.
-        dsp::mul_k2(vResult, sChirpParams.fConvScale / (nSampleRate * nSampleRate), sConvParams.vConvLengths[channel]);
+    size_t SyncChirpProcessor::get_num_threads() const
+    {
+        size_t threads  = (nThreads > 0) ? nThreads : ipc::Thread::system_cores();
+        return lsp_max(size_t(1), lsp_min(threads, size_t(MAX_THREADS)));
+    }
+
+    status_t SyncChirpProcessor::task_worker(void *arg)
+    {
+        task_t *task    = reinterpret_cast<task_t *>(arg);
+        uint8_t *data   = NULL;
+        float *buf      = NULL;
+
+        if (task->nBufSize > 0)
+        {
+            buf             = alloc_aligned<float>(data, task->nBufSize);
+            if (buf == NULL)
+                return STATUS_NO_MEM;
+        }
+
+        while (true)
+        {
+            size_t item     = atomic_add(&task->nNext, 1);
+            if (item >= task->nItems)
+                break;
+            (task->pCore->*(task->pProc))(item, buf);
+            atomic_add(&task->nDone, 1);
+        }
 
+        free_aligned(data);
         return STATUS_OK;
     }
 
+    status_t SyncChirpProcessor::run_tasks(task_proc_t proc, size_t items, size_t bufsize)
+    {
+        if (items == 0)
+            return STATUS_OK;
+
+        task_t task;
+        task.pCore          = this;
+        task.pProc          = proc;
+        task.nItems         = items;
+        task.nBufSize       = bufsize;
+        task.nNext          = 0;
+        task.nDone          = 0;
+
+        // Launch additional workers, the calling thread also processes work items
+        cvector<ipc::Thread> workers;
+        size_t threads      = lsp_min(get_num_threads(), items);
+
+        for (size_t i = 1; i < threads; ++i)
+        {
+            ipc::Thread *t      = new ipc::Thread(task_worker, &task);
+            if (t == NULL)
+                break;
+            if ((t->start() != STATUS_OK) || (!workers.add(t)))
+            {
+                t->join();
+                delete t;
+                break;
+            }
+        }
+
+        task_worker(&task);
+
+        for (size_t i = 0, n = workers.size(); i < n; ++i)
+        {
+            ipc::Thread *t      = workers.at(i);
+            t->join();
+            delete t;
+        }
+        workers.flush();
+
+        return (task.nDone >= items) ? STATUS_OK : STATUS_NO_MEM;
+    }
+
     status_t SyncChirpProcessor::postprocess_linear_convolution(size_t channel, ssize_t offset, scp_rtcalc_t rtCalc, float windowSize, double tolerance)
     {
         if (pConvResult == NULL)
@@ -1701,7 +1929,7 @@ namespace lsp
         p.channels          = sConvParams.nChannels;
         p.sample_format     = __IF_LEBE(LSPC_SAMPLE_FMT_F32LE, LSPC_SAMPLE_FMT_F32BE);;
         p.sample_rate       = nSampleRate;
-        p.codec             = LSPC_CODEC_PCM;
+        p.codec             = LSPC_CODEC_LOSSLESS;
         p.frames            = dataLength;
 
         res = aw.open(&fd, &p);
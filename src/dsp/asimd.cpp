@@ -66,6 +66,7 @@ namespace asimd // TODO: make constants common for all architectures
 #include <dsp/arch/aarch64/asimd/search/minmax.h>
 #include <dsp/arch/aarch64/asimd/search/iminmax.h>
 #include <dsp/arch/aarch64/asimd/resampling.h>
+#include <dsp/arch/aarch64/asimd/pcm.h>
 #include <dsp/arch/aarch64/asimd/convolution.h>
 
 #include <dsp/arch/aarch64/asimd/complex.h>
@@ -79,6 +80,7 @@ namespace asimd // TODO: make constants common for all architectures
 #include <dsp/arch/aarch64/asimd/filters/dynamic.h>
 #include <dsp/arch/aarch64/asimd/filters/transfer.h>
 #include <dsp/arch/aarch64/asimd/filters/transform.h>
+#include <dsp/arch/aarch64/asimd/dynamics.h>
 
 
 #define EXPORT2(function, export)           dsp::function = asimd::export; TEST_EXPORT(asimd::export);
@@ -293,6 +295,11 @@ namespace asimd
         EXPORT1(biquad_process_x4);
         EXPORT1(biquad_process_x8);
 
+        // Interleaved biquad kernels are not verified on the hardware yet, keep native implementation
+//        EXPORT1(biquad_process_i2);
+//        EXPORT1(biquad_process_i4);
+//        EXPORT1(biquad_process_i8);
+
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
         EXPORT1(dyn_biquad_process_x4);
@@ -303,6 +310,10 @@ namespace asimd
         EXPORT1(filter_transfer_calc_pc);
         EXPORT1(filter_transfer_apply_pc);
 
+        // Envelope follower kernels are not verified on the hardware yet, keep native implementation
+//        EXPORT1(envelope_process_x4);
+//        EXPORT1(envelope_process_x8);
+
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
         EXPORT1(dyn_biquad_process_x4);
@@ -329,6 +340,19 @@ namespace asimd
         EXPORT1(downsample_4x);
         EXPORT1(downsample_6x);
         EXPORT1(downsample_8x);
+//        EXPORT1(cubic_interpolate); // Not verified on the hardware yet, keep native implementation
+
+        // PCM conversion kernels are not verified on the hardware yet, keep native implementation
+//        EXPORT1(pcm_s16_to_f32);
+//        EXPORT1(pcm_s24le_to_f32);
+//        EXPORT1(pcm_s24be_to_f32);
+//        EXPORT1(pcm_s32_to_f32);
+//        EXPORT1(pcm_f64_to_f32);
+//        EXPORT1(pcm_f32_to_s16);
+//        EXPORT1(pcm_f32_to_s24le);
+//        EXPORT1(pcm_f32_to_s24be);
+//        EXPORT1(pcm_f32_to_s32);
+//        EXPORT1(pcm_f32_to_f64);
 
         EXPORT1(convolve);
     }
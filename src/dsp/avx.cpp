@@ -44,6 +44,7 @@
 #include <dsp/arch/x86/avx/filters/dynamic.h>
 #include <dsp/arch/x86/avx/filters/transform.h>
 #include <dsp/arch/x86/avx/filters/transfer.h>
+#include <dsp/arch/x86/avx/dynamics.h>
 
 #include <dsp/arch/x86/avx/msmatrix.h>
 #include <dsp/arch/x86/avx/resampling.h>
@@ -220,17 +221,23 @@ namespace avx
         CEXPORT1(favx, biquad_process_x2);
         CEXPORT1(favx, biquad_process_x4);
         EXPORT2_X64(biquad_process_x8, x64_biquad_process_x8);
+        CEXPORT1(favx, biquad_process_i8);
 
         CEXPORT1(favx, dyn_biquad_process_x1);
         CEXPORT1(favx, dyn_biquad_process_x2);
         CEXPORT1(favx, dyn_biquad_process_x4);
         EXPORT2_X64(dyn_biquad_process_x8, x64_dyn_biquad_process_x8);
 
+        CEXPORT1(favx, envelope_process_x4);
+        CEXPORT1(favx, envelope_process_x8);
+
         CEXPORT1(favx, bilinear_transform_x1);
         CEXPORT1(favx, bilinear_transform_x2);
         CEXPORT1(favx, bilinear_transform_x4);
         CEXPORT2_X64(favx, bilinear_transform_x8, x64_bilinear_transform_x8);
 
+        CEXPORT1(favx, interpolate_cascades);
+
         CEXPORT1(favx, h_sum);
         CEXPORT1(favx, h_sqr_sum);
         CEXPORT1(favx, h_abs_sum);
@@ -274,6 +281,7 @@ namespace avx
         CEXPORT1(favx, fastconv_parse);
         CEXPORT1(favx, fastconv_restore);
         CEXPORT1(favx, fastconv_apply);
+        CEXPORT1(favx, fastconv_mul_add);
         CEXPORT1(favx, fastconv_parse_apply);
 
         CEXPORT1(favx, filter_transfer_calc_ri);
@@ -298,6 +306,10 @@ namespace avx
         CEXPORT1(favx, downsample_6x);
         CEXPORT1(favx, downsample_8x);
 
+        CEXPORT1(favx, cubic_interpolate);
+        CEXPORT1(favx, halfband_upsample_2x);
+        CEXPORT1(favx, halfband_downsample_2x);
+
         CEXPORT1(favx, convolve);
 
         // FMA3 support?
@@ -367,6 +379,7 @@ namespace avx
             CEXPORT2(favx, fastconv_parse, fastconv_parse_fma3);
             CEXPORT2(favx, fastconv_restore, fastconv_restore_fma3);
             CEXPORT2(favx, fastconv_apply, fastconv_apply_fma3);
+            CEXPORT2(favx, fastconv_mul_add, fastconv_mul_add_fma3);
             CEXPORT2(favx, fastconv_parse_apply, fastconv_parse_apply_fma3);
 
             CEXPORT2(favx, filter_transfer_calc_ri, filter_transfer_calc_ri_fma3);
@@ -375,12 +388,15 @@ namespace avx
             CEXPORT2(favx, filter_transfer_apply_pc, filter_transfer_apply_pc_fma3);
 
             CEXPORT2(favx, convolve, convolve_fma3);
+            CEXPORT2(favx, halfband_upsample_2x, halfband_upsample_2x_fma3);
+            CEXPORT2(favx, halfband_downsample_2x, halfband_downsample_2x_fma3);
 
 
             CEXPORT2(favx, biquad_process_x1, biquad_process_x1_fma3);
             CEXPORT2(favx, biquad_process_x2, biquad_process_x2_fma3);
             CEXPORT2(favx, biquad_process_x4, biquad_process_x4_fma3);
             CEXPORT2(ffma, biquad_process_x8, biquad_process_x8_fma3);
+            CEXPORT2(favx, biquad_process_i8, biquad_process_i8_fma3);
 
             CEXPORT2(ffma, dyn_biquad_process_x1, dyn_biquad_process_x1_fma3);
             CEXPORT2(favx, dyn_biquad_process_x2, dyn_biquad_process_x2_fma3);
@@ -30,6 +30,8 @@
 #include <dsp/arch/x86/avx2/graphics/transpose.h>
 #include <dsp/arch/x86/avx2/graphics/effects.h>
 
+#include <dsp/arch/x86/avx2/pcm.h>
+
 #undef DSP_ARCH_X86_AVX2_IMPL
 
 namespace avx2
@@ -147,6 +149,17 @@ namespace avx2
         CEXPORT1(favx, normalize_fft2);
         CEXPORT1(favx, normalize_fft3);
 
+        CEXPORT1(favx, pcm_s16_to_f32);
+        CEXPORT1(favx, pcm_s24le_to_f32);
+        CEXPORT1(favx, pcm_s24be_to_f32);
+        CEXPORT1(favx, pcm_s32_to_f32);
+        CEXPORT1(favx, pcm_f64_to_f32);
+        CEXPORT1(favx, pcm_f32_to_s16);
+        CEXPORT1(favx, pcm_f32_to_s24le);
+        CEXPORT1(favx, pcm_f32_to_s24be);
+        CEXPORT1(favx, pcm_f32_to_s32);
+        CEXPORT1(favx, pcm_f32_to_f64);
+
         if (f->features & CPU_OPTION_FMA3)
         {
             CEXPORT2_X64(favx, mod_k2, mod_k2_fma3);
@@ -249,6 +249,7 @@ namespace dsp
     void    (* fastconv_parse_apply)(float *dst, float *tmp, const float *c, const float *src, size_t rank) = NULL;
     void    (* fastconv_restore)(float *dst, float *tmp, size_t rank) = NULL;
     void    (* fastconv_apply)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank) = NULL;
+    void    (* fastconv_mul_add)(float *dst, const float *c1, const float *c2, size_t rank) = NULL;
 
     void    (* lr_to_ms)(float *m, float *s, const float *l, const float *r, size_t count) = NULL;
     void    (* lr_to_mid)(float *m, const float *l, const float *r, size_t count) = NULL;
@@ -258,11 +259,18 @@ namespace dsp
     void    (* ms_to_right)(float *r, const float *m, const float *s, size_t count) = NULL;
     void    (* avoid_denormals)(float *dst, const float *src, size_t count) = NULL;
 
+    void    (* envelope_process_x4)(float *dst, const float *src, envelope_x4_t *e, size_t count) = NULL;
+    void    (* envelope_process_x8)(float *dst, const float *src, envelope_x8_t *e, size_t count) = NULL;
+
     void    (* biquad_process_x1)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
     void    (* biquad_process_x2)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
     void    (* biquad_process_x4)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
     void    (* biquad_process_x8)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
 
+    void    (* biquad_process_i2)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
+    void    (* biquad_process_i4)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
+    void    (* biquad_process_i8)(float *dst, const float *src, size_t count, biquad_t *f) = NULL;
+
     void    (* dyn_biquad_process_x1)(float *dst, const float *src, float *d, size_t count, const biquad_x1_t *f) = NULL;
     void    (* dyn_biquad_process_x2)(float *dst, const float *src, float *d, size_t count, const biquad_x2_t *f) = NULL;
     void    (* dyn_biquad_process_x4)(float *dst, const float *src, float *d, size_t count, const biquad_x4_t *f) = NULL;
@@ -283,6 +291,8 @@ namespace dsp
     void    (* matched_transform_x4)(biquad_x4_t *bf, f_cascade_t *bc, float kf, float td, size_t count) = NULL;
     void    (* matched_transform_x8)(biquad_x8_t *bf, f_cascade_t *bc, float kf, float td, size_t count) = NULL;
 
+    void    (* interpolate_cascades)(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count) = NULL;
+
     void    (* axis_apply_log1)(float *x, const float *v, float zero, float norm_x, size_t count) = NULL;
     void    (* axis_apply_log2)(float *x, float *y, const float *v, float zero, float norm_x, float norm_y, size_t count) = NULL;
     void    (* rgba32_to_bgra32)(void *dst, const void *src, size_t count) = NULL;
@@ -318,6 +328,10 @@ namespace dsp
     void    (* downsample_6x)(float *dst, const float *src, size_t count) = NULL;
     void    (* downsample_8x)(float *dst, const float *src, size_t count) = NULL;
 
+    void    (* cubic_interpolate)(float *dst, const float *src, float pos, float step, size_t count) = NULL;
+    void    (* halfband_upsample_2x)(float *dst, const float *src, const float *k, size_t taps, size_t count) = NULL;
+    void    (* halfband_downsample_2x)(float *dst, const float *src, const float *k, size_t taps, size_t count) = NULL;
+
     // 3D mathematics
     void    (* init_point_xyz)(point3d_t *p, float x, float y, float z) = NULL;
     void    (* init_point)(point3d_t *p, const point3d_t *s) = NULL;
@@ -471,6 +485,17 @@ namespace dsp
 
     size_t  (* base64_enc)(void *dst, size_t *dst_left, const void *src, size_t *src_left) = NULL;
     ssize_t (* base64_dec)(void *dst, size_t *dst_left, const void *src, size_t *src_left) = NULL;
+
+    void    (* pcm_s16_to_f32)(float *dst, const int16_t *src, size_t count) = NULL;
+    void    (* pcm_s24le_to_f32)(float *dst, const uint8_t *src, size_t count) = NULL;
+    void    (* pcm_s24be_to_f32)(float *dst, const uint8_t *src, size_t count) = NULL;
+    void    (* pcm_s32_to_f32)(float *dst, const int32_t *src, size_t count) = NULL;
+    void    (* pcm_f64_to_f32)(float *dst, const double *src, size_t count) = NULL;
+    void    (* pcm_f32_to_s16)(int16_t *dst, const float *src, size_t count) = NULL;
+    void    (* pcm_f32_to_s24le)(uint8_t *dst, const float *src, size_t count) = NULL;
+    void    (* pcm_f32_to_s24be)(uint8_t *dst, const float *src, size_t count) = NULL;
+    void    (* pcm_f32_to_s32)(int32_t *dst, const float *src, size_t count) = NULL;
+    void    (* pcm_f32_to_f64)(double *dst, const float *src, size_t count) = NULL;
 }
 
 namespace dsp
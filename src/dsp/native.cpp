@@ -43,6 +43,7 @@
 #include <dsp/arch/native/filters/dynamic.h>
 #include <dsp/arch/native/filters/transform.h>
 #include <dsp/arch/native/filters/transfer.h>
+#include <dsp/arch/native/dynamics.h>
 
 #include <dsp/arch/native/fft.h>
 #include <dsp/arch/native/fastconv.h>
@@ -54,6 +55,7 @@
 #include <dsp/arch/native/3dmath.h>
 
 #include <dsp/arch/native/coding.h>
+#include <dsp/arch/native/pcm.h>
 
 #undef __DSP_NATIVE_IMPL
 
@@ -239,6 +241,7 @@ namespace native
         EXPORT1(fastconv_parse_apply);
         EXPORT1(fastconv_restore);
         EXPORT1(fastconv_apply);
+        EXPORT1(fastconv_mul_add);
 
         EXPORT1(complex_mul2);
         EXPORT1(complex_mul3);
@@ -286,11 +289,18 @@ namespace native
         EXPORT1(biquad_process_x4);
         EXPORT1(biquad_process_x8);
 
+        EXPORT1(biquad_process_i2);
+        EXPORT1(biquad_process_i4);
+        EXPORT1(biquad_process_i8);
+
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
         EXPORT1(dyn_biquad_process_x4);
         EXPORT1(dyn_biquad_process_x8);
 
+        EXPORT1(envelope_process_x4);
+        EXPORT1(envelope_process_x8);
+
         EXPORT1(filter_transfer_calc_ri);
         EXPORT1(filter_transfer_apply_ri);
         EXPORT1(filter_transfer_calc_pc);
@@ -306,6 +316,8 @@ namespace native
         EXPORT1(matched_transform_x4);
         EXPORT1(matched_transform_x8);
 
+        EXPORT1(interpolate_cascades);
+
         EXPORT1(axis_apply_log1);
         EXPORT1(axis_apply_log2);
         EXPORT1(rgba32_to_bgra32);
@@ -343,6 +355,10 @@ namespace native
         EXPORT1(downsample_6x);
         EXPORT1(downsample_8x);
 
+        EXPORT1(cubic_interpolate);
+        EXPORT1(halfband_upsample_2x);
+        EXPORT1(halfband_downsample_2x);
+
         // 3D math
         EXPORT1(init_point_xyz);
         EXPORT1(init_point);
@@ -497,6 +513,17 @@ namespace native
 
         EXPORT1(base64_enc);
         EXPORT1(base64_dec);
+
+        EXPORT1(pcm_s16_to_f32);
+        EXPORT1(pcm_s24le_to_f32);
+        EXPORT1(pcm_s24be_to_f32);
+        EXPORT1(pcm_s32_to_f32);
+        EXPORT1(pcm_f64_to_f32);
+        EXPORT1(pcm_f32_to_s16);
+        EXPORT1(pcm_f32_to_s24le);
+        EXPORT1(pcm_f32_to_s24be);
+        EXPORT1(pcm_f32_to_s32);
+        EXPORT1(pcm_f32_to_f64);
     }
 
     #undef EXPORT1
@@ -73,11 +73,13 @@ namespace neon_d32 // TODO: make constants common for all architectures
 #include <dsp/arch/arm/neon-d32/float.h>
 #include <dsp/arch/arm/neon-d32/msmatrix.h>
 #include <dsp/arch/arm/neon-d32/resampling.h>
+#include <dsp/arch/arm/neon-d32/pcm.h>
 
 #include <dsp/arch/arm/neon-d32/filters/static.h>
 #include <dsp/arch/arm/neon-d32/filters/dynamic.h>
 #include <dsp/arch/arm/neon-d32/filters/transform.h>
 #include <dsp/arch/arm/neon-d32/filters/transfer.h>
+#include <dsp/arch/arm/neon-d32/dynamics.h>
 
 #include <dsp/arch/arm/neon-d32/fft.h>
 #include <dsp/arch/arm/neon-d32/fastconv.h>
@@ -284,6 +286,12 @@ namespace neon_d32
         EXPORT1(downsample_4x);
         EXPORT1(downsample_6x);
         EXPORT1(downsample_8x);
+//        EXPORT1(cubic_interpolate); // Not verified on the hardware yet, keep native implementation
+
+        // PCM conversion kernels are not verified on the hardware yet, keep native implementation
+//        EXPORT1(pcm_f32_to_s16);
+//        EXPORT1(pcm_f32_to_s24le);
+//        EXPORT1(pcm_f32_to_s24be);
 
         EXPORT1(min);
         EXPORT1(max);
@@ -304,6 +312,11 @@ namespace neon_d32
         EXPORT1(biquad_process_x4);
         EXPORT1(biquad_process_x8);
 
+        // Interleaved biquad kernels are not verified on the hardware yet, keep native implementation
+//        EXPORT1(biquad_process_i2);
+//        EXPORT1(biquad_process_i4);
+//        EXPORT1(biquad_process_i8);
+
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
         EXPORT1(dyn_biquad_process_x4);
@@ -314,6 +327,10 @@ namespace neon_d32
         EXPORT1(filter_transfer_calc_pc);
         EXPORT1(filter_transfer_apply_pc);
 
+        // Envelope follower kernels are not verified on the hardware yet, keep native implementation
+//        EXPORT1(envelope_process_x4);
+//        EXPORT1(envelope_process_x8);
+
         EXPORT1(bilinear_transform_x1);
         EXPORT1(bilinear_transform_x2);
         EXPORT1(bilinear_transform_x4);
@@ -82,6 +82,7 @@ namespace sse // TODO: make constants common for all architectures
 #include <dsp/arch/x86/sse/filters/dynamic.h>
 #include <dsp/arch/x86/sse/filters/transform.h>
 #include <dsp/arch/x86/sse/filters/transfer.h>
+#include <dsp/arch/x86/sse/dynamics.h>
 
 #include <dsp/arch/x86/sse/3dmath.h>
 
@@ -264,6 +265,7 @@ namespace sse
         EXPORT1(fastconv_parse_apply);
         EXPORT1(fastconv_restore);
         EXPORT1(fastconv_apply);
+        EXPORT1(fastconv_mul_add);
 
         EXPORT1(complex_mul2);
         EXPORT1(complex_mul3);
@@ -300,11 +302,18 @@ namespace sse
         EXPORT1(biquad_process_x4);
         EXPORT1(biquad_process_x8);
 
+        EXPORT1(biquad_process_i2);
+        EXPORT1(biquad_process_i4);
+        EXPORT1(biquad_process_i8);
+
         EXPORT1(dyn_biquad_process_x1);
         EXPORT1(dyn_biquad_process_x2);
         EXPORT1(dyn_biquad_process_x4);
         EXPORT1(dyn_biquad_process_x8);
 
+        EXPORT1(envelope_process_x4);
+        EXPORT1(envelope_process_x8);
+
         EXPORT1(filter_transfer_calc_ri);
         EXPORT1(filter_transfer_apply_ri);
         EXPORT1(filter_transfer_calc_pc);
@@ -315,6 +324,8 @@ namespace sse
         EXPORT1(bilinear_transform_x4);
         EXPORT1(bilinear_transform_x8);
 
+        EXPORT1(interpolate_cascades);
+
         EXPORT1(fill_rgba);
         EXPORT1(fill_hsla);
 
@@ -335,6 +346,10 @@ namespace sse
         EXPORT1(downsample_6x);
         EXPORT1(downsample_8x);
 
+        EXPORT1(cubic_interpolate);
+        EXPORT1(halfband_upsample_2x);
+        EXPORT1(halfband_downsample_2x);
+
         // 3D Math
         EXPORT1(init_point_xyz);
         EXPORT1(init_point);
@@ -62,6 +62,8 @@ namespace sse2 // TODO: make constants common for all architectures
 #include <dsp/arch/x86/sse2/pmath/log.h>
 #include <dsp/arch/x86/sse2/pmath/pow.h>
 
+#include <dsp/arch/x86/sse2/pcm.h>
+
 #undef DSP_ARCH_X86_SSE2_IMPL
 
 namespace sse2
@@ -134,6 +136,17 @@ namespace sse2
         EXPORT1(axis_apply_log1);
         EXPORT1(axis_apply_log2);
         EXPORT1(rgba32_to_bgra32);
+
+        EXPORT1(pcm_s16_to_f32);
+        EXPORT1(pcm_s24le_to_f32);
+        EXPORT1(pcm_s24be_to_f32);
+        EXPORT1(pcm_s32_to_f32);
+        EXPORT1(pcm_f64_to_f32);
+        EXPORT1(pcm_f32_to_s16);
+        EXPORT1(pcm_f32_to_s24le);
+        EXPORT1(pcm_f32_to_s24be);
+        EXPORT1(pcm_f32_to_s32);
+        EXPORT1(pcm_f32_to_f64);
     }
 
     #undef EXPORT1
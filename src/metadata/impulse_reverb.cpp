@@ -47,6 +47,10 @@ namespace lsp
         { "16384",  NULL },
         { "32767",  NULL },
         { "65536",  NULL },
+        { "131072", NULL },
+        { "262144", NULL },
+        { "524288", NULL },
+        { "1048576", NULL },
         { NULL, NULL }
     };
 
@@ -79,6 +83,8 @@ namespace lsp
         BYPASS, \
         COMBO("fsel", "File selector", 0, ir_file_select), \
         COMBO("fft", "FFT size", impulse_reverb_base_metadata::FFT_RANK_DEFAULT, ir_fft_rank), \
+        SWITCH("bgp", "Background processing", 0.0f), \
+        UNLIMITED_METER("ldc", "Late deadline counter", U_NONE, 0.0f), \
         CONTROL("pd", "Pre-delay", U_MSEC, impulse_reverb_base_metadata::PREDELAY), \
         pan, \
         DRY_GAIN(1.0f), \
@@ -185,7 +191,7 @@ namespace lsp
         "impulse_reverb_mono",
         "fggq",
         0,
-        LSP_VERSION(1, 0, 1),
+        LSP_VERSION(1, 0, 2),
         impulse_reverb_classes,
         E_NONE,
         impulse_reverb_mono_ports,
@@ -203,7 +209,7 @@ namespace lsp
         "impulse_reverb_stereo",
         "o9zj",
         0,
-        LSP_VERSION(1, 0, 1),
+        LSP_VERSION(1, 0, 2),
         impulse_reverb_classes,
         E_NONE,
         impulse_reverb_stereo_ports,
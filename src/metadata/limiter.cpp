@@ -68,6 +68,20 @@ namespace lsp
         { "Full x8(2L)",    "oversampler.full.8x2" },
         { "Full x8(3L)",    "oversampler.full.8x3" },
 
+        { "FIR x2 (fast)",  "oversampler.fir.2x_fast" },
+        { "FIR x2 (normal)","oversampler.fir.2x_normal" },
+        { "FIR x2 (high)",  "oversampler.fir.2x_high" },
+        { "FIR x4 (fast)",  "oversampler.fir.4x_fast" },
+        { "FIR x4 (normal)","oversampler.fir.4x_normal" },
+        { "FIR x4 (high)",  "oversampler.fir.4x_high" },
+        { "FIR x8 (fast)",  "oversampler.fir.8x_fast" },
+        { "FIR x8 (normal)","oversampler.fir.8x_normal" },
+        { "FIR x8 (high)",  "oversampler.fir.8x_high" },
+
+        { "IIR x2",         "oversampler.iir.2x" },
+        { "IIR x4",         "oversampler.iir.4x" },
+        { "IIR x8",         "oversampler.iir.8x" },
+
         { NULL, NULL }
     };
 
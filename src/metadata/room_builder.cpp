@@ -21,6 +21,10 @@ namespace lsp
         { "16384",  NULL },
         { "32767",  NULL },
         { "65536",  NULL },
+        { "131072", NULL },
+        { "262144", NULL },
+        { "524288", NULL },
+        { "1048576", NULL },
         { NULL, NULL }
     };
 
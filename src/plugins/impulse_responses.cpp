@@ -195,6 +195,7 @@ namespace lsp
             if (!c->sEqualizer.init(impulse_responses_base_metadata::EQ_BANDS + 2, CONV_RANK))
                 return;
             c->sEqualizer.set_mode(EQM_BYPASS);
+            c->sEqualizer.set_executor(pExecutor);
 
             c->pCurr        = NULL;
             c->pSwap        = NULL;
@@ -770,9 +771,9 @@ namespace lsp
         if (af == NULL)
             return STATUS_NO_MEM;
 
-        // Try to load file
+        // Try to map file, files that can not be mapped are loaded
         float convLengthMaxSeconds = impulse_reverb_base_metadata::CONV_LENGTH_MAX * 0.001f;
-        status_t status = af->load(fname,  convLengthMaxSeconds);
+        status_t status = af->map(fname, convLengthMaxSeconds);
         if (status != STATUS_OK)
         {
             af->destroy();
@@ -782,7 +783,7 @@ namespace lsp
         }
 
         // Try to resample
-        status  = af->resample(fSampleRate);
+        status  = af->resample(fSampleRate, pExecutor);
         if (status != STATUS_OK)
         {
             af->destroy();
@@ -60,6 +60,7 @@ namespace lsp
             sReconfig.nTrack[i]     = 0;
             sReconfig.nRank[i]      = 0;
         }
+        sReconfig.bBackground   = false;
     }
 
     impulse_reverb_base::IRConfigurator::~IRConfigurator()
@@ -79,9 +80,13 @@ namespace lsp
         nInputs         = inputs;
         nReconfigReq    = 0;
         nReconfigResp   = -1;
+        bBackground     = false;
+        nLateDeadlines  = 0;
 
         pBypass         = NULL;
         pRank           = NULL;
+        pBackground     = NULL;
+        pLateDeadlines  = NULL;
         pDry            = NULL;
         pWet            = NULL;
         pOutGain        = NULL;
@@ -279,6 +284,7 @@ namespace lsp
             if (!c->sEqualizer.init(impulse_reverb_base_metadata::EQ_BANDS + 2, CONV_RANK))
                 return;
             c->sEqualizer.set_mode(EQM_BYPASS);
+            c->sEqualizer.set_executor(pExecutor);
 
             c->fDryPan[0]   = 0.0f;
             c->fDryPan[1]   = 0.0f;
@@ -322,6 +328,10 @@ namespace lsp
         port_id++;
         TRACE_PORT(vPorts[port_id]);            // FFT rank
         pRank       = vPorts[port_id++];
+        TRACE_PORT(vPorts[port_id]);            // Background processing
+        pBackground = vPorts[port_id++];
+        TRACE_PORT(vPorts[port_id]);            // Late deadline counter
+        pLateDeadlines  = vPorts[port_id++];
         TRACE_PORT(vPorts[port_id]);            // Pre-delay
         pPredelay   = vPorts[port_id++];
 
@@ -460,6 +470,15 @@ namespace lsp
         bool bypass         = pBypass->getValue() >= 0.5f;
         float predelay      = pPredelay->getValue();
         size_t rank         = get_fft_rank(pRank->getValue());
+        bool background     = pBackground->getValue() >= 0.5f;
+
+        // Background processing mode requires all convolvers to be re-created
+        if (background != bBackground)
+        {
+            bBackground         = background;
+            nLateDeadlines      = 0;
+            nReconfigReq        ++;
+        }
 
         // Adjust volume of dry channel
         if (nInputs == 1)
@@ -710,6 +729,7 @@ namespace lsp
                 sConfigurator.set_track(i, vConvolvers[i].nTrackReq);
                 sConfigurator.set_rank(i, vConvolvers[i].nRankReq);
             }
+            sConfigurator.set_background(bBackground);
 
             // Try to submit task
             if (pExecutor->submit(&sConfigurator))
@@ -724,6 +744,14 @@ namespace lsp
         }
         else if (sConfigurator.completed())
         {
+            // Background tasks of current convolvers should be finished before swapping
+            for (size_t i=0; i<impulse_reverb_base_metadata::CONVOLVERS; ++i)
+            {
+                AsyncConvolver *cv  = vConvolvers[i].pCurr;
+                if ((cv != NULL) && (!cv->idle()))
+                    return;
+            }
+
             // Update samples
             for (size_t i=0; i<impulse_reverb_base_metadata::FILES; ++i)
             {
@@ -750,7 +778,7 @@ namespace lsp
             for (size_t i=0; i<impulse_reverb_base_metadata::CONVOLVERS; ++i)
             {
                 convolver_t *c  = &vConvolvers[i];
-                Convolver *cv   = c->pCurr;
+                AsyncConvolver *cv  = c->pCurr;
                 c->pCurr        = c->pSwap;
                 c->pSwap        = cv;
             }
@@ -798,9 +826,13 @@ namespace lsp
                 else
                     dsp::mix_copy2(c->vBuffer, vInputs[0].vIn, vInputs[1].vIn, c->fPanIn[0], c->fPanIn[1], to_do);
 
-                // Do processing
+                // Do processing, do not submit new background tasks when convolvers are going to be swapped
                 if (c->pCurr != NULL)
+                {
                     c->pCurr->process(c->vBuffer, c->vBuffer, to_do);
+                    if (!sConfigurator.completed())
+                        c->pCurr->submit(pExecutor);
+                }
                 else
                     dsp::fill_zero(c->vBuffer, to_do);
                 c->sDelay.process(c->vBuffer, c->vBuffer, to_do);
@@ -845,7 +877,10 @@ namespace lsp
             // Output information about the convolver
             convolver_t *c          = &vConvolvers[i];
             c->pActivity->setValue(c->pCurr != NULL);
+            if (c->pCurr != NULL)
+                nLateDeadlines         += c->pCurr->fetch_late();
         }
+        pLateDeadlines->setValue(nLateDeadlines);
 
         for (size_t i=0; i<impulse_reverb_base_metadata::FILES; ++i)
         {
@@ -910,9 +945,9 @@ namespace lsp
         if (af == NULL)
             return STATUS_NO_MEM;
 
-        // Try to load file
+        // Try to map file, files that can not be mapped are loaded
         float convLengthMaxSeconds = impulse_reverb_base_metadata::CONV_LENGTH_MAX * 0.001f;
-        status_t status = af->load(fname, convLengthMaxSeconds);
+        status_t status = af->map(fname, convLengthMaxSeconds);
         if (status != STATUS_OK)
         {
             af->destroy();
@@ -922,7 +957,7 @@ namespace lsp
         }
 
         // Try to resample
-        status  = af->resample(fSampleRate);
+        status  = af->resample(fSampleRate, pExecutor);
         if (status != STATUS_OK)
         {
             af->destroy();
@@ -957,7 +992,7 @@ namespace lsp
         for (size_t i=0; i<impulse_reverb_base_metadata::CONVOLVERS; ++i)
         {
             convolver_t *c      = &vConvolvers[i];
-            Convolver *cv       = c->pSwap;
+            AsyncConvolver *cv  = c->pSwap;
             if (cv == NULL)
                 continue;
 
@@ -1061,6 +1096,15 @@ namespace lsp
         phase           = ((phase << 16) | (phase >> 16)) & 0x7fffffff;
         uint32_t step   = 0x80000000 / (impulse_reverb_base_metadata::CONVOLVERS + 1);
 
+        // Compute the part of impulse response that is processed in real time
+        size_t delay    = 0;
+        if (cfg->bBackground)
+        {
+            delay           = millis_to_samples(fSampleRate, impulse_reverb_base_metadata::BG_DELAY);
+            if (delay < TMP_BUF_SIZE)
+                delay           = TMP_BUF_SIZE;
+        }
+
         // OK, files have been rendered, now need to commutate
         for (size_t i=0; i<impulse_reverb_base_metadata::CONVOLVERS; ++i)
         {
@@ -1084,8 +1128,8 @@ namespace lsp
                 continue;
 
             // Now we can create convolver
-            Convolver *cv   = new Convolver();
-            if (!cv->init(s->getBuffer(track), s->length(), cfg->nRank[i], float((phase + i*step)& 0x7fffffff)/float(0x80000000)))
+            AsyncConvolver *cv  = new AsyncConvolver();
+            if (!cv->init(s->getBuffer(track), s->length(), cfg->nRank[i], float((phase + i*step)& 0x7fffffff)/float(0x80000000), delay))
             {
                 cv->destroy();
                 delete cv;
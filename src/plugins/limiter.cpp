@@ -127,7 +127,7 @@ namespace lsp
             if (!c->sScOver.init())
                 return;
             // Initialize limiter with latency compensation gap
-            float lk_latency = int(samples_to_millis(MAX_SAMPLE_RATE, limiter_base_metadata::OVERSAMPLING_MAX)) + 1.0f;
+            float lk_latency = int(samples_to_millis(MAX_SAMPLE_RATE, OS_LATENCY_MAX)) + 1.0f;
             if (!c->sLimit.init(MAX_SAMPLE_RATE * limiter_base_metadata::OVERSAMPLING_MAX, limiter_base_metadata::LOOKAHEAD_MAX + lk_latency))
                 return;
         }
@@ -316,6 +316,19 @@ namespace lsp
             L_KEY(8X2)
             L_KEY(8X3)
 
+            case limiter_base_metadata::OVS_FIR_2X_FAST:    return OM_HALFBAND_2X_FAST;
+            case limiter_base_metadata::OVS_FIR_2X_NORMAL:  return OM_HALFBAND_2X_NORMAL;
+            case limiter_base_metadata::OVS_FIR_2X_HIGH:    return OM_HALFBAND_2X_HIGH;
+            case limiter_base_metadata::OVS_FIR_4X_FAST:    return OM_HALFBAND_4X_FAST;
+            case limiter_base_metadata::OVS_FIR_4X_NORMAL:  return OM_HALFBAND_4X_NORMAL;
+            case limiter_base_metadata::OVS_FIR_4X_HIGH:    return OM_HALFBAND_4X_HIGH;
+            case limiter_base_metadata::OVS_FIR_8X_FAST:    return OM_HALFBAND_8X_FAST;
+            case limiter_base_metadata::OVS_FIR_8X_NORMAL:  return OM_HALFBAND_8X_NORMAL;
+            case limiter_base_metadata::OVS_FIR_8X_HIGH:    return OM_HALFBAND_8X_HIGH;
+            case limiter_base_metadata::OVS_IIR_2X:         return OM_HALFBAND_IIR_2X;
+            case limiter_base_metadata::OVS_IIR_4X:         return OM_HALFBAND_IIR_4X;
+            case limiter_base_metadata::OVS_IIR_8X:         return OM_HALFBAND_IIR_8X;
+
             case limiter_base_metadata::OVS_NONE:
             default:
                 return OM_NONE;
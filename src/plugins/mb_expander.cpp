@@ -112,6 +112,7 @@ namespace lsp
                     // Band buffers
                     (
                         MBE_BUFFER_SIZE * sizeof(float) + // vVCA of each band
+                        MBE_BUFFER_SIZE * sizeof(float) + // vEnv of each band
                         mb_expander_base_metadata::FFT_MESH_POINTS * 2 * sizeof(float) // vTr transfer function for each band
                     ) * mb_expander_base_metadata::BANDS_MAX
                 ) * channels;
@@ -151,6 +152,7 @@ namespace lsp
         // Initialize filters according to number of bands
         if (sFilters.init(mb_expander_base_metadata::BANDS_MAX * channels) != STATUS_OK)
             return;
+        sFilters.set_interpolation(DYNAMIC_FILTERS_INTERP_DFL);
         size_t filter_cid = 0;
 
         // Initialize channels
@@ -228,6 +230,8 @@ namespace lsp
 
                 b->vVCA         = reinterpret_cast<float *>(ptr);
                 ptr            += MBE_BUFFER_SIZE * sizeof(float);
+                b->vEnv         = reinterpret_cast<float *>(ptr);
+                ptr            += MBE_BUFFER_SIZE * sizeof(float);
                 b->vTr          = reinterpret_cast<float *>(ptr);
                 ptr            += mb_expander_base_metadata::FFT_MESH_POINTS * sizeof(float) * 2;
 
@@ -1123,6 +1127,10 @@ namespace lsp
             }
 
             // MAIN PLUGIN STUFF
+            Expander *vc[mb_expander_base_metadata::BANDS_MAX * 2];
+            float *vout[mb_expander_base_metadata::BANDS_MAX * 2], *venv[mb_expander_base_metadata::BANDS_MAX * 2];
+            const float *vin[mb_expander_base_metadata::BANDS_MAX * 2];
+            size_t n_proc       = 0;
             for (size_t i=0; i<channels; ++i)
             {
                 channel_t *c        = &vChannels[i];
@@ -1131,24 +1139,51 @@ namespace lsp
                 {
                     exp_band_t *b       = c->vPlan[j];
 
-                    // Prepare sidechain signal with band equalizers
-                    b->sEQ[0].process(vSc[0], (b->bExtSc) ? vChannels[0].vExtScBuffer : vChannels[0].vScBuffer, to_process);
-                    if (channels > 1)
-                        b->sEQ[1].process(vSc[1], (b->bExtSc) ? vChannels[1].vExtScBuffer : vChannels[1].vScBuffer, to_process);
+                    // Prepare sidechain signal with band equalizers, equalizers of all channels have the same settings
+                    Equalizer *veq[2];
+                    const float *vsc[2];
+                    for (size_t k=0; k<channels; ++k)
+                    {
+                        veq[k]              = &b->sEQ[k];
+                        vsc[k]              = (b->bExtSc) ? vChannels[k].vExtScBuffer : vChannels[k].vScBuffer;
+                    }
+                    Equalizer::process(veq, vSc, vsc, channels, to_process);
 
                     // Preprocess VCA signal
                     b->sSC.process(vBuffer, const_cast<const float **>(vSc), to_process); // Band now contains processed by sidechain signal
-                    b->sDelay.process(vBuffer, vBuffer, b->fScPreamp, to_process); // Apply sidechain preamp and lookahead delay
+                    b->sDelay.process(b->vVCA, vBuffer, b->fScPreamp, to_process); // Apply sidechain preamp and lookahead delay
+
+                    // Schedule the band for processing
+                    if (b->bEnabled)
+                    {
+                        vc[n_proc]          = &b->sExp;
+                        vout[n_proc]        = b->vVCA;
+                        venv[n_proc]        = b->vEnv;
+                        vin[n_proc]         = b->vVCA;
+                        ++n_proc;
+                    }
+                }
+            }
+
+            // Compute envelopes and gain of all enabled bands at once
+            Expander::process(vc, vout, venv, vin, n_proc, to_process);
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+
+                for (size_t j=0; j<c->nPlanSize; ++j)
+                {
+                    exp_band_t *b       = c->vPlan[j];
 
                     if (b->bEnabled)
                     {
-                        b->sExp.process(b->vVCA, vEnv, vBuffer, to_process); // Output
                         if ((bModern) && (b->sExp.is_downward()))
                             dsp::limit1(b->vVCA, GAIN_AMP_M_72_DB, GAIN_AMP_P_72_DB, to_process);
                         dsp::mul_k2(b->vVCA, b->fMakeup, to_process); // Apply makeup gain
 
                         // Output curve level
-                        float lvl = dsp::abs_max(vEnv, to_process);
+                        float lvl = dsp::abs_max(b->vEnv, to_process);
                         b->pEnvLvl->setValue(lvl);
                         b->pMeterGain->setValue(b->sExp.amplification(lvl));
                         lvl = b->sExp.curve(lvl) * b->fMakeup;
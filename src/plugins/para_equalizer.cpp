@@ -345,6 +345,7 @@ namespace lsp
 
         // Determine number of channels
         size_t channels     = (nMode == EQ_MONO) ? 1 : 2;
+        ipc::IExecutor *executor = wrapper->get_executor();
 
         // Initialize analyzer
         if (!sAnalyzer.init(channels, para_equalizer_base_metadata::FFT_RANK))
@@ -428,6 +429,7 @@ namespace lsp
                 return;
 
             c->sEqualizer.init(nFilters, EQ_RANK);
+            c->sEqualizer.set_executor(executor);
 
             // Initialize filters
             for (size_t j=0; j<nFilters; ++j)
@@ -871,17 +873,36 @@ namespace lsp
                 }
             }
 
-            // Process each channel individually
+            // Do FFT in 'PRE'-position
+            if (fft_pos == FFTP_PRE)
+            {
+                for (size_t i=0; i<channels; ++i)
+                    sAnalyzer.process(i, vChannels[i].vBuffer, to_process);
+            }
+
+            // Process the signal by the equalizers, linked stereo channels are processed at once
+            if (nMode == EQ_STEREO)
+            {
+                Equalizer *veq[2];
+                float *vbuf[2];
+                for (size_t i=0; i<channels; ++i)
+                {
+                    veq[i]              = &vChannels[i].sEqualizer;
+                    vbuf[i]             = vChannels[i].vBuffer;
+                }
+                Equalizer::process(veq, vbuf, const_cast<const float **>(vbuf), channels, to_process);
+            }
+            else
+            {
+                for (size_t i=0; i<channels; ++i)
+                    vChannels[i].sEqualizer.process(vChannels[i].vBuffer, vChannels[i].vBuffer, to_process);
+            }
+
             for (size_t i=0; i<channels; ++i)
             {
                 eq_channel_t *c     = &vChannels[i];
 
-                // Do FFT in 'PRE'-position
-                if (fft_pos == FFTP_PRE)
-                    sAnalyzer.process(i, c->vBuffer, to_process);
-
-                // Process the signal by the equalizer
-                c->sEqualizer.process(c->vBuffer, c->vBuffer, to_process);
+                // Apply input gain of the channel
                 if (c->fInGain != 1.0f)
                     dsp::mul_k2(c->vBuffer, c->fInGain, to_process);
 
@@ -6,6 +6,7 @@
  */
 
 #include <dsp/dsp.h>
+#include <dsp/bits.h>
 
 #include <plugins/phase_detector.h>
 #include <core/debug.h>
@@ -24,6 +25,8 @@ namespace lsp
         vFunction           = NULL;
         vAccumulated        = NULL;
         vNormalized         = NULL;
+        vFftSignal          = NULL;
+        vFftSpectrum        = NULL;
 
         nMaxVectorSize      = 0;
         nVectorSize         = 0;
@@ -36,6 +39,10 @@ namespace lsp
         nMaxGapSize         = 0;
         nGapOffset          = 0;
 
+        nFftRank            = 0;
+        nFftBlock           = 0;
+        nFftThresh          = 0;
+
         vA.nSize            = 0;
         vA.pData            = NULL;
         vB.nSize            = 0;
@@ -89,6 +96,124 @@ namespace lsp
 
         return fill;
     }
+
+    void phase_detector::correlate(const float *a, const float *b, size_t count)
+    {
+        while (count > 0)
+        {
+            size_t filled   = fillGap(a, b, count);
+            a              += filled;
+            b              += filled;
+            count          -= filled;
+
+            // Samples are accumulated between calls and the correlation function is updated
+            // by FFT once per accumulated block. Remaining samples are processed only when
+            // the gap is full: small blocks are processed directly, large blocks by FFT
+            while (nGapOffset < nGapSize)
+            {
+                size_t pending  = nGapSize - nGapOffset;
+                if ((nFftBlock > 0) && (pending >= nFftBlock))
+                    correlateFFT(nFftBlock);
+                else if (nGapSize < nMaxGapSize)
+                    break;
+                else if (pending < nFftThresh)
+                    correlateDirect(pending);
+                else
+                    correlateFFT(pending);
+            }
+        }
+    }
+
+    void phase_detector::correlateDirect(size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            // Make assertions
+            lsp_assert((nGapOffset + nFuncSize) <= (nMaxVectorSize * 4));
+            lsp_assert(nGapOffset <= (nMaxVectorSize * 3));
+            lsp_assert((nGapOffset + nVectorSize + nFuncSize) < (nMaxVectorSize * 4));
+            lsp_assert((nGapOffset + nVectorSize) <= (nMaxVectorSize * 3));
+
+            // Update function peak values
+            // vFunction[i] = vFunction[i] - vB.pData[i + nGapOffset] * vA.pData[nGapOffset] +
+            //                + vB.pData[i + nGapOffset + nVectorSize] * vA.pData[nGapOffset + nVectorSize]
+            dsp::mix_add2(vFunction,
+                    &vB.pData[nGapOffset], &vB.pData[nGapOffset + nVectorSize],
+                    -vA.pData[nGapOffset], vA.pData[nGapOffset + nVectorSize],
+                    nFuncSize);
+
+            // Accumulate peak function value
+            // vAccumulated[i] = vAccumulated[i] * (1.0f - fTau) + vFunction * fTau
+            dsp::mix2(vAccumulated, vFunction, 1.0f - fTau, fTau, nFuncSize);
+
+            // Increment gap offset: move to next sample
+            nGapOffset++;
+        }
+    }
+
+    void phase_detector::correlateFFT(size_t count)
+    {
+        /*
+           Let d[k] be the change of the correlation function made by the k-th sample
+           of the block and q = 1 - tau. Then after processing of M samples:
+             F' = F + sum { d[k] }
+             R' = q^M * R + (1 - q^M) * F + sum { (1 - q^(M-k)) * d[k] }
+           where both sums are cross-correlations of the weighted A samples with the
+           B samples. They are computed at once as a convolution of the complex signal
+           with the B samples: the real part holds unweighted A samples, the imaginary
+           part holds weighted A samples. The A samples are stored in reverse order.
+        */
+        size_t fft_size     = 1 << nFftRank;
+        size_t a_size       = count + nVectorSize;
+        size_t b_size       = a_size + nFuncSize - 1;
+        const float *a      = &vA.pData[nGapOffset];
+        const float *b      = &vB.pData[nGapOffset];
+
+        lsp_assert(count <= nFftBlock);
+        lsp_assert((nGapOffset + a_size) <= (nMaxVectorSize * 3));
+        lsp_assert((nGapOffset + b_size) <= (nMaxVectorSize * 4));
+
+        // Prepare the signal
+        double q            = 1.0 - fTau;
+        double qk           = 1.0;
+        float *sig          = vFftSignal;
+        dsp::fill_zero(sig, fft_size * 2);
+
+        for (size_t k=count; k > 0; )
+        {
+            --k;
+            qk                 *= q;
+            float w             = 1.0 - qk;
+            float s_lo          = a[k];
+            float s_hi          = a[k + nVectorSize];
+            float *lo           = &sig[(a_size - 1 - k) << 1];
+            float *hi           = &sig[(count - 1 - k) << 1];
+
+            lo[0]              -= s_lo;
+            lo[1]              -= s_lo * w;
+            hi[0]              += s_hi;
+            hi[1]              += s_hi * w;
+        }
+
+        // Prepare the spectrum of B samples
+        float *spc          = vFftSpectrum;
+        dsp::pcomplex_r2c(spc, b, b_size);
+        dsp::fill_zero(&spc[b_size << 1], (fft_size - b_size) << 1);
+
+        // Perform the convolution
+        dsp::packed_direct_fft(sig, sig, nFftRank);
+        dsp::packed_direct_fft(spc, spc, nFftRank);
+        dsp::pcomplex_mul2(sig, spc, fft_size);
+        dsp::packed_reverse_fft(sig, sig, nFftRank);
+
+        // Update the accumulated function first, it depends on previous value of function
+        sig                += (a_size - 1) << 1;
+        dsp::mix2(vAccumulated, vFunction, qk, 1.0 - qk, nFuncSize);
+        dsp::pcomplex_c2r_add2(vAccumulated, &sig[1], nFuncSize); // Imaginary part
+        dsp::pcomplex_c2r_add2(vFunction, sig, nFuncSize); // Real part
+
+        nGapOffset         += count;
+    }
     
     void phase_detector::update_sample_rate(long sr)
     {
@@ -117,6 +242,10 @@ namespace lsp
         vAccumulated    = new float[nMaxVectorSize * 2];
         vNormalized     = new float[nMaxVectorSize * 2];
 
+        size_t fft_size = 1 << (int_log2(nMaxVectorSize * 4 - 1) + 1);
+        vFftSignal      = new float[fft_size * 2];
+        vFftSpectrum    = new float[fft_size * 2];
+
         setTimeInterval(fTimeInterval, true);
         setReactiveInterval(fReactivity);
 
@@ -193,37 +322,7 @@ namespace lsp
         }
 
         // Make calculations
-        while (samples > 0)
-        {
-            ssize_t filled   = fillGap(in_a, in_b, samples);
-            samples -= filled;
-
-            // Subtract values
-            while (nGapOffset < nGapSize)
-            {
-                // Make assertions
-                lsp_assert((nGapOffset + nFuncSize) <= (nMaxVectorSize * 4));
-                lsp_assert(nGapOffset <= (nMaxVectorSize * 3));
-                lsp_assert((nGapOffset + nVectorSize + nFuncSize) < (nMaxVectorSize * 4));
-                lsp_assert((nGapOffset + nVectorSize) <= (nMaxVectorSize * 3));
-
-                // Update function peak values
-                // vFunction[i] = vFunction[i] - vB.pData[i + nGapOffset] * vA.pData[nGapOffset] +
-                //                + vB.pData[i + nGapOffset + nVectorSize] * vA.pData[nGapOffset + nVectorSize]
-                dsp::mix_add2(vFunction,
-                        &vB.pData[nGapOffset], &vB.pData[nGapOffset + nVectorSize],
-                        -vA.pData[nGapOffset], vA.pData[nGapOffset + nVectorSize],
-                        nFuncSize);
-
-
-                // Accumulate peak function value
-                // vAccumulated[i] = vAccumulated[i] * (1.0f - fTau) + vFunction * fTau
-                dsp::mix2(vAccumulated, vFunction, 1.0f - fTau, fTau, nFuncSize);
-
-                // Increment gap offset: move to next sample
-                nGapOffset++;
-            }
-        }
+        correlate(in_a, in_b, samples);
 
         // Now analyze average function in the time
         size_t best     = nVectorSize, worst = nVectorSize;
@@ -297,6 +396,23 @@ namespace lsp
         nGapSize        = 0;
         nGapOffset      = 0;
 
+        // Compute FFT parameters: FFT size should be not less than nFuncSize + nVectorSize + block size - 1,
+        // FFT processing is used when it's cheaper than direct update of nFuncSize elements for each sample
+        if (nVectorSize > 0)
+        {
+            nFftRank        = int_log2(nVectorSize * 4 - 1) + 1;
+            nFftBlock       = (1 << nFftRank) - nFuncSize - nVectorSize + 1;
+            nFftThresh      = (nFftRank << (nFftRank + 2)) / nFuncSize;
+            if (nFftThresh > nFftBlock)
+                nFftThresh      = nFftBlock;
+        }
+        else
+        {
+            nFftRank        = 0;
+            nFftBlock       = 0;
+            nFftThresh      = nMaxGapSize + 1;
+        }
+
         // Yep, clear all buffers
         return true;
     }
@@ -359,6 +475,18 @@ namespace lsp
             delete []   vNormalized;
             vNormalized = NULL;
         }
+        if (vFftSignal != NULL)
+        {
+            lsp_debug("delete []   vFftSignal (%p)", vFftSignal);
+            delete []   vFftSignal;
+            vFftSignal  = NULL;
+        }
+        if (vFftSpectrum != NULL)
+        {
+            lsp_debug("delete []   vFftSpectrum (%p)", vFftSpectrum);
+            delete []   vFftSpectrum;
+            vFftSpectrum= NULL;
+        }
         if (pIDisplay != NULL)
         {
             pIDisplay->detroy();
@@ -433,6 +433,7 @@ namespace lsp
             if (!c->sEqualizer.init(room_builder_base_metadata::EQ_BANDS + 2, CONV_RANK))
                 return;
             c->sEqualizer.set_mode(EQM_BYPASS);
+            c->sEqualizer.set_executor(pExecutor);
 
             c->fDryPan[0]   = 0.0f;
             c->fDryPan[1]   = 0.0f;
@@ -2107,7 +2108,7 @@ namespace lsp
             params.channels         = hdr.channels;
             params.sample_format    = (hdr.version & 1) ? LSPC_SAMPLE_FMT_F32BE : LSPC_SAMPLE_FMT_F32LE;
             params.sample_rate      = hdr.sample_rate;
-            params.codec            = LSPC_CODEC_PCM;
+            params.codec            = LSPC_CODEC_LOSSLESS;
             params.frames           = hdr.samples;
 
             // Initialize sample array
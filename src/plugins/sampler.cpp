@@ -34,6 +34,24 @@ namespace lsp
         return pCore->load_file(pFile);
     };
 
+    //-------------------------------------------------------------------------
+    sampler_kernel::AFScanner::AFScanner(sampler_kernel *base, afile_t *descr)
+    {
+        pCore       = base;
+        pFile       = descr;
+    }
+
+    sampler_kernel::AFScanner::~AFScanner()
+    {
+        pCore       = NULL;
+        pFile       = NULL;
+    }
+
+    status_t sampler_kernel::AFScanner::run()
+    {
+        return pCore->scan_peaks(pFile);
+    };
+
     //-------------------------------------------------------------------------
     sampler_kernel::sampler_kernel()
     {
@@ -117,8 +135,12 @@ namespace lsp
 
             af->nID                     = i;
             af->pLoader                 = NULL;
+            af->pScanner                = NULL;
 
             af->bDirty                  = false;
+            af->bReload                 = false;
+            af->bPreload                = false;
+            af->bInterrupt              = false;
             af->fVelocity               = 1.0f;
             af->fHeadCut                = 0.0f;
             af->fTailCut                = 0.0f;
@@ -164,15 +186,22 @@ namespace lsp
                 afs->pFile                  = NULL;
                 afs->fNorm                  = 1.0f;
                 afs->pSample                = NULL;
+                afs->pStream                = NULL;
+                afs->nOffset                = 0;
+                afs->nPeaks                 = 0;
+                afs->nScanned               = 0;
 
                 for (size_t k=0; k<TRACKS_MAX; ++k)
+                {
                     afs->vThumbs[k]     = NULL;
+                    afs->vPeaks[k]      = NULL;
+                }
             }
 
             vActive[i]                  = NULL;
         }
 
-        // Create additional objects: tasks for file loading
+        // Create additional objects: tasks for file loading and peak scanning
         lsp_trace("Create loaders");
         for (size_t i=0; i<files; ++i)
         {
@@ -188,13 +217,25 @@ namespace lsp
 
             // Store loader
             af->pLoader         = ldr;
+
+            // Create scanner
+            AFScanner *scn      = new AFScanner(this, af);
+            if (scn == NULL)
+            {
+                destroy_state();
+                return false;
+            }
+
+            // Store scanner
+            af->pScanner        = scn;
         }
 
         // Initialize channels
         lsp_trace("Initialize channels");
         for (size_t i=0; i<nChannels; ++i)
         {
-            if (!vChannels[i].init(nFiles, sampler_base_metadata::PLAYBACKS_MAX))
+            if (!vChannels[i].init(nFiles, sampler_base_metadata::PLAYBACKS_MAX,
+                    sampler_base_metadata::STREAMS_MAX, sampler_base_metadata::STREAM_BUFFER))
             {
                 destroy_state();
                 return false;
@@ -317,6 +358,14 @@ namespace lsp
                     vFiles[i].pLoader = NULL;
                 }
 
+                // Delete peak scanners
+                AFScanner *scn  = vFiles[i].pScanner;
+                if (scn != NULL)
+                {
+                    delete scn;
+                    vFiles[i].pScanner = NULL;
+                }
+
                 // Destroy samples
                 for (size_t j=0; j<AFI_TOTAL; ++j)
                     destroy_afsample(vFiles[i].vData[j]);
@@ -351,32 +400,6 @@ namespace lsp
         if (pListen != NULL)
             sListen.submit(pListen->getValue());
 
-        // Process file load requests
-        for (size_t i=0; i<nFiles; ++i)
-        {
-            // Get descriptor
-            afile_t *af             = &vFiles[i];
-            if (af->pFile == NULL)
-                continue;
-
-            // Get path
-            path_t *path = af->pFile->getBuffer<path_t>();
-            if ((path == NULL) || (!path->pending()))
-                continue;
-
-            // Check task state
-            if (af->pLoader->idle())
-            {
-                // Try to submit task
-                if (pExecutor->submit(af->pLoader))
-                {
-                    af->nStatus     = STATUS_LOADING;
-                    lsp_trace("successfully submitted task");
-                    path->accept();
-                }
-            }
-        }
-
         // Update note and octave
         lsp_trace("Initializing samples...");
 
@@ -489,8 +512,13 @@ namespace lsp
             delete [] af->vThumbs[0];
 
             for (size_t i=0; i<TRACKS_MAX; ++i)
+            {
                 af->vThumbs[i]      = NULL;
+                af->vPeaks[i]       = NULL;
+            }
         }
+        af->nPeaks          = 0;
+        af->nScanned        = 0;
 
         if (af->pSample != NULL)
         {
@@ -498,6 +526,201 @@ namespace lsp
             delete af->pSample;
             af->pSample     = NULL;
         }
+
+        if (af->pStream != NULL)
+        {
+            af->pStream->close();
+            delete af->pStream;
+            af->pStream     = NULL;
+        }
+        af->nOffset         = 0;
+    }
+
+    bool sampler_kernel::streams_idle()
+    {
+        for (size_t i=0; i<nChannels; ++i)
+            if (!vChannels[i].idle())
+                return false;
+        return true;
+    }
+
+    status_t sampler_kernel::load_stream(afile_t *file, afsample_t *af, const char *fname)
+    {
+        // Open the file for streaming
+        af->pStream             = new SampleStream();
+        if (af->pStream == NULL)
+            return STATUS_NO_MEM;
+
+        SampleStream *ss        = af->pStream;
+        status_t status         = ss->open(fname, SAMPLE_LENGTH_MAX * 0.001f);
+        if (status != STATUS_OK)
+        {
+            lsp_trace("could not open stream: status=%d (%s)", status, get_status(status));
+            return STATUS_NOT_SUPPORTED;
+        }
+
+        // Short files and files that need resampling are loaded completely
+        size_t head_len         = millis_to_samples(nSampleRate, STREAM_HEAD);
+        size_t frames           = ss->frames();
+        if ((ss->sample_rate() != nSampleRate) || (frames <= head_len * 4))
+            return STATUS_NOT_SUPPORTED;
+
+        size_t s_channels       = ss->channels();
+        size_t channels         = (s_channels > nChannels) ? nChannels : s_channels;
+
+        // Allocate thumbnails and peak values
+        size_t peaks            = (frames + STREAM_PEAK - 1) / STREAM_PEAK;
+        float *thumbs           = new float[channels * (MESH_SIZE + peaks)];
+        if (thumbs == NULL)
+            return STATUS_NO_MEM;
+        dsp::fill_zero(thumbs, channels * (MESH_SIZE + peaks));
+
+        af->vThumbs[0]          = thumbs;
+        af->nPeaks              = peaks;
+        af->nScanned            = 0;
+        for (size_t i=0; i<channels; ++i)
+        {
+            af->vThumbs[i]          = thumbs;
+            thumbs                 += MESH_SIZE;
+        }
+        for (size_t i=0; i<channels; ++i)
+        {
+            af->vPeaks[i]           = thumbs;
+            thumbs                 += peaks;
+        }
+
+        // Reload of the same file keeps the peak values computed by the scanner,
+        // otherwise peak values are computed by the scanner after the sample is loaded
+        const afsample_t *prev  = file->vData[AFI_CURR];
+        if ((file->bPreload) && (prev->pStream != NULL) && (prev->nPeaks == peaks) &&
+            (prev->pSample != NULL) && (prev->pSample->channels() == channels))
+        {
+            for (size_t i=0; i<channels; ++i)
+                dsp::copy(af->vPeaks[i], prev->vPeaks[i], peaks);
+            af->nScanned            = prev->nScanned;
+            af->fNorm               = prev->fNorm;
+        }
+
+        // Allocate buffers for reading
+        float **vbuf            = new float *[s_channels];
+        if (vbuf == NULL)
+            return STATUS_NO_MEM;
+        for (size_t i=0; i<s_channels; ++i)
+            vbuf[i]                 = NULL;
+
+        // Preload the head of the sample starting at the current head cut position
+        size_t head             = millis_to_samples(nSampleRate, file->fHeadCut);
+        if (head >= frames)
+            head                    = frames - 1;
+        size_t preload          = lsp_min(frames - head, head_len * 2);
+
+        af->pFile               = new AudioFile();
+        if (af->pFile == NULL)
+        {
+            delete [] vbuf;
+            return STATUS_NO_MEM;
+        }
+        status                  = af->pFile->create_samples(channels, nSampleRate, preload);
+        if (status != STATUS_OK)
+        {
+            delete [] vbuf;
+            return status;
+        }
+
+        for (size_t i=0; i<channels; ++i)
+            vbuf[i]                 = af->pFile->channel(i);
+        ssize_t res             = ss->read(vbuf, head, preload);
+        delete [] vbuf;
+        if (res < 0)
+            return -res;
+        af->nOffset             = head;
+
+        // Create and initialize sample
+        af->pSample             = new Sample();
+        if ((af->pSample == NULL) || (!af->pSample->init(channels, head_len)))
+            return STATUS_NO_MEM;
+        af->pSample->set_stream(ss);
+
+        lsp_trace("file successful opened for streaming: %s, head=%d, preload=%d", fname, int(head), int(preload));
+
+        return STATUS_OK;
+    }
+
+    status_t sampler_kernel::scan_peaks(afile_t *file)
+    {
+        // The current sample is not replaced while the scanner is running
+        afsample_t *af          = file->vData[AFI_CURR];
+        SampleStream *ss        = af->pStream;
+        if ((ss == NULL) || (af->pSample == NULL))
+            return STATUS_OK;
+
+        size_t frames           = ss->frames();
+        size_t s_channels       = ss->channels();
+        size_t channels         = af->pSample->channels();
+
+        // Allocate buffers for reading
+        size_t chunk            = STREAM_PEAK * 64;
+        float **vbuf            = new float *[s_channels];
+        if (vbuf == NULL)
+            return STATUS_NO_MEM;
+        float *buf              = new float[chunk * channels];
+        if (buf == NULL)
+        {
+            delete [] vbuf;
+            return STATUS_NO_MEM;
+        }
+        for (size_t i=0; i<s_channels; ++i)
+            vbuf[i]                 = (i < channels) ? &buf[i * chunk] : NULL;
+
+        // Continue the scan of the file from the last computed peak value,
+        // stop if the loader is going to replace the sample
+        for (size_t offset = af->nScanned * STREAM_PEAK; offset < frames; )
+        {
+            if (file->bInterrupt)
+            {
+                lsp_trace("peak scanner interrupted at offset=%d", int(offset));
+                break;
+            }
+
+            size_t count            = frames - offset;
+            if (count > chunk)
+                count                   = chunk;
+
+            ssize_t res             = ss->read(vbuf, offset, count);
+            if (res < 0)
+            {
+                delete [] buf;
+                delete [] vbuf;
+                return -res;
+            }
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                float *dst              = &af->vPeaks[i][offset / STREAM_PEAK];
+                for (size_t j=0; j<count; j += STREAM_PEAK)
+                    *(dst++)                = dsp::abs_max(&vbuf[i][j], lsp_min(count - j, STREAM_PEAK));
+            }
+
+            offset                 += count;
+            af->nScanned            = (offset + STREAM_PEAK - 1) / STREAM_PEAK;
+        }
+        delete [] buf;
+        delete [] vbuf;
+
+        // Determine the normalizing factor after all peak values are computed
+        if (af->nScanned >= af->nPeaks)
+        {
+            float max = 0.0f;
+            for (size_t i=0; i<channels; ++i)
+            {
+                float a_max = dsp::abs_max(af->vPeaks[i], af->nPeaks);
+                if (max < a_max)
+                    max     = a_max;
+            }
+            af->fNorm       = (max != 0.0f) ? 1.0f / max : 1.0f;
+        }
+
+        return STATUS_OK;
     }
 
     int sampler_kernel::load_file(afile_t *file)
@@ -514,7 +737,7 @@ namespace lsp
 
         // Check state
         afsample_t *snew        = file->vData[AFI_NEW];
-        if ((snew->pFile != NULL) || (snew->pSample != NULL))
+        if ((snew->pFile != NULL) || (snew->pSample != NULL) || (snew->pStream != NULL))
             return STATUS_UNKNOWN_ERR;
 
         // Check port binding
@@ -531,12 +754,23 @@ namespace lsp
         if (strlen(fname) <= 0)
             return STATUS_UNSPECIFIED;
 
+        // Try to stream the file, otherwise load it completely
+        status_t status = load_stream(file, snew, fname);
+        if (status == STATUS_OK)
+            return status;
+        destroy_afsample(snew);
+        if (status != STATUS_NOT_SUPPORTED)
+        {
+            lsp_trace("stream failed: status=%d (%s)", status, get_status(status));
+            return status;
+        }
+
         // Load audio file
         snew->pFile         = new AudioFile();
         if (snew->pFile == NULL)
             return STATUS_NO_MEM;
 
-        status_t status = snew->pFile->load(fname, SAMPLE_LENGTH_MAX * 0.001f);
+        status = snew->pFile->load(fname, SAMPLE_LENGTH_MAX * 0.001f);
         if (status != STATUS_OK)
         {
             lsp_trace("load failed: status=%d (%s)", status, get_status(status));
@@ -544,7 +778,7 @@ namespace lsp
             return status;
         }
 
-        status = snew->pFile->resample(nSampleRate);
+        status = snew->pFile->resample(nSampleRate, pExecutor);
         if (status != STATUS_OK)
         {
             lsp_trace("resample failed: status=%d (%s)", status, get_status(status));
@@ -604,9 +838,16 @@ namespace lsp
         dst->pFile          = src->pFile;
         dst->fNorm          = src->fNorm;
         dst->pSample        = src->pSample;
+        dst->pStream        = src->pStream;
+        dst->nOffset        = src->nOffset;
+        dst->nPeaks         = src->nPeaks;
+        dst->nScanned       = src->nScanned;
 
         for (size_t j=0; j<TRACKS_MAX; ++j)
+        {
             dst->vThumbs[j]     = src->vThumbs[j];
+            dst->vPeaks[j]      = src->vPeaks[j];
+        }
     }
 
     void sampler_kernel::clear_asample(afsample_t *dst)
@@ -614,9 +855,16 @@ namespace lsp
         dst->pFile          = NULL;
         dst->pSample        = NULL;
         dst->fNorm          = 1.0f;
+        dst->pStream        = NULL;
+        dst->nOffset        = 0;
+        dst->nPeaks         = 0;
+        dst->nScanned       = 0;
 
         for (size_t j=0; j<TRACKS_MAX; ++j)
+        {
             dst->vThumbs[j]     = NULL;
+            dst->vPeaks[j]      = NULL;
+        }
     }
 
     void sampler_kernel::render_sample(afile_t *af)
@@ -630,33 +878,82 @@ namespace lsp
             ssize_t tot_samples = millis_to_samples(nSampleRate, af->fLength);
             ssize_t max_samples = tot_samples - head - tail;
             Sample *s           = afs->pSample;
+            SampleStream *ss    = afs->pStream;
 
             if (max_samples > 0)
             {
                 lsp_trace("re-render sample max_samples=%d", int(max_samples));
 
+                // Streamed file keeps only the head of the sample in memory
+                ssize_t s_len       = max_samples;
+                if (ss != NULL)
+                {
+                    s_len               = lsp_min(max_samples, ssize_t(s->max_length()));
+                    if ((head < ssize_t(afs->nOffset)) ||
+                        ((head + s_len) > ssize_t(afs->nOffset + afs->pFile->samples())))
+                    {
+                        // Head of the sample is not preloaded, keep current state until reload
+                        lsp_trace("request reload of head=%d", int(head));
+                        af->bReload         = true;
+                        af->bDirty          = false;
+                        return;
+                    }
+                }
+
+                size_t fade_in_len  = millis_to_samples(nSampleRate, af->fFadeIn);
+                size_t fade_out_len = millis_to_samples(nSampleRate, af->fFadeOut);
+
                 // Re-render sample
                 for (size_t j=0; j<s->channels(); ++j)
                 {
                     float *dst          = s->getBuffer(j);
                     const float *src    = afs->pFile->channel(j);
-                    dsp::copy(dst, &src[head], max_samples);
+                    dsp::copy(dst, &src[head - afs->nOffset], s_len);
 
                     // Apply fade-in and fade-out to the buffer
-                    fade_in(dst, dst, millis_to_samples(nSampleRate, af->fFadeIn), max_samples);
-                    fade_out(dst, dst, millis_to_samples(nSampleRate, af->fFadeOut), max_samples);
+                    fade_in(dst, dst, fade_in_len, 0, s_len);
+                    fade_out(dst, dst, fade_out_len, max_samples, 0, s_len);
 
                     // Now render thumbnail
                     src                 = dst;
                     dst                 = afs->vThumbs[j];
-                    for (size_t k=0; k<MESH_SIZE; ++k)
+                    if (ss != NULL)
+                    {
+                        // Use peak values of the streamed file and approximate fades
+                        const float *peaks  = afs->vPeaks[j];
+                        size_t fade_start   = (fade_out_len > size_t(max_samples)) ? 0 : max_samples - fade_out_len;
+                        for (size_t k=0; k<MESH_SIZE; ++k)
+                        {
+                            size_t first    = (k * max_samples) / MESH_SIZE;
+                            size_t last     = ((k + 1) * max_samples) / MESH_SIZE;
+                            size_t p_first  = (head + first) / STREAM_PEAK;
+                            size_t p_last   = (head + last + STREAM_PEAK - 1) / STREAM_PEAK;
+                            if (p_last > afs->nPeaks)
+                                p_last          = afs->nPeaks;
+                            if (p_last <= p_first)
+                                p_last          = p_first + 1;
+
+                            size_t pos      = (first + last) >> 1;
+                            float gain      = 1.0f;
+                            if (pos < fade_in_len)
+                                gain           *= float(pos) / fade_in_len;
+                            if (pos >= fade_start)
+                                gain           *= float(fade_out_len - (pos - fade_start)) / fade_out_len;
+
+                            dst[k]          = dsp::abs_max(&peaks[p_first], p_last - p_first) * gain;
+                        }
+                    }
+                    else
                     {
-                        size_t first    = (k * max_samples) / MESH_SIZE;
-                        size_t last     = ((k + 1) * max_samples) / MESH_SIZE;
-                        if (first < last)
-                            dst[k]          = dsp::abs_max(&src[first], last - first);
-                        else
-                            dst[k]          = fabs(src[first]);
+                        for (size_t k=0; k<MESH_SIZE; ++k)
+                        {
+                            size_t first    = (k * max_samples) / MESH_SIZE;
+                            size_t last     = ((k + 1) * max_samples) / MESH_SIZE;
+                            if (first < last)
+                                dst[k]          = dsp::abs_max(&src[first], last - first);
+                            else
+                                dst[k]          = fabs(src[first]);
+                        }
                     }
 
                     // Normalize graph if possible
@@ -664,8 +961,10 @@ namespace lsp
                         dsp::mul_k2(dst, afs->fNorm, MESH_SIZE);
                 }
 
-                // Update length of the sample
-                s->setLength(max_samples);
+                // Update length of the sample and the rest of sample provided by the stream
+                s->setLength(s_len);
+                if (ss != NULL)
+                    ss->set_window(head, max_samples, fade_in_len, fade_out_len);
 
                 // (Re)bind sample
                 for (size_t j=0; j<nChannels; ++j)
@@ -675,6 +974,8 @@ namespace lsp
             {
                 // Mark  sample empty
                 s->setLength(0);
+                if (ss != NULL)
+                    ss->set_window(0, 0, 0, 0);
 
                 // Unbind empty sample
                 for (size_t j=0; j<nChannels; ++j)
@@ -876,7 +1177,46 @@ namespace lsp
 
             // Get path and check task state
             path_t *path = af->pFile->getBuffer<path_t>();
-            if ((path != NULL) && (path->accepted()) && (af->pLoader->completed()))
+            if (path == NULL)
+                continue;
+
+            // Peak scanner has finished or has been interrupted, re-render the thumbnails
+            if (af->pScanner->completed())
+            {
+                lsp_trace("peak scanner has been completed");
+                af->pScanner->reset();
+                af->bInterrupt  = false;
+                af->bDirty      = true;
+            }
+
+            // Submit load of the new file or reload of the streamed file, the scanner should
+            // not access the replaced sample, streamed data of the previous file also should
+            // not be accessed
+            bool load           = path->pending();
+            if ((load) || (af->bReload))
+            {
+                if (!af->pScanner->idle())
+                    af->bInterrupt  = true;
+                else if ((af->pLoader->idle()) && (streams_idle()))
+                {
+                    // Load of the new file cancels the reload of the current one
+                    if (load)
+                        af->bReload     = false;
+                    af->bPreload    = !load;
+
+                    if (pExecutor->submit(af->pLoader))
+                    {
+                        lsp_trace("successfully submitted %s task", (load) ? "load" : "reload");
+                        if (load)
+                        {
+                            af->nStatus     = STATUS_LOADING;
+                            path->accept();
+                        }
+                    }
+                }
+            }
+
+            if (af->pLoader->completed())
             {
                 // Task has been completed
                 lsp_trace("task has been completed");
@@ -889,19 +1229,37 @@ namespace lsp
                 afsample_t *afs = af->vData[AFI_CURR];
                 af->nStatus     = af->pLoader->code();
                 af->bDirty      = true; // Mark sample for re-rendering
-                af->fLength     = (af->nStatus == STATUS_OK) ? samples_to_millis(nSampleRate, afs->pFile->samples()) : 0.0f;
+                af->bReload     = false;
+                if (af->nStatus == STATUS_OK)
+                {
+                    size_t frames   = (afs->pStream != NULL) ? afs->pStream->frames() : afs->pFile->samples();
+                    af->fLength     = samples_to_millis(nSampleRate, frames);
+                }
+                else
+                    af->fLength     = 0.0f;
 
                 lsp_trace("Current file: status=%d (%s), length=%f msec\n",
                     int(af->nStatus), get_status(af->nStatus), af->fLength);
 
                 // Now we surely can commit changes and reset task state
-                path->commit();
+                if (path->accepted())
+                    path->commit();
                 af->pLoader->reset();
 
                 // Trigger the state for reorder
                 bReorder        = true;
             }
 
+            // Compute the rest of peak values of the streamed file in background
+            afsample_t *afs     = af->vData[AFI_CURR];
+            if ((afs->pStream != NULL) && (afs->nScanned < afs->nPeaks) &&
+                (!af->bReload) && (!path->pending()) &&
+                (af->pLoader->idle()) && (af->pScanner->idle()))
+            {
+                if (pExecutor->submit(af->pScanner))
+                    lsp_trace("successfully submitted peak scanner task");
+            }
+
             // Check that we need to re-render sample
             if (af->bDirty)
                 render_sample(af);
@@ -939,6 +1297,10 @@ namespace lsp
                 vChannels[i].process(outs[i], NULL, samples);
         }
 
+        // Fill ring buffers of streamed playbacks
+        for (size_t i=0; i<nChannels; ++i)
+            vChannels[i].submit(pExecutor);
+
         // Step 4
         // Output parameters
         output_parameters(samples);
@@ -28,6 +28,7 @@ namespace lsp
         vFrequences     = NULL;
         vMFrequences    = NULL;
         vIndexes        = NULL;
+        vAnalyze        = NULL;
 
         bBypass         = false;
         nChannel        = 0;
@@ -84,12 +85,14 @@ namespace lsp
         size_t freq_buf_size    = ALIGN_SIZE(sizeof(float) * spectrum_analyzer_base_metadata::MESH_POINTS, 64);
         size_t mfreq_buf_size   = ALIGN_SIZE(sizeof(float) * spectrum_analyzer_base_metadata::MESH_POINTS, 64);
         size_t ind_buf_size     = ALIGN_SIZE(sizeof(uint32_t) * spectrum_analyzer_base_metadata::MESH_POINTS, 64);
-        size_t alloc            = hdr_size + freq_buf_size + mfreq_buf_size + ind_buf_size;
+        size_t an_buf_size      = ALIGN_SIZE(sizeof(float *) * channels, 64);
+        size_t alloc            = hdr_size + freq_buf_size + mfreq_buf_size + ind_buf_size + an_buf_size;
 
         lsp_trace("header_size      = %d", int(hdr_size));
         lsp_trace("freq_buf_size    = %d", int(freq_buf_size));
         lsp_trace("mfreq_buf_size   = %d", int(mfreq_buf_size));
         lsp_trace("ind_buf_size     = %d", int(ind_buf_size));
+        lsp_trace("an_buf_size      = %d", int(an_buf_size));
         lsp_trace("alloc            = %d", int(alloc));
 
         // Allocate data
@@ -128,6 +131,10 @@ namespace lsp
         memset(vIndexes, 0, ind_buf_size);
         lsp_trace("vIndexes = %p", vIndexes);
 
+        vAnalyze      = reinterpret_cast<const float **>(ptr);
+        ptr          += an_buf_size;
+        lsp_trace("vAnalyze = %p", vAnalyze);
+
         // Initialize channels
         for (size_t i=0; i<channels; ++i)
         {
@@ -283,6 +290,7 @@ namespace lsp
         }
         vFrequences     = NULL;
         vIndexes        = NULL;
+        vAnalyze        = NULL;
 
         if (pIDisplay != NULL)
         {
@@ -594,6 +602,14 @@ namespace lsp
                 count = n;
             bool fired = sCounter.submit(count);
 
+            // Perform analysis of all channels in one pass
+            if (!bBypass)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    vAnalyze[i]         = vChannels[i].vIn;
+                sAnalyzer.process(vAnalyze, count);
+            }
+
             // Process data
             for (size_t i=0; i<nChannels; ++i)
             {
@@ -622,9 +638,6 @@ namespace lsp
                 }
                 else
                 {
-                    // Process the data
-                    sAnalyzer.process(i, c->vIn, count);
-
                     // Copy data to output channel
                     if (data_request)
                     {
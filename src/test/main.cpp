@@ -18,6 +18,7 @@
 #include <metadata/metadata.h>
 #include <core/stdlib/stdio.h>
 #include <core/init.h>
+#include <data/cstorage.h>
 #include <sys/stat.h>
 
 namespace test
@@ -235,6 +236,71 @@ namespace test
         return STATUS_OK;
     }
 
+    status_t create_report(const config_t *cfg)
+    {
+        if ((cfg->mode != PTEST) || (cfg->report == NULL))
+            return STATUS_OK;
+
+        FILE *fd = fopen(cfg->report, "w");
+        if (fd == NULL)
+            return STATUS_OK;
+
+        if (cfg->report_format == test::PTEST_REPORT_CSV)
+            fputs("test,case,units,time,iterations,mean,p50,p99,max\n", fd);
+        fclose(fd);
+
+        return STATUS_OK;
+    }
+
+    status_t finalize_report(const config_t *cfg)
+    {
+        if ((cfg->mode != PTEST) || (cfg->report == NULL) || (cfg->report_format != test::PTEST_REPORT_JSON))
+            return STATUS_OK;
+
+        // Read records emitted by tests, one record per line
+        FILE *fd = fopen(cfg->report, "r");
+        if (fd == NULL)
+            return STATUS_OK;
+
+        cstorage<char> data;
+        char buf[0x1000];
+        size_t n;
+        while ((n = fread(buf, sizeof(char), sizeof(buf), fd)) > 0)
+        {
+            if (!data.add_all(buf, n))
+            {
+                fclose(fd);
+                return STATUS_NO_MEM;
+            }
+        }
+        fclose(fd);
+
+        // Rewrite the report as JSON array
+        if ((fd = fopen(cfg->report, "w")) == NULL)
+            return STATUS_OK;
+
+        const char *p = data.get_array(), *end = p + data.size();
+        bool first = true;
+        fputs("[\n", fd);
+        while (p < end)
+        {
+            const char *eol = reinterpret_cast<const char *>(memchr(p, '\n', end - p));
+            if (eol == NULL)
+                eol     = end;
+            if (eol > p)
+            {
+                fputs((first) ? "    " : ",\n    ", fd);
+                fwrite(p, sizeof(char), eol - p, fd);
+                first   = false;
+            }
+            p       = eol + 1;
+        }
+        fputs((first) ? "]\n" : "\n]\n", fd);
+        fclose(fd);
+
+        return STATUS_OK;
+    }
+
     int main(int argc, const char **argv)
     {
     //    // Enable mcheck
@@ -316,6 +382,8 @@ namespace test
                 res = check_duplicates(&cfg, list);
                 if (res == STATUS_OK)
                     res     = create_outfile(&cfg);
+                if (res == STATUS_OK)
+                    res     = create_report(&cfg);
             }
 
             // Prepare for test
@@ -345,7 +413,10 @@ namespace test
 
             // Output statistics
             if (!cfg.is_child)
+            {
+                finalize_report(&cfg);
                 output_stats(&cfg, &stats);
+            }
         }
 
         dsp::finish(&ctx);
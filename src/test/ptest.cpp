@@ -9,6 +9,13 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <test/ptest.h>
+#include <core/files/json/Parser.h>
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#endif /* PLATFORM_WINDOWS */
+
+#define PTEST_P99_RANK          0.99
 
 namespace test
 {
@@ -18,6 +25,8 @@ namespace test
     {
         __test_time         = time;
         __test_iterations   = iterations;
+        __test_clock        = PTEST_CLOCK_MONOTONIC;
+        __test_warmup       = 0;
 
         // Self-register
         __next              = __root;
@@ -45,10 +54,115 @@ namespace test
             free(stats->performance);
         if (stats->time_cost != NULL)
             free(stats->time_cost);
+        if (stats->p50 != NULL)
+            free(stats->p50);
+        if (stats->p99 != NULL)
+            free(stats->p99);
+        if (stats->max != NULL)
+            free(stats->max);
         if (stats->rel != NULL)
             free(stats->rel);
     }
 
+    double PerformanceTest::time_stamp() const
+    {
+        if (__test_clock == PTEST_CLOCK_CPU)
+            return double(clock()) / CLOCKS_PER_SEC;
+
+    #ifdef PLATFORM_WINDOWS
+        LARGE_INTEGER freq, ctr;
+        ::QueryPerformanceFrequency(&freq);
+        ::QueryPerformanceCounter(&ctr);
+        return double(ctr.QuadPart) / double(freq.QuadPart);
+    #else
+        struct timespec ts;
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+    #endif /* PLATFORM_WINDOWS */
+    }
+
+    double PerformanceTest::sample_stamp() const
+    {
+        if (__test_clock != PTEST_CLOCK_CYCLES)
+            return time_stamp();
+
+    #if defined(ARCH_X86)
+        uint32_t lo, hi;
+        ARCH_X86_ASM (
+            __ASM_EMIT("rdtsc")
+            : "=a"(lo), "=d"(hi)
+            :
+            :
+        );
+        return double((uint64_t(hi) << 32) | lo);
+    #elif defined(ARCH_AARCH64)
+        uint64_t v;
+        ARCH_AARCH64_ASM (
+            __ASM_EMIT("isb")
+            __ASM_EMIT("mrs %[v], cntvct_el0")
+            : [v] "=r"(v)
+            :
+            : "memory"
+        );
+        return double(v);
+    #else
+        // No cycle counter available: count nanoseconds
+        return time_stamp() * 1e+9;
+    #endif /* ARCH */
+    }
+
+    const char *PerformanceTest::units() const
+    {
+        return (__test_clock == PTEST_CLOCK_CYCLES) ? "clk" : "us";
+    }
+
+    double PerformanceTest::units_scale() const
+    {
+        return (__test_clock == PTEST_CLOCK_CYCLES) ? 1.0 : 1000000.0;
+    }
+
+    void PerformanceTest::start_loop(loop_t *loop)
+    {
+        loop->time          = 0.0;
+        loop->iterations    = 0;
+        loop->warmup        = __test_warmup;
+        loop->start         = time_stamp();
+        loop->stamp         = sample_stamp();
+    }
+
+    bool PerformanceTest::next_batch(loop_t *loop, wsize_t iterations)
+    {
+        double stamp        = sample_stamp();
+        double now          = time_stamp();
+
+        if (loop->warmup > 0)
+        {
+            // Warmup batches are not accounted
+            --loop->warmup;
+            loop->start         = now;
+        }
+        else
+        {
+            double *sample      = loop->samples.add();
+            if (sample != NULL)
+                *sample             = (stamp - loop->stamp) / iterations;
+            loop->iterations   += iterations;
+            loop->time          = now - loop->start;
+            if (loop->time >= __test_time)
+                return false;
+        }
+
+        loop->stamp         = sample_stamp();
+        return true;
+    }
+
+    static int cmp_samples(const void *a, const void *b)
+    {
+        double da = *static_cast<const double *>(a);
+        double db = *static_cast<const double *>(b);
+        return (da < db) ? -1 : (da > db) ? 1 : 0;
+    }
+
     void PerformanceTest::estimate(size_t *len, const char *text)
     {
         size_t slen = (text != NULL) ? strlen(text) : 0;
@@ -69,7 +183,16 @@ namespace test
         stats->n_iterations = NULL;
         stats->performance  = NULL;
         stats->time_cost    = NULL;
+        stats->p50          = NULL;
+        stats->p99          = NULL;
+        stats->max          = NULL;
         stats->rel          = NULL;
+        stats->v_time       = time;
+        stats->v_iterations = iterations;
+        stats->v_mean       = 0.0;
+        stats->v_p50        = 0.0;
+        stats->v_p99        = 0.0;
+        stats->v_max        = 0.0;
 
         if (key == NULL)
         {
@@ -137,6 +260,48 @@ namespace test
         }
     }
 
+    void PerformanceTest::gather_stats(const char *key, loop_t *loop)
+    {
+        size_t count    = __test_stats.size();
+        gather_stats(key, loop->time, loop->iterations);
+        if ((key == NULL) || (__test_stats.size() <= count))
+            return;
+
+        stats_t *stats  = __test_stats.at(count);
+        size_t n        = loop->samples.size();
+        double *v       = loop->samples.get_array();
+        double k        = units_scale();
+
+        if (n > 0)
+        {
+            double sum      = 0.0;
+            for (size_t i=0; i<n; ++i)
+                sum            += v[i];
+            ::qsort(v, n, sizeof(double), cmp_samples);
+
+            size_t p99      = size_t(n * PTEST_P99_RANK);
+            stats->v_mean   = (sum * k) / n;
+            stats->v_p50    = v[n >> 1] * k;
+            stats->v_p99    = v[(p99 < n) ? p99 : n - 1] * k;
+            stats->v_max    = v[n - 1] * k;
+        }
+
+        int res = asprintf(&stats->p50, "%.4f", stats->v_p50);
+        if (res >= 0)
+            res = asprintf(&stats->p99, "%.4f", stats->v_p99);
+        if (res >= 0)
+            res = asprintf(&stats->max, "%.4f", stats->v_max);
+
+        if ((res < 0) ||
+            (stats->p50 == NULL) ||
+            (stats->p99 == NULL) ||
+            (stats->max == NULL))
+        {
+            destroy_stats(stats);
+            __test_stats.remove(stats);
+        }
+    }
+
     /*
      Table drawing symbols:
         ┌ ─ ┬ ─ ┐
@@ -181,6 +346,14 @@ namespace test
         size_t time_cost    = strlen("Cost[us/i]");
         size_t rel          = strlen("Rel[%]");
 
+        char h_p50[32], h_p99[32], h_max[32];
+        sprintf(h_p50, "P50[%s/i]", units());
+        sprintf(h_p99, "P99[%s/i]", units());
+        sprintf(h_max, "Max[%s/i]", units());
+        size_t p50          = strlen(h_p50);
+        size_t p99          = strlen(h_p99);
+        size_t max          = strlen(h_max);
+
         // Estimate size of all columns
         for (size_t i=0, n=__test_stats.size(); i < n; ++i)
         {
@@ -193,6 +366,9 @@ namespace test
             estimate(&n_iterations, stats->n_iterations);
             estimate(&performance, stats->performance);
             estimate(&time_cost, stats->time_cost);
+            estimate(&p50, stats->p50);
+            estimate(&p99, stats->p99);
+            estimate(&max, stats->max);
             estimate(&rel, stats->rel);
         }
 
@@ -205,6 +381,9 @@ namespace test
         out_text(out, n_iterations, "Est", 1, "─", "┬");
         out_text(out, performance, "Perf[i/s]", 1, "─", "┬");
         out_text(out, time_cost, "Cost[us/i]", 1, "─", "┬");
+        out_text(out, p50, h_p50, 1, "─", "┬");
+        out_text(out, p99, h_p99, 1, "─", "┬");
+        out_text(out, max, h_max, 1, "─", "┬");
         out_text(out, rel, "Rel[%]", 1, "─", "┐\n");
 
         int separator = 0;
@@ -225,6 +404,9 @@ namespace test
                     out_text(out, n_iterations, NULL, 1, "─", "┼");
                     out_text(out, performance, NULL, 1, "─", "┼");
                     out_text(out, time_cost, NULL, 1, "─", "┼");
+                    out_text(out, p50, NULL, 1, "─", "┼");
+                    out_text(out, p99, NULL, 1, "─", "┼");
+                    out_text(out, max, NULL, 1, "─", "┼");
                     out_text(out, rel, NULL, 1, "─", "┤\n");
                 }
                 else if (separator == 2)
@@ -237,6 +419,9 @@ namespace test
                     out_text(out, n_iterations, NULL, 1, "═", "╪");
                     out_text(out, performance, NULL, 1, "═", "╪");
                     out_text(out, time_cost, NULL, 1, "═", "╪");
+                    out_text(out, p50, NULL, 1, "═", "╪");
+                    out_text(out, p99, NULL, 1, "═", "╪");
+                    out_text(out, max, NULL, 1, "═", "╪");
                     out_text(out, rel, NULL, 1, "═", "╡\n");
                 }
                 separator = 0;
@@ -249,6 +434,9 @@ namespace test
                 out_text(out, n_iterations, stats->n_iterations, 1, " ", "│");
                 out_text(out, performance, stats->performance, 1, " ", "│");
                 out_text(out, time_cost, stats->time_cost, 1, " ", "│");
+                out_text(out, p50, stats->p50, 1, " ", "│");
+                out_text(out, p99, stats->p99, 1, " ", "│");
+                out_text(out, max, stats->max, 1, " ", "│");
                 out_text(out, rel, stats->rel, 1, " ", "│\n");
             }
             else
@@ -264,9 +452,176 @@ namespace test
         out_text(out, n_iterations, NULL, 1, "─", "┴");
         out_text(out, performance, NULL, 1, "─", "┴");
         out_text(out, time_cost, NULL, 1, "─", "┴");
+        out_text(out, p50, NULL, 1, "─", "┴");
+        out_text(out, p99, NULL, 1, "─", "┴");
+        out_text(out, max, NULL, 1, "─", "┴");
         out_text(out, rel, NULL, 1, "─", "┘\n");
     }
 
+    void PerformanceTest::out_escaped(FILE *out, const char *text, ptest_report_t format)
+    {
+        fputc('"', out);
+        for (const char *p = text; (p != NULL) && (*p != '\0'); ++p)
+        {
+            if (format == PTEST_REPORT_CSV)
+            {
+                // CSV: double the quote character
+                if (*p == '"')
+                    fputc('"', out);
+                fputc(*p, out);
+            }
+            else if ((*p == '"') || (*p == '\\'))
+            {
+                fputc('\\', out);
+                fputc(*p, out);
+            }
+            else if (uint8_t(*p) < 0x20)
+                fprintf(out, "\\u%04x", int(*p));
+            else
+                fputc(*p, out);
+        }
+        fputc('"', out);
+    }
+
+    void PerformanceTest::dump_report(FILE *out, ptest_report_t format) const
+    {
+        const char *name    = full_name();
+
+        for (size_t i=0, n=__test_stats.size(); i < n; ++i)
+        {
+            stats_t *stats = __test_stats.at(i);
+            if ((stats->key == NULL) || (stats->p50 == NULL))
+                continue;
+
+            if (format == PTEST_REPORT_CSV)
+            {
+                out_escaped(out, name, format);
+                fputc(',', out);
+                out_escaped(out, stats->key, format);
+                fprintf(out, ",%s,%.6f,%lld,%.6f,%.6f,%.6f,%.6f\n",
+                        units(), stats->v_time, (long long)(stats->v_iterations),
+                        stats->v_mean, stats->v_p50, stats->v_p99, stats->v_max);
+            }
+            else
+            {
+                fputs("{\"test\":", out);
+                out_escaped(out, name, format);
+                fputs(",\"case\":", out);
+                out_escaped(out, stats->key, format);
+                fprintf(out, ",\"units\":\"%s\",\"time\":%.6f,\"iterations\":%lld,\"mean\":%.6f,\"p50\":%.6f,\"p99\":%.6f,\"max\":%.6f}\n",
+                        units(), stats->v_time, (long long)(stats->v_iterations),
+                        stats->v_mean, stats->v_p50, stats->v_p99, stats->v_max);
+            }
+        }
+    }
+
+    status_t PerformanceTest::check_baseline(const char *path, double tolerance) const
+    {
+        using namespace lsp;
+
+        json::Parser p;
+        json::event_t ev;
+        LSPString key, test, name, item, units;
+        double p50      = -1.0;
+        size_t failed   = 0;
+
+        if (!name.set_utf8(full_name()))
+            return STATUS_NO_MEM;
+        if (!units.set_utf8(this->units()))
+            return STATUS_NO_MEM;
+
+        status_t res = p.open(path, json::JSON_VERSION5);
+        if (res != STATUS_OK)
+            return res;
+
+        // The baseline is an array of objects
+        res = p.read_next(&ev);
+        if ((res == STATUS_OK) && (ev.type != json::JE_ARRAY_START))
+            res = STATUS_BAD_FORMAT;
+
+        while (res == STATUS_OK)
+        {
+            if ((res = p.read_next(&ev)) != STATUS_OK)
+                break;
+            if (ev.type == json::JE_ARRAY_END)
+                break;
+            else if (ev.type != json::JE_OBJECT_START)
+            {
+                res = STATUS_BAD_FORMAT;
+                break;
+            }
+
+            // Read the record
+            bool match      = true;
+            p50             = -1.0;
+            while ((res = p.read_next(&ev)) == STATUS_OK)
+            {
+                if (ev.type == json::JE_OBJECT_END)
+                    break;
+                if (ev.type != json::JE_PROPERTY)
+                {
+                    res = STATUS_BAD_FORMAT;
+                    break;
+                }
+
+                if (!key.set(&ev.sValue))
+                    res = STATUS_NO_MEM;
+                else if (key.compare_to_utf8("test") == 0)
+                {
+                    if ((res = p.read_string(&test)) == STATUS_OK)
+                        match = match && test.equals(&name);
+                }
+                else if (key.compare_to_utf8("case") == 0)
+                    res = p.read_string(&item);
+                else if (key.compare_to_utf8("units") == 0)
+                {
+                    if ((res = p.read_string(&test)) == STATUS_OK)
+                        match = match && test.equals(&units);
+                }
+                else if (key.compare_to_utf8("p50") == 0)
+                    res = p.read_double(&p50);
+                else
+                    res = p.skip_next();
+
+                if (res != STATUS_OK)
+                    break;
+            }
+            if ((res != STATUS_OK) || (!match) || (p50 <= 0.0))
+                continue;
+
+            // Find the matching case
+            const char *ckey = item.get_utf8();
+            if (ckey == NULL)
+            {
+                res = STATUS_NO_MEM;
+                break;
+            }
+
+            for (size_t i=0, n=__test_stats.size(); i < n; ++i)
+            {
+                stats_t *stats = __test_stats.at(i);
+                if ((stats->key == NULL) || (stats->p50 == NULL) || (strcmp(stats->key, ckey) != 0))
+                    continue;
+
+                double limit = p50 * (1.0 + tolerance * 0.01);
+                if (stats->v_p50 > limit)
+                {
+                    fprintf(stdout, "Performance regression of %s, case '%s': p50=%.4f %s/i, baseline=%.4f %s/i (+%.2f%%)\n",
+                            full_name(), ckey, stats->v_p50, this->units(), p50, this->units(),
+                            100.0 * (stats->v_p50 - p50) / p50);
+                    ++failed;
+                }
+                break;
+            }
+        }
+
+        p.close();
+        if (res != STATUS_OK)
+            return res;
+
+        return (failed > 0) ? STATUS_FAILED : STATUS_OK;
+    }
+
     void PerformanceTest::free_stats()
     {
         for (size_t i=0, n=__test_stats.size(); i < n; ++i)
@@ -0,0 +1,175 @@
+/*
+ * raytrace.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/3d/RayTrace3D.h>
+#include <core/files/Model3DFile.h>
+#include <core/sampling/Sample.h>
+#include <core/LSPString.h>
+
+#define MIN_TESS        8
+#define MAX_TESS        64
+#define ROOM_W          4.0f
+#define ROOM_D          4.0f
+#define ROOM_H          3.0f
+#define ENERGY_THRESH   0.1f
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for ray tracing of the room with densely tessellated walls
+PTEST_BEGIN("core.3d", raytrace, 5, 1)
+
+    void emit_wall(FILE *fd, size_t *vid, size_t n, const point3d_t *o, const vector3d_t *du, const vector3d_t *dv)
+    {
+        // Emit vertices of the grid
+        for (size_t i=0; i<=n; ++i)
+            for (size_t j=0; j<=n; ++j)
+            {
+                float u = float(i) / n, v = float(j) / n;
+                fprintf(fd, "v %f %f %f\n",
+                        o->x + du->dx * u + dv->dx * v,
+                        o->y + du->dy * u + dv->dy * v,
+                        o->z + du->dz * u + dv->dz * v);
+            }
+
+        // Emit two triangles per each cell of the grid
+        size_t base = *vid;
+        for (size_t i=0; i<n; ++i)
+            for (size_t j=0; j<n; ++j)
+            {
+                size_t v0 = base + i * (n + 1) + j, v1 = v0 + n + 1;
+                fprintf(fd, "f %d// %d// %d//\n", int(v0), int(v1), int(v1 + 1));
+                fprintf(fd, "f %d// %d// %d//\n", int(v0), int(v1 + 1), int(v0 + 1));
+            }
+
+        *vid   += (n + 1) * (n + 1);
+    }
+
+    bool generate_room(const char *path, size_t n)
+    {
+        FILE *fd = fopen(path, "w");
+        if (fd == NULL)
+            return false;
+
+        point3d_t o;
+        vector3d_t u, v;
+        size_t vid = 1;
+        float w = ROOM_W * 0.5f, d = ROOM_D * 0.5f, h = ROOM_H * 0.5f;
+
+        fprintf(fd, "o room\n");
+
+        // Walls are oriented to have normals looking inside the room
+        dsp::init_point_xyz(&o, -w, -d, -h);
+        dsp::init_vector_dxyz(&u, ROOM_W, 0.0f, 0.0f);
+        dsp::init_vector_dxyz(&v, 0.0f, ROOM_D, 0.0f);
+        emit_wall(fd, &vid, n, &o, &u, &v);     // Floor
+
+        dsp::init_point_xyz(&o, -w, -d, h);
+        emit_wall(fd, &vid, n, &o, &v, &u);     // Ceiling
+
+        dsp::init_point_xyz(&o, -w, -d, -h);
+        dsp::init_vector_dxyz(&v, 0.0f, 0.0f, ROOM_H);
+        emit_wall(fd, &vid, n, &o, &v, &u);     // Front wall
+
+        dsp::init_point_xyz(&o, -w, d, -h);
+        emit_wall(fd, &vid, n, &o, &u, &v);     // Back wall
+
+        dsp::init_point_xyz(&o, -w, -d, -h);
+        dsp::init_vector_dxyz(&u, 0.0f, ROOM_D, 0.0f);
+        emit_wall(fd, &vid, n, &o, &u, &v);     // Left wall
+
+        dsp::init_point_xyz(&o, w, -d, -h);
+        emit_wall(fd, &vid, n, &o, &v, &u);     // Right wall
+
+        fclose(fd);
+        return true;
+    }
+
+    status_t render(Scene3D *scene, const rt_source_settings_t *src, const rt_capture_settings_t *cs, Sample *out)
+    {
+        RayTrace3D trace;
+        status_t res = trace.init();
+        if (res != STATUS_OK)
+            return res;
+
+        trace.set_sample_rate(48000);
+        trace.set_energy_threshold(ENERGY_THRESH);
+        trace.set_tolerance(1e-5f);
+        trace.set_detalization(1e-9f);
+        trace.set_normalize(false);
+
+        if ((res = trace.set_scene(scene, false)) == STATUS_OK)
+            res = trace.add_source(src);
+        if ((res == STATUS_OK) && (trace.add_capture(cs) < 0))
+            res = STATUS_NO_MEM;
+        if (res == STATUS_OK)
+            res = trace.bind_capture(0, out, 0, -1, -1);
+        if (res == STATUS_OK)
+            res = trace.process(1, 1.0f);
+
+        trace.destroy(false);
+        return res;
+    }
+
+    void call(const char *path, size_t n)
+    {
+        char buf[80];
+        sprintf(buf, "tess=%d, triangles=%d", int(n), int(n * n * 12));
+        printf("Testing ray tracing %s ...\n", buf);
+
+        Scene3D scene;
+        if (!generate_room(path, n))
+            PTEST_FAIL_MSG("Could not generate file %s", path);
+        status_t res = Model3DFile::load(&scene, path, true);
+        if (res != STATUS_OK)
+            PTEST_FAIL_MSG("Could not load file %s, code=%d", path, int(res));
+
+        // Prepare source and capture
+        rt_source_settings_t src;
+        dsp::init_matrix3d_identity(&src.pos);
+        src.type        = RT_AS_ICOSPHERE;
+        src.size        = 0.3048f;
+        src.height      = 0.3048f;
+        src.angle       = 0.0f;
+        src.curvature   = 0.0f;
+        src.amplitude   = 1.0f;
+
+        ray3d_t cap;
+        rt_capture_settings_t cs;
+        dsp::init_point_xyz(&cap.z, 1.0f, -0.06f, 0.0f);
+        dsp::init_vector_dxyz(&cap.v, -M_SQRT2, M_SQRT2, 0.0f);
+        dsp::calc_matrix3d_transform_r1(&cs.pos, &cap);
+        cs.radius       = 0.0254f * 2;
+        cs.type         = RT_AC_CARDIO;
+
+        Sample out;
+        if (!out.init(1, 512, 0))
+            PTEST_FAIL_MSG("Could not initialize sample");
+
+        PTEST_LOOP(buf,
+            if (render(&scene, &src, &cs, &out) != STATUS_OK)
+                PTEST_FAIL_MSG("Ray tracing has failed");
+        );
+
+        out.destroy();
+        scene.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        LSPString path;
+        if (!path.fmt_utf8("tmp/ptest-%s.obj", this->full_name()))
+            PTEST_FAIL_MSG("Could not format path");
+
+        for (size_t n=MIN_TESS; n<=MAX_TESS; n <<= 1)
+            call(path.get_native(), n);
+
+        remove(path.get_native());
+    }
+PTEST_END
@@ -0,0 +1,86 @@
+/*
+ * follower.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/dynamics/Compressor.h>
+
+#define SRATE           48000
+#define BUF_SIZE        1024
+#define CHANNELS        16
+
+using namespace dsp;
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for compressors: per-instance processing vs batch processing
+PTEST_BEGIN("core.dynamics", follower, 5, 1000)
+
+    void call(float **out, float **env, const float **in, size_t n, bool batch)
+    {
+        char buf[80];
+        sprintf(buf, "%d channels, %s", int(n), (batch) ? "batch" : "single");
+        printf("Testing compressors %s ...\n", buf);
+
+        Compressor c[CHANNELS];
+        Compressor *vc[CHANNELS];
+        for (size_t i=0; i<n; ++i)
+        {
+            c[i].set_sample_rate(SRATE);
+            c[i].set_threshold(GAIN_AMP_M_12_DB, GAIN_AMP_M_24_DB);
+            c[i].set_timings(5.0f + i, 50.0f + i * 10.0f);
+            c[i].set_ratio(4.0f);
+            c[i].set_knee(GAIN_AMP_M_6_DB);
+            c[i].update_settings();
+            vc[i]       = &c[i];
+        }
+
+        if (batch)
+        {
+            PTEST_LOOP(buf,
+                Compressor::process(vc, out, env, in, n, BUF_SIZE);
+            );
+        }
+        else
+        {
+            PTEST_LOOP(buf,
+                for (size_t i=0; i<n; ++i)
+                    c[i].process(out[i], env[i], in[i], BUF_SIZE);
+            );
+        }
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *ptr      = alloc_aligned<float>(data, BUF_SIZE * CHANNELS * 3, 64);
+
+        float *out[CHANNELS], *env[CHANNELS];
+        const float *in[CHANNELS];
+
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            float *src      = ptr;
+            for (size_t j=0; j<BUF_SIZE; ++j)
+                src[j]          = float(rand()) / RAND_MAX;
+
+            in[i]           = src;
+            out[i]          = &ptr[BUF_SIZE];
+            env[i]          = &ptr[BUF_SIZE * 2];
+            ptr            += BUF_SIZE * 3;
+        }
+
+        for (size_t n=2; n <= CHANNELS; n <<= 1)
+        {
+            call(out, env, in, n, false);
+            call(out, env, in, n, true);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,121 @@
+/*
+ * limiter.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/dynamics/Limiter.h>
+
+#define SRATE           48000
+#define BUF_SIZE        1024
+#define RISE_SIZE       (BUF_SIZE * 32)
+#define MAX_LOOKAHEAD   20.0f
+
+using namespace dsp;
+using namespace lsp;
+
+static const limiter_mode_t modes[] =
+{
+    LM_HERM_THIN,
+    LM_EXP_WIDE,
+    LM_LINE_DUCK,
+    LM_MIXED_HERM
+};
+
+static const char *mode_names[] =
+{
+    "herm_thin",
+    "exp_wide",
+    "line_duck",
+    "mixed_herm"
+};
+
+static const char *signal_names[] =
+{
+    "sparse",
+    "dense",
+    "rising"
+};
+
+//-----------------------------------------------------------------------------
+// Performance test for limiter: sliding window peak detector vs iterative peak patching
+PTEST_BEGIN("core.dynamics", limiter, 5, 1000)
+
+    void call(float *out, float *gain, const float *in, size_t length, size_t mode, float lookahead, size_t signal, bool sliding)
+    {
+        char buf[80];
+        sprintf(buf, "%s, lookahead=%.1f, %s, %s",
+                mode_names[mode], lookahead,
+                signal_names[signal],
+                (sliding) ? "sliding" : "patch");
+        printf("Testing limiter %s ...\n", buf);
+
+        Limiter l;
+        l.init(SRATE, MAX_LOOKAHEAD);
+        l.set_sample_rate(SRATE);
+        l.set_mode(modes[mode]);
+        l.set_sliding(sliding);
+        l.set_threshold(0.25f);
+        l.set_attack(lookahead * 0.5f);
+        l.set_release(lookahead);
+        l.set_lookahead(lookahead);
+        l.update_settings();
+
+        // Long signals are processed block by block
+        size_t offset = 0;
+        PTEST_LOOP(buf,
+                l.process(out, gain, &in[offset], &in[offset], BUF_SIZE);
+                offset  = (offset + BUF_SIZE) % length;
+        );
+
+        l.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *sparse   = alloc_aligned<float>(data, BUF_SIZE * 4 + RISE_SIZE, 64);
+        float *dense    = &sparse[BUF_SIZE];
+        float *rising   = &dense[BUF_SIZE];
+        float *out      = &rising[RISE_SIZE];
+        float *gain     = &out[BUF_SIZE];
+
+        // The dense signal has a lot of peaks above threshold: the worst case
+        // for the iterative peak patching. The rising signal is a slow ramp that
+        // raises the held peak at each sample: the worst case for the sliding
+        // window attack
+        for (size_t i=0; i < BUF_SIZE; ++i)
+        {
+            sparse[i]       = (float(rand()) / RAND_MAX - 0.5f) * 0.4f;
+            dense[i]        = (float(rand()) / RAND_MAX - 0.5f) * 4.0f;
+        }
+        for (size_t i=0; i < RISE_SIZE; ++i)
+            rising[i]       = 0.3f + (1.7f * i) / RISE_SIZE;
+        for (size_t i=0; i < BUF_SIZE; i += 200)
+            sparse[i]      *= 8.0f;
+
+        for (size_t i=0; i < sizeof(modes)/sizeof(limiter_mode_t); ++i)
+        {
+            for (size_t j=0; j<2; ++j)
+            {
+                float lookahead = (j == 0) ? 2.0f : MAX_LOOKAHEAD;
+
+                call(out, gain, sparse, BUF_SIZE, i, lookahead, 0, false);
+                call(out, gain, sparse, BUF_SIZE, i, lookahead, 0, true);
+                call(out, gain, dense, BUF_SIZE, i, lookahead, 1, false);
+                call(out, gain, dense, BUF_SIZE, i, lookahead, 1, true);
+                call(out, gain, rising, RISE_SIZE, i, lookahead, 2, false);
+                call(out, gain, rising, RISE_SIZE, i, lookahead, 2, true);
+
+                PTEST_SEPARATOR;
+            }
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
+
+
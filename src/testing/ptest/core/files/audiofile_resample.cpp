@@ -0,0 +1,75 @@
+/*
+ * audiofile_resample.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <test/ptest.h>
+#include <core/files/AudioFile.h>
+#include <core/ipc/ThreadPoolExecutor.h>
+
+#define CHANNELS        2
+#define DURATION        2
+
+using namespace lsp;
+
+static const size_t rates[][2] =
+{
+    { 44100, 48000 },
+    { 96000, 44100 },
+    { 48000, 96000 }
+};
+
+static const size_t workers[] = { 0, 1, 2, 4 };
+
+//-----------------------------------------------------------------------------
+// Performance test for resampling of audio file with thread pool executor
+PTEST_BEGIN("core.files", audiofile_resample, 5, 10)
+
+    void init_file(AudioFile &af, size_t sample_rate)
+    {
+        af.create_samples(CHANNELS, sample_rate, sample_rate * DURATION);
+        for (size_t c=0; c<CHANNELS; ++c)
+        {
+            float *dst  = af.channel(c);
+            for (size_t i=0, n=af.samples(); i<n; ++i)
+                dst[i]      = sinf(2.0f * M_PI * 1000.0f * i / sample_rate + c * 0.5f * M_PI);
+        }
+    }
+
+    void call(size_t src_rate, size_t dst_rate, size_t n_workers)
+    {
+        char buf[80];
+        sprintf(buf, "%d -> %d, workers=%d", int(src_rate), int(dst_rate), int(n_workers));
+        printf("Testing resampling %s ...\n", buf);
+
+        // Zero workers means resampling in the caller's thread only
+        ipc::ThreadPoolExecutor pool;
+        if (n_workers > 0)
+            pool.start(n_workers);
+
+        AudioFile af;
+        PTEST_LOOP(buf,
+            init_file(af, src_rate);
+            af.resample(dst_rate, (n_workers > 0) ? &pool : NULL);
+        );
+
+        af.destroy();
+        if (n_workers > 0)
+            pool.shutdown();
+    }
+
+    PTEST_MAIN
+    {
+        for (size_t i=0, n=sizeof(rates)/sizeof(rates[0]); i<n; ++i)
+        {
+            for (size_t j=0; j<sizeof(workers)/sizeof(size_t); ++j)
+                call(rates[i][0], rates[i][1], workers[j]);
+
+            PTEST_SEPARATOR;
+        }
+    }
+
+PTEST_END
@@ -0,0 +1,80 @@
+/*
+ * dynamic_filters.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/filters/DynamicFilters.h>
+
+#define BUF_SIZE        1024
+#define SAMPLE_RATE     48000
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for dynamic filters: cascades computed for each sample are
+// compared with cascades computed at anchor points and interpolated between them
+PTEST_BEGIN("core.filters", dynamic_filters, 5, 1000)
+
+    void call(float *out, const float *in, const float *gain, const char *label, size_t type, size_t slope, size_t interp)
+    {
+        DynamicFilters df;
+        df.init(1);
+        df.set_sample_rate(SAMPLE_RATE);
+        df.set_interpolation(interp);
+
+        filter_params_t fp;
+        fp.nType        = type;
+        fp.fFreq        = 500.0f;
+        fp.fFreq2       = 4000.0f;
+        fp.fGain        = 1.0f;
+        fp.nSlope       = slope;
+        fp.fQuality     = 0.0f;
+        df.set_params(0, &fp);
+        df.set_filter_active(0, true);
+
+        char buf[80];
+        sprintf(buf, "%s x%d, interpolation=%d", label, int(slope), int(interp));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            df.process(0, out, in, gain, BUF_SIZE);
+        );
+
+        df.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 3, 64);
+        float *gain     = &in[BUF_SIZE];
+        float *out      = &in[BUF_SIZE * 2];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+        {
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+            gain[i]         = expf(-2.0f * i / BUF_SIZE);
+        }
+
+        #define CALL(type, slope) \
+            call(out, in, gain, #type, type, slope, 0); \
+            call(out, in, gain, #type, type, slope, 16); \
+            call(out, in, gain, #type, type, slope, 32); \
+            call(out, in, gain, #type, type, slope, 64); \
+            PTEST_SEPARATOR;
+
+        CALL(FLT_BT_LRX_LOSHELF, 2);
+        CALL(FLT_BT_LRX_LADDERPASS, 2);
+        CALL(FLT_MT_LRX_LADDERPASS, 2);
+        CALL(FLT_BT_BWC_BELL, 4);
+        CALL(FLT_BT_RLC_HISHELF, 2);
+
+        free_aligned(data);
+    }
+
+PTEST_END
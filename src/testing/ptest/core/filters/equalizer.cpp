@@ -5,6 +5,7 @@
  *      Author: sadko
  */
 
+#include <math.h>
 #include <dsp/dsp.h>
 #include <test/ptest.h>
 #include <core/filters/Equalizer.h>
@@ -52,6 +53,41 @@ PTEST_BEGIN("core.filters", equalizer, 5, 1000)
         eq.destroy();
     }
 
+    void call_fir(float *out, const float *in, size_t part_rank, size_t count)
+    {
+        char buf[80];
+        sprintf(buf, "part_rank=%d, samples=%d", int(part_rank), int(count));
+        printf("Testing linear phase equalizer of 32 bands, %s ...\n", buf);
+
+        filter_params_t bell;
+        bell.fFreq      = 16.0f;
+        bell.fFreq2     = 16.0f;
+        bell.fGain      = 2.0f;
+        bell.fQuality   = 0.707f;
+        bell.nSlope     = 2;
+        bell.nType      = FLT_BT_BWC_BELL;
+
+        Equalizer eq;
+        eq.init(32, 13, part_rank);
+        eq.set_sample_rate(48000);
+        eq.set_mode(EQM_FIR);
+
+        for (size_t i=0; i<32; ++i)
+        {
+            bell.fFreq      = 16.0f * powf(2.0f, i * 0.333f);
+            bell.fFreq2     = bell.fFreq;
+            bell.fGain      = (i & 1) ? 2.0f : 0.5f;
+            eq.set_params(i, &bell);
+        }
+        eq.process(out, in, count); // Build the impulse response
+
+        PTEST_LOOP(buf,
+                eq.process(out, in, count);
+        );
+
+        eq.destroy();
+    }
+
     PTEST_MAIN
     {
         size_t buf_size = 1 << MAX_RANK;
@@ -70,6 +106,8 @@ PTEST_BEGIN("core.filters", equalizer, 5, 1000)
             call(out, in, 4, count);
             call(out, in, 6, count);
             call(out, in, 8, count);
+            call_fir(out, in, 0, count);
+            call_fir(out, in, 9, count);
 
             PTEST_SEPARATOR;
             printf("\n");
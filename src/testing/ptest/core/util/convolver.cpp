@@ -10,7 +10,7 @@
 #include <core/util/Convolver.h>
 
 #define MIN_RANK        8
-#define MAX_RANK        16
+#define MAX_RANK        CONVOLVER_RANK_MAX
 #define STEP_SIZE       128
 
 #define MIN_LENGTH      (1 << MIN_RANK)
@@ -0,0 +1,82 @@
+/*
+ * oversampler.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/util/Oversampler.h>
+
+#define BUF_SIZE        1024
+#define SAMPLE_RATE     48000
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test for the round trip (upsampling + downsampling) of the oversampler.
+// Lanczos modes have the lowest latency but rely on the IIR anti-aliasing filter,
+// half-band FIR modes are linear-phase (FAST < NORMAL < HIGH by attenuation, cost
+// and latency), half-band IIR modes provide the low latency with non-linear phase.
+PTEST_BEGIN("core.util", oversampler, 5, 1000)
+
+    void call(float *out, const float *in, size_t count, const char *label, over_mode_t mode)
+    {
+        Oversampler os;
+        os.init();
+        os.set_sample_rate(SAMPLE_RATE);
+        os.set_mode(mode);
+        os.set_filtering(true);
+        os.update_settings();
+
+        char buf[80];
+        sprintf(buf, "%s, latency=%d", label, int(os.latency()));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            os.process(out, in, count);
+        );
+
+        os.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, BUF_SIZE * 2, 64);
+        float *out      = &in[BUF_SIZE];
+
+        for (size_t i=0; i < BUF_SIZE; ++i)
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+
+        #define CALL(mode) \
+            call(out, in, BUF_SIZE, #mode, mode)
+
+        CALL(OM_LANCZOS_2X2);
+        CALL(OM_LANCZOS_2X3);
+        CALL(OM_HALFBAND_2X_FAST);
+        CALL(OM_HALFBAND_2X_NORMAL);
+        CALL(OM_HALFBAND_2X_HIGH);
+        CALL(OM_HALFBAND_IIR_2X);
+        PTEST_SEPARATOR;
+
+        CALL(OM_LANCZOS_4X2);
+        CALL(OM_LANCZOS_4X3);
+        CALL(OM_HALFBAND_4X_FAST);
+        CALL(OM_HALFBAND_4X_NORMAL);
+        CALL(OM_HALFBAND_4X_HIGH);
+        CALL(OM_HALFBAND_IIR_4X);
+        PTEST_SEPARATOR;
+
+        CALL(OM_LANCZOS_8X2);
+        CALL(OM_LANCZOS_8X3);
+        CALL(OM_HALFBAND_8X_FAST);
+        CALL(OM_HALFBAND_8X_NORMAL);
+        CALL(OM_HALFBAND_8X_HIGH);
+        CALL(OM_HALFBAND_IIR_8X);
+        PTEST_SEPARATOR;
+
+        free_aligned(data);
+    }
+PTEST_END
@@ -0,0 +1,140 @@
+/*
+ * envelope.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/sugar.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 12
+
+namespace native
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+
+    namespace avx
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+)
+
+typedef void (* envelope_process_x4_t)(float *dst, const float *src, envelope_x4_t *e, size_t count);
+typedef void (* envelope_process_x8_t)(float *dst, const float *src, envelope_x8_t *e, size_t count);
+
+//-----------------------------------------------------------------------------
+// Performance test for envelope follower banks: 8 envelopes are computed per iteration
+PTEST_BEGIN("dsp.dynamics", envelope, 5, 1000)
+
+    template <class bank_t>
+        void init(bank_t &e, size_t lanes)
+        {
+            for (size_t j=0; j<lanes; ++j)
+            {
+                e.env[j]        = 0.0f;
+                e.attack[j]     = 0.01f;
+                e.release[j]    = 0.001f;
+                e.thresh[j]     = 0.1f;
+            }
+        }
+
+    void call(const char *label, float *dst, const float *src, size_t count, envelope_process_x4_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s envelopes...\n", buf);
+
+        envelope_x4_t e[2];
+        init(e[0], 4);
+        init(e[1], 4);
+
+        PTEST_LOOP(buf,
+            func(dst, src, &e[0], count);
+            func(&dst[count*4], &src[count*4], &e[1], count);
+        );
+    }
+
+    void call(const char *label, float *dst, const float *src, size_t count, envelope_process_x8_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s envelopes...\n", buf);
+
+        envelope_x8_t e;
+        init(e, 8);
+
+        PTEST_LOOP(buf,
+            func(dst, src, &e, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, buf_size * 16, 64);
+        float *dst      = &src[buf_size * 8];
+
+        for (size_t i=0; i < buf_size*8; ++i)
+            src[i]          = float(rand()) / RAND_MAX;
+
+        #define CALL(func, count) \
+            call(#func, dst, src, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            CALL(native::envelope_process_x4, count);
+            IF_ARCH_X86(CALL(sse::envelope_process_x4, count));
+            IF_ARCH_X86(CALL(avx::envelope_process_x4, count));
+            IF_ARCH_ARM(CALL(neon_d32::envelope_process_x4, count));
+            IF_ARCH_AARCH64(CALL(asimd::envelope_process_x4, count));
+            PTEST_SEPARATOR;
+
+            CALL(native::envelope_process_x8, count);
+            IF_ARCH_X86(CALL(sse::envelope_process_x8, count));
+            IF_ARCH_X86(CALL(avx::envelope_process_x8, count));
+            IF_ARCH_ARM(CALL(neon_d32::envelope_process_x8, count));
+            IF_ARCH_AARCH64(CALL(asimd::envelope_process_x8, count));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
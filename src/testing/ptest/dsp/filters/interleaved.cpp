@@ -0,0 +1,214 @@
+/*
+ * interleaved.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+#include <core/sugar.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 12
+
+namespace native
+{
+    void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_x2(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_x2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+
+    namespace avx
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_x2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8_fma3(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_x2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_x2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+)
+
+typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, biquad_t *f);
+
+static biquad_x1_t bq_normal = {
+    1.0, 2.0, 1.0,
+    -2.0, -1.0,
+    0.0, 0.0, 0.0
+};
+
+//-----------------------------------------------------------------------------
+// Performance test for processing of multiple channels with the same set of filters:
+// per-channel processing is compared with processing of interleaved channels
+PTEST_BEGIN("dsp.filters", interleaved, 5, 1000)
+
+    void init(biquad_t *f, size_t lanes)
+    {
+        for (size_t j=0; j<lanes; ++j)
+        {
+            if (lanes > 4)
+            {
+                f->x8.b0[j]     = bq_normal.b0;
+                f->x8.b1[j]     = bq_normal.b1;
+                f->x8.b2[j]     = bq_normal.b2;
+                f->x8.a1[j]     = bq_normal.a1;
+                f->x8.a2[j]     = bq_normal.a2;
+            }
+            else
+            {
+                f->x4.b0[j]     = bq_normal.b0;
+                f->x4.b1[j]     = bq_normal.b1;
+                f->x4.b2[j]     = bq_normal.b2;
+                f->x4.a1[j]     = bq_normal.a1;
+                f->x4.a2[j]     = bq_normal.a2;
+            }
+        }
+
+        for (size_t j=0; j<16; ++j)
+            f->d[j]         = 0.0f;
+    }
+
+    void split(const char *label, float *dst, const float *src, size_t count, size_t channels, size_t cascades, biquad_process_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d x %d", label, int(channels), int(count));
+        printf("Testing %s channels...\n", buf);
+
+        biquad_t f[8] __lsp_aligned64;
+        for (size_t i=0; i<channels; ++i)
+        {
+            for (size_t j=0; j<cascades; ++j)
+            {
+                f[i].x2.b0[j]   = bq_normal.b0;
+                f[i].x2.b1[j]   = bq_normal.b1;
+                f[i].x2.b2[j]   = bq_normal.b2;
+                f[i].x2.a1[j]   = bq_normal.a1;
+                f[i].x2.a2[j]   = bq_normal.a2;
+                f[i].x2.p[j]    = 0.0f;
+            }
+            if (cascades < 2)
+                f[i].x1         = bq_normal;
+            for (size_t j=0; j<16; ++j)
+                f[i].d[j]       = 0.0f;
+        }
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<channels; ++i)
+                func(&dst[i*count], &src[i*count], count, &f[i]);
+        );
+    }
+
+    void interleaved(const char *label, float *dst, const float *src, size_t count, size_t lanes, biquad_process_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", label, int(count));
+        printf("Testing %s channels...\n", buf);
+
+        biquad_t f __lsp_aligned64;
+        init(&f, lanes);
+
+        PTEST_LOOP(buf,
+            func(dst, src, count, &f);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *src      = alloc_aligned<float>(data, buf_size * 16, 64);
+        float *dst      = &src[buf_size * 8];
+
+        for (size_t i=0; i < buf_size*8; ++i)
+            src[i]          = float(rand()) / RAND_MAX;
+
+        #define SPLIT(func, channels, cascades, count) \
+            split(#func, dst, src, count, channels, cascades, func)
+        #define INTERLEAVED(func, lanes, count) \
+            interleaved(#func, dst, src, count, lanes, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            size_t count = 1 << i;
+
+            // Stereo, two filters per channel
+            SPLIT(native::biquad_process_x2, 2, 2, count);
+            IF_ARCH_X86(SPLIT(sse::biquad_process_x2, 2, 2, count));
+            IF_ARCH_X86(SPLIT(avx::biquad_process_x2, 2, 2, count));
+            IF_ARCH_ARM(SPLIT(neon_d32::biquad_process_x2, 2, 2, count));
+            IF_ARCH_AARCH64(SPLIT(asimd::biquad_process_x2, 2, 2, count));
+            INTERLEAVED(native::biquad_process_i2, 4, count);
+            IF_ARCH_X86(INTERLEAVED(sse::biquad_process_i2, 4, count));
+            IF_ARCH_ARM(INTERLEAVED(neon_d32::biquad_process_i2, 4, count));
+            IF_ARCH_AARCH64(INTERLEAVED(asimd::biquad_process_i2, 4, count));
+            PTEST_SEPARATOR;
+
+            // Four channels, one filter per channel
+            SPLIT(native::biquad_process_x1, 4, 1, count);
+            IF_ARCH_X86(SPLIT(sse::biquad_process_x1, 4, 1, count));
+            IF_ARCH_X86(SPLIT(avx::biquad_process_x1, 4, 1, count));
+            IF_ARCH_ARM(SPLIT(neon_d32::biquad_process_x1, 4, 1, count));
+            IF_ARCH_AARCH64(SPLIT(asimd::biquad_process_x1, 4, 1, count));
+            INTERLEAVED(native::biquad_process_i4, 4, count);
+            IF_ARCH_X86(INTERLEAVED(sse::biquad_process_i4, 4, count));
+            IF_ARCH_ARM(INTERLEAVED(neon_d32::biquad_process_i4, 4, count));
+            IF_ARCH_AARCH64(INTERLEAVED(asimd::biquad_process_i4, 4, count));
+            PTEST_SEPARATOR;
+
+            // Eight channels, one filter per channel
+            SPLIT(native::biquad_process_x1, 8, 1, count);
+            IF_ARCH_X86(SPLIT(sse::biquad_process_x1, 8, 1, count));
+            IF_ARCH_X86(SPLIT(avx::biquad_process_x1, 8, 1, count));
+            IF_ARCH_ARM(SPLIT(neon_d32::biquad_process_x1, 8, 1, count));
+            IF_ARCH_AARCH64(SPLIT(asimd::biquad_process_x1, 8, 1, count));
+            INTERLEAVED(native::biquad_process_i8, 8, count);
+            IF_ARCH_X86(INTERLEAVED(sse::biquad_process_i8, 8, count));
+            IF_ARCH_X86(INTERLEAVED(avx::biquad_process_i8, 8, count));
+            IF_ARCH_X86(INTERLEAVED(avx::biquad_process_i8_fma3, 8, count));
+            IF_ARCH_ARM(INTERLEAVED(neon_d32::biquad_process_i8, 8, count));
+            IF_ARCH_AARCH64(INTERLEAVED(asimd::biquad_process_i8, 8, count));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+PTEST_END
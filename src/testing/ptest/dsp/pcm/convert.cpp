@@ -0,0 +1,139 @@
+/*
+ * convert.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+
+#define MIN_RANK 8
+#define MAX_RANK 16
+
+#define PCM_DECL \
+    void pcm_s16_to_f32(float *dst, const int16_t *src, size_t count); \
+    void pcm_s24le_to_f32(float *dst, const uint8_t *src, size_t count); \
+    void pcm_s32_to_f32(float *dst, const int32_t *src, size_t count); \
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count); \
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count); \
+    void pcm_f32_to_s32(int32_t *dst, const float *src, size_t count);
+
+namespace native
+{
+    PCM_DECL
+}
+
+IF_ARCH_X86(
+    namespace sse2
+    {
+        PCM_DECL
+    }
+
+    namespace avx2
+    {
+        PCM_DECL
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count);
+        void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        PCM_DECL
+    }
+)
+
+#undef PCM_DECL
+
+//-----------------------------------------------------------------------------
+// Performance test for PCM sample format conversions
+PTEST_BEGIN("dsp.pcm", convert, 5, 1000)
+
+    template <class D, class S>
+        void call(const char *label, D *dst, const S *src, size_t count, void (* func)(D *dst, const S *src, size_t count))
+        {
+            if (!PTEST_SUPPORTED(func))
+                return;
+
+            char buf[80];
+            sprintf(buf, "%s x %d", label, int(count));
+            printf("Testing %s samples ...\n", buf);
+
+            PTEST_LOOP(buf,
+                func(dst, src, count);
+            );
+        }
+
+    PTEST_MAIN
+    {
+        size_t buf_size = 1 << MAX_RANK;
+        uint8_t *data   = NULL;
+        float *f        = alloc_aligned<float>(data, buf_size * 4, 64);
+        uint8_t *pcm    = reinterpret_cast<uint8_t *>(&f[buf_size]);
+
+        for (size_t i=0; i < buf_size; ++i)
+            f[i]            = (float(rand()) * 2.0f) / RAND_MAX - 1.0f;
+        for (size_t i=0; i < buf_size * sizeof(int32_t); ++i)
+            pcm[i]          = uint8_t(rand());
+
+        int16_t *s16    = reinterpret_cast<int16_t *>(pcm);
+        int32_t *s32    = reinterpret_cast<int32_t *>(pcm);
+
+        #define CALL(func, dst, src, count) \
+            call(#func, dst, src, count, func)
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; i += 4)
+        {
+            size_t count = 1 << i;
+
+            CALL(native::pcm_s16_to_f32, f, s16, count);
+            IF_ARCH_X86(CALL(sse2::pcm_s16_to_f32, f, s16, count));
+            IF_ARCH_X86(CALL(avx2::pcm_s16_to_f32, f, s16, count));
+            IF_ARCH_AARCH64(CALL(asimd::pcm_s16_to_f32, f, s16, count));
+            PTEST_SEPARATOR;
+
+            CALL(native::pcm_s24le_to_f32, f, pcm, count);
+            IF_ARCH_X86(CALL(sse2::pcm_s24le_to_f32, f, pcm, count));
+            IF_ARCH_X86(CALL(avx2::pcm_s24le_to_f32, f, pcm, count));
+            IF_ARCH_AARCH64(CALL(asimd::pcm_s24le_to_f32, f, pcm, count));
+            PTEST_SEPARATOR;
+
+            CALL(native::pcm_s32_to_f32, f, s32, count);
+            IF_ARCH_X86(CALL(sse2::pcm_s32_to_f32, f, s32, count));
+            IF_ARCH_X86(CALL(avx2::pcm_s32_to_f32, f, s32, count));
+            IF_ARCH_AARCH64(CALL(asimd::pcm_s32_to_f32, f, s32, count));
+            PTEST_SEPARATOR;
+
+            CALL(native::pcm_f32_to_s16, s16, f, count);
+            IF_ARCH_X86(CALL(sse2::pcm_f32_to_s16, s16, f, count));
+            IF_ARCH_X86(CALL(avx2::pcm_f32_to_s16, s16, f, count));
+            IF_ARCH_ARM(CALL(neon_d32::pcm_f32_to_s16, s16, f, count));
+            IF_ARCH_AARCH64(CALL(asimd::pcm_f32_to_s16, s16, f, count));
+            PTEST_SEPARATOR;
+
+            CALL(native::pcm_f32_to_s24le, pcm, f, count);
+            IF_ARCH_X86(CALL(sse2::pcm_f32_to_s24le, pcm, f, count));
+            IF_ARCH_X86(CALL(avx2::pcm_f32_to_s24le, pcm, f, count));
+            IF_ARCH_ARM(CALL(neon_d32::pcm_f32_to_s24le, pcm, f, count));
+            IF_ARCH_AARCH64(CALL(asimd::pcm_f32_to_s24le, pcm, f, count));
+            PTEST_SEPARATOR;
+
+            CALL(native::pcm_f32_to_s32, s32, f, count);
+            IF_ARCH_X86(CALL(sse2::pcm_f32_to_s32, s32, f, count));
+            IF_ARCH_X86(CALL(avx2::pcm_f32_to_s32, s32, f, count));
+            IF_ARCH_AARCH64(CALL(asimd::pcm_f32_to_s32, s32, f, count));
+            PTEST_SEPARATOR2;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
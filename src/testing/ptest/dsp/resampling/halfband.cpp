@@ -0,0 +1,91 @@
+/*
+ * halfband.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+
+#define RTEST_BUF_SIZE  0x1000
+
+namespace native
+{
+    void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+    void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+    }
+
+    namespace avx
+    {
+        void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_upsample_2x_fma3(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_downsample_2x_fma3(float *dst, const float *src, const float *k, size_t taps, size_t count);
+    }
+)
+
+typedef void (* halfband_func_t)(float *dst, const float *src, const float *k, size_t taps, size_t count);
+
+//-----------------------------------------------------------------------------
+// Performance test for polyphase half-band 2x resampling
+PTEST_BEGIN("dsp.resampling", halfband, 5, 1000)
+
+    void call(float *out, const float *in, const float *k, size_t taps, size_t count, const char *text, halfband_func_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %d", text, int(taps));
+        printf("Testing %s resampling for %d samples ...\n", buf, int(count));
+
+        PTEST_LOOP(buf,
+            func(out, in, k, taps, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        float *out          = new float[RTEST_BUF_SIZE*2];
+        float *in           = new float[RTEST_BUF_SIZE*2 + 64];
+        float *k            = new float[32];
+
+        // Prepare data
+        for (size_t i=0; i<RTEST_BUF_SIZE*2 + 64; ++i)
+            in[i]               = float(rand()) / RAND_MAX;
+        for (size_t i=0; i<32; ++i)
+            k[i]                = float(rand()) / RAND_MAX;
+
+        #define CALL(func, taps, count) \
+            call(out, in, k, taps, count, #func, func);
+
+        // Do tests
+        for (size_t taps=8; taps <= 32; taps <<= 1)
+        {
+            CALL(native::halfband_upsample_2x, taps, RTEST_BUF_SIZE);
+            IF_ARCH_X86(CALL(sse::halfband_upsample_2x, taps, RTEST_BUF_SIZE));
+            IF_ARCH_X86(CALL(avx::halfband_upsample_2x, taps, RTEST_BUF_SIZE));
+            IF_ARCH_X86(CALL(avx::halfband_upsample_2x_fma3, taps, RTEST_BUF_SIZE));
+            PTEST_SEPARATOR;
+
+            CALL(native::halfband_downsample_2x, taps, RTEST_BUF_SIZE);
+            IF_ARCH_X86(CALL(sse::halfband_downsample_2x, taps, RTEST_BUF_SIZE));
+            IF_ARCH_X86(CALL(avx::halfband_downsample_2x, taps, RTEST_BUF_SIZE));
+            IF_ARCH_X86(CALL(avx::halfband_downsample_2x_fma3, taps, RTEST_BUF_SIZE));
+            PTEST_SEPARATOR2;
+        }
+
+        delete [] out;
+        delete [] in;
+        delete [] k;
+    }
+
+PTEST_END
@@ -0,0 +1,95 @@
+/*
+ * interpolation.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/ptest.h>
+
+#define RTEST_BUF_SIZE  0x1000
+
+namespace native
+{
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+
+    namespace avx
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+)
+
+typedef void (* cubic_interpolate_t)(float *dst, const float *src, float pos, float step, size_t count);
+
+//-----------------------------------------------------------------------------
+// Performance test for variable-rate interpolation
+PTEST_BEGIN("dsp.resampling", interpolation, 5, 1000)
+
+    void call(float *out, const float *in, size_t count, float step, const char *text, cubic_interpolate_t func)
+    {
+        if (!PTEST_SUPPORTED(func))
+            return;
+
+        char buf[80];
+        sprintf(buf, "%s x %.2f", text, step);
+        printf("Testing %s interpolation for %d samples ...\n", buf, int(count));
+
+        PTEST_LOOP(buf,
+            func(out, &in[1], 0.5f, step, count);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        float *out          = new float[RTEST_BUF_SIZE];
+        float *in           = new float[RTEST_BUF_SIZE*2 + 4];
+
+        // Prepare data
+        for (size_t i=0; i<RTEST_BUF_SIZE*2 + 4; ++i)
+            in[i]               = float(rand()) / RAND_MAX;
+
+        #define CALL(func, step) \
+            call(out, in, RTEST_BUF_SIZE, step, #func, func);
+
+        // Do tests
+        CALL(native::cubic_interpolate, 0.75f);
+        IF_ARCH_X86(CALL(sse::cubic_interpolate, 0.75f));
+        IF_ARCH_X86(CALL(avx::cubic_interpolate, 0.75f));
+        IF_ARCH_ARM(CALL(neon_d32::cubic_interpolate, 0.75f));
+        IF_ARCH_AARCH64(CALL(asimd::cubic_interpolate, 0.75f));
+        PTEST_SEPARATOR;
+
+        CALL(native::cubic_interpolate, 1.5f);
+        IF_ARCH_X86(CALL(sse::cubic_interpolate, 1.5f));
+        IF_ARCH_X86(CALL(avx::cubic_interpolate, 1.5f));
+        IF_ARCH_ARM(CALL(neon_d32::cubic_interpolate, 1.5f));
+        IF_ARCH_AARCH64(CALL(asimd::cubic_interpolate, 1.5f));
+        PTEST_SEPARATOR;
+
+        delete [] out;
+        delete [] in;
+    }
+
+PTEST_END
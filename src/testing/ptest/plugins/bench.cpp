@@ -0,0 +1,177 @@
+/*
+ * bench.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/ptest.h>
+#include <errno.h>
+#include <core/types.h>
+#include <data/cvector.h>
+#include <data/cstorage.h>
+
+#include <plugins/plugins.h>
+#include <container/bench/wrapper.h>
+
+#define DFL_SAMPLE_RATE     "48000"
+#define DFL_BLOCK_SIZE      "512"
+#define DFL_AUTOMATION      16          /* Blocks   */
+#define DFL_MIDI_PERIOD     250         /* ms       */
+
+using namespace lsp;
+
+//-----------------------------------------------------------------------------
+// Performance test of the whole plugin processing, usage:
+//   ptest plugins.bench -a [key=value...] [plugin_id...]
+// Keys:
+//   srate=N[,N...]     list of sample rates
+//   block=N[,N...]     list of block sizes passed to process()
+//   auto=N             number of blocks between automation steps, 0 disables automation
+//   midi=N             period of generated MIDI notes in milliseconds, 0 disables MIDI
+//   ui=on|off          emulate active UI
+// If no plugin identifiers are specified, all plugins are tested.
+PTEST_BEGIN("plugins", bench, 1, 1)
+
+    typedef struct config_t
+    {
+        cvector<char>       ids;
+        cstorage<size_t>    srates;
+        cstorage<size_t>    blocks;
+        size_t              automation;
+        size_t              midi;
+        bool                ui;
+    } config_t;
+
+    static plugin_t *create_plugin(const char *id)
+    {
+        #define MOD_PLUGIN(plugin, ui) \
+            if (!strcmp(plugin::metadata.lv2_uid, id)) \
+                return new plugin();
+        #include <metadata/modules.h>
+
+        return NULL;
+    }
+
+    bool parse_list(cstorage<size_t> *dst, const char *s)
+    {
+        while (*s != '\0')
+        {
+            char *end   = NULL;
+            errno       = 0;
+            long v      = strtol(s, &end, 10);
+            if ((errno != 0) || (end == s) || (v <= 0) || ((*end != ',') && (*end != '\0')))
+                return false;
+
+            size_t *p   = dst->add();
+            if (p == NULL)
+                return false;
+            *p          = v;
+            s           = (*end == ',') ? end + 1 : end;
+        }
+        return true;
+    }
+
+    void parse_args(config_t *cfg, int argc, const char **argv)
+    {
+        cfg->automation = DFL_AUTOMATION;
+        cfg->midi       = DFL_MIDI_PERIOD;
+        cfg->ui         = true;
+
+        for (int i=0; i<argc; ++i)
+        {
+            const char *arg = argv[i];
+            bool valid      = true;
+
+            if (!strncmp(arg, "srate=", 6))
+                valid   = parse_list(&cfg->srates, &arg[6]);
+            else if (!strncmp(arg, "block=", 6))
+                valid   = parse_list(&cfg->blocks, &arg[6]);
+            else if (!strncmp(arg, "auto=", 5))
+                cfg->automation = atoi(&arg[5]);
+            else if (!strncmp(arg, "midi=", 5))
+                cfg->midi       = atoi(&arg[5]);
+            else if (!strncmp(arg, "ui=", 3))
+                cfg->ui         = strcmp(&arg[3], "off");
+            else
+                valid   = cfg->ids.add(const_cast<char *>(arg));
+
+            if (!valid)
+                PTEST_FAIL_MSG("Invalid argument: %s", arg);
+        }
+
+        // Apply defaults
+        if ((cfg->srates.size() <= 0) && (!parse_list(&cfg->srates, DFL_SAMPLE_RATE)))
+            PTEST_FAIL_MSG("Could not set default sample rate");
+        if ((cfg->blocks.size() <= 0) && (!parse_list(&cfg->blocks, DFL_BLOCK_SIZE)))
+            PTEST_FAIL_MSG("Could not set default block size");
+        if (cfg->ids.size() <= 0)
+        {
+            #define MOD_PLUGIN(plugin, ui) \
+                cfg->ids.add(const_cast<char *>(plugin::metadata.lv2_uid));
+            #include <metadata/modules.h>
+        }
+    }
+
+    void call(const char *id, const config_t *cfg, size_t srate, size_t block)
+    {
+        plugin_t *p = create_plugin(id);
+        if (p == NULL)
+            PTEST_FAIL_MSG("Unknown plugin identifier: %s", id);
+
+        bench_settings_t s;
+        s.sample_rate   = srate;
+        s.block_size    = block;
+        s.automation    = cfg->automation;
+        s.midi_period   = (cfg->midi * srate) / 1000;
+        s.ui            = cfg->ui;
+
+        BenchWrapper w(p);
+        status_t res    = w.init(&s);
+        if (res != STATUS_OK)
+            PTEST_FAIL_MSG("Could not initialize plugin %s, code=%d", id, int(res));
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %d Hz x %d", id, int(srate), int(block));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            w.run();
+        );
+
+        // Estimate real-time factor: the part of block's duration spent on processing
+        stats_t *st     = __test_stats.last();
+        if ((st != NULL) && (st->key != NULL) && (st->v_iterations > 0))
+        {
+            double period   = double(block) / srate;
+            printf("  real-time factor: mean=%.4f", (st->v_time / st->v_iterations) / period);
+            if (__test_clock != PTEST_CLOCK_CYCLES)
+                printf(", p99=%.4f, max=%.4f", st->v_p99 * 1e-6 / period, st->v_max * 1e-6 / period);
+            printf(", automated ports: %d\n", int(w.automated()));
+        }
+
+        w.destroy();
+        p->destroy();
+        delete p;
+    }
+
+    PTEST_MAIN
+    {
+        config_t cfg;
+        parse_args(&cfg, argc, argv);
+
+        for (size_t i=0, n=cfg.ids.size(); i<n; ++i)
+        {
+            for (size_t j=0, ns=cfg.srates.size(); j<ns; ++j)
+                for (size_t k=0, nb=cfg.blocks.size(); k<nb; ++k)
+                    call(cfg.ids.at(i), &cfg, *cfg.srates.at(j), *cfg.blocks.at(k));
+
+            PTEST_SEPARATOR;
+        }
+
+        cfg.ids.flush();
+        cfg.srates.flush();
+        cfg.blocks.flush();
+    }
+
+PTEST_END
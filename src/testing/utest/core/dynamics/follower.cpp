@@ -0,0 +1,181 @@
+/*
+ * follower.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <test/FloatBuffer.h>
+#include <core/dynamics/Compressor.h>
+#include <core/dynamics/Expander.h>
+#include <core/dynamics/Gate.h>
+#include <core/dynamics/DynamicProcessor.h>
+
+#define SRATE           48000
+#define BUF_SIZE        1000
+#define CHANNELS        11
+#define TOLERANCE       1e-5f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.dynamics", follower)
+
+    void setup(Compressor *c, size_t i)
+    {
+        c->set_sample_rate(SRATE);
+        c->set_mode((i & 1) ? CM_UPWARD : CM_DOWNWARD);
+        c->set_threshold(GAIN_AMP_M_12_DB, GAIN_AMP_M_24_DB);
+        c->set_boost_threshold(GAIN_AMP_M_36_DB);
+        c->set_timings(1.0f + i, 10.0f + i * 5.0f);
+        c->set_ratio(4.0f);
+        c->set_knee(GAIN_AMP_M_6_DB);
+        c->update_settings();
+    }
+
+    void setup(Expander *c, size_t i)
+    {
+        c->set_sample_rate(SRATE);
+        c->set_mode((i & 1) ? EM_UPWARD : EM_DOWNWARD);
+        c->set_threshold(GAIN_AMP_M_12_DB, GAIN_AMP_M_24_DB);
+        c->set_timings(1.0f + i, 10.0f + i * 5.0f);
+        c->set_ratio(2.0f);
+        c->set_knee(GAIN_AMP_M_6_DB);
+        c->update_settings();
+    }
+
+    void setup(Gate *c, size_t i)
+    {
+        c->set_sample_rate(SRATE);
+        c->set_threshold(GAIN_AMP_M_12_DB, GAIN_AMP_M_18_DB);
+        c->set_zone(GAIN_AMP_M_6_DB, GAIN_AMP_M_6_DB);
+        c->set_timings(1.0f + i, 10.0f + i * 5.0f);
+        c->set_reduction(GAIN_AMP_M_24_DB);
+        c->update_settings();
+    }
+
+    void setup(DynamicProcessor *c, size_t i)
+    {
+        c->set_sample_rate(SRATE);
+        for (size_t j=0; j<DYNAMIC_PROCESSOR_DOTS; ++j)
+        {
+            c->set_attack_level(j, -1.0f);
+            c->set_release_level(j, -1.0f);
+            c->set_dot(j, -1.0f, -1.0f, -1.0f);
+        }
+        for (size_t j=0; j<DYNAMIC_PROCESSOR_RANGES; ++j)
+        {
+            c->set_attack_time(j, 1.0f + i + j);
+            c->set_release_time(j, 10.0f + i * 5.0f + j);
+        }
+        c->set_dot(0, GAIN_AMP_M_12_DB, GAIN_AMP_M_18_DB, GAIN_AMP_M_6_DB);
+
+        // Some of processors have level-dependent reactions
+        if (i % 3)
+        {
+            c->set_attack_level(0, GAIN_AMP_M_12_DB);
+            c->set_release_level(0, GAIN_AMP_M_6_DB);
+        }
+        c->set_in_ratio(1.0f);
+        c->set_out_ratio(2.0f);
+        c->update_settings();
+    }
+
+    template <class T>
+        void test_batch(const char *label)
+        {
+            T c1[CHANNELS], c2[CHANNELS];
+            T *vc[CHANNELS];
+            FloatBuffer *in[CHANNELS], *out1[CHANNELS], *out2[CHANNELS], *env1[CHANNELS], *env2[CHANNELS];
+            const float *vin[CHANNELS];
+            float *vout[CHANNELS], *venv[CHANNELS];
+
+            for (size_t n=1; n <= CHANNELS; ++n)
+            {
+                printf("Testing batch processing of %d %s instances...\n", int(n), label);
+
+                for (size_t i=0; i<n; ++i)
+                {
+                    setup(&c1[i], i);
+                    setup(&c2[i], i);
+
+                    in[i]       = new FloatBuffer(BUF_SIZE);
+                    out1[i]     = new FloatBuffer(BUF_SIZE);
+                    out2[i]     = new FloatBuffer(BUF_SIZE);
+                    env1[i]     = new FloatBuffer(BUF_SIZE);
+                    env2[i]     = new FloatBuffer(BUF_SIZE);
+
+                    // Bursts of signal with different level for each channel
+                    float *s    = *in[i];
+                    for (size_t j=0; j<BUF_SIZE; ++j)
+                        s[j]        = (float(rand()) / RAND_MAX) * (((j / (100 + i*10)) & 1) ? 0.01f : 1.0f);
+
+                    vc[i]       = &c2[i];
+                    vin[i]      = *in[i];
+                    vout[i]     = *out2[i];
+                    venv[i]     = (i & 1) ? NULL : env2[i]->data();
+                }
+
+                // Process data by blocks of different size
+                for (size_t off=0, step=1; off < BUF_SIZE; step = (step * 7) % 300 + 1)
+                {
+                    size_t to_do = (BUF_SIZE - off > step) ? step : BUF_SIZE - off;
+
+                    for (size_t i=0; i<n; ++i)
+                        c1[i].process(out1[i]->data(off), (i & 1) ? NULL : env1[i]->data(off), in[i]->data(off), to_do);
+
+                    T::process(vc, vout, venv, vin, n, to_do);
+                    for (size_t i=0; i<n; ++i)
+                    {
+                        vin[i]     += to_do;
+                        vout[i]    += to_do;
+                        if (venv[i] != NULL)
+                            venv[i]    += to_do;
+                    }
+
+                    off    += to_do;
+                }
+
+                // Compare results
+                for (size_t i=0; i<n; ++i)
+                {
+                    UTEST_ASSERT_MSG(in[i]->valid(), "Input buffer %d corrupted", int(i));
+                    UTEST_ASSERT_MSG(out1[i]->valid(), "Output buffer 1 of channel %d corrupted", int(i));
+                    UTEST_ASSERT_MSG(out2[i]->valid(), "Output buffer 2 of channel %d corrupted", int(i));
+                    UTEST_ASSERT_MSG(env1[i]->valid(), "Envelope buffer 1 of channel %d corrupted", int(i));
+                    UTEST_ASSERT_MSG(env2[i]->valid(), "Envelope buffer 2 of channel %d corrupted", int(i));
+
+                    if (!out1[i]->equals_adaptive(*out2[i], TOLERANCE))
+                    {
+                        UTEST_FAIL_MSG("Output of channel %d differs at sample %d: %.6f vs %.6f",
+                                int(i), int(out1[i]->last_diff()), out1[i]->get_diff(), out2[i]->get_diff());
+                    }
+                    if ((!(i & 1)) && (!env1[i]->equals_adaptive(*env2[i], TOLERANCE)))
+                    {
+                        UTEST_FAIL_MSG("Envelope of channel %d differs at sample %d: %.6f vs %.6f",
+                                int(i), int(env1[i]->last_diff()), env1[i]->get_diff(), env2[i]->get_diff());
+                    }
+                }
+
+                for (size_t i=0; i<n; ++i)
+                {
+                    delete in[i];
+                    delete out1[i];
+                    delete out2[i];
+                    delete env1[i];
+                    delete env2[i];
+                }
+            }
+        }
+
+    UTEST_MAIN
+    {
+        test_batch<Compressor>("compressor");
+        test_batch<Expander>("expander");
+        test_batch<Gate>("gate");
+        test_batch<DynamicProcessor>("dynamic processor");
+    }
+
+UTEST_END
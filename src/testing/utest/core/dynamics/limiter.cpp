@@ -14,6 +14,32 @@
 
 #define SRATE       48000
 #define BUF_SIZE    4096
+#define SLIDE_TOL   1e-3f
+#define PENDING_TOL 1e-5f
+
+namespace lsp
+{
+    class LimiterSlide: public Limiter
+    {
+        public:
+            size_t attack() const
+            {
+                return sSlide.nAttack;
+            }
+
+            double kernel(size_t t) const
+            {
+                const double *k = sSlide.vKernel;
+                double x        = t;
+                return ((k[3]*x + k[2])*x + k[1])*x + k[0] + sSlide.fExpGain * ::pow(sSlide.fExpUp, x);
+            }
+
+            float pending(float rise)
+            {
+                return pending_slide(&sSlide, rise);
+            }
+    };
+}
 
 using namespace lsp;
 
@@ -84,9 +110,169 @@ UTEST_BEGIN("core.dynamics", limiter)
         l.destroy();
     }
 
+    void process_limiter(Limiter &l, float *out, float *gain, const float *in, size_t count)
+    {
+        // Use variable block size to check state transitions between calls
+        for (size_t i=0, step=1; i<count; step = (step * 7) % 1024 + 1)
+        {
+            size_t to_do = (count - i > step) ? step : count - i;
+            l.process(&out[i], &gain[i], &in[i], &in[i], to_do);
+            i += to_do;
+        }
+    }
+
+    void test_sliding(limiter_mode_t mode, const char *name, bool dense)
+    {
+        FloatBuffer in(BUF_SIZE * 4);
+        FloatBuffer out1(in.size());
+        FloatBuffer out2(in.size());
+        FloatBuffer gain1(in.size());
+        FloatBuffer gain2(in.size());
+
+        printf("Testing sliding window peak detector for mode %s, %s peaks...\n",
+                name, (dense) ? "dense" : "isolated");
+
+        // Prepare noise with isolated or dense peaks
+        if (dense)
+            in.randomize(-1.5f, 1.5f);
+        else
+        {
+            in.randomize(-0.5f, 0.5f);
+            for (size_t i=0; i<8; ++i)
+                in[BUF_SIZE/4 + i*BUF_SIZE/2]  = ((i & 1) ? -1.0f : 1.0f) * (1.0f + i*0.3f);
+        }
+
+        Limiter l1, l2;
+        UTEST_ASSERT(l1.init(SRATE, 20.0f));
+        UTEST_ASSERT(l2.init(SRATE, 20.0f));
+
+        Limiter *vl[2] = { &l1, &l2 };
+        for (size_t i=0; i<2; ++i)
+        {
+            Limiter *l = vl[i];
+            l->set_sample_rate(SRATE);
+            l->set_mode(mode);
+            l->set_knee(GAIN_AMP_M_3_DB);
+            l->set_threshold(0.5f);
+            l->set_attack(2.0f);
+            l->set_release(5.0f);
+            l->set_lookahead(5.0f);
+            l->update_settings();
+        }
+        UTEST_ASSERT(!l2.get_sliding());
+        l1.set_sliding(true);
+        UTEST_ASSERT(l1.get_sliding());
+
+        process_limiter(l1, out1, gain1, in, in.size());
+        process_limiter(l2, out2, gain2, in, in.size());
+
+        UTEST_ASSERT_MSG(out1.valid(), "Output buffer 1 corrupted");
+        UTEST_ASSERT_MSG(gain1.valid(), "Gain buffer 1 corrupted");
+        UTEST_ASSERT_MSG(out2.valid(), "Output buffer 2 corrupted");
+        UTEST_ASSERT_MSG(gain2.valid(), "Gain buffer 2 corrupted");
+
+        // Check that there is no overload
+        float diff = 0.0f, max_diff = 0.0f;
+        for (size_t i=0; i<in.size(); ++i)
+        {
+            float s = out1[i] * gain1[i];
+            UTEST_ASSERT_MSG(fabs(s) <= 0.5f, "Overload at sample %d: %f", int(i), s);
+            UTEST_ASSERT(float_equals_adaptive(out1[i], out2[i]));
+            UTEST_ASSERT(gain1[i] >= 0.0f);
+
+            float d = gain1[i] - gain2[i];
+            diff   += d;
+            if (fabs(d) > max_diff)
+                max_diff = fabs(d);
+
+            // On isolated peaks the gain curves should match the patched one
+            if (!dense)
+                UTEST_ASSERT_MSG(float_equals_relative(gain1[i], gain2[i], SLIDE_TOL),
+                        "Gain curve differs at sample %d: sliding=%f, patch=%f", int(i), gain1[i], gain2[i]);
+        }
+        diff   /= in.size();
+        printf("Gain difference: average=%.5f, maximum=%.5f\n", diff, max_diff);
+
+        // Patches overlap on dense peaks and the patched gain curve lowers, the sliding window
+        // peak detector should not reduce gain more
+        if (dense)
+            UTEST_ASSERT_MSG(diff > -0.005f, "Average gain is lower than expected: %f", diff);
+
+        l1.destroy();
+        l2.destroy();
+    }
+
+    void test_pending(limiter_mode_t mode, const char *name)
+    {
+        FloatBuffer rise(BUF_SIZE * 4);
+        printf("Testing pending part of rises for mode %s...\n", name);
+
+        LimiterSlide l;
+        UTEST_ASSERT(l.init(SRATE, 20.0f));
+        l.set_sample_rate(SRATE);
+        l.set_mode(mode);
+        l.set_sliding(true);
+        l.set_attack(2.0f);
+        l.set_release(5.0f);
+        l.set_lookahead(5.0f);
+        l.update_settings();
+
+        size_t len = l.attack();
+        UTEST_ASSERT(len > 0);
+
+        // Alternate rises at each sample (the worst case), sparse rises and silence
+        for (size_t i=0; i<rise.size(); ++i)
+        {
+            float r = float(rand()) / RAND_MAX;
+            switch ((i / 1000) % 3)
+            {
+                case 0: rise[i] = r * 0.01f; break;
+                case 1: rise[i] = (r < 0.02f) ? r * 10.0f : 0.0f; break;
+                default: rise[i] = 0.0f; break;
+            }
+        }
+
+        // Compare with the direct convolution of rises with the attack kernel
+        for (size_t i=0; i<rise.size(); ++i)
+        {
+            float p     = l.pending(rise[i]);
+            double ref  = 0.0;
+            for (size_t j=0; (j < len) && (j <= i); ++j)
+                ref        += rise[i-j] * l.kernel(j);
+
+            UTEST_ASSERT_MSG(fabs(p - ref) <= PENDING_TOL,
+                    "Pending part differs at sample %d: moments=%f, direct=%f", int(i), p, ref);
+        }
+
+        l.destroy();
+    }
+
     UTEST_MAIN
     {
         test_triangle_peak_classic();
+
+        test_pending(LM_HERM_WIDE, "LM_HERM_WIDE");
+        test_pending(LM_EXP_THIN, "LM_EXP_THIN");
+        test_pending(LM_LINE_DUCK, "LM_LINE_DUCK");
+
+        #define TEST_SLIDING(mode)  \
+            test_sliding(mode, #mode, false); \
+            test_sliding(mode, #mode, true);
+        TEST_SLIDING(LM_HERM_THIN);
+        TEST_SLIDING(LM_HERM_WIDE);
+        TEST_SLIDING(LM_HERM_TAIL);
+        TEST_SLIDING(LM_HERM_DUCK);
+        TEST_SLIDING(LM_EXP_THIN);
+        TEST_SLIDING(LM_EXP_WIDE);
+        TEST_SLIDING(LM_EXP_TAIL);
+        TEST_SLIDING(LM_EXP_DUCK);
+        TEST_SLIDING(LM_LINE_THIN);
+        TEST_SLIDING(LM_LINE_WIDE);
+        TEST_SLIDING(LM_LINE_TAIL);
+        TEST_SLIDING(LM_LINE_DUCK);
+        TEST_SLIDING(LM_MIXED_HERM);
+        TEST_SLIDING(LM_MIXED_EXP);
+        TEST_SLIDING(LM_MIXED_LINE);
     }
 
 UTEST_END
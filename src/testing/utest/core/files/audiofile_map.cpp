@@ -0,0 +1,204 @@
+/*
+ * audiofile_map.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <stdio.h>
+#include <test/utest.h>
+#include <dsp/endian.h>
+#include <core/LSPString.h>
+#include <core/files/AudioFile.h>
+#include <core/files/lspc/LSPCAudioWriter.h>
+
+#define SAMPLE_RATE         48000
+#define LONG_FRAMES         100003
+#define SHORT_FRAMES        1001
+
+using namespace lsp;
+
+UTEST_BEGIN("core.files", audiofile_map)
+
+    void init_data(float *dst, size_t channels, size_t frames)
+    {
+        for (size_t i=0; i<frames; ++i)
+            for (size_t j=0; j<channels; ++j)
+                *(dst++)    = float(i) + j * 0.25f;
+    }
+
+    void write_lspc(const LSPString *path, const float *data, size_t channels, size_t frames, size_t fmt)
+    {
+        LSPCAudioWriter aw;
+        lspc_audio_parameters_t p;
+
+        p.channels          = channels;
+        p.sample_format     = fmt;
+        p.sample_rate       = SAMPLE_RATE;
+        p.codec             = LSPC_CODEC_PCM;
+        p.frames            = frames;
+
+        UTEST_ASSERT(aw.create(path, &p) == STATUS_OK);
+        UTEST_ASSERT(aw.write_frames(data, frames) == STATUS_OK);
+        UTEST_ASSERT(aw.close() == STATUS_OK);
+    }
+
+    void write_wav(const LSPString *path, const float *data, size_t channels, size_t frames)
+    {
+        FILE *fd = fopen(path->get_native(), "wb");
+        UTEST_ASSERT(fd != NULL);
+
+        uint32_t data_size  = frames * channels * sizeof(float);
+        uint32_t u32;
+        uint16_t u16;
+
+        // RIFF header with extensible format and extra chunk before data
+        fwrite("RIFF", 4, 1, fd);
+        u32 = CPU_TO_LE(uint32_t(4 + 8 + 40 + 8 + 3 + 1 + 8 + data_size));     fwrite(&u32, 4, 1, fd);
+        fwrite("WAVE", 4, 1, fd);
+        fwrite("fmt ", 4, 1, fd);
+        u32 = CPU_TO_LE(uint32_t(40));                                          fwrite(&u32, 4, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(0xfffe));                                      fwrite(&u16, 2, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(channels));                                    fwrite(&u16, 2, 1, fd);
+        u32 = CPU_TO_LE(uint32_t(SAMPLE_RATE));                                 fwrite(&u32, 4, 1, fd);
+        u32 = CPU_TO_LE(uint32_t(SAMPLE_RATE * channels * sizeof(float)));      fwrite(&u32, 4, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(channels * sizeof(float)));                    fwrite(&u16, 2, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(32));                                          fwrite(&u16, 2, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(22));                                          fwrite(&u16, 2, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(32));                                          fwrite(&u16, 2, 1, fd);
+        u32 = 0;                                                                fwrite(&u32, 4, 1, fd);
+        u16 = CPU_TO_LE(uint16_t(0x0003));                                      fwrite(&u16, 2, 1, fd);
+        for (size_t i=0; i<14; ++i)
+            fputc(0, fd);
+        fwrite("junk", 4, 1, fd);
+        u32 = CPU_TO_LE(uint32_t(3));                                           fwrite(&u32, 4, 1, fd);
+        fwrite("abc\0", 4, 1, fd); // Odd-sized chunk with padding
+        fwrite("data", 4, 1, fd);
+        u32 = CPU_TO_LE(data_size);                                             fwrite(&u32, 4, 1, fd);
+        fwrite(data, sizeof(float), frames * channels, fd);
+
+        fclose(fd);
+    }
+
+    void check_contents(AudioFile &af, AudioFile &ref, size_t frames)
+    {
+        UTEST_ASSERT(af.channels() == ref.channels());
+        UTEST_ASSERT(af.samples() == frames);
+        UTEST_ASSERT(af.sample_rate() == SAMPLE_RATE);
+
+        for (size_t j=0; j<af.channels(); ++j)
+        {
+            const float *src = af.channel(j);
+            const float *dst = ref.channel(j);
+            UTEST_ASSERT((src != NULL) && (dst != NULL));
+            UTEST_ASSERT_MSG(::memcmp(src, dst, frames * sizeof(float)) == 0,
+                    "Channel %d of mapped file differs from loaded file", int(j));
+        }
+    }
+
+    void check_mapped(const LSPString *path, size_t channels, size_t frames)
+    {
+        AudioFile af, ref;
+
+        printf("Mapping file %s, channels=%d, frames=%d\n", path->get_native(), int(channels), int(frames));
+
+        // Mapped data should match loaded data
+        UTEST_ASSERT(ref.load(path) == STATUS_OK);
+        UTEST_ASSERT(!ref.mapped());
+        UTEST_ASSERT(ref.samples() >= frames);
+        UTEST_ASSERT(af.map(path) == STATUS_OK);
+        UTEST_ASSERT(af.mapped());
+        check_contents(af, ref, frames);
+
+        // Modifications of mapped data should not affect the file
+        float first = ref.channel(0)[0];
+        float last  = ref.channel(0)[frames - 1];
+        UTEST_ASSERT(af.reverse());
+        UTEST_ASSERT(af.channel(0)[0] == last);
+        af.destroy();
+        UTEST_ASSERT(af.map(path) == STATUS_OK);
+        UTEST_ASSERT(af.channel(0)[0] == first);
+        af.destroy();
+
+        // Check limited duration
+        UTEST_ASSERT(af.map(path, 0.01f) == STATUS_OK);
+        UTEST_ASSERT(af.mapped());
+        check_contents(af, ref, lsp_min(frames, size_t(SAMPLE_RATE / 100)));
+        af.destroy();
+
+        // Resampling to the same sample rate should keep data mapped
+        UTEST_ASSERT(af.map(path) == STATUS_OK);
+        UTEST_ASSERT(af.resample(af.sample_rate()) == STATUS_OK);
+        UTEST_ASSERT(af.mapped());
+        check_contents(af, ref, frames);
+        af.destroy();
+    }
+
+    void check_wav(const LSPString *path, const float *data, size_t channels, size_t frames)
+    {
+        AudioFile af;
+
+        printf("Mapping file %s, channels=%d, frames=%d\n", path->get_native(), int(channels), int(frames));
+        UTEST_ASSERT(af.map(path) == STATUS_OK);
+        UTEST_ASSERT(af.mapped());
+        UTEST_ASSERT(af.channels() == channels);
+        UTEST_ASSERT(af.samples() == frames);
+        UTEST_ASSERT(af.sample_rate() == SAMPLE_RATE);
+
+        for (size_t j=0; j<channels; ++j)
+        {
+            const float *src = af.channel(j);
+            UTEST_ASSERT(src != NULL);
+            for (size_t i=0; i<frames; ++i)
+                UTEST_ASSERT_MSG(src[i] == data[i*channels + j], "Channel %d differs at sample %d", int(j), int(i));
+        }
+
+        UTEST_ASSERT(af.map(path, 0.01f) == STATUS_OK);
+        UTEST_ASSERT(af.samples() == lsp_min(frames, size_t(SAMPLE_RATE / 100)));
+    }
+
+    UTEST_MAIN
+    {
+        LSPString path;
+        float *data = new float[LONG_FRAMES * 2];
+        UTEST_ASSERT(data != NULL);
+
+        static const size_t layouts[][2] = {
+            { 1, SHORT_FRAMES },
+            { 1, LONG_FRAMES },
+            { 2, SHORT_FRAMES },
+            { 2, LONG_FRAMES },
+            { 3, SHORT_FRAMES }
+        };
+
+        for (size_t i=0, n=sizeof(layouts)/sizeof(layouts[0]); i<n; ++i)
+        {
+            size_t channels = layouts[i][0], frames = layouts[i][1];
+            init_data(data, channels, frames);
+
+            UTEST_ASSERT(path.fmt_utf8("tmp/utest-%s-%d.lspc", full_name(), int(i)));
+            write_lspc(&path, data, channels, frames, __IF_LEBE(LSPC_SAMPLE_FMT_F32LE, LSPC_SAMPLE_FMT_F32BE));
+            check_mapped(&path, channels, frames - (frames / 2 - 2)); // Version 1 header skips half of frames
+
+            UTEST_ASSERT(path.fmt_utf8("tmp/utest-%s-%d.wav", full_name(), int(i)));
+            write_wav(&path, data, channels, frames);
+            check_wav(&path, data, channels, frames);
+        }
+
+        // Integer data can not be mapped, the file should be loaded
+        init_data(data, 1, SHORT_FRAMES);
+        for (size_t i=0; i<SHORT_FRAMES; ++i)
+            data[i]    /= SHORT_FRAMES;
+        UTEST_ASSERT(path.fmt_utf8("tmp/utest-%s-s16.lspc", full_name()));
+        write_lspc(&path, data, 1, SHORT_FRAMES, LSPC_SAMPLE_FMT_S16LE);
+
+        AudioFile af;
+        UTEST_ASSERT(af.map(&path) == STATUS_OK);
+        UTEST_ASSERT(!af.mapped());
+        UTEST_ASSERT(af.channels() == 1);
+        af.destroy();
+
+        delete [] data;
+    }
+
+UTEST_END
@@ -0,0 +1,150 @@
+/*
+ * audiofile_resample.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <test/utest.h>
+#include <core/files/AudioFile.h>
+#include <core/ipc/NativeExecutor.h>
+#include <core/ipc/ThreadPoolExecutor.h>
+
+#define FREQUENCY       1000.0f
+#define AMPLITUDE       0.5f
+#define CHANNELS        2
+#define MARGIN          64
+#define TOLERANCE       2e-3f
+#define WORKERS         4
+
+using namespace lsp;
+
+static const size_t rates[][2] =
+{
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 44100, 96000 },
+    { 96000, 44100 },
+    { 22050, 48000 },
+    { 48000, 96000 },       // Integer ratios
+    { 96000, 48000 },
+    { 48000, 16000 },
+    { 11025, 44100 },
+    { 44100, 44101 },       // Kernel table with quantized phases
+    { 48000, 7 * 4801 }
+};
+
+UTEST_BEGIN("core.files", audiofile_resample)
+
+    void init_file(AudioFile &af, size_t sample_rate)
+    {
+        UTEST_ASSERT(af.create_samples(CHANNELS, sample_rate, sample_rate / 2) == STATUS_OK);
+
+        for (size_t c=0; c<CHANNELS; ++c)
+        {
+            float *dst  = af.channel(c);
+            UTEST_ASSERT(dst != NULL);
+            for (size_t i=0, n=af.samples(); i<n; ++i)
+                dst[i]      = AMPLITUDE * sinf(2.0f * M_PI * FREQUENCY * i / sample_rate + c * 0.5f * M_PI);
+        }
+    }
+
+    void check_file(AudioFile &af, size_t src_samples, size_t src_rate, size_t dst_rate)
+    {
+        size_t samples  = ALIGN_SIZE((wsize_t(src_samples) * dst_rate) / src_rate, 4);
+        UTEST_ASSERT(af.sample_rate() == dst_rate);
+        UTEST_ASSERT_MSG(af.samples() == samples, "Expected %d samples, got %d", int(samples), int(af.samples()));
+
+        for (size_t c=0; c<CHANNELS; ++c)
+        {
+            const float *src    = af.channel(c);
+            UTEST_ASSERT(src != NULL);
+
+            for (size_t i=MARGIN, n=af.samples() - MARGIN; i<n; ++i)
+            {
+                float v     = AMPLITUDE * sinf(2.0f * M_PI * FREQUENCY * i / dst_rate + c * 0.5f * M_PI);
+                UTEST_ASSERT_MSG(fabs(src[i] - v) < TOLERANCE,
+                        "Channel %d sample %d: expected %f, got %f", int(c), int(i), v, src[i]);
+            }
+        }
+    }
+
+    class ResampleTask: public ipc::ITask
+    {
+        private:
+            AudioFile          *pFile;
+            size_t              nSampleRate;
+            ipc::IExecutor     *pExecutor;
+
+        public:
+            explicit ResampleTask(AudioFile *af, size_t sample_rate, ipc::IExecutor *executor):
+                pFile(af), nSampleRate(sample_rate), pExecutor(executor) {}
+            virtual ~ResampleTask() {}
+
+        public:
+            virtual status_t run()
+            {
+                return pFile->resample(nSampleRate, pExecutor);
+            }
+    };
+
+    void check_same(AudioFile &af1, AudioFile &af2, const char *mode)
+    {
+        UTEST_ASSERT(af2.samples() == af1.samples());
+        for (size_t c=0; c<CHANNELS; ++c)
+            UTEST_ASSERT_MSG(::memcmp(af1.channel(c), af2.channel(c), af1.samples() * sizeof(float)) == 0,
+                    "Channel %d differs for resampling in the caller's thread and %s", int(c), mode);
+    }
+
+    UTEST_MAIN
+    {
+        ipc::ThreadPoolExecutor pool, single;
+        ipc::NativeExecutor native;
+        UTEST_ASSERT(pool.start(WORKERS) == STATUS_OK);
+        UTEST_ASSERT(single.start(1) == STATUS_OK);
+        UTEST_ASSERT(native.start() == STATUS_OK);
+
+        for (size_t i=0, n=sizeof(rates)/sizeof(rates[0]); i<n; ++i)
+        {
+            size_t src_rate = rates[i][0], dst_rate = rates[i][1];
+            printf("Testing resampling %d -> %d\n", int(src_rate), int(dst_rate));
+
+            // Resample in the caller's thread
+            AudioFile af1;
+            init_file(af1, src_rate);
+            size_t src_samples = af1.samples();
+            UTEST_ASSERT(af1.resample(dst_rate) == STATUS_OK);
+            check_file(af1, src_samples, src_rate, dst_rate);
+
+            // Resample using the thread pool, the result should be the same
+            AudioFile af2;
+            init_file(af2, src_rate);
+            UTEST_ASSERT(af2.resample(dst_rate, &pool) == STATUS_OK);
+            check_same(af1, af2, "thread pool");
+
+            // Resample from the task running on the executor with the only thread:
+            // helpers can not be started and should be cancelled
+            ipc::IExecutor *executors[] = { &single, &native };
+            for (size_t j=0; j<2; ++j)
+            {
+                AudioFile af3;
+                init_file(af3, src_rate);
+                ResampleTask task(&af3, dst_rate, executors[j]);
+                while (!executors[j]->submit(&task))
+                    ipc::Thread::sleep(1);
+                while (!task.completed())
+                    ipc::Thread::sleep(1);
+                UTEST_ASSERT(task.code() == STATUS_OK);
+                check_same(af1, af3, "nested task");
+            }
+        }
+
+        UTEST_ASSERT(single.pending() == 0);
+
+        pool.shutdown();
+        single.shutdown();
+        native.shutdown();
+    }
+
+UTEST_END
@@ -24,6 +24,26 @@ using namespace lsp;
 
 static const float cvalues[CHANNELS] = { -1.0f, -0.5f, 0.0f, 0.5f, 1.0f };
 
+static const float u24values[] = { -1.0f, -0.5f, -0.3333333f, 0.0f, 0.0000001f, 0.25f, 0.7f, 1.0f };
+
+namespace lsp
+{
+    // Give access to sample codecs
+    class test_audio_reader: public LSPCAudioReader
+    {
+        public:
+            using LSPCAudioReader::decode_u24le;
+            using LSPCAudioReader::decode_u24be;
+    };
+
+    class test_audio_writer: public LSPCAudioWriter
+    {
+        public:
+            using LSPCAudioWriter::encode_u24le;
+            using LSPCAudioWriter::encode_u24be;
+    };
+}
+
 static const size_t formats[] =
 {
     LSPC_SAMPLE_FMT_U8LE,
@@ -189,6 +209,42 @@ UTEST_BEGIN("core.files", lspc_audio)
         }
     }
 
+    void check_u24_codecs()
+    {
+        const size_t n = sizeof(u24values) / sizeof(float);
+        uint8_t le[n * 3], be[n * 3];
+        float dle[n], dbe[n];
+
+        printf("Testing u24 sample codecs\n");
+
+        // Encoded samples should follow the byte order of the format, not of the host
+        test_audio_writer::encode_u24le(le, u24values, n);
+        test_audio_writer::encode_u24be(be, u24values, n);
+        for (size_t i=0; i<n; ++i)
+        {
+            uint32_t s      = int32_t(u24values[i] * 0x7fffff) + 0x800000;
+            const uint8_t *l = &le[i*3], *b = &be[i*3];
+
+            UTEST_ASSERT_MSG((l[0] == uint8_t(s)) && (l[1] == uint8_t(s >> 8)) && (l[2] == uint8_t(s >> 16)),
+                    "u24le sample %d encoded as %02x %02x %02x, expected 0x%06x",
+                    int(i), int(l[0]), int(l[1]), int(l[2]), int(s));
+            UTEST_ASSERT_MSG((b[0] == uint8_t(s >> 16)) && (b[1] == uint8_t(s >> 8)) && (b[2] == uint8_t(s)),
+                    "u24be sample %d encoded as %02x %02x %02x, expected 0x%06x",
+                    int(i), int(b[0]), int(b[1]), int(b[2]), int(s));
+        }
+
+        // Decoded samples should match the source ones
+        test_audio_reader::decode_u24le(dle, le, n);
+        test_audio_reader::decode_u24be(dbe, be, n);
+        for (size_t i=0; i<n; ++i)
+        {
+            UTEST_ASSERT_MSG(fabs(dle[i] - u24values[i]) <= 2.0f / 0x7fffff,
+                    "u24le sample %d decoded as %.8f, expected %.8f", int(i), dle[i], u24values[i]);
+            UTEST_ASSERT_MSG(dle[i] == dbe[i],
+                    "u24be sample %d decoded as %.8f, expected %.8f", int(i), dbe[i], dle[i]);
+        }
+    }
+
     void add_buffer(cvector<FloatBuffer> &v, float value)
     {
         FloatBuffer *fb = new FloatBuffer(TOTAL_FRAMES);
@@ -212,6 +268,8 @@ UTEST_BEGIN("core.files", lspc_audio)
 
     UTEST_MAIN
     {
+        check_u24_codecs();
+
         // Initialize buffers
         cvector<FloatBuffer> src, dst;
         for (size_t i=0; i<CHANNELS; ++i)
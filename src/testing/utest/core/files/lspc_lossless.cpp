@@ -0,0 +1,389 @@
+/*
+ * lspc_lossless.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/LSPString.h>
+#include <core/io/File.h>
+#include <core/files/lspc/lspc.h>
+#include <core/files/lspc/lossless.h>
+#include <core/files/lspc/LSPCAudioWriter.h>
+#include <core/files/lspc/LSPCAudioReader.h>
+
+#define FRAMES              100000
+#define CHANNELS            3
+#define SKIP_STEP           11000
+#define READ_STEP           3000
+
+using namespace lsp;
+
+static const size_t formats[] =
+{
+    LSPC_SAMPLE_FMT_S8LE,
+    LSPC_SAMPLE_FMT_U8BE,
+    LSPC_SAMPLE_FMT_S16LE,
+    LSPC_SAMPLE_FMT_U16BE,
+    LSPC_SAMPLE_FMT_S24LE,
+    LSPC_SAMPLE_FMT_U24BE,
+    LSPC_SAMPLE_FMT_F32LE,
+    LSPC_SAMPLE_FMT_F32BE,
+    LSPC_SAMPLE_FMT_F64LE
+};
+
+UTEST_BEGIN("core.files", lspc_lossless)
+
+    void init_signal(float *dst)
+    {
+        // Two correlated channels and one sparse channel with impulses
+        for (size_t i=0; i<FRAMES; ++i)
+        {
+            float s     = 0.4f * sinf(i * 0.0131f) + 0.2f * sinf(i * 0.0517f) + 0.1f * sinf(i * 0.00071f);
+            float n     = (float(rand()) / RAND_MAX - 0.5f) * 0.001f;
+            dst[0]      = s + n;
+            dst[1]      = 0.9f * s - n;
+            dst[2]      = ((i % 4999) == 0) ? 0.999f : 0.0f;
+            dst        += CHANNELS;
+        }
+    }
+
+    void write_file(const LSPString *path, const float *data, size_t fmt, size_t codec)
+    {
+        LSPCAudioWriter aw;
+        lspc_audio_parameters_t p;
+
+        p.channels          = CHANNELS;
+        p.sample_format     = fmt;
+        p.sample_rate       = 48000;
+        p.codec             = codec;
+        p.frames            = FRAMES;
+
+        UTEST_ASSERT(aw.create(path, &p) == STATUS_OK);
+
+        // Write data in chunks that do not match the block size
+        for (size_t off=0; off < FRAMES; )
+        {
+            size_t count    = lsp_min(size_t(FRAMES - off), size_t(READ_STEP + 7));
+            UTEST_ASSERT(aw.write_frames(&data[off * CHANNELS], count) == STATUS_OK);
+            off            += count;
+        }
+
+        UTEST_ASSERT(aw.close() == STATUS_OK);
+    }
+
+    void write_unindexed_file(const LSPString *path, const float *data, size_t fmt)
+    {
+        LSPCFile fd;
+        LSPCAudioWriter aw;
+        lspc_audio_parameters_t p;
+
+        p.channels          = CHANNELS;
+        p.sample_format     = fmt;
+        p.sample_rate       = 48000;
+        p.codec             = LSPC_CODEC_LOSSLESS;
+        p.frames            = FRAMES;
+
+        // Audio writer opened over the chunk writer does not create the block index
+        UTEST_ASSERT(fd.create(path) == STATUS_OK);
+        LSPCChunkWriter *wr = fd.write_chunk(LSPC_CHUNK_AUDIO);
+        UTEST_ASSERT(wr != NULL);
+        UTEST_ASSERT(aw.open(wr, &p, true) == STATUS_OK);
+        UTEST_ASSERT(aw.write_frames(data, FRAMES) == STATUS_OK);
+        UTEST_ASSERT(aw.close() == STATUS_OK);
+        delete wr;
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+    }
+
+    bool has_index(const LSPString *path)
+    {
+        LSPCFile fd;
+        UTEST_ASSERT(fd.open(path) == STATUS_OK);
+        LSPCChunkReader *rd = fd.find_chunk(LSPC_CHUNK_AUDIO_INDEX);
+        bool found = rd != NULL;
+        if (rd != NULL)
+        {
+            rd->close();
+            delete rd;
+        }
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+        return found;
+    }
+
+    void read_file(const LSPString *path, float *data, size_t codec)
+    {
+        LSPCFile fd;
+        LSPCAudioReader ar;
+        lspc_audio_parameters_t p;
+
+        UTEST_ASSERT(fd.open(path) == STATUS_OK);
+        UTEST_ASSERT(ar.open(&fd) == STATUS_OK);
+        UTEST_ASSERT(ar.get_parameters(&p) == STATUS_OK);
+        UTEST_ASSERT(p.codec == codec);
+        UTEST_ASSERT(p.channels == CHANNELS);
+
+        ssize_t n = ar.read_frames(data, FRAMES);
+        UTEST_ASSERT_MSG(n == FRAMES, "Read %d frames, expected %d", int(n), int(FRAMES));
+        UTEST_ASSERT(ar.read_frames(data, 1) <= 0);
+
+        UTEST_ASSERT(ar.close() == STATUS_OK);
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+    }
+
+    void check_skip(const LSPString *path, const float *pcm, float *buf)
+    {
+        LSPCFile fd;
+        LSPCAudioReader ar;
+
+        UTEST_ASSERT(fd.open(path) == STATUS_OK);
+        UTEST_ASSERT(ar.open(&fd) == STATUS_OK);
+
+        // Skip over block boundaries and whole blocks, then read part of data
+        size_t off = 0;
+        while (off < FRAMES)
+        {
+            ssize_t n   = ar.skip_frames(SKIP_STEP);
+            UTEST_ASSERT(n > 0);
+            off        += n;
+            if (off >= FRAMES)
+                break;
+
+            size_t count = lsp_min(size_t(FRAMES - off), size_t(READ_STEP));
+            n           = ar.read_frames(buf, count);
+            UTEST_ASSERT(n == ssize_t(count));
+            UTEST_ASSERT_MSG(::memcmp(buf, &pcm[off * CHANNELS], count * CHANNELS * sizeof(float)) == 0,
+                    "Data differs after skip at frame %d", int(off));
+            off        += count;
+        }
+
+        UTEST_ASSERT(ar.close() == STATUS_OK);
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+    }
+
+    void check_seek(const LSPString *path, const float *pcm, float *buf)
+    {
+        // Skip from the beginning of file directly to the target frame
+        UTEST_FOREACH(target, 1, LSPC_LOSSLESS_BLOCK_FRAMES - 1, LSPC_LOSSLESS_BLOCK_FRAMES, LSPC_LOSSLESS_BLOCK_FRAMES * 7 + 13, FRAMES - 100, FRAMES - 1)
+        {
+            LSPCFile fd;
+            LSPCAudioReader ar;
+
+            UTEST_ASSERT(fd.open(path) == STATUS_OK);
+            UTEST_ASSERT(ar.open(&fd) == STATUS_OK);
+
+            UTEST_ASSERT(ar.skip_frames(target) == ssize_t(target));
+            size_t count    = lsp_min(size_t(FRAMES - target), size_t(READ_STEP));
+            UTEST_ASSERT(ar.read_frames(buf, count) == ssize_t(count));
+            UTEST_ASSERT_MSG(::memcmp(buf, &pcm[target * CHANNELS], count * CHANNELS * sizeof(float)) == 0,
+                    "Data differs after seek to frame %d", int(target));
+
+            // Skip beyond the end of file
+            ssize_t left    = FRAMES - target - count;
+            ssize_t n       = ar.skip_frames(FRAMES);
+            UTEST_ASSERT((left > 0) ? (n == left) : (n <= 0));
+
+            UTEST_ASSERT(ar.close() == STATUS_OK);
+            UTEST_ASSERT(fd.close() == STATUS_OK);
+        }
+    }
+
+    wsize_t file_size(const LSPString *path)
+    {
+        io::fattr_t attr;
+        UTEST_ASSERT(io::File::stat(path, &attr) == STATUS_OK);
+        return attr.size;
+    }
+
+    void check_codec()
+    {
+        // Encode and decode blocks of extreme values directly
+        int32_t *buf    = new int32_t[LSPC_LOSSLESS_BLOCK_FRAMES * 4];
+        uint8_t *data   = new uint8_t[lossless_block_size(2, LSPC_LOSSLESS_BLOCK_FRAMES)];
+        uint8_t *tmp    = new uint8_t[lossless_tmp_size(LSPC_LOSSLESS_BLOCK_FRAMES)];
+        UTEST_ASSERT((buf != NULL) && (data != NULL) && (tmp != NULL));
+
+        int32_t *src[2], *dst[2];
+        src[0]      = &buf[0];
+        src[1]      = &buf[LSPC_LOSSLESS_BLOCK_FRAMES];
+        dst[0]      = &buf[LSPC_LOSSLESS_BLOCK_FRAMES * 2];
+        dst[1]      = &buf[LSPC_LOSSLESS_BLOCK_FRAMES * 3];
+
+        for (size_t bits=8; bits <= 24; bits += 8)
+        {
+            int32_t max     = (1 << (bits - 1)) - 1;
+            for (size_t pass=0; pass<3; ++pass)
+            {
+                UTEST_FOREACH(frames, 1, 2, 5, 13, 100, 257, LSPC_LOSSLESS_BLOCK_FRAMES)
+                {
+                    printf("Testing codec bits=%d, pass=%d, frames=%d\n", int(bits), int(pass), int(frames));
+
+                    for (size_t i=0; i<frames; ++i)
+                    {
+                        switch (pass)
+                        {
+                            case 0: // Full-scale noise
+                                src[0][i]   = (rand() % (2 * max + 1)) - max;
+                                src[1][i]   = (rand() % (2 * max + 1)) - max;
+                                break;
+                            case 1: // Alternating extremes
+                                src[0][i]   = (i & 1) ? max : -max;
+                                src[1][i]   = (i & 2) ? -max : max;
+                                break;
+                            default: // Identical channels
+                                src[0][i]   = int32_t(max * sin(i * 0.01));
+                                src[1][i]   = src[0][i];
+                                break;
+                        }
+                    }
+
+                    size_t size     = lossless_encode_block(data, src, 2, frames, bits, tmp);
+                    UTEST_ASSERT(size <= lossless_block_size(2, frames));
+                    UTEST_ASSERT(lossless_decode_block(dst, data, size, 2, frames, bits) == STATUS_OK);
+                    UTEST_ASSERT(::memcmp(src[0], dst[0], frames * sizeof(int32_t)) == 0);
+                    UTEST_ASSERT(::memcmp(src[1], dst[1], frames * sizeof(int32_t)) == 0);
+
+                    // Truncated data should be detected
+                    UTEST_ASSERT(lossless_decode_block(dst, data, size / 2, 2, frames, bits) != STATUS_OK);
+                }
+            }
+        }
+
+        delete [] buf;
+        delete [] data;
+        delete [] tmp;
+    }
+
+    void check_float_codec()
+    {
+        // Encode and decode blocks of floating-point values directly
+        float *buf      = new float[LSPC_LOSSLESS_BLOCK_FRAMES * 4];
+        int32_t *itmp   = new int32_t[LSPC_LOSSLESS_BLOCK_FRAMES];
+        uint8_t *data   = new uint8_t[lossless_block_size(2, LSPC_LOSSLESS_BLOCK_FRAMES)];
+        uint8_t *tmp    = new uint8_t[lossless_tmp_size(LSPC_LOSSLESS_BLOCK_FRAMES)];
+        UTEST_ASSERT((buf != NULL) && (itmp != NULL) && (data != NULL) && (tmp != NULL));
+
+        float *src[2], *dst[2];
+        src[0]      = &buf[0];
+        src[1]      = &buf[LSPC_LOSSLESS_BLOCK_FRAMES];
+        dst[0]      = &buf[LSPC_LOSSLESS_BLOCK_FRAMES * 2];
+        dst[1]      = &buf[LSPC_LOSSLESS_BLOCK_FRAMES * 3];
+
+        for (size_t pass=0; pass<4; ++pass)
+        {
+            UTEST_FOREACH(frames, 1, 2, 13, 257, LSPC_LOSSLESS_BLOCK_FRAMES)
+            {
+                printf("Testing float codec pass=%d, frames=%d\n", int(pass), int(frames));
+
+                for (size_t i=0; i<frames; ++i)
+                {
+                    float s     = sinf(i * 0.01f);
+                    switch (pass)
+                    {
+                        case 0: // Samples converted from 24-bit integers, values out of range
+                            src[0][i]   = int32_t(s * 0x7fffff) / float(0x7fffff + 1);
+                            src[1][i]   = int32_t(s * 0x7fff) * 4.0f;
+                            break;
+                        case 1: // Arbitrary floating-point values
+                            src[0][i]   = s + 1e-3f * (float(rand()) / RAND_MAX);
+                            src[1][i]   = s * 1e+20f;
+                            break;
+                        case 2: // Special values
+                            src[0][i]   = (i & 1) ? -0.0f : s;
+                            src[1][i]   = ((i % 3) == 0) ? INFINITY : ((i % 3) == 1) ? NAN : 1e-40f;
+                            break;
+                        default: // Full-scale random bit patterns
+                        {
+                            uint32_t v[2];
+                            v[0]        = (uint32_t(rand()) << 16) ^ uint32_t(rand());
+                            v[1]        = (uint32_t(rand()) << 16) ^ uint32_t(rand());
+                            ::memcpy(&src[0][i], &v[0], sizeof(float));
+                            ::memcpy(&src[1][i], &v[1], sizeof(float));
+                            break;
+                        }
+                    }
+                }
+
+                size_t size     = lossless_encode_float_block(data, src, 2, frames, tmp);
+                UTEST_ASSERT(size <= lossless_block_size(2, frames));
+                UTEST_ASSERT(lossless_decode_float_block(dst, data, size, 2, frames, itmp) == STATUS_OK);
+                UTEST_ASSERT(::memcmp(src[0], dst[0], frames * sizeof(float)) == 0);
+                UTEST_ASSERT(::memcmp(src[1], dst[1], frames * sizeof(float)) == 0);
+
+                // Truncated data should be detected
+                UTEST_ASSERT(lossless_decode_float_block(dst, data, size / 2, 2, frames, itmp) != STATUS_OK);
+            }
+        }
+
+        delete [] buf;
+        delete [] itmp;
+        delete [] data;
+        delete [] tmp;
+    }
+
+    UTEST_MAIN
+    {
+        LSPString pcm_path, ll_path;
+        UTEST_ASSERT(pcm_path.fmt_utf8("tmp/utest-%s-pcm.lspc", full_name()));
+        UTEST_ASSERT(ll_path.fmt_utf8("tmp/utest-%s-lossless.lspc", full_name()));
+
+        check_codec();
+        check_float_codec();
+
+        float *src  = new float[FRAMES * CHANNELS];
+        float *pcm  = new float[FRAMES * CHANNELS];
+        float *ll   = new float[FRAMES * CHANNELS];
+        UTEST_ASSERT((src != NULL) && (pcm != NULL) && (ll != NULL));
+        init_signal(src);
+
+        for (size_t i=0, n=sizeof(formats)/sizeof(size_t); i<n; ++i)
+        {
+            printf("Testing lossless codec for sample_format=%d\n", int(formats[i]));
+
+            // Lossless-encoded data should be decoded exactly as PCM data
+            write_file(&pcm_path, src, formats[i], LSPC_CODEC_PCM);
+            write_file(&ll_path, src, formats[i], LSPC_CODEC_LOSSLESS);
+            read_file(&pcm_path, pcm, LSPC_CODEC_PCM);
+            read_file(&ll_path, ll, LSPC_CODEC_LOSSLESS);
+            UTEST_ASSERT_MSG(::memcmp(pcm, ll, FRAMES * CHANNELS * sizeof(float)) == 0,
+                    "Decoded lossless data differs from PCM data");
+
+            UTEST_ASSERT(has_index(&ll_path));
+            check_skip(&ll_path, pcm, ll);
+            check_seek(&ll_path, pcm, ll);
+
+            // Compressed file should be significantly smaller
+            wsize_t pcm_size    = file_size(&pcm_path);
+            wsize_t ll_size     = file_size(&ll_path);
+            printf("  PCM size: %d, lossless size: %d (%.1f%%)\n",
+                    int(pcm_size), int(ll_size), (ll_size * 100.0) / pcm_size);
+            if (formats[i] < LSPC_SAMPLE_FMT_F32LE)
+            {
+                UTEST_ASSERT(ll_size < (pcm_size * 6) / 10);
+            }
+            else
+            {
+                UTEST_ASSERT(ll_size < pcm_size);
+            }
+        }
+
+        // Files without block index should be read sequentially
+        printf("Testing lossless codec without block index\n");
+        write_file(&pcm_path, src, LSPC_SAMPLE_FMT_S16LE, LSPC_CODEC_PCM);
+        write_unindexed_file(&ll_path, src, LSPC_SAMPLE_FMT_S16LE);
+        read_file(&pcm_path, pcm, LSPC_CODEC_PCM);
+        read_file(&ll_path, ll, LSPC_CODEC_LOSSLESS);
+        UTEST_ASSERT(::memcmp(pcm, ll, FRAMES * CHANNELS * sizeof(float)) == 0);
+        UTEST_ASSERT(!has_index(&ll_path));
+        check_skip(&ll_path, pcm, ll);
+        check_seek(&ll_path, pcm, ll);
+
+        delete [] src;
+        delete [] pcm;
+        delete [] ll;
+    }
+
+UTEST_END
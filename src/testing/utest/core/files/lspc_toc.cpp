@@ -0,0 +1,183 @@
+/*
+ * lspc_toc.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include <test/utest.h>
+#include <core/files/LSPCFile.h>
+#include <core/LSPString.h>
+
+#define MAGIC_DATA          0x44415441      /* 'DATA' */
+#define MAGIC_META          0x4D455441      /* 'META' */
+#define INTERLEAVED         3
+#define SEQUENTIAL          40
+#define CHUNKS              (INTERLEAVED + SEQUENTIAL)
+#define ROUNDS              8
+#define ROUND_SIZE          0x1000
+
+using namespace lsp;
+
+UTEST_BEGIN("core.files", lspc_toc)
+
+    inline uint32_t chunk_magic(size_t index)
+    {
+        return (index % 3) ? MAGIC_DATA : MAGIC_META;
+    }
+
+    inline uint8_t chunk_byte(size_t index, size_t offset)
+    {
+        return uint8_t(index * 31 + offset * 7 + (offset >> 8));
+    }
+
+    void fill_chunk(uint8_t *dst, size_t index, size_t offset, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            dst[i]      = chunk_byte(index, offset + i);
+    }
+
+    void write_file(const LSPString *path, uint32_t *uids)
+    {
+        LSPCFile fd;
+        uint8_t buf[ROUND_SIZE];
+        LSPCChunkWriter *wr[INTERLEAVED];
+
+        printf("Writing file %s ...\n", path->get_utf8());
+        UTEST_ASSERT(fd.create(path) == STATUS_OK);
+
+        // Write interleaved chunks
+        for (size_t i=0; i<INTERLEAVED; ++i)
+        {
+            wr[i]       = fd.write_chunk(chunk_magic(i));
+            UTEST_ASSERT(wr[i] != NULL);
+            uids[i]     = wr[i]->unique_id();
+        }
+
+        for (size_t j=0; j<ROUNDS; ++j)
+            for (size_t i=0; i<INTERLEAVED; ++i)
+            {
+                fill_chunk(buf, i, j * ROUND_SIZE, ROUND_SIZE);
+                UTEST_ASSERT(wr[i]->write(buf, ROUND_SIZE) == STATUS_OK);
+                UTEST_ASSERT(wr[i]->flush() == STATUS_OK);
+            }
+
+        for (size_t i=0; i<INTERLEAVED; ++i)
+        {
+            UTEST_ASSERT(wr[i]->close() == STATUS_OK);
+            delete wr[i];
+        }
+
+        // Write sequential chunks of different size
+        for (size_t i=INTERLEAVED; i<CHUNKS; ++i)
+        {
+            LSPCChunkWriter *w = fd.write_chunk(chunk_magic(i));
+            UTEST_ASSERT(w != NULL);
+            uids[i]     = w->unique_id();
+
+            fill_chunk(buf, i, 0, i);
+            UTEST_ASSERT(w->write(buf, i) == STATUS_OK);
+            UTEST_ASSERT(w->close() == STATUS_OK);
+            delete w;
+        }
+
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+    }
+
+    void check_chunk(LSPCChunkReader *rd, size_t index)
+    {
+        uint8_t buf[ROUND_SIZE];
+        size_t length   = (index < INTERLEAVED) ? ROUNDS * ROUND_SIZE : index;
+
+        UTEST_ASSERT(rd != NULL);
+        UTEST_ASSERT(rd->magic() == chunk_magic(index));
+
+        for (size_t offset = 0; offset < length; )
+        {
+            size_t to_read  = length - offset;
+            if (to_read > ROUND_SIZE)
+                to_read         = ROUND_SIZE;
+
+            ssize_t n       = rd->read(buf, to_read);
+            UTEST_ASSERT_MSG(n == ssize_t(to_read), "Chunk %d: read %d bytes of %d", int(index), int(n), int(to_read));
+            for (size_t i=0; i<to_read; ++i)
+                UTEST_ASSERT_MSG(buf[i] == chunk_byte(index, offset + i),
+                        "Chunk %d: data mismatch at offset %d", int(index), int(offset + i));
+            offset         += to_read;
+        }
+
+        // There should be no more data
+        UTEST_ASSERT(rd->read(buf, 1) <= 0);
+
+        UTEST_ASSERT(rd->close() == STATUS_OK);
+        delete rd;
+    }
+
+    void read_file(const LSPString *path, const uint32_t *uids, bool indexed)
+    {
+        LSPCFile fd;
+
+        printf("Reading file %s (%s) ...\n", path->get_utf8(), (indexed) ? "indexed" : "linear scan");
+        UTEST_ASSERT(fd.open(path) == STATUS_OK);
+        UTEST_ASSERT(fd.indexed() == indexed);
+
+        // Random access to chunks in reverse order
+        for (ssize_t i=CHUNKS-1; i>=0; --i)
+        {
+            check_chunk(fd.read_chunk(uids[i]), i);
+            check_chunk(fd.read_chunk(uids[i], chunk_magic(i)), i);
+            UTEST_ASSERT(fd.read_chunk(uids[i], LSPC_CHUNK_AUDIO) == NULL);
+        }
+
+        // Non-existing chunks
+        UTEST_ASSERT(fd.read_chunk(uids[CHUNKS-1] + 100) == NULL);
+        UTEST_ASSERT(fd.read_chunk(0) == NULL);
+
+        // Enumerate chunks by magic
+        size_t found = 0;
+        uint32_t uid = 0;
+        for (size_t i=0; i<CHUNKS; ++i)
+        {
+            if (chunk_magic(i) != MAGIC_META)
+                continue;
+
+            LSPCChunkReader *rd = fd.find_chunk(MAGIC_META, &uid, uid + 1);
+            UTEST_ASSERT(uid == uids[i]);
+            check_chunk(rd, i);
+            ++found;
+        }
+        UTEST_ASSERT(found > 0);
+        UTEST_ASSERT(fd.find_chunk(MAGIC_META, &uid, uid + 1) == NULL);
+
+        UTEST_ASSERT(fd.close() == STATUS_OK);
+    }
+
+    void drop_toc(const LSPString *path)
+    {
+        // Emulate the file written by the previous version of the writer
+        FILE *fd = fopen(path->get_native(), "r+b");
+        UTEST_ASSERT(fd != NULL);
+
+        uint64_t offset = 0;
+        UTEST_ASSERT(fseek(fd, offsetof(lspc_root_header_t, toc_offset), SEEK_SET) == 0);
+        UTEST_ASSERT(fwrite(&offset, sizeof(offset), 1, fd) == 1);
+        fclose(fd);
+    }
+
+    UTEST_MAIN
+    {
+        LSPString path;
+        uint32_t uids[CHUNKS];
+
+        UTEST_ASSERT(path.fmt_utf8("tmp" FILE_SEPARATOR_S "utest-%s.lspc", full_name()));
+
+        write_file(&path, uids);
+        read_file(&path, uids, true);
+
+        drop_toc(&path);
+        read_file(&path, uids, false);
+    }
+
+UTEST_END
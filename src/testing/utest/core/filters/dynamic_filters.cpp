@@ -0,0 +1,172 @@
+/*
+ * dynamic_filters.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/sugar.h>
+#include <core/filters/DynamicFilters.h>
+#include <core/dynamics/Compressor.h>
+
+#define SAMPLE_RATE         48000
+#define SAMPLES             8192
+#define TOLERANCE           1e-2f
+#define GAIN_TOLERANCE      5e-3f
+#define JUMP_PERIOD         37
+#define BURST_PERIOD        1500
+
+using namespace lsp;
+
+UTEST_BEGIN("core.filters", dynamic_filters)
+
+    typedef struct filter_desc_t
+    {
+        size_t      type;
+        size_t      slope;
+        float       freq;
+        float       freq2;
+    } filter_desc_t;
+
+    void process(float *out, const float *in, const float *gain, const filter_desc_t *fd, size_t interp)
+    {
+        DynamicFilters df;
+        UTEST_ASSERT(df.init(1) == STATUS_OK);
+        df.set_sample_rate(SAMPLE_RATE);
+        df.set_interpolation(interp);
+
+        filter_params_t fp;
+        fp.nType        = fd->type;
+        fp.fFreq        = fd->freq;
+        fp.fFreq2       = fd->freq2;
+        fp.fGain        = 1.0f;
+        fp.nSlope       = fd->slope;
+        fp.fQuality     = 0.0f;
+        UTEST_ASSERT(df.set_params(0, &fp));
+        UTEST_ASSERT(df.set_filter_active(0, true));
+
+        // Process data with blocks that do not match the distance between anchor points
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 7 + 3) % 1501 + 1)
+        {
+            size_t count = lsp_min(step, size_t(SAMPLES - i));
+            df.process(0, &out[i], &in[i], &gain[i], count);
+            i          += count;
+        }
+
+        df.destroy();
+    }
+
+    float max_error(const float *ref, const float *out)
+    {
+        float peak  = dsp::abs_max(ref, SAMPLES);
+        float err   = 0.0f;
+        for (size_t i=0; i<SAMPLES; ++i)
+            err         = lsp_max(err, float(fabs(ref[i] - out[i])));
+        return err / peak;
+    }
+
+    void test_filter(const filter_desc_t *fd, const float *in, const float *smooth, const float *jumps, float *ref, float *out)
+    {
+        UTEST_FOREACH(interp, 8, 16, 32, 64)
+        {
+            printf("Testing filter type=%d, slope=%d, interpolation=%d\n", int(fd->type), int(fd->slope), int(interp));
+
+            // Interpolated cascades should follow the smooth gain curve
+            process(ref, in, smooth, fd, 0);
+            process(out, in, smooth, fd, interp);
+            float err   = max_error(ref, out);
+            printf("Maximum relative error: %.6f\n", err);
+            UTEST_ASSERT_MSG(err <= TOLERANCE, "Maximum relative error %.6f exceeds %.6f", err, TOLERANCE);
+
+            // Abrupt gain changes should never make the filter unstable
+            process(ref, in, jumps, fd, 0);
+            process(out, in, jumps, fd, interp);
+            for (size_t i=0; i<SAMPLES; ++i)
+                UTEST_ASSERT_MSG(isfinite(out[i]) && (fabs(out[i]) <= 1e+3f),
+                        "Unstable output at sample %d: %.6f", int(i), out[i]);
+
+            // Anchor points should be placed at each jump of the gain
+            err         = max_error(ref, out);
+            printf("Maximum relative error for gain jumps: %.6f\n", err);
+            UTEST_ASSERT_MSG(err <= GAIN_TOLERANCE, "Maximum relative error %.6f exceeds %.6f", err, GAIN_TOLERANCE);
+        }
+    }
+
+    void test_compressor(const filter_desc_t *fd, const float *in, const float *sc, float *gain, float *ref, float *out)
+    {
+        UTEST_FOREACH(time, 0, 2, 5, 10, 20, 50, 200)
+        {
+            printf("Testing filter type=%d, slope=%d, compressor time=%d ms\n",
+                    int(fd->type), int(fd->slope), int(time));
+
+            // Hard-knee compressor with maximum ratio, the signal jumps far above the threshold
+            Compressor comp;
+            comp.set_sample_rate(SAMPLE_RATE);
+            comp.set_mode(CM_DOWNWARD);
+            comp.set_threshold(GAIN_AMP_M_24_DB, GAIN_AMP_M_24_DB);
+            comp.set_ratio(100.0f);
+            comp.set_knee(GAIN_AMP_0_DB);
+            comp.set_timings(time, time);
+            comp.update_settings();
+            comp.process(gain, NULL, sc, SAMPLES);
+
+            process(ref, in, gain, fd, 0);
+            process(out, in, gain, fd, DYNAMIC_FILTERS_INTERP_DFL);
+            float err   = max_error(ref, out);
+            printf("Maximum relative error: %.6f\n", err);
+            UTEST_ASSERT_MSG(err <= GAIN_TOLERANCE, "Maximum relative error %.6f exceeds %.6f", err, GAIN_TOLERANCE);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        static const filter_desc_t filters[] =
+        {
+            { FLT_BT_LRX_LOSHELF,       2,  200.0f,     200.0f      },
+            { FLT_MT_LRX_LADDERPASS,    2,  500.0f,     4000.0f     },
+            { FLT_BT_LRX_HISHELF,       3,  8000.0f,    8000.0f     },
+            { FLT_BT_BWC_BELL,          4,  1000.0f,    1000.0f     },
+            { FLT_MT_RLC_LOSHELF,       1,  300.0f,     300.0f      },
+            { FLT_NONE,                 0,  0.0f,       0.0f        }
+        };
+
+        // Check parameters of interpolation
+        DynamicFilters df;
+        df.set_interpolation(1);
+        UTEST_ASSERT(df.get_interpolation() == 0);
+        df.set_interpolation(2);
+        UTEST_ASSERT(df.get_interpolation() == DYNAMIC_FILTERS_INTERP_MIN);
+        df.set_interpolation(DYNAMIC_FILTERS_INTERP_MAX * 2);
+        UTEST_ASSERT(df.get_interpolation() == DYNAMIC_FILTERS_INTERP_MAX);
+
+        float *buf      = new float[SAMPLES * 7];
+        float *in       = buf;
+        float *smooth   = &buf[SAMPLES];
+        float *jumps    = &buf[SAMPLES * 2];
+        float *ref      = &buf[SAMPLES * 3];
+        float *out      = &buf[SAMPLES * 4];
+        float *sc       = &buf[SAMPLES * 5];
+        float *gain     = &buf[SAMPLES * 6];
+
+        // Smooth gain curve in the range of -20..+12 dB, gain with abrupt jumps
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            in[i]           = float(rand()) / RAND_MAX - 0.5f;
+            smooth[i]       = expf(logf(10.0f) * (-0.4f + 1.0f * sin(2.0 * M_PI * i / 3000.0)));
+            jumps[i]        = ((i / JUMP_PERIOD) & 1) ? 0.01f : 4.0f;
+            sc[i]           = ((i / BURST_PERIOD) & 1) ? GAIN_AMP_M_48_DB : GAIN_AMP_0_DB; // 24 dB above the threshold
+        }
+
+        for (const filter_desc_t *fd = filters; fd->type != FLT_NONE; ++fd)
+        {
+            test_filter(fd, in, smooth, jumps, ref, out);
+            test_compressor(fd, in, sc, gain, ref, out);
+        }
+
+        delete [] buf;
+    }
+
+UTEST_END
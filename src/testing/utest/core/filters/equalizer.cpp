@@ -0,0 +1,278 @@
+/*
+ * equalizer.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/ipc/IExecutor.h>
+#include <core/filters/Equalizer.h>
+
+#define SAMPLE_RATE         48000
+#define CONV_RANK           10
+#define SAMPLES             8192
+#define IMPULSE_POS         333
+#define TOLERANCE           1e-5f
+#define SWITCH_POS          3072
+#define STEP                64
+
+using namespace lsp;
+
+// Executor that launches submitted tasks only on explicit request
+class ManualExecutor: public ipc::IExecutor
+{
+    private:
+        ipc::ITask     *pTask;
+
+    public:
+        explicit ManualExecutor()   { pTask = NULL; }
+
+        virtual bool submit(ipc::ITask *task)
+        {
+            if ((pTask != NULL) || (!task->idle()))
+                return false;
+            change_task_state(task, ipc::ITask::TS_SUBMITTED);
+            pTask       = task;
+            return true;
+        }
+
+        inline bool pending() const { return pTask != NULL; }
+
+        void run_pending()
+        {
+            if (pTask == NULL)
+                return;
+            run_task(pTask);
+            pTask       = NULL;
+        }
+
+        void drop_pending()         { pTask = NULL; }
+};
+
+UTEST_BEGIN("core.filters", equalizer)
+
+    void set_bell(Equalizer &eq, float gain)
+    {
+        filter_params_t fp;
+        fp.nType        = FLT_BT_BWC_BELL;
+        fp.fFreq        = 1000.0f;
+        fp.fFreq2       = 1000.0f;
+        fp.fGain        = gain;
+        fp.nSlope       = 2;
+        fp.fQuality     = 1.0f;
+        UTEST_ASSERT(eq.set_params(0, &fp));
+    }
+
+    void process(float *out, const float *in, equalizer_mode_t mode, size_t part_rank, size_t *latency)
+    {
+        Equalizer eq;
+        UTEST_ASSERT(eq.init(2, CONV_RANK, part_rank));
+        eq.set_sample_rate(SAMPLE_RATE);
+        eq.set_mode(mode);
+
+        set_bell(eq, 4.0f);
+
+        filter_params_t fp;
+        fp.nType        = FLT_BT_BWC_LOPASS;
+        fp.fFreq        = 8000.0f;
+        fp.fFreq2       = 8000.0f;
+        fp.fGain        = 1.0f;
+        fp.nSlope       = 2;
+        fp.fQuality     = 1.0f;
+        UTEST_ASSERT(eq.set_params(1, &fp));
+
+        // Process data with blocks that do not match the partition size
+        for (size_t i=0, step=1; i<SAMPLES; step = (step * 7 + 3) % 97 + 1)
+        {
+            size_t count = lsp_min(step, size_t(SAMPLES - i));
+            eq.process(&out[i], &in[i], count);
+            i          += count;
+        }
+
+        *latency    = eq.get_latency();
+        eq.destroy();
+    }
+
+    void process_async(float *out, const float *in, equalizer_mode_t mode, ManualExecutor *executor, float gain1, float gain2)
+    {
+        Equalizer eq;
+        UTEST_ASSERT(eq.init(1, CONV_RANK));
+        eq.set_sample_rate(SAMPLE_RATE);
+        eq.set_mode(mode);
+        eq.set_executor(executor);
+        set_bell(eq, gain1);
+
+        for (size_t i=0; i<SAMPLES; i += STEP)
+        {
+            if (i == SWITCH_POS)
+                set_bell(eq, gain2);
+            eq.process(&out[i], &in[i], STEP);
+
+            // Complete the kernel task before processing the next block
+            if (executor != NULL)
+                executor->run_pending();
+        }
+
+        eq.destroy();
+    }
+
+    void test_async(const float *in, equalizer_mode_t mode)
+    {
+        float *out  = new float[SAMPLES];
+        float *ref1 = new float[SAMPLES];
+        float *ref2 = new float[SAMPLES];
+        UTEST_ASSERT((out != NULL) && (ref1 != NULL) && (ref2 != NULL));
+
+        ManualExecutor executor;
+
+        // References: constant parameters with synchronous kernel build
+        process_async(ref1, in, mode, NULL, 4.0f, 4.0f);
+        process_async(ref2, in, mode, NULL, 0.25f, 0.25f);
+        process_async(out, in, mode, &executor, 4.0f, 0.25f);
+
+        // The output should follow the old kernel, then be crossfaded to the new kernel
+        size_t xfade_start = SAMPLES, xfade_end = SAMPLES;
+        for (size_t i=0; i<SAMPLES; ++i)
+        {
+            if (fabs(out[i] - ref1[i]) < TOLERANCE)
+                continue;
+            xfade_start     = i;
+            break;
+        }
+        for (size_t i=SAMPLES; i>0; --i)
+        {
+            if (fabs(out[i-1] - ref2[i-1]) < TOLERANCE)
+                continue;
+            xfade_end       = i;
+            break;
+        }
+
+        printf("Testing async kernel rebuild mode=%d, crossfade at [%d, %d)\n\n",
+                int(mode), int(xfade_start), int(xfade_end));
+        UTEST_ASSERT(xfade_start >= SWITCH_POS);
+        UTEST_ASSERT(xfade_end < SAMPLES - (1 << CONV_RANK));
+        UTEST_ASSERT(xfade_end - xfade_start <= (1 << CONV_RANK));
+
+        // There should be no discontinuity during the crossfade
+        for (size_t i=xfade_start; i<xfade_end; ++i)
+        {
+            float min = lsp_min(ref1[i], ref2[i]) - TOLERANCE;
+            float max = lsp_max(ref1[i], ref2[i]) + TOLERANCE;
+            UTEST_ASSERT_MSG((out[i] >= min) && (out[i] <= max),
+                    "Sample %d: got %f, expected value between %f and %f", int(i), out[i], ref1[i], ref2[i]);
+        }
+
+        delete [] out;
+        delete [] ref1;
+        delete [] ref2;
+    }
+
+    void test_mode_switch(const float *in)
+    {
+        printf("Testing asynchronous kernel build on mode switch\n");
+
+        float *out  = new float[SAMPLES];
+        float *ref  = new float[SAMPLES];
+        UTEST_ASSERT((out != NULL) && (ref != NULL));
+
+        ManualExecutor executor;
+        Equalizer eq, eq_ref;
+        UTEST_ASSERT(eq.init(1, CONV_RANK));
+        UTEST_ASSERT(eq_ref.init(1, CONV_RANK));
+        eq.set_sample_rate(SAMPLE_RATE);
+        eq_ref.set_sample_rate(SAMPLE_RATE);
+        eq.set_executor(&executor);
+        set_bell(eq, 4.0f);
+        set_bell(eq_ref, 4.0f);
+
+        for (size_t i=0; i<SAMPLES; i += STEP)
+        {
+            if (i == 0)
+            {
+                eq.set_mode(EQM_IIR);
+                eq_ref.set_mode(EQM_IIR);
+            }
+            else if (i == SWITCH_POS)
+            {
+                eq.set_mode(EQM_FIR);
+                eq_ref.set_mode(EQM_FIR);
+            }
+
+            eq.process(&out[i], &in[i], STEP);
+            eq_ref.process(&ref[i], &in[i], STEP);
+
+            // The mode switch should not build the kernel in the process() call
+            if (i == SWITCH_POS)
+                UTEST_ASSERT(executor.pending());
+            executor.run_pending();
+        }
+
+        // The kernel is ready before the first partition is processed, the output is the same
+        for (size_t i=0; i<SAMPLES; ++i)
+            UTEST_ASSERT_MSG(fabs(out[i] - ref[i]) < TOLERANCE,
+                    "Sample %d: expected %f, got %f", int(i), ref[i], out[i]);
+
+        // Task that has been submitted but never launched should not block destroy()
+        eq.set_mode(EQM_FFT);
+        eq.process(out, in, STEP);
+        UTEST_ASSERT(executor.pending());
+        executor.drop_pending();
+        eq.destroy();
+        eq_ref.destroy();
+
+        delete [] out;
+        delete [] ref;
+    }
+
+    UTEST_MAIN
+    {
+        float *in   = new float[SAMPLES];
+        float *ref  = new float[SAMPLES];
+        float *out  = new float[SAMPLES];
+        UTEST_ASSERT((in != NULL) && (ref != NULL) && (out != NULL));
+
+        dsp::fill_zero(in, SAMPLES);
+        in[IMPULSE_POS] = 1.0f;
+
+        equalizer_mode_t modes[] = { EQM_FIR, EQM_FFT };
+        for (size_t i=0; i<sizeof(modes)/sizeof(modes[0]); ++i)
+        {
+            // Reference: single partition convolution
+            size_t ref_latency;
+            process(ref, in, modes[i], CONV_RANK, &ref_latency);
+            UTEST_ASSERT(ref_latency == (1 << CONV_RANK) + (1 << (CONV_RANK - 1)));
+
+            UTEST_FOREACH(part_rank, 0, 5, 6, 8, CONV_RANK - 1)
+            {
+                size_t latency;
+                process(out, in, modes[i], part_rank, &latency);
+                printf("Testing mode=%d, part_rank=%d, latency=%d\n", int(modes[i]), int(part_rank), int(latency));
+
+                // The impulse response of linear phase filter is centered at the latency
+                size_t peak = dsp::abs_max_index(out, SAMPLES);
+                UTEST_ASSERT_MSG(peak == IMPULSE_POS + latency,
+                        "Peak at %d, expected %d", int(peak), int(IMPULSE_POS + latency));
+
+                // The impulse response should not depend on partitioning
+                size_t shift = ref_latency - latency;
+                for (size_t j=0; j<SAMPLES - shift; ++j)
+                    UTEST_ASSERT_MSG(fabs(out[j] - ref[j + shift]) < TOLERANCE,
+                            "Sample %d: expected %f, got %f", int(j), ref[j + shift], out[j]);
+            }
+        }
+
+        // Kernel rebuild in background with crossfade
+        for (size_t i=0; i<SAMPLES; ++i)
+            in[i]       = sinf(i * 0.131f) + 0.5f * sinf(i * 0.0173f);
+        for (size_t i=0; i<sizeof(modes)/sizeof(modes[0]); ++i)
+            test_async(in, modes[i]);
+        test_mode_switch(in);
+
+        delete [] in;
+        delete [] ref;
+        delete [] out;
+    }
+
+UTEST_END
@@ -0,0 +1,148 @@
+/*
+ * filter_bank.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <core/sugar.h>
+#include <core/filters/FilterBank.h>
+
+#define CHANNELS_MAX        9
+#define SAMPLES             1024
+#define TOLERANCE           1e-4f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.filters", filter_bank)
+
+    void init_chains(biquad_x1_t *c, size_t items)
+    {
+        // Stable filters with poles inside of the unit circle
+        for (size_t i=0; i<items; ++i)
+        {
+            float r     = 0.5f + 0.45f * (float(rand()) / RAND_MAX);
+            float w     = M_PI * (float(rand()) / RAND_MAX);
+            c[i].b0     = float(rand()) / RAND_MAX;
+            c[i].b1     = float(rand()) / RAND_MAX - 0.5f;
+            c[i].b2     = float(rand()) / RAND_MAX - 0.5f;
+            c[i].a1     = 2.0f * r * cosf(w);
+            c[i].a2     = -r * r;
+            c[i].p0     = 0.0f;
+            c[i].p1     = 0.0f;
+            c[i].p2     = 0.0f;
+        }
+    }
+
+    void init_bank(FilterBank &fb, const biquad_x1_t *c, size_t items)
+    {
+        UTEST_ASSERT(fb.init(items));
+        fb.begin();
+        for (size_t i=0; i<items; ++i)
+        {
+            biquad_x1_t *dst = fb.add_chain();
+            UTEST_ASSERT(dst != NULL);
+            *dst        = c[i];
+        }
+        fb.end(true);
+    }
+
+    void check(const float *ref, const float *out, size_t n, size_t items, size_t channel)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            UTEST_ASSERT_MSG(float_equals_adaptive(ref[i], out[i], TOLERANCE),
+                    "Cascades=%d, channel %d differs at sample %d: %.6f vs %.6f",
+                    int(items), int(channel), int(i), ref[i], out[i]);
+        }
+    }
+
+    void test_linked(size_t channels, size_t items, bool mixed)
+    {
+        printf("Testing linked processing of %d banks with %d %s cascades\n",
+                int(channels), int(items), (mixed) ? "different" : "same");
+
+        biquad_x1_t c[32];
+        FilterBank ref[CHANNELS_MAX], fb[CHANNELS_MAX];
+        FilterBank *vfb[CHANNELS_MAX];
+        float *vin[CHANNELS_MAX], *vref[CHANNELS_MAX], *vout[CHANNELS_MAX];
+
+        // Use the same filters and input on each launch
+        srand(channels * 0x100 + items);
+        init_chains(c, items);
+        float *buf = new float[SAMPLES * CHANNELS_MAX * 3];
+        for (size_t i=0; i<channels; ++i)
+        {
+            // Banks with different cascades should not share coefficients of the first bank
+            if ((mixed) && (i > 0))
+                init_chains(c, items);
+            init_bank(ref[i], c, items);
+            init_bank(fb[i], c, items);
+            vfb[i]      = &fb[i];
+            vin[i]      = &buf[SAMPLES * i];
+            vref[i]     = &buf[SAMPLES * (CHANNELS_MAX + i)];
+            vout[i]     = &buf[SAMPLES * (CHANNELS_MAX*2 + i)];
+
+            for (size_t j=0; j<SAMPLES; ++j)
+                vin[i][j]   = float(rand()) / RAND_MAX - 0.5f;
+        }
+
+        // Process data in blocks of different size, individual and in-place calls should keep the state
+        for (size_t off=0, step=1, pass=0; off<SAMPLES; step = (step * 7 + 3) % 193 + 1, ++pass)
+        {
+            size_t count = lsp_min(step, size_t(SAMPLES - off));
+            const float *src[CHANNELS_MAX];
+            float *dst[CHANNELS_MAX];
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                ref[i].process(&vref[i][off], &vin[i][off], count);
+                if (pass & 1)
+                {
+                    dsp::copy(&vout[i][off], &vin[i][off], count);
+                    src[i]      = &vout[i][off];
+                }
+                else
+                    src[i]      = &vin[i][off];
+                dst[i]      = &vout[i][off];
+            }
+
+            if ((pass % 5) == 4)
+            {
+                for (size_t i=0; i<channels; ++i)
+                    fb[i].process(dst[i], src[i], count);
+            }
+            else
+                FilterBank::process(vfb, dst, src, channels, count);
+
+            off        += count;
+        }
+
+        for (size_t i=0; i<channels; ++i)
+            check(vref[i], vout[i], SAMPLES, items, i);
+
+        delete [] buf;
+        for (size_t i=0; i<channels; ++i)
+        {
+            ref[i].destroy();
+            fb[i].destroy();
+        }
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t channels=1; channels <= CHANNELS_MAX; ++channels)
+        {
+            UTEST_FOREACH(items, 0, 1, 2, 3, 4, 5, 7, 8, 9, 14, 19)
+            {
+                test_linked(channels, items, false);
+                test_linked(channels, items, true);
+            }
+        }
+    }
+
+UTEST_END
@@ -0,0 +1,176 @@
+/*
+ * deque.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <dsp/atomic.h>
+#include <data/cdeque.h>
+#include <core/ipc/Thread.h>
+
+#define THIEVES         4
+#define ITEMS           200000
+
+using namespace lsp;
+
+UTEST_BEGIN("core.ipc", deque)
+
+    typedef struct item_t
+    {
+        volatile atomic_t   hits;
+    } item_t;
+
+    class Thief: public ipc::Thread
+    {
+        private:
+            cdeque<item_t>     *pDeque;
+            volatile bool      *pDone;
+            volatile atomic_t  *pStarted;
+
+        public:
+            size_t              nStolen;
+            size_t              nAborted;
+
+        public:
+            explicit Thief(cdeque<item_t> *dq, volatile bool *done, volatile atomic_t *started)
+            {
+                pDeque      = dq;
+                pDone       = done;
+                pStarted    = started;
+                nStolen     = 0;
+                nAborted    = 0;
+            }
+
+            virtual status_t run()
+            {
+                item_t *item;
+                atomic_add(pStarted, 1);
+
+                while (true)
+                {
+                    bool done   = *pDone;
+                    switch (pDeque->steal(&item))
+                    {
+                        case cdeque<item_t>::STEAL_OK:
+                            atomic_add(&item->hits, 1);
+                            ++nStolen;
+                            break;
+                        case cdeque<item_t>::STEAL_ABORT:
+                            ++nAborted;
+                            break;
+                        default:
+                            if (done)
+                                return STATUS_OK;
+                            ipc::Thread::yield();
+                            break;
+                    }
+                }
+
+                return STATUS_OK;
+            }
+    };
+
+    void test_single()
+    {
+        printf("Testing single-threaded access...\n");
+
+        cdeque<item_t> dq;
+        item_t items[0x1000];
+        item_t *item = NULL;
+
+        UTEST_ASSERT(dq.pop() == NULL);
+        UTEST_ASSERT(dq.steal(&item) == cdeque<item_t>::STEAL_EMPTY);
+
+        // Push items, deque should grow
+        for (size_t i=0; i<0x1000; ++i)
+            UTEST_ASSERT(dq.push(&items[i]));
+        UTEST_ASSERT(dq.size() == 0x1000);
+
+        // Steal is FIFO, pop is LIFO
+        UTEST_ASSERT(dq.steal(&item) == cdeque<item_t>::STEAL_OK);
+        UTEST_ASSERT(item == &items[0]);
+        UTEST_ASSERT(dq.pop() == &items[0xfff]);
+
+        for (size_t i=0xffe; i>0; --i)
+            UTEST_ASSERT(dq.pop() == &items[i]);
+        UTEST_ASSERT(dq.size() == 0);
+        UTEST_ASSERT(dq.pop() == NULL);
+        UTEST_ASSERT(dq.steal(&item) == cdeque<item_t>::STEAL_EMPTY);
+
+        dq.flush();
+    }
+
+    void test_concurrent()
+    {
+        printf("Testing concurrent access of %d thieves...\n", int(THIEVES));
+
+        cdeque<item_t> dq;
+        volatile bool done = false;
+        volatile atomic_t started = 0;
+        item_t *items = new item_t[ITEMS];
+        UTEST_ASSERT(items != NULL);
+        for (size_t i=0; i<ITEMS; ++i)
+            items[i].hits       = 0;
+
+        Thief *thieves[THIEVES];
+        for (size_t i=0; i<THIEVES; ++i)
+        {
+            thieves[i]  = new Thief(&dq, &done, &started);
+            UTEST_ASSERT(thieves[i] != NULL);
+            UTEST_ASSERT(thieves[i]->start() == STATUS_OK);
+        }
+
+        // Wait until all thieves are ready
+        while (started < THIEVES)
+            ipc::Thread::yield();
+
+        // Push items by bursts and pop some of them
+        size_t popped = 0;
+        for (size_t i=0; i<ITEMS; )
+        {
+            size_t burst = (rand() % 64) + 1;
+            for (size_t j=0; (j<burst) && (i<ITEMS); ++j, ++i)
+                UTEST_ASSERT(dq.push(&items[i]));
+
+            for (size_t j=rand() % 48; j > 0; --j)
+            {
+                item_t *item = dq.pop();
+                if (item == NULL)
+                    break;
+                atomic_add(&item->hits, 1);
+                ++popped;
+            }
+        }
+
+        // Fetch the rest of items
+        for (item_t *item; (item = dq.pop()) != NULL; ++popped)
+            atomic_add(&item->hits, 1);
+
+        done = true;
+        size_t stolen = 0;
+        for (size_t i=0; i<THIEVES; ++i)
+        {
+            UTEST_ASSERT(thieves[i]->join() == STATUS_OK);
+            printf("Thief %d: stolen=%d, aborted=%d\n", int(i), int(thieves[i]->nStolen), int(thieves[i]->nAborted));
+            stolen     += thieves[i]->nStolen;
+            delete thieves[i];
+        }
+        printf("Owner: popped=%d\n", int(popped));
+
+        // Each item should be fetched exactly once
+        UTEST_ASSERT(popped + stolen == ITEMS);
+        for (size_t i=0; i<ITEMS; ++i)
+            UTEST_ASSERT_MSG(items[i].hits == 1, "Item %d has been fetched %d times", int(i), int(items[i].hits));
+
+        delete [] items;
+    }
+
+    UTEST_MAIN
+    {
+        test_single();
+        test_concurrent();
+    }
+
+UTEST_END
@@ -0,0 +1,159 @@
+/*
+ * thread_pool.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <core/alloc.h>
+#include <test/utest.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/ThreadPoolExecutor.h>
+
+#define WORKERS         4
+#define TASKS           32
+
+using namespace lsp;
+
+static const status_t statuses[] =
+{
+    STATUS_OK, STATUS_NOT_FOUND, STATUS_BAD_ARGUMENTS, STATUS_CANCELLED
+};
+
+UTEST_BEGIN("core.ipc", thread_pool)
+
+    class TestTask: public ipc::ITask
+    {
+        private:
+            size_t nDelay;
+            status_t nResult;
+
+        public:
+            explicit TestTask(size_t delay, status_t result) : nDelay(delay), nResult(result) {}
+            virtual ~TestTask() {}
+
+        public:
+            virtual status_t run()
+            {
+                ipc::Thread::sleep(nDelay);
+                return nResult;
+            }
+    };
+
+    void test_cancel()
+    {
+        TestTask blocker(200, STATUS_OK);
+        TestTask t1(0, STATUS_OK), t2(0, STATUS_OK), t3(0, STATUS_OK);
+
+        printf("Testing cancel of tasks...\n");
+        ipc::ThreadPoolExecutor executor;
+        UTEST_ASSERT(executor.start(1) == STATUS_OK);
+
+        // Keep the only worker busy
+        while (!executor.submit(&blocker))
+            ipc::Thread::sleep(1);
+        while (blocker.submitted())
+            ipc::Thread::sleep(1);
+        UTEST_ASSERT(!blocker.idle());
+
+        UTEST_ASSERT(executor.submit(&t1));
+        UTEST_ASSERT(executor.submit(&t2));
+        UTEST_ASSERT(executor.submit(&t3));
+        UTEST_ASSERT(executor.pending() == 4);
+
+        // Queued tasks can be cancelled, running task can not
+        UTEST_ASSERT(executor.cancel(&t2));
+        UTEST_ASSERT(t2.idle());
+        UTEST_ASSERT(executor.cancel(&t2));
+        UTEST_ASSERT(executor.cancel(&t3));
+        UTEST_ASSERT(t3.idle());
+        UTEST_ASSERT(!executor.cancel(&blocker));
+        UTEST_ASSERT(executor.pending() == 2);
+
+        // Cancelled task can be submitted again
+        UTEST_ASSERT(executor.submit(&t2));
+
+        while (executor.pending() > 0)
+            ipc::Thread::sleep(10);
+        UTEST_ASSERT(blocker.completed());
+        UTEST_ASSERT(t1.completed());
+        UTEST_ASSERT(t2.completed());
+        UTEST_ASSERT(t3.idle());
+        UTEST_ASSERT(executor.executed(0) == 3);
+        UTEST_ASSERT(!executor.cancel(&t1));
+
+        executor.shutdown();
+    }
+
+    UTEST_MAIN
+    {
+        TestTask *tasks[TASKS];
+
+        test_cancel();
+
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            tasks[i] = new TestTask(20 + (rand() % 100), statuses[i % 4]);
+            UTEST_ASSERT(tasks[i] != NULL);
+            UTEST_ASSERT(tasks[i]->idle());
+            UTEST_ASSERT(tasks[i]->priority() == ipc::ITask::TP_NORMAL);
+            UTEST_ASSERT(tasks[i]->set_priority(ipc::ITask::task_priority_t(i % ipc::ITask::TP_TOTAL)));
+        }
+
+        printf("Starting thread pool executor...\n");
+        ipc::ThreadPoolExecutor executor;
+        UTEST_ASSERT(executor.submit(tasks[0]) == false);
+        UTEST_ASSERT(executor.start(WORKERS) == STATUS_OK);
+        UTEST_ASSERT(executor.workers() == WORKERS);
+        UTEST_ASSERT(executor.start(WORKERS) == STATUS_BAD_STATE);
+
+        printf("Submitting tasks...\n");
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            // The submit may fail only due to lock contention, retry
+            while (!executor.submit(tasks[i]))
+                ipc::Thread::sleep(1);
+
+            ipc::ITask::task_state_t ts = tasks[i]->state();
+            UTEST_ASSERT(
+                    (ts == ipc::ITask::TS_SUBMITTED) ||
+                    (ts == ipc::ITask::TS_RUNNING) ||
+                    (ts == ipc::ITask::TS_COMPLETED)
+                    );
+            UTEST_ASSERT(!tasks[i]->set_priority(ipc::ITask::TP_HIGH));
+        }
+
+        // Wait for completion
+        while (executor.pending() > 0)
+            ipc::Thread::sleep(10);
+
+        size_t executed = 0, stolen = 0;
+        for (size_t i=0; i<WORKERS; ++i)
+        {
+            printf("Worker %d: executed=%d, stolen=%d\n",
+                    int(i), int(executor.executed(i)), int(executor.stolen(i)));
+            executed   += executor.executed(i);
+            stolen     += executor.stolen(i);
+        }
+        UTEST_ASSERT(executed == TASKS);
+        UTEST_ASSERT(stolen <= TASKS);
+
+        printf("Shutting down executor...\n");
+        executor.shutdown();
+        UTEST_ASSERT(executor.workers() == 0);
+
+        printf("Checking tasks...\n");
+        for (size_t i=0; i<TASKS; ++i)
+        {
+            UTEST_ASSERT(tasks[i]->completed());
+            UTEST_ASSERT(tasks[i]->code() == statuses[i % 4]);
+            UTEST_ASSERT(tasks[i]->reset());
+            UTEST_ASSERT(tasks[i]->idle());
+        }
+
+        printf("Destroying tasks...\n");
+        for (size_t i=0; i<TASKS; ++i)
+            delete tasks[i];
+    }
+
+UTEST_END
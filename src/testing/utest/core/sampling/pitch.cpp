@@ -0,0 +1,191 @@
+/*
+ * pitch.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+#include <dsp/dsp.h>
+#include <core/windows.h>
+#include <core/sampling/SamplePlayer.h>
+
+#define SAMPLE_LENGTH       3000
+#define BUFFER_SIZE         0x4000
+#define DELAY               13
+#define VOLUME              0.7f
+#define TOLERANCE           1e-4f
+#define KERNEL_LOBES        14
+#define SINE_LENGTH         0x8000
+#define ALIAS_LEVEL         1e-4f       /* -80 dB */
+#define PASS_TOLERANCE      0.05f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.sampling", pitch)
+
+    float sample_at(const float *s, ssize_t i)
+    {
+        return ((i >= 0) && (i < SAMPLE_LENGTH)) ? s[i] : 0.0f;
+    }
+
+    // Reference implementation of the anti-aliasing filter applied to each step-th sample
+    float filter_at(const float *s, const float *k, ssize_t half, ssize_t i)
+    {
+        double sum  = 0.0;
+        for (ssize_t j=-half; j<=half; ++j)
+            sum        += k[j + half] * sample_at(s, i + j);
+        return sum;
+    }
+
+    float decimated_at(const float *s, const float *k, ssize_t half, size_t step, ssize_t i)
+    {
+        return (half > 0) ? filter_at(s, k, half, i * step) : sample_at(s, i);
+    }
+
+    // Reference implementation of the Catmull-Rom interpolation, band-limited when pitching up
+    void render(float *dst, const float *s, float rate, size_t count)
+    {
+        float k[KERNEL_LOBES * 16 + 1];
+        size_t step     = 1;
+        ssize_t half    = 0;
+        if (rate > 1.0f)
+        {
+            step            = rate;
+            half            = ceilf(KERNEL_LOBES * rate);
+            windows::window(k, half * 2 + 1, windows::BLACKMAN_HARRIS);
+            double sum      = 0.0;
+            for (ssize_t j=-half; j<=half; ++j)
+            {
+                double x        = j * M_PI / rate;
+                if (j != 0)
+                    k[j + half]    *= sin(x) / x;
+                sum            += k[j + half];
+            }
+            for (ssize_t j=-half; j<=half; ++j)
+                k[j + half]    /= sum;
+        }
+
+        for (size_t i=0; i<count; ++i)
+        {
+            double x    = double(i) * rate / step;
+            ssize_t n   = x;
+            float t     = x - n;
+            float p     = decimated_at(s, k, half, step, n-1);
+            float s0    = decimated_at(s, k, half, step, n);
+            float s1    = decimated_at(s, k, half, step, n+1);
+            float s2    = decimated_at(s, k, half, step, n+2);
+
+            dst[i + DELAY] += VOLUME * (s0 + 0.5f * t * ((s1 - p) +
+                    t * ((2.0f*p - 5.0f*s0 + 4.0f*s1 - s2) + t * (3.0f*(s0 - s1) + s2 - p))));
+        }
+    }
+
+    void test_rate(Sample *s, float rate, size_t block)
+    {
+        printf("Testing playback at rate %.4f, block size=%d...\n", rate, int(block));
+
+        SamplePlayer sp;
+        UTEST_ASSERT(sp.init(1, 4));
+        UTEST_ASSERT(sp.bind(0, s, false));
+
+        FloatBuffer dst1(BUFFER_SIZE);
+        FloatBuffer dst2(BUFFER_SIZE);
+        dst1.fill_zero();
+        size_t length = ceil(SAMPLE_LENGTH / double(rate));
+        render(dst1, s->getBuffer(0), rate, length);
+
+        // Play the sample and check that the playback has been finished
+        UTEST_ASSERT(sp.play(0, 0, VOLUME, DELAY, rate));
+        for (size_t offset=0; offset < BUFFER_SIZE; offset += block)
+            sp.process(&dst2[offset], lsp_min(block, BUFFER_SIZE - offset));
+        UTEST_ASSERT(dsp::h_abs_sum(&dst2[length + DELAY], BUFFER_SIZE - length - DELAY) == 0.0f);
+
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output differs at sample %d: %.6f vs %.6f",
+                    int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+
+        sp.unbind(0);
+        sp.destroy(false);
+    }
+
+    float play_sine(Sample *s, float rate, float freq)
+    {
+        SamplePlayer sp;
+        UTEST_ASSERT_MSG(sp.init(1, 1), "Could not initialize player");
+        UTEST_ASSERT_MSG(sp.bind(0, s, false), "Could not bind sample");
+
+        float *buf = s->getBuffer(0);
+        for (size_t i=0; i<SINE_LENGTH; ++i)
+            buf[i]      = sin(2.0 * M_PI * freq * i);
+
+        size_t length   = SINE_LENGTH / rate;
+        FloatBuffer dst(length);
+        UTEST_ASSERT_MSG(sp.play(0, 0, 1.0f, 0, rate), "Could not start playback");
+        sp.process(dst, length);
+
+        // Measure the RMS level far enough from the edges of the sample
+        size_t skip     = KERNEL_LOBES * 4;
+        float rms       = sqrtf(dsp::h_sqr_sum(&dst[skip], length - skip*2) / (length - skip*2));
+
+        sp.unbind(0);
+        sp.destroy(false);
+        return rms;
+    }
+
+    void test_aliasing(Sample *s, float rate)
+    {
+        // The sine above the Nyquist frequency of the output should be suppressed,
+        // the transition band of the filter is 0.8 .. 1.2 of the output Nyquist frequency
+        float alias = play_sine(s, rate, 0.65f / rate);
+        printf("Aliasing at rate %.4f: level=%.2f dB\n", rate, 20.0f * log10f(alias * M_SQRT2));
+        UTEST_ASSERT_MSG(alias * M_SQRT2 <= ALIAS_LEVEL,
+                "Aliasing at rate %.4f is too high: %.2f dB", rate, 20.0f * log10f(alias * M_SQRT2));
+
+        // The sine in the pass band should be kept
+        float pass  = play_sine(s, rate, 0.2f / rate);
+        printf("Pass band at rate %.4f: level=%.2f dB\n", rate, 20.0f * log10f(pass * M_SQRT2));
+        UTEST_ASSERT_MSG(fabs(pass * M_SQRT2 - 1.0f) <= PASS_TOLERANCE,
+                "Pass band at rate %.4f is distorted: %.2f dB", rate, 20.0f * log10f(pass * M_SQRT2));
+    }
+
+    UTEST_MAIN
+    {
+        Sample *s = new Sample();
+        UTEST_ASSERT(s->init(1, SAMPLE_LENGTH, SAMPLE_LENGTH));
+        float *buf = s->getBuffer(0);
+        for (size_t i=0; i<SAMPLE_LENGTH; ++i)
+            buf[i]      = (float(rand()) / RAND_MAX) - 0.5f;
+
+        UTEST_FOREACH(block, 64, 100, 1000)
+        {
+            test_rate(s, 0.25f, block);
+            test_rate(s, 0.5f, block);
+            test_rate(s, 0.7937005f, block);
+            test_rate(s, 1.0f, block);
+            test_rate(s, 1.0594631f, block);
+            test_rate(s, 2.0f, block);
+            test_rate(s, 7.5f, block);
+        }
+
+        s->destroy();
+        delete s;
+
+        s = new Sample();
+        UTEST_ASSERT(s->init(1, SINE_LENGTH, SINE_LENGTH));
+        test_aliasing(s, 1.5f);
+        test_aliasing(s, 2.0f);
+        test_aliasing(s, 3.3f);
+        test_aliasing(s, 7.5f);
+        test_aliasing(s, 8.0f);
+        s->destroy();
+        delete s;
+    }
+UTEST_END;
@@ -0,0 +1,331 @@
+/*
+ * stream.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+#include <dsp/dsp.h>
+#include <core/fade.h>
+#include <core/LSPString.h>
+#include <core/ipc/IExecutor.h>
+#include <core/files/AudioFile.h>
+#include <core/sampling/SamplePlayer.h>
+
+#define FILE_LENGTH         (DEFAULT_SAMPLE_RATE * 2)
+#define SAMPLE_HEAD         1000
+#define SAMPLE_LENGTH       80000
+#define SAMPLE_MEMORY       12000
+#define FADE_IN             3000
+#define FADE_OUT            5000
+#define BLOCK_SIZE          256
+#define BLOCKS              400
+#define REBIND_HEAD         7000
+#define REBIND_BLOCK        100
+#define VOICES              40
+
+using namespace lsp;
+
+namespace
+{
+    /**
+     * Executor that runs tasks immediately in the caller's thread or
+     * does not run them at all to emulate the slow I/O
+     */
+    class SyncExecutor: public ipc::IExecutor
+    {
+        private:
+            bool    bEnabled;
+
+        public:
+            explicit SyncExecutor(bool enabled)
+            {
+                bEnabled    = enabled;
+            }
+
+            virtual bool submit(ipc::ITask *task)
+            {
+                if (bEnabled)
+                    run_task(task);
+                else
+                    change_task_state(task, ipc::ITask::TS_SUBMITTED);
+                return true;
+            }
+    };
+}
+
+UTEST_BEGIN("core.sampling", stream)
+
+    void render(Sample *s, AudioFile &af, size_t length, size_t head = SAMPLE_HEAD)
+    {
+        for (size_t i=0; i<s->channels(); ++i)
+        {
+            float *dst  = s->getBuffer(i);
+            dsp::copy(dst, &af.channel(i)[head], length);
+            fade_in(dst, dst, FADE_IN, 0, length);
+            fade_out(dst, dst, FADE_OUT, SAMPLE_LENGTH, 0, length);
+        }
+        s->setLength(length);
+    }
+
+    void play(SamplePlayer &sp, size_t block)
+    {
+        switch (block)
+        {
+            case 0:     sp.play(0, 0, 1.0f, 10); break;
+            case 3:     sp.play(0, 1, 0.5f, 100); break;
+            case 5:
+                sp.play(0, 0, 0.3f, 0);
+                sp.play(0, 1, 0.3f, 7);
+                break;
+            case 7:     sp.play(0, 1, 0.7f, 3, 1.5f); break;
+            case 9:     sp.play(0, 0, 0.4f, 11, 0.75f); break;
+            case 100:   sp.cancel_all(0, 0, 777, 33); break;
+            case 200:   sp.play(0, 0, 1.0f, 0); break;
+            default:    break;
+        }
+    }
+
+    void test_playback(const char *path, AudioFile &af, bool io)
+    {
+        printf("Testing streamed playback, I/O %s...\n", (io) ? "enabled" : "disabled");
+
+        SampleStream ss;
+        UTEST_ASSERT(ss.open(path) == STATUS_OK);
+        UTEST_ASSERT(ss.frames() == FILE_LENGTH);
+        UTEST_ASSERT(ss.channels() == af.channels());
+        ss.set_window(SAMPLE_HEAD, SAMPLE_LENGTH, FADE_IN, FADE_OUT);
+
+        // Streamed sample keeps only the head in memory, reference sample is loaded completely
+        Sample *s1 = new Sample(), *s2 = new Sample();
+        UTEST_ASSERT(s1->init(af.channels(), SAMPLE_MEMORY));
+        UTEST_ASSERT(s2->init(af.channels(), SAMPLE_LENGTH));
+        render(s1, af, SAMPLE_MEMORY);
+        render(s2, af, SAMPLE_LENGTH);
+        s1->set_stream(&ss);
+
+        SamplePlayer sp1, sp2;
+        UTEST_ASSERT(sp1.init(1, 16, 8, 4096));
+        UTEST_ASSERT(sp2.init(1, 16));
+        UTEST_ASSERT(sp1.bind(0, s1, false));
+        UTEST_ASSERT(sp2.bind(0, s2, false));
+
+        SyncExecutor executor(io);
+        FloatBuffer dst1(BLOCK_SIZE), dst2(BLOCK_SIZE);
+        float energy = 0.0f;
+
+        for (size_t i=0; i<BLOCKS; ++i)
+        {
+            play(sp1, i);
+            play(sp2, i);
+            sp1.process(dst1, BLOCK_SIZE);
+            sp2.process(dst2, BLOCK_SIZE);
+            sp1.submit(&executor);
+
+            if (io)
+            {
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+                if (!dst1.equals_absolute(dst2))
+                {
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of block %d differs", int(i));
+                }
+            }
+            else if ((i * BLOCK_SIZE > SAMPLE_MEMORY * 2) && (i < 200))
+                energy     += dsp::h_abs_sum(dst1, BLOCK_SIZE);
+        }
+
+        // Without I/O the playbacks should be silent after the head
+        size_t underruns = sp1.fetch_underruns();
+        if (io)
+        {
+            UTEST_ASSERT(underruns == 0);
+        }
+        else
+        {
+            UTEST_ASSERT(underruns > 0);
+            UTEST_ASSERT(energy == 0.0f);
+        }
+
+        sp1.destroy(true);
+        sp2.destroy(true);
+        ss.close();
+    }
+
+    void test_no_slot(const char *path, AudioFile &af)
+    {
+        printf("Testing streamed playback without free stream slots...\n");
+
+        SampleStream ss;
+        UTEST_ASSERT(ss.open(path) == STATUS_OK);
+        ss.set_window(SAMPLE_HEAD, SAMPLE_LENGTH, FADE_IN, FADE_OUT);
+
+        Sample *s = new Sample();
+        UTEST_ASSERT(s->init(af.channels(), SAMPLE_MEMORY));
+        render(s, af, SAMPLE_MEMORY);
+        s->set_stream(&ss);
+
+        SamplePlayer sp;
+        UTEST_ASSERT(sp.init(1, 16, 1, 4096));
+        UTEST_ASSERT(sp.bind(0, s, false));
+
+        // Two playbacks compete for the only stream slot, one of them should report underruns
+        SyncExecutor executor(true);
+        FloatBuffer dst(BLOCK_SIZE);
+        UTEST_ASSERT(sp.play(0, 0, 1.0f, 0));
+        UTEST_ASSERT(sp.play(0, 1, 1.0f, 0));
+
+        for (size_t i=0; i * BLOCK_SIZE < SAMPLE_MEMORY * 2; ++i)
+        {
+            sp.process(dst, BLOCK_SIZE);
+            sp.submit(&executor);
+        }
+        UTEST_ASSERT(sp.fetch_underruns() > 0);
+
+        sp.destroy(true);
+        ss.close();
+    }
+
+    void test_voices(const char *path, AudioFile &af)
+    {
+        printf("Testing streamed playback of %d simultaneous voices...\n", int(VOICES));
+
+        SampleStream ss;
+        UTEST_ASSERT(ss.open(path) == STATUS_OK);
+        ss.set_window(SAMPLE_HEAD, SAMPLE_LENGTH, FADE_IN, FADE_OUT);
+
+        Sample *s1 = new Sample(), *s2 = new Sample();
+        UTEST_ASSERT(s1->init(af.channels(), SAMPLE_MEMORY));
+        UTEST_ASSERT(s2->init(af.channels(), SAMPLE_LENGTH));
+        render(s1, af, SAMPLE_MEMORY);
+        render(s2, af, SAMPLE_LENGTH);
+        s1->set_stream(&ss);
+
+        // Each voice should get the stream slot, no voice should be silenced
+        SamplePlayer sp1, sp2;
+        UTEST_ASSERT(sp1.init(1, VOICES * 2, VOICES * 2, 4096));
+        UTEST_ASSERT(sp2.init(1, VOICES * 2));
+        UTEST_ASSERT(sp1.bind(0, s1, false));
+        UTEST_ASSERT(sp2.bind(0, s2, false));
+
+        SyncExecutor executor(true);
+        FloatBuffer dst1(BLOCK_SIZE), dst2(BLOCK_SIZE);
+
+        for (size_t i=0; (i + 1) * BLOCK_SIZE <= SAMPLE_LENGTH; ++i)
+        {
+            if (i < VOICES)
+            {
+                float volume = 1.0f / (i + 1);
+                UTEST_ASSERT(sp1.play(0, i & 1, volume, i));
+                UTEST_ASSERT(sp2.play(0, i & 1, volume, i));
+            }
+
+            sp1.process(dst1, BLOCK_SIZE);
+            sp2.process(dst2, BLOCK_SIZE);
+            sp1.submit(&executor);
+
+            UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+            if (!dst1.equals_absolute(dst2))
+            {
+                dst1.dump("dst1");
+                dst2.dump("dst2");
+                UTEST_FAIL_MSG("Output of block %d differs", int(i));
+            }
+        }
+        UTEST_ASSERT(sp1.fetch_underruns() == 0);
+
+        sp1.destroy(true);
+        sp2.destroy(true);
+        ss.close();
+    }
+
+    void test_rebind(const char *path, AudioFile &af)
+    {
+        printf("Testing streamed playback after rebinding the sample...\n");
+
+        SampleStream ss;
+        UTEST_ASSERT(ss.open(path) == STATUS_OK);
+        ss.set_window(SAMPLE_HEAD, SAMPLE_LENGTH, FADE_IN, FADE_OUT);
+
+        // The reference sample is rendered from the window set after rebinding
+        Sample *s = new Sample(), ref;
+        UTEST_ASSERT(s->init(af.channels(), SAMPLE_MEMORY));
+        UTEST_ASSERT(ref.init(af.channels(), SAMPLE_LENGTH));
+        render(s, af, SAMPLE_MEMORY);
+        render(&ref, af, SAMPLE_LENGTH, REBIND_HEAD);
+        s->set_stream(&ss);
+
+        SamplePlayer sp;
+        UTEST_ASSERT(sp.init(1, 16, 8, 4096));
+        UTEST_ASSERT(sp.bind(0, s, false));
+
+        SyncExecutor executor(true);
+        FloatBuffer dst(BLOCK_SIZE);
+        UTEST_ASSERT(sp.play(0, 0, 1.0f, 0));
+
+        for (size_t i=0; (i + 1) * BLOCK_SIZE <= SAMPLE_LENGTH; ++i)
+        {
+            // Change the window of the stream and rebind the same sample
+            if (i == REBIND_BLOCK)
+            {
+                ss.set_window(REBIND_HEAD, SAMPLE_LENGTH, FADE_IN, FADE_OUT);
+                render(s, af, SAMPLE_MEMORY, REBIND_HEAD);
+                UTEST_ASSERT(sp.bind(0, s, false));
+            }
+
+            sp.process(dst, BLOCK_SIZE);
+            sp.submit(&executor);
+
+            // The playback should get the data of the new window after the slot is re-assigned
+            if (i <= REBIND_BLOCK)
+                continue;
+
+            UTEST_ASSERT_MSG(dst.valid(), "Destination buffer corrupted");
+            FloatBuffer exp(BLOCK_SIZE);
+            dsp::copy(exp, ref.getBuffer(0, i * BLOCK_SIZE), BLOCK_SIZE);
+            if (!dst.equals_absolute(exp))
+            {
+                dst.dump("dst");
+                exp.dump("exp");
+                UTEST_FAIL_MSG("Output of block %d differs", int(i));
+            }
+        }
+
+        sp.destroy(true);
+        ref.destroy();
+        ss.close();
+    }
+
+    UTEST_MAIN
+    {
+        // Create the audio file
+        AudioFile af;
+        LSPString path;
+        UTEST_ASSERT(path.fmt_utf8("tmp/utest-%s.wav", this->full_name()));
+        UTEST_ASSERT(af.create_samples(2, DEFAULT_SAMPLE_RATE, FILE_LENGTH) == STATUS_OK);
+        for (size_t i=0; i<af.channels(); ++i)
+        {
+            float *dst = af.channel(i);
+            for (size_t j=0; j<FILE_LENGTH; ++j)
+                dst[j]      = (float(rand()) / RAND_MAX) - 0.5f;
+        }
+        UTEST_ASSERT(af.store(&path) == STATUS_OK);
+
+        // Use the stored data as a reference
+        UTEST_ASSERT(af.load(&path) == STATUS_OK);
+
+        test_playback(path.get_utf8(), af, true);
+        test_playback(path.get_utf8(), af, false);
+        test_no_slot(path.get_utf8(), af);
+        test_voices(path.get_utf8(), af);
+        test_rebind(path.get_utf8(), af);
+
+        af.destroy();
+    }
+
+UTEST_END
@@ -0,0 +1,131 @@
+/*
+ * analyzer.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <core/util/Analyzer.h>
+
+#define SRATE       48000
+#define RANK        10
+#define CHANNELS    4
+#define SAMPLES     (SRATE / 2)
+#define POINTS      64
+
+using namespace lsp;
+
+namespace lsp
+{
+    // Gives access to the ring buffers of the analyzer
+    class test_analyzer: public Analyzer
+    {
+        public:
+            inline const float *buffer(size_t channel) const    { return vChannels[channel].vBuffer;    }
+            inline size_t head(size_t channel) const            { return vChannels[channel].nHead;      }
+    };
+}
+
+UTEST_BEGIN("core.util", analyzer)
+
+    void init_analyzer(Analyzer &a)
+    {
+        UTEST_ASSERT(a.init(CHANNELS, RANK));
+        a.set_sample_rate(SRATE);
+        a.set_rate(40.0f);
+        a.set_reactivity(20.0f);
+        a.set_window(windows::HANN);
+        a.set_envelope(envelope::WHITE_NOISE);
+        a.reconfigure();
+    }
+
+    void get_spectrums(Analyzer &a, float *out, const uint32_t *idx)
+    {
+        for (size_t i=0; i<CHANNELS; ++i)
+            UTEST_ASSERT(a.get_spectrum(i, &out[i * POINTS], idx, POINTS));
+    }
+
+    UTEST_MAIN
+    {
+        test_analyzer sa, ba;
+        init_analyzer(sa);
+        init_analyzer(ba);
+        ba.freeze_channel(2, true);
+        ba.enable_channel(3, false);
+
+        // Prepare signal: sine wave of different frequency for each channel
+        float *buf      = new float[CHANNELS * SAMPLES];
+        UTEST_ASSERT(buf != NULL);
+        const float *vin[CHANNELS];
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            float *dst      = &buf[i * SAMPLES];
+            float w         = 2.0f * M_PI * 1000.0f * (i + 1) / SRATE;
+            for (size_t j=0; j<SAMPLES; ++j)
+                dst[j]          = sinf(w * j);
+        }
+
+        float frq[POINTS], s_spc[CHANNELS * POINTS], b_spc[CHANNELS * POINTS];
+        uint32_t idx[POINTS];
+        sa.get_frequencies(frq, idx, 20.0f, 20000.0f, POINTS);
+
+        // Process the signal by blocks of random size
+        for (size_t off=0; off < SAMPLES; )
+        {
+            size_t count    = (rand() % 1024) + 1;
+            if (count > (SAMPLES - off))
+                count           = SAMPLES - off;
+
+            // Single-channel processing uses random splitting of the block
+            for (size_t i=0; i<CHANNELS; ++i)
+            {
+                const float *src    = &buf[i * SAMPLES + off];
+                size_t split        = rand() % (count + 1);
+                sa.process(i, src, split);
+                sa.process(i, &src[split], count - split);
+                vin[i]              = src;
+            }
+
+            // Batch processing
+            ba.process(vin, count);
+            off            += count;
+        }
+
+        get_spectrums(sa, s_spc, idx);
+        get_spectrums(ba, b_spc, idx);
+
+        // Active channels should give the same result with the peak at the proper frequency
+        for (size_t i=0; i<2; ++i)
+        {
+            float *s        = &s_spc[i * POINTS];
+            float *b        = &b_spc[i * POINTS];
+            UTEST_ASSERT_MSG(float_equals_relative(dsp::h_sum(s, POINTS), dsp::h_sum(b, POINTS), 1e-5f),
+                    "Spectrum of channel %d differs", int(i));
+
+            size_t peak     = dsp::max_index(s, POINTS);
+            float f         = 1000.0f * (i + 1);
+            UTEST_ASSERT_MSG((frq[peak] > f * 0.8f) && (frq[peak] < f * 1.25f),
+                    "Channel %d: peak frequency %.1f does not match %.1f", int(i), frq[peak], f);
+        }
+
+        // Frozen channel should not be updated, disabled channel should be cleared
+        UTEST_ASSERT(dsp::h_abs_sum(&b_spc[2 * POINTS], POINTS) == 0.0f);
+        UTEST_ASSERT(dsp::h_abs_sum(&b_spc[3 * POINTS], POINTS) == 0.0f);
+
+        // Skipped channels should keep the ring buffer up to date to resume the analysis
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            UTEST_ASSERT_MSG(sa.head(i) == ba.head(i), "Head of channel %d differs", int(i));
+            UTEST_ASSERT_MSG(memcmp(sa.buffer(i), ba.buffer(i), (1 << RANK) * sizeof(float)) == 0,
+                    "Ring buffer of channel %d differs", int(i));
+        }
+
+        sa.destroy();
+        ba.destroy();
+        delete [] buf;
+    }
+
+UTEST_END
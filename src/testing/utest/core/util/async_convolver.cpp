@@ -0,0 +1,140 @@
+/*
+ * async_convolver.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+#include <core/ipc/Thread.h>
+#include <core/ipc/ThreadPoolExecutor.h>
+#include <core/util/AsyncConvolver.h>
+
+using namespace lsp;
+
+static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
+{
+    for (size_t i=0; i<count; ++i)
+    {
+        float k = src[i];
+        for (size_t j=0; j<length; ++j)
+            dst[i+j] += k * conv[j];
+    }
+}
+
+UTEST_BEGIN("core.util", async_convolver)
+
+    void convolve(AsyncConvolver &conv, ipc::IExecutor *executor, float *dst, const float *src, size_t count, size_t step)
+    {
+        for (size_t i=0; i<count;)
+        {
+            size_t todo = count - i;
+            if (todo > step)
+                todo = step;
+            conv.process(&dst[i], &src[i], todo);
+            i += todo;
+
+            // Give enough time to the background task to meet the deadline,
+            // the submit may fail due to lock contention, so retry it
+            for (size_t j=0; j<3; ++j)
+            {
+                while (conv.submit(executor))
+                    ipc::Thread::sleep(1);
+            }
+        }
+    }
+
+    void test_convolution(ipc::IExecutor *executor, size_t length, size_t rank, size_t delay, size_t step)
+    {
+        AsyncConvolver c;
+
+        FloatBuffer conv(length);
+        FloatBuffer src(length * 3);
+        FloatBuffer dst1(src.size());
+        FloatBuffer dst2(dst1);
+
+        printf("Testing async convolution length=%d, rank=%d, delay=%d, step=%d...\n",
+                int(length), int(rank), int(delay), int(step));
+
+        // Use sparse source signal to speed up computation of reference data
+        conv.randomize(-1.0f, 1.0f);
+        src.fill_zero();
+        for (size_t i=0; i<16; ++i)
+            src[(i * length) / 8 + i * 37] = ((i % 3) == 0) ? 1.0f :
+                                             ((i % 3) == 1) ? -0.5f : 0.25f;
+
+        dst1.fill_zero();
+        dst2.fill_zero();
+
+        for (size_t i=0; i<src.size(); ++i)
+        {
+            if (src[i] != 0.0f)
+                ::convolve(dst1.data(i), src.data(i), conv, conv.size(), 1);
+        }
+
+        UTEST_ASSERT(c.init(conv, conv.size(), rank, 0.0f, delay));
+        UTEST_ASSERT(c.delay() == ((delay < length) ? delay : 0));
+        UTEST_ASSERT(c.data_size() == length);
+        convolve(c, executor, dst2, src, src.size(), step);
+        UTEST_ASSERT(c.idle());
+        UTEST_ASSERT(c.fetch_late() == 0);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(conv.valid(), "Convolution buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (!dst2.equals_adaptive(dst1, 5e-3))
+        {
+            size_t index = dst2.last_diff();
+            UTEST_FAIL_MSG("Output of convolver is invalid, started at sample=%d: %.5f vs %.5f",
+                    int(index), dst1[index], dst2[index]);
+        }
+
+        c.destroy();
+    }
+
+    void test_late_deadlines()
+    {
+        AsyncConvolver c;
+        FloatBuffer conv(0x4000);
+        FloatBuffer buf(0x400);
+
+        printf("Testing late deadlines...\n");
+
+        conv.randomize(-1.0f, 1.0f);
+        buf.randomize(-1.0f, 1.0f);
+        UTEST_ASSERT(c.init(conv, conv.size(), 12, 0.0f, 0x1000));
+
+        // The background task is never launched, first 'delay' samples
+        // do not require any data from the background task
+        for (size_t i=0; i<4; ++i)
+            c.process(buf, buf, buf.size());
+        UTEST_ASSERT(c.fetch_late() == 0);
+        for (size_t i=0; i<4; ++i)
+            c.process(buf, buf, buf.size());
+        UTEST_ASSERT(c.fetch_late() == 4);
+        UTEST_ASSERT(c.fetch_late() == 0);
+        UTEST_ASSERT(c.idle());
+
+        c.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        ipc::ThreadPoolExecutor executor;
+        UTEST_ASSERT(executor.start(2) == STATUS_OK);
+
+        test_convolution(&executor, 0x2000, 10, 0, 256);
+        test_convolution(&executor, 0x2000, 10, 0x4000, 256);
+        test_convolution(&executor, 0x8000, 12, 0x1000, 100);
+        test_convolution(&executor, 0x20000, 14, 0x2000, 1024);
+        test_convolution(&executor, 0x8000, 13, 0x800, 64);
+        test_late_deadlines();
+
+        executor.shutdown();
+    }
+
+UTEST_END;
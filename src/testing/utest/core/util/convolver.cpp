@@ -216,11 +216,60 @@ UTEST_BEGIN("core.util", convolver)
         c.destroy();
     }
 
+    void test_tail(size_t length, size_t rank, size_t step)
+    {
+        Convolver c;
+
+        FloatBuffer conv(length);
+        FloatBuffer src(length * 3);
+        FloatBuffer dst1(src.size());
+        FloatBuffer dst2(dst1);
+
+        printf("Testing tail convolution length=%d, rank=%d...\n", int(length), int(rank));
+
+        // Use sparse source signal to speed up computation of reference data
+        conv.randomize(-1.0f, 1.0f);
+        src.fill_zero();
+        for (size_t i=0; i<16; ++i)
+            src[(i * length) / 8 + i * 37] = ((i % 3) == 0) ? 1.0f :
+                                             ((i % 3) == 1) ? -0.5f : 0.25f;
+
+        dst1.fill_zero();
+        dst2.fill_zero();
+
+        for (size_t i=0; i<src.size(); ++i)
+        {
+            if (src[i] != 0.0f)
+                ::convolve(dst1.data(i), src.data(i), conv, conv.size(), 1);
+        }
+
+        UTEST_ASSERT(c.init(conv, conv.size(), rank, 0));
+        convolve(c, dst2, src, src.size(), step);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(conv.valid(), "Convolution buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+        if (!dst2.equals_adaptive(dst1, 5e-3))
+        {
+            size_t index = dst2.last_diff();
+            UTEST_FAIL_MSG("Output of convolver is invalid, started at sample=%d: %.5f vs %.5f",
+                    int(index), dst1[index], dst2[index]);
+        }
+
+        c.destroy();
+    }
+
     UTEST_MAIN
     {
 //        test_collisions();
         test_small();
         test_large();
+        test_tail(0x2000, 12, 1024);
+        test_tail(0x8000, 12, 100);
+        test_tail(0x48000, 17, 1024);
+        test_tail(0x140000, CONVOLVER_RANK_MAX, 4096);
     }
 UTEST_END;
 
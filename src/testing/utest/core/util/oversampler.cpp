@@ -0,0 +1,135 @@
+/*
+ * oversampler.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/sugar.h>
+#include <core/util/Oversampler.h>
+
+#define SAMPLE_RATE         48000
+#define SAMPLES             8192
+#define SETTLE              1024
+#define FIR_TOLERANCE       2e-3f
+#define IIR_TOLERANCE       2e-2f
+#define STOPBAND_LEVEL      1e-3f
+
+using namespace lsp;
+
+UTEST_BEGIN("core.util", oversampler)
+
+    void sine(float *dst, float freq, size_t count)
+    {
+        double w    = 2.0 * M_PI * freq / SAMPLE_RATE;
+        for (size_t i=0; i<count; ++i)
+            dst[i]      = sin(w * i);
+    }
+
+    void init(Oversampler &os, over_mode_t mode)
+    {
+        UTEST_ASSERT(os.init());
+        os.set_sample_rate(SAMPLE_RATE);
+        os.set_mode(mode);
+        if (os.modified())
+            os.update_settings();
+    }
+
+    void check_delay(const char *label, const float *ref, const float *out, size_t latency, float tolerance)
+    {
+        for (size_t i=SETTLE; i<SAMPLES; ++i)
+        {
+            UTEST_ASSERT_MSG(fabs(out[i] - ref[i - latency]) <= tolerance,
+                    "Mode %s, sample %d: expected %.6f, got %.6f (latency=%d)",
+                    label, int(i), ref[i - latency], out[i], int(latency));
+        }
+    }
+
+    void test_round_trip(const char *label, over_mode_t mode, size_t times, float freq, float tolerance)
+    {
+        printf("Testing round trip for mode %s at %.1f Hz\n", label, freq);
+
+        Oversampler os1, os2;
+        init(os1, mode);
+        init(os2, mode);
+        UTEST_ASSERT(os1.get_oversampling() == times);
+        UTEST_ASSERT(os1.latency() < SETTLE);
+
+        float *src      = new float[SAMPLES * 3];
+        float *dst1     = &src[SAMPLES];
+        float *dst2     = &dst1[SAMPLES];
+        float *up       = new float[SAMPLES * times];
+        sine(src, freq, SAMPLES);
+
+        // Process data in blocks of different size
+        for (size_t off=0, step=1; off<SAMPLES; step = (step * 7 + 3) % 1031 + 1)
+        {
+            size_t count    = lsp_min(step, size_t(SAMPLES - off));
+            os1.process(&dst1[off], &src[off], count);
+            os2.upsample(&up[off * times], &src[off], count);
+            os2.downsample(&dst2[off], &up[off * times], count);
+            off            += count;
+        }
+
+        check_delay(label, src, dst1, os1.latency(), tolerance);
+        check_delay(label, src, dst2, os2.latency(), tolerance);
+
+        delete [] src;
+        delete [] up;
+        os1.destroy();
+        os2.destroy();
+    }
+
+    void test_stopband(const char *label, over_mode_t mode, size_t times)
+    {
+        printf("Testing stop band for mode %s\n", label);
+
+        Oversampler os;
+        init(os, mode);
+
+        // The tone above the Nyquist frequency of the base sample rate should be suppressed
+        float *src      = new float[SAMPLES * times];
+        float *dst      = new float[SAMPLES];
+        double w        = 2.0 * M_PI * 0.75 / times;
+        for (size_t i=0; i<SAMPLES * times; ++i)
+            src[i]          = sin(w * i);
+
+        os.downsample(dst, src, SAMPLES);
+        float level     = dsp::abs_max(&dst[SETTLE], SAMPLES - SETTLE);
+        printf("  level of the suppressed tone: %.1f dB\n", 20.0f * log10f(level + 1e-10f));
+        UTEST_ASSERT_MSG(level <= STOPBAND_LEVEL, "Mode %s: tone level %f is too high", label, level);
+
+        delete [] src;
+        delete [] dst;
+        os.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        #define FIR(mode, times) \
+            test_round_trip(#mode, mode, times, 1000.0f, FIR_TOLERANCE); \
+            test_round_trip(#mode, mode, times, 10000.0f, FIR_TOLERANCE); \
+            test_stopband(#mode, mode, times);
+        #define IIR(mode, times) \
+            test_round_trip(#mode, mode, times, 200.0f, IIR_TOLERANCE); \
+            test_stopband(#mode, mode, times);
+
+        FIR(OM_HALFBAND_2X_FAST, 2);
+        FIR(OM_HALFBAND_2X_NORMAL, 2);
+        FIR(OM_HALFBAND_2X_HIGH, 2);
+        FIR(OM_HALFBAND_4X_FAST, 4);
+        FIR(OM_HALFBAND_4X_NORMAL, 4);
+        FIR(OM_HALFBAND_4X_HIGH, 4);
+        FIR(OM_HALFBAND_8X_FAST, 8);
+        FIR(OM_HALFBAND_8X_NORMAL, 8);
+        FIR(OM_HALFBAND_8X_HIGH, 8);
+
+        IIR(OM_HALFBAND_IIR_2X, 2);
+        IIR(OM_HALFBAND_IIR_4X, 4);
+        IIR(OM_HALFBAND_IIR_8X, 8);
+    }
+
+UTEST_END
@@ -0,0 +1,160 @@
+/*
+ * sync_chirp.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/windows.h>
+#include <core/util/SyncChirpProcessor.h>
+
+#define SAMPLE_RATE         48000
+#define CHANNELS            3
+#define TOLERANCE           1e-4f
+#define ORDER               4
+#define WINDOW_RANK         10
+
+using namespace lsp;
+
+UTEST_BEGIN("core.util", sync_chirp)
+
+    void init_data(Sample *s, const Sample *chirp, size_t length, size_t delay, float gain)
+    {
+        UTEST_ASSERT(s->init(1, length, length));
+        float *dst = s->getBuffer(0);
+        dsp::fill_zero(dst, length);
+
+        size_t count = lsp_min(chirp->length(), length - delay);
+        dsp::mul_k3(&dst[delay], chirp->getBuffer(0), gain, count);
+    }
+
+    float *convolve(SyncChirpProcessor &sc, Sample **data, size_t *offsets, size_t threads, size_t part_size, size_t *length)
+    {
+        sc.set_threads(threads);
+        UTEST_ASSERT(sc.do_linear_convolutions(data, offsets, CHANNELS, part_size) == STATUS_OK);
+
+        AudioFile *res  = sc.get_convolution_result();
+        UTEST_ASSERT(res != NULL);
+        UTEST_ASSERT(res->channels() == CHANNELS);
+
+        *length         = res->samples();
+        float *buf      = new float[CHANNELS * res->samples()];
+        for (size_t i=0; i<CHANNELS; ++i)
+            dsp::copy(&buf[i * res->samples()], res->channel(i), res->samples());
+
+        return buf;
+    }
+
+    UTEST_MAIN
+    {
+        SyncChirpProcessor sc;
+        UTEST_ASSERT(sc.init());
+
+        sc.set_sample_rate(SAMPLE_RATE);
+        sc.set_chirp_synthesis_method(SCP_SYNTH_BANDLIMITED);
+        sc.set_chirp_initial_frequency(50.0);
+        sc.set_chirp_final_frequency(20000.0);
+        sc.set_chirp_duration(0.2f);
+        sc.set_chirp_amplitude(1.0f);
+        sc.set_fader_fading_method(SCP_FADE_RAISED_COSINES);
+        sc.set_fader_fadein(0.01f);
+        sc.set_fader_fadeout(0.003f);
+        sc.update_settings();
+        UTEST_ASSERT(sc.reconfigure() == STATUS_OK);
+
+        const Sample *chirp = sc.get_chirp();
+        UTEST_ASSERT(chirp != NULL);
+        size_t len      = chirp->length();
+
+        // Channels of different length with different delays of the chirp
+        Sample s[CHANNELS];
+        Sample *data[CHANNELS];
+        size_t offsets[CHANNELS], delays[CHANNELS];
+
+        init_data(&s[0], chirp, len * 2, 1000, 1.0f);
+        init_data(&s[1], chirp, len + 3000, 2500, 0.5f);
+        init_data(&s[2], chirp, len * 2 + 777, 100, -0.25f);
+        delays[0] = 1000 - 200;
+        delays[1] = 2500;
+        delays[2] = 100 - 100;
+        offsets[0] = 200;
+        offsets[1] = 0;
+        offsets[2] = 100;
+        for (size_t i=0; i<CHANNELS; ++i)
+            data[i] = &s[i];
+
+        // Reference: single partition convolution
+        size_t ref_len  = 0;
+        float *ref      = convolve(sc, data, offsets, 1, 0, &ref_len);
+        size_t ref_mid  = ref_len / 2 - 1;
+
+        // The impulse response of the linear system should be located at the time origin with the delay
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            const float *r  = &ref[i * ref_len];
+            size_t peak     = dsp::abs_max_index(r, ref_len);
+            printf("Channel %d peak at %d, expected %d\n", int(i), int(peak), int(ref_mid + delays[i]));
+            UTEST_ASSERT((peak >= ref_mid + delays[i] - 2) && (peak <= ref_mid + delays[i] + 2));
+        }
+
+        UTEST_FOREACH(part_size, 256, 1024, 4096)
+        {
+            // Partitioned convolution should be the same as the single partition convolution
+            size_t len1, len2;
+            float *res1     = convolve(sc, data, offsets, 1, part_size, &len1);
+            float *res2     = convolve(sc, data, offsets, 4, part_size, &len2);
+            size_t mid      = len1 / 2 - 1;
+
+            printf("Testing partition size=%d, result length=%d\n", int(part_size), int(len1));
+            UTEST_ASSERT(len1 == len2);
+
+            // The result should not depend on the number of threads
+            UTEST_ASSERT_MSG(::memcmp(res1, res2, CHANNELS * len1 * sizeof(float)) == 0,
+                    "Convolution results differ for single-threaded and multi-threaded processing");
+
+            // Compare results relatively to the time origin
+            for (size_t i=0; i<CHANNELS; ++i)
+            {
+                const float *r  = &ref[i * ref_len + ref_mid];
+                const float *c  = &res1[i * len1 + mid];
+                float peak      = fabs(r[delays[i]]);
+                ssize_t head    = -ssize_t(lsp_min(mid, ref_mid));
+                ssize_t tail    = lsp_min(len1 - mid, ref_len - ref_mid);
+
+                for (ssize_t j=head; j<tail; ++j)
+                    UTEST_ASSERT_MSG(fabs(r[j] - c[j]) <= TOLERANCE * peak,
+                            "Channel %d sample %d: expected %f, got %f", int(i), int(j), r[j], c[j]);
+            }
+
+            delete [] res1;
+            delete [] res2;
+        }
+
+        // Identified kernels should not depend on the number of threads
+        float *k1   = new float[ORDER << WINDOW_RANK];
+        float *k2   = new float[ORDER << WINDOW_RANK];
+        for (size_t pass=0; pass<2; ++pass)
+        {
+            size_t threads = (pass > 0) ? 4 : 1;
+            printf("Testing nonlinear identification threads=%d\n", int(threads));
+            size_t length;
+            float *res = convolve(sc, data, offsets, threads, 1024, &length);
+            UTEST_ASSERT(sc.postprocess_nonlinear_convolution(0, ORDER, true, 16, 16, windows::HANN, WINDOW_RANK) == STATUS_OK);
+            UTEST_ASSERT(sc.fill_with_kernel_taps((pass > 0) ? k2 : k1) == STATUS_OK);
+            delete [] res;
+        }
+        UTEST_ASSERT_MSG(::memcmp(k1, k2, (ORDER << WINDOW_RANK) * sizeof(float)) == 0,
+                "Kernels differ for single-threaded and multi-threaded identification");
+        delete [] k1;
+        delete [] k2;
+
+        delete [] ref;
+        for (size_t i=0; i<CHANNELS; ++i)
+            s[i].destroy();
+        sc.destroy();
+    }
+
+UTEST_END
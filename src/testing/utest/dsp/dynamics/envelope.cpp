@@ -0,0 +1,138 @@
+/*
+ * envelope.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+    void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+
+    namespace avx
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        void envelope_process_x4(float *dst, const float *src, envelope_x4_t *e, size_t count);
+        void envelope_process_x8(float *dst, const float *src, envelope_x8_t *e, size_t count);
+    }
+)
+
+UTEST_BEGIN("dsp.dynamics", envelope)
+
+    template <class bank_t, class func_t>
+        void call(const char *label, size_t lanes, func_t native, func_t func)
+        {
+            if (!UTEST_SUPPORTED(func))
+                return;
+
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 16, 31, 64, 0x1ff)
+            {
+                for (size_t inplace=0; inplace < 2; ++inplace)
+                {
+                    printf("Testing %s on input buffer size=%d, in-place=%d...\n", label, int(count), int(inplace));
+
+                    FloatBuffer src(count * lanes);
+                    FloatBuffer dst1(count * lanes);
+                    FloatBuffer dst2(count * lanes);
+
+                    // Each lane gets the sidechain signal of different level
+                    for (size_t i=0; i<count; ++i)
+                        for (size_t j=0; j<lanes; ++j)
+                            src[i*lanes + j]    = (float(rand()) / RAND_MAX) * (j + 1) * 0.25f;
+
+                    // Initialize envelope followers, the threshold of some lanes is above the signal
+                    bank_t e1, e2;
+                    for (size_t j=0; j<lanes; ++j)
+                    {
+                        e1.env[j]       = 0.1f * j;
+                        e1.attack[j]    = 0.05f + 0.05f * j;
+                        e1.release[j]   = 0.001f + 0.002f * j;
+                        e1.thresh[j]    = (j & 1) ? 0.05f : 1.5f;
+                    }
+                    e2      = e1;
+
+                    // Apply processing
+                    if (inplace)
+                    {
+                        dst1.copy(src);
+                        dst2.copy(src);
+                        native(dst1, dst1, &e1, count);
+                        func(dst2, dst2, &e2, count);
+                    }
+                    else
+                    {
+                        native(dst1, src, &e1, count);
+                        func(dst2, src, &e2, count);
+                    }
+
+                    // Perform validation
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                    }
+
+                    for (size_t j=0; j<lanes; ++j)
+                    {
+                        UTEST_ASSERT_MSG(float_equals_adaptive(e1.env[j], e2.env[j], TOLERANCE),
+                            "Envelope state of lane %d differs: %.6f vs %.6f", int(j), e1.env[j], e2.env[j]);
+                    }
+                }
+            }
+        }
+
+    UTEST_MAIN
+    {
+        #define CALL(native, func, bank, lanes) \
+            call<bank>(#func, lanes, native, func)
+
+        IF_ARCH_X86(CALL(native::envelope_process_x4, sse::envelope_process_x4, envelope_x4_t, 4));
+        IF_ARCH_X86(CALL(native::envelope_process_x4, avx::envelope_process_x4, envelope_x4_t, 4));
+        IF_ARCH_ARM(CALL(native::envelope_process_x4, neon_d32::envelope_process_x4, envelope_x4_t, 4));
+        IF_ARCH_AARCH64(CALL(native::envelope_process_x4, asimd::envelope_process_x4, envelope_x4_t, 4));
+
+        IF_ARCH_X86(CALL(native::envelope_process_x8, sse::envelope_process_x8, envelope_x8_t, 8));
+        IF_ARCH_X86(CALL(native::envelope_process_x8, avx::envelope_process_x8, envelope_x8_t, 8));
+        IF_ARCH_ARM(CALL(native::envelope_process_x8, neon_d32::envelope_process_x8, envelope_x8_t, 8));
+        IF_ARCH_AARCH64(CALL(native::envelope_process_x8, asimd::envelope_process_x8, envelope_x8_t, 8));
+    }
+
+UTEST_END
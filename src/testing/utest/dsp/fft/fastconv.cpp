@@ -19,6 +19,7 @@ namespace native
     void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
     void fastconv_restore(float *dst, float *src, size_t rank);
     void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+    void fastconv_mul_add(float *dst, const float *c1, const float *c2, size_t rank);
 }
 
 IF_ARCH_X86(
@@ -28,6 +29,7 @@ IF_ARCH_X86(
         void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
         void fastconv_restore(float *dst, float *src, size_t rank);
         void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void fastconv_mul_add(float *dst, const float *c1, const float *c2, size_t rank);
     }
 
     namespace avx
@@ -36,11 +38,13 @@ IF_ARCH_X86(
         void fastconv_parse_apply(float *dst, float *tmp, const float *c, const float *src, size_t rank);
         void fastconv_restore(float *dst, float *src, size_t rank);
         void fastconv_apply(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void fastconv_mul_add(float *dst, const float *c1, const float *c2, size_t rank);
 
         void fastconv_parse_fma3(float *dst, const float *src, size_t rank);
         void fastconv_parse_apply_fma3(float *dst, float *tmp, const float *c, const float *src, size_t rank);
         void fastconv_restore_fma3(float *dst, float *src, size_t rank);
         void fastconv_apply_fma3(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
+        void fastconv_mul_add_fma3(float *dst, const float *c1, const float *c2, size_t rank);
     }
 )
 
@@ -72,6 +76,8 @@ typedef void (* fastconv_restore_t)(float *dst, float *src, size_t rank);
 
 typedef void (* fastconv_apply_t)(float *dst, float *tmp, const float *c1, const float *c2, size_t rank);
 
+typedef void (* fastconv_mul_add_t)(float *dst, const float *c1, const float *c2, size_t rank);
+
 UTEST_BEGIN("dsp.fft", fastconv)
 
     // This is long-time test, raise time limit for it to one second
@@ -279,6 +285,79 @@ UTEST_BEGIN("dsp.fft", fastconv)
         }
     }
 
+    void call_pma(const char *label, size_t align,
+            fastconv_parse_t parse,
+            fastconv_mul_add_t mul_add,
+            fastconv_restore_t restore
+        )
+    {
+        if (!UTEST_SUPPORTED(parse))
+            return;
+        if (!UTEST_SUPPORTED(mul_add))
+            return;
+        if (!UTEST_SUPPORTED(restore))
+            return;
+
+        for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank ++)
+        {
+            for (size_t mask=0; mask <= 0x0f; ++mask)
+            {
+                printf("Testing '%s' for FFT rank=%d, mask=0x%x\n", label, rank, mask);
+
+                FloatBuffer src1(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src2(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer src3(1 << (rank-1), align, mask & 0x01);
+                FloatBuffer fa1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fa2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb1(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer fb2(1 << (rank+1), align, mask & 0x02);
+                FloatBuffer acc1(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer acc2(1 << (rank+1), align, mask & 0x04);
+                FloatBuffer dst1(1 << rank, align, mask & 0x08);
+                FloatBuffer dst2(1 << rank, align, mask & 0x08);
+
+                native::fastconv_parse(fa1, src1, rank);
+                native::fastconv_parse(fb1, src2, rank);
+                native::fastconv_parse(acc1, src3, rank);
+                parse(fa2, src1, rank);
+                parse(fb2, src2, rank);
+                parse(acc2, src3, rank);
+                UTEST_ASSERT_MSG(src1.valid(), "Buffer SRC1 corrupted");
+                UTEST_ASSERT_MSG(src2.valid(), "Buffer SRC2 corrupted");
+                UTEST_ASSERT_MSG(src3.valid(), "Buffer SRC3 corrupted");
+
+                native::fastconv_mul_add(acc1, fa1, fb1, rank);
+                UTEST_ASSERT_MSG(acc1.valid(), "Buffer ACC1 corrupted");
+                UTEST_ASSERT_MSG(fa1.valid(), "Buffer FA1 corrupted");
+                UTEST_ASSERT_MSG(fb1.valid(), "Buffer FB1 corrupted");
+                mul_add(acc2, fa2, fb2, rank);
+                UTEST_ASSERT_MSG(acc2.valid(), "Buffer ACC2 corrupted");
+                UTEST_ASSERT_MSG(fa2.valid(), "Buffer FA2 corrupted");
+                UTEST_ASSERT_MSG(fb2.valid(), "Buffer FB2 corrupted");
+
+                // Data layout may differ, compare restored real data
+                native::fastconv_restore(dst1, acc1, rank);
+                UTEST_ASSERT_MSG(dst1.valid(), "Buffer DST1 corrupted");
+                restore(dst2, acc2, rank);
+                UTEST_ASSERT_MSG(dst2.valid(), "Buffer DST2 corrupted");
+
+                // Compare buffers
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src1.dump("src1");
+                    src2.dump("src2");
+                    src3.dump("src3");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+
+                    ssize_t diff = dst2.last_diff();
+                    UTEST_FAIL_MSG("DST1 differs DST2 for test '%s' at sample %d (%.5f vs %.5f), rank=%d",
+                            label, int(diff), dst1.get(diff), dst2.get(diff), int(rank));
+                }
+            }
+        }
+    }
+
     UTEST_MAIN
     {
         // Do tests
@@ -299,6 +378,10 @@ UTEST_BEGIN("dsp.fft", fastconv)
         IF_ARCH_X86(call_pap("avx::fastconv_parse_fma3 + avx::fastconv_parse_apply_fma3", 32, avx::fastconv_parse_fma3, avx::fastconv_parse_apply_fma3));
         IF_ARCH_ARM(call_pap("neon_d32::fastconv_parse + neon_d32::fastconv_parse_apply", 16, neon_d32::fastconv_parse, neon_d32::fastconv_parse_apply));
         IF_ARCH_AARCH64(call_pap("asimd::fastconv_parse + asimd::fastconv_parse_apply", 16, asimd::fastconv_parse, asimd::fastconv_parse_apply));
+
+        IF_ARCH_X86(call_pma("sse::fastconv_mul_add", 16, sse::fastconv_parse, sse::fastconv_mul_add, sse::fastconv_restore));
+        IF_ARCH_X86(call_pma("avx::fastconv_mul_add", 32, avx::fastconv_parse, avx::fastconv_mul_add, avx::fastconv_restore));
+        IF_ARCH_X86(call_pma("avx::fastconv_mul_add_fma3", 32, avx::fastconv_parse_fma3, avx::fastconv_mul_add_fma3, avx::fastconv_restore_fma3));
     }
 UTEST_END;
 
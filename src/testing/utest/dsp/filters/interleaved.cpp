@@ -0,0 +1,226 @@
+/*
+ * interleaved.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-3f
+
+namespace native
+{
+    void biquad_process_x1(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+    void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+
+    namespace avx
+    {
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8_fma3(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        void biquad_process_i2(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i4(float *dst, const float *src, size_t count, biquad_t *f);
+        void biquad_process_i8(float *dst, const float *src, size_t count, biquad_t *f);
+    }
+)
+
+typedef void (* biquad_process_t)(float *dst, const float *src, size_t count, biquad_t *f);
+
+UTEST_BEGIN("dsp.filters", interleaved)
+
+    void init_lanes(biquad_t *f, size_t lanes)
+    {
+        float *b0, *b1, *b2, *a1, *a2;
+        if (lanes > 4)
+        {
+            b0 = f->x8.b0; b1 = f->x8.b1; b2 = f->x8.b2; a1 = f->x8.a1; a2 = f->x8.a2;
+        }
+        else
+        {
+            b0 = f->x4.b0; b1 = f->x4.b1; b2 = f->x4.b2; a1 = f->x4.a1; a2 = f->x4.a2;
+        }
+
+        // Each lane gets its own stable filter with poles inside of the unit circle
+        for (size_t j=0; j<lanes; ++j)
+        {
+            float r     = 0.5f + 0.45f * (float(rand()) / RAND_MAX);
+            float w     = M_PI * (float(rand()) / RAND_MAX);
+            b0[j]       = float(rand()) / RAND_MAX;
+            b1[j]       = float(rand()) / RAND_MAX - 0.5f;
+            b2[j]       = float(rand()) / RAND_MAX - 0.5f;
+            a1[j]       = 2.0f * r * cosf(w);
+            a2[j]       = -r * r;
+        }
+
+        for (size_t j=0; j<16; ++j)
+            f->d[j]     = (float(rand()) / RAND_MAX - 0.5f) * 0.1f;
+    }
+
+    void call(const char *label, size_t lanes, size_t channels, biquad_process_t native, biquad_process_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 16, 31, 64, 0x1ff)
+        {
+            for (size_t inplace=0; inplace < 2; ++inplace)
+            {
+                printf("Testing %s on input buffer size=%d, in-place=%d...\n", label, int(count), int(inplace));
+
+                FloatBuffer src(count * channels);
+                FloatBuffer dst1(count * channels);
+                FloatBuffer dst2(count * channels);
+                biquad_t f1 __lsp_aligned64;
+                biquad_t f2 __lsp_aligned64;
+
+                init_lanes(&f1, lanes);
+                f2      = f1;
+
+                // Apply processing
+                if (inplace)
+                {
+                    dst1.copy(src);
+                    dst2.copy(src);
+                    native(dst1, dst1, count, &f1);
+                    func(dst2, dst2, count, &f2);
+                }
+                else
+                {
+                    native(dst1, src, count, &f1);
+                    func(dst2, src, count, &f2);
+                }
+
+                // Perform validation
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+
+                for (size_t j=0; j<lanes*2; ++j)
+                {
+                    size_t k = (j < lanes) ? j : j - lanes + ((lanes > 4) ? 8 : 4);
+                    UTEST_ASSERT_MSG(float_equals_adaptive(f1.d[k], f2.d[k], TOLERANCE),
+                        "Filter memory of lane %d differs: %.6f vs %.6f", int(k), f1.d[k], f2.d[k]);
+                }
+            }
+        }
+    }
+
+    void check_reference(const char *label, size_t lanes, size_t channels, biquad_process_t func)
+    {
+        size_t count    = 0x1ff;
+        size_t stride   = (lanes > 4) ? 8 : 4;
+        size_t cascades = lanes / channels;
+
+        printf("Testing %s against the per-channel processing...\n", label);
+
+        FloatBuffer src(count * channels);
+        FloatBuffer dst1(count * channels);
+        FloatBuffer dst2(count * channels);
+        FloatBuffer tmp(count);
+        biquad_t f __lsp_aligned64;
+        biquad_t x1 __lsp_aligned64;
+
+        init_lanes(&f, lanes);
+
+        // Process each channel by the cascade of single filters
+        for (size_t c=0; c<channels; ++c)
+        {
+            for (size_t i=0; i<count; ++i)
+                tmp[i]      = src[i*channels + c];
+
+            for (size_t k=0; k<cascades; ++k)
+            {
+                size_t l    = k*channels + c;
+                x1.x1.b0    = (lanes > 4) ? f.x8.b0[l] : f.x4.b0[l];
+                x1.x1.b1    = (lanes > 4) ? f.x8.b1[l] : f.x4.b1[l];
+                x1.x1.b2    = (lanes > 4) ? f.x8.b2[l] : f.x4.b2[l];
+                x1.x1.a1    = (lanes > 4) ? f.x8.a1[l] : f.x4.a1[l];
+                x1.x1.a2    = (lanes > 4) ? f.x8.a2[l] : f.x4.a2[l];
+                x1.x1.p0    = 0.0f;
+                x1.x1.p1    = 0.0f;
+                x1.x1.p2    = 0.0f;
+                x1.d[0]     = f.d[l];
+                x1.d[1]     = f.d[l + stride];
+                native::biquad_process_x1(tmp, tmp, count, &x1);
+            }
+
+            for (size_t i=0; i<count; ++i)
+                dst1[i*channels + c]    = tmp[i];
+        }
+
+        func(dst2, src, count, &f);
+
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_adaptive(dst2, TOLERANCE))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of '%s' differs from reference at sample %d: %.6f vs %.6f",
+                    label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference("native::biquad_process_i2", 4, 2, native::biquad_process_i2);
+        check_reference("native::biquad_process_i4", 4, 4, native::biquad_process_i4);
+        check_reference("native::biquad_process_i8", 8, 8, native::biquad_process_i8);
+
+        #define CALL(native, func, lanes, channels) \
+            call(#func, lanes, channels, native, func)
+
+        IF_ARCH_X86(CALL(native::biquad_process_i2, sse::biquad_process_i2, 4, 2));
+        IF_ARCH_X86(CALL(native::biquad_process_i4, sse::biquad_process_i4, 4, 4));
+        IF_ARCH_X86(CALL(native::biquad_process_i8, sse::biquad_process_i8, 8, 8));
+        IF_ARCH_X86(CALL(native::biquad_process_i8, avx::biquad_process_i8, 8, 8));
+        IF_ARCH_X86(CALL(native::biquad_process_i8, avx::biquad_process_i8_fma3, 8, 8));
+
+        IF_ARCH_ARM(CALL(native::biquad_process_i2, neon_d32::biquad_process_i2, 4, 2));
+        IF_ARCH_ARM(CALL(native::biquad_process_i4, neon_d32::biquad_process_i4, 4, 4));
+        IF_ARCH_ARM(CALL(native::biquad_process_i8, neon_d32::biquad_process_i8, 8, 8));
+
+        IF_ARCH_AARCH64(CALL(native::biquad_process_i2, asimd::biquad_process_i2, 4, 2));
+        IF_ARCH_AARCH64(CALL(native::biquad_process_i4, asimd::biquad_process_i4, 4, 4));
+        IF_ARCH_AARCH64(CALL(native::biquad_process_i8, asimd::biquad_process_i8, 8, 8));
+    }
+
+UTEST_END
@@ -0,0 +1,122 @@
+/*
+ * interpolate.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <math.h>
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/helpers.h>
+#include <test/FloatBuffer.h>
+
+#define CASCADE_FLOATS      (sizeof(f_cascade_t) / sizeof(float))
+#define TOLERANCE           1e-5f
+
+namespace native
+{
+    void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count);
+    }
+
+    namespace avx
+    {
+        void interpolate_cascades(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count);
+    }
+)
+
+typedef void (* interpolate_cascades_t)(f_cascade_t *dst, const f_cascade_t *c1, const f_cascade_t *c2, size_t stride, size_t count);
+
+UTEST_BEGIN("dsp.filters", interpolate)
+
+    void init_anchors(f_cascade_t *c, size_t n)
+    {
+        for (size_t i=0; i<n; ++i)
+        {
+            for (size_t j=0; j<4; ++j)
+            {
+                c[i].t[j]   = float(rand()) / RAND_MAX - 0.5f;
+                c[i].b[j]   = float(rand()) / RAND_MAX;
+            }
+        }
+    }
+
+    void check_reference()
+    {
+        printf("Testing native::interpolate_cascades against the reference formula...\n");
+
+        f_cascade_t a[2], dst[16];
+        init_anchors(a, 2);
+        native::interpolate_cascades(dst, &a[0], &a[1], 1, 16);
+
+        for (size_t i=0; i<16; ++i)
+        {
+            float k     = i / 16.0f;
+            for (size_t j=0; j<4; ++j)
+            {
+                float t     = a[0].t[j] + (a[1].t[j] - a[0].t[j]) * k;
+                float b     = a[0].b[j] + (a[1].b[j] - a[0].b[j]) * k;
+                UTEST_ASSERT_MSG(float_equals_adaptive(dst[i].t[j], t, TOLERANCE),
+                        "Cascade %d t[%d] differs: %.6f vs %.6f", int(i), int(j), dst[i].t[j], t);
+                UTEST_ASSERT_MSG(float_equals_adaptive(dst[i].b[j], b, TOLERANCE),
+                        "Cascade %d b[%d] differs: %.6f vs %.6f", int(i), int(j), dst[i].b[j], b);
+            }
+        }
+    }
+
+    void call(const char *label, interpolate_cascades_t func)
+    {
+        if (!UTEST_SUPPORTED(func))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 8, 16, 31, 64, 0x1ff)
+        {
+            for (size_t stride=1; stride <= 8; stride += 3)
+            {
+                printf("Testing %s on count=%d, stride=%d...\n", label, int(count), int(stride));
+
+                FloatBuffer src(CASCADE_FLOATS * 2, 64, true);
+                FloatBuffer dst1(CASCADE_FLOATS * (stride * count + 1), 64, true);
+                FloatBuffer dst2(dst1);
+
+                f_cascade_t *a  = src.data<f_cascade_t>();
+                init_anchors(a, 2);
+
+                native::interpolate_cascades(dst1.data<f_cascade_t>(), &a[0], &a[1], stride, count);
+                func(dst2.data<f_cascade_t>(), &a[0], &a[1], stride, count);
+
+                UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                // Cascades between the strided ones should stay untouched
+                if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                {
+                    src.dump("src");
+                    dst1.dump("dst1");
+                    dst2.dump("dst2");
+                    UTEST_FAIL_MSG("Output of functions for test '%s' differs at index %d: %.6f vs %.6f",
+                            label, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        check_reference();
+
+        #define CALL(func) \
+            call(#func, func)
+
+        IF_ARCH_X86(CALL(sse::interpolate_cascades));
+        IF_ARCH_X86(CALL(avx::interpolate_cascades));
+    }
+
+UTEST_END
@@ -0,0 +1,206 @@
+/*
+ * convert.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/ByteBuffer.h>
+
+#define PCM_DECL \
+    void pcm_s16_to_f32(float *dst, const int16_t *src, size_t count); \
+    void pcm_s24le_to_f32(float *dst, const uint8_t *src, size_t count); \
+    void pcm_s24be_to_f32(float *dst, const uint8_t *src, size_t count); \
+    void pcm_s32_to_f32(float *dst, const int32_t *src, size_t count); \
+    void pcm_f64_to_f32(float *dst, const double *src, size_t count); \
+    void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count); \
+    void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count); \
+    void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count); \
+    void pcm_f32_to_s32(int32_t *dst, const float *src, size_t count); \
+    void pcm_f32_to_f64(double *dst, const float *src, size_t count);
+
+namespace native
+{
+    PCM_DECL
+}
+
+IF_ARCH_X86(
+    namespace sse2
+    {
+        PCM_DECL
+    }
+
+    namespace avx2
+    {
+        PCM_DECL
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void pcm_f32_to_s16(int16_t *dst, const float *src, size_t count);
+        void pcm_f32_to_s24le(uint8_t *dst, const float *src, size_t count);
+        void pcm_f32_to_s24be(uint8_t *dst, const float *src, size_t count);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        PCM_DECL
+    }
+)
+
+#undef PCM_DECL
+
+UTEST_BEGIN("dsp.pcm", convert)
+
+    void init_samples(ByteBuffer &buf, const float *, size_t count)
+    {
+        float *v = buf.data<float>();
+        for (size_t i=0; i<count; ++i)
+        {
+            switch (i % 7)
+            {
+                case 0:     v[i] = 1.0f; break;
+                case 3:     v[i] = -1.0f; break;
+                case 5:     v[i] = 0.0f; break;
+                default:    v[i] = (float(rand()) * 2.0f) / RAND_MAX - 1.0f; break;
+            }
+        }
+    }
+
+    void init_samples(ByteBuffer &buf, const double *, size_t count)
+    {
+        double *v = buf.data<double>();
+        for (size_t i=0; i<count; ++i)
+            v[i]    = (double(rand()) * 2.0) / RAND_MAX - 1.0;
+    }
+
+    void init_samples(ByteBuffer &buf, const void *, size_t count)
+    {
+        buf.randomize();
+    }
+
+    template <class D, class S>
+        void call(const char *label, size_t align,
+                void (* native)(D *dst, const S *src, size_t count),
+                void (* func)(D *dst, const S *src, size_t count),
+                size_t dsize, size_t ssize)
+        {
+            if (!UTEST_SUPPORTED(func))
+                return;
+
+            UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+                    18, 19, 20, 31, 32, 33, 64, 65, 100, 768, 999, 1024, 0x1fff)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s on %d samples, mask=0x%x...\n", label, int(count), int(mask));
+
+                    ByteBuffer src(count * ssize, align, mask & 0x01);
+                    init_samples(src, static_cast<const S *>(NULL), count);
+                    ByteBuffer dst1(count * dsize, align, mask & 0x02);
+                    ByteBuffer dst2(dst1);
+
+                    // Call functions
+                    native(dst1.data<D>(), src.data<S>(), count);
+                    func(dst2.data<D>(), src.data<S>(), count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers, the output should be bit-exact
+                    if (!dst1.equals(dst2))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs", label);
+                    }
+                }
+            }
+        }
+
+    void check_range()
+    {
+        // Check that full-scale values survive the round-trip
+        static const float values[] = { -1.0f, -0.5f, 0.0f, 0.5f, 1.0f };
+        float f[5];
+        int16_t s16[5];
+        uint8_t s24[15];
+        int32_t s32[5];
+
+        printf("Testing round-trip conversions...\n");
+
+        dsp::pcm_f32_to_s16(s16, values, 5);
+        UTEST_ASSERT((s16[0] == -0x7fff) && (s16[2] == 0) && (s16[4] == 0x7fff));
+        dsp::pcm_s16_to_f32(f, s16, 5);
+        UTEST_ASSERT((f[0] == -1.0f) && (f[2] == 0.0f) && (f[4] == 1.0f));
+
+        dsp::pcm_f32_to_s24le(s24, values, 5);
+        UTEST_ASSERT((s24[12] == 0xff) && (s24[13] == 0xff) && (s24[14] == 0x7f));
+        dsp::pcm_s24le_to_f32(f, s24, 5);
+        UTEST_ASSERT((f[0] == -1.0f) && (f[2] == 0.0f) && (f[4] == 1.0f));
+
+        dsp::pcm_f32_to_s24be(s24, values, 5);
+        UTEST_ASSERT((s24[12] == 0x7f) && (s24[13] == 0xff) && (s24[14] == 0xff));
+        dsp::pcm_s24be_to_f32(f, s24, 5);
+        UTEST_ASSERT((f[0] == -1.0f) && (f[2] == 0.0f) && (f[4] == 1.0f));
+
+        dsp::pcm_f32_to_s32(s32, values, 5);
+        UTEST_ASSERT((s32[0] == -0x7fffffff) && (s32[2] == 0) && (s32[4] == 0x7fffffff));
+        dsp::pcm_s32_to_f32(f, s32, 5);
+        UTEST_ASSERT((f[0] == -1.0f) && (f[2] == 0.0f) && (f[4] == 1.0f));
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(native, func, align, dsize, ssize) \
+            call(#func, align, native, func, dsize, ssize)
+
+        check_range();
+
+        IF_ARCH_X86(CALL(native::pcm_s16_to_f32, sse2::pcm_s16_to_f32, 16, 4, 2));
+        IF_ARCH_X86(CALL(native::pcm_s24le_to_f32, sse2::pcm_s24le_to_f32, 16, 4, 3));
+        IF_ARCH_X86(CALL(native::pcm_s24be_to_f32, sse2::pcm_s24be_to_f32, 16, 4, 3));
+        IF_ARCH_X86(CALL(native::pcm_s32_to_f32, sse2::pcm_s32_to_f32, 16, 4, 4));
+        IF_ARCH_X86(CALL(native::pcm_f64_to_f32, sse2::pcm_f64_to_f32, 16, 4, 8));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s16, sse2::pcm_f32_to_s16, 16, 2, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s24le, sse2::pcm_f32_to_s24le, 16, 3, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s24be, sse2::pcm_f32_to_s24be, 16, 3, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s32, sse2::pcm_f32_to_s32, 16, 4, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_f64, sse2::pcm_f32_to_f64, 16, 8, 4));
+
+        IF_ARCH_X86(CALL(native::pcm_s16_to_f32, avx2::pcm_s16_to_f32, 32, 4, 2));
+        IF_ARCH_X86(CALL(native::pcm_s24le_to_f32, avx2::pcm_s24le_to_f32, 32, 4, 3));
+        IF_ARCH_X86(CALL(native::pcm_s24be_to_f32, avx2::pcm_s24be_to_f32, 32, 4, 3));
+        IF_ARCH_X86(CALL(native::pcm_s32_to_f32, avx2::pcm_s32_to_f32, 32, 4, 4));
+        IF_ARCH_X86(CALL(native::pcm_f64_to_f32, avx2::pcm_f64_to_f32, 32, 4, 8));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s16, avx2::pcm_f32_to_s16, 32, 2, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s24le, avx2::pcm_f32_to_s24le, 32, 3, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s24be, avx2::pcm_f32_to_s24be, 32, 3, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_s32, avx2::pcm_f32_to_s32, 32, 4, 4));
+        IF_ARCH_X86(CALL(native::pcm_f32_to_f64, avx2::pcm_f32_to_f64, 32, 8, 4));
+
+        IF_ARCH_ARM(CALL(native::pcm_f32_to_s16, neon_d32::pcm_f32_to_s16, 16, 2, 4));
+        IF_ARCH_ARM(CALL(native::pcm_f32_to_s24le, neon_d32::pcm_f32_to_s24le, 16, 3, 4));
+        IF_ARCH_ARM(CALL(native::pcm_f32_to_s24be, neon_d32::pcm_f32_to_s24be, 16, 3, 4));
+
+        IF_ARCH_AARCH64(CALL(native::pcm_s16_to_f32, asimd::pcm_s16_to_f32, 16, 4, 2));
+        IF_ARCH_AARCH64(CALL(native::pcm_s24le_to_f32, asimd::pcm_s24le_to_f32, 16, 4, 3));
+        IF_ARCH_AARCH64(CALL(native::pcm_s24be_to_f32, asimd::pcm_s24be_to_f32, 16, 4, 3));
+        IF_ARCH_AARCH64(CALL(native::pcm_s32_to_f32, asimd::pcm_s32_to_f32, 16, 4, 4));
+        IF_ARCH_AARCH64(CALL(native::pcm_f64_to_f32, asimd::pcm_f64_to_f32, 16, 4, 8));
+        IF_ARCH_AARCH64(CALL(native::pcm_f32_to_s16, asimd::pcm_f32_to_s16, 16, 2, 4));
+        IF_ARCH_AARCH64(CALL(native::pcm_f32_to_s24le, asimd::pcm_f32_to_s24le, 16, 3, 4));
+        IF_ARCH_AARCH64(CALL(native::pcm_f32_to_s24be, asimd::pcm_f32_to_s24be, 16, 3, 4));
+        IF_ARCH_AARCH64(CALL(native::pcm_f32_to_s32, asimd::pcm_f32_to_s32, 16, 4, 4));
+        IF_ARCH_AARCH64(CALL(native::pcm_f32_to_f64, asimd::pcm_f32_to_f64, 16, 8, 4));
+    }
+
+UTEST_END
@@ -0,0 +1,101 @@
+/*
+ * halfband.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+    void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+    }
+
+    namespace avx
+    {
+        void halfband_upsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_upsample_2x_fma3(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_downsample_2x(float *dst, const float *src, const float *k, size_t taps, size_t count);
+        void halfband_downsample_2x_fma3(float *dst, const float *src, const float *k, size_t taps, size_t count);
+    }
+)
+
+typedef void (* halfband_func_t)(float *dst, const float *src, const float *k, size_t taps, size_t count);
+
+UTEST_BEGIN("dsp.resampling", halfband)
+
+    void call(const char *text, size_t align, bool up, halfband_func_t func1, halfband_func_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 31, 32, 33, 100, 999)
+        {
+            for (size_t taps=4; taps <= 32; taps += 4)
+            {
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s for %d samples, taps=%d, mask=0x%x...\n",
+                            text, int(count), int(taps), int(mask));
+
+                    // The source buffer contains history before the processed range
+                    size_t in_len   = (up) ? count + taps - 1 : 2*count + 2*taps - 2;
+                    size_t out_len  = (up) ? count * 2 : count;
+
+                    FloatBuffer k(taps, align, mask & 0x01);
+                    FloatBuffer src(in_len, align, mask & 0x01);
+                    FloatBuffer dst1(out_len, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    // Call functions
+                    func1(dst1, src, k, taps, count);
+                    func2(dst2, src, k, taps, count);
+
+                    UTEST_ASSERT_MSG(k.valid(), "Kernel buffer corrupted");
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                text, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(native, func, align, up) \
+            call(#func, align, up, native, func)
+
+        // Do tests
+        IF_ARCH_X86(CALL(native::halfband_upsample_2x, sse::halfband_upsample_2x, 16, true));
+        IF_ARCH_X86(CALL(native::halfband_upsample_2x, avx::halfband_upsample_2x, 32, true));
+        IF_ARCH_X86(CALL(native::halfband_upsample_2x, avx::halfband_upsample_2x_fma3, 32, true));
+        IF_ARCH_X86(CALL(native::halfband_downsample_2x, sse::halfband_downsample_2x, 16, false));
+        IF_ARCH_X86(CALL(native::halfband_downsample_2x, avx::halfband_downsample_2x, 32, false));
+        IF_ARCH_X86(CALL(native::halfband_downsample_2x, avx::halfband_downsample_2x_fma3, 32, false));
+    }
+UTEST_END;
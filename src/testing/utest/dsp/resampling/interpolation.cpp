@@ -0,0 +1,109 @@
+/*
+ * interpolation.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <test/FloatBuffer.h>
+
+#define TOLERANCE       1e-5f
+
+namespace native
+{
+    void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+}
+
+IF_ARCH_X86(
+    namespace sse
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+
+    namespace avx
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+)
+
+IF_ARCH_ARM(
+    namespace neon_d32
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+)
+
+IF_ARCH_AARCH64(
+    namespace asimd
+    {
+        void cubic_interpolate(float *dst, const float *src, float pos, float step, size_t count);
+    }
+)
+
+typedef void (* cubic_interpolate_t)(float *dst, const float *src, float pos, float step, size_t count);
+
+UTEST_BEGIN("dsp.resampling", interpolation)
+
+    void call(const char *text, size_t align, cubic_interpolate_t func1, cubic_interpolate_t func2)
+    {
+        if (!UTEST_SUPPORTED(func1))
+            return;
+        if (!UTEST_SUPPORTED(func2))
+            return;
+
+        static const float steps[] = { 0.25f, 0.7071f, 1.0f, 1.0594631f, 1.5f, 2.9f };
+
+        UTEST_FOREACH(count, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17,
+                32, 63, 64, 100, 999)
+        {
+            for (size_t i=0; i<sizeof(steps)/sizeof(float); ++i)
+            {
+                float step  = steps[i];
+                float pos   = 0.3f * i;
+
+                for (size_t mask=0; mask <= 0x03; ++mask)
+                {
+                    printf("Testing %s interpolation for %d samples, step=%.4f, mask=0x%x...\n",
+                            text, int(count), step, int(mask));
+
+                    // The source buffer contains one sample before and two samples after the range
+                    FloatBuffer src(size_t(pos + count * step) + 4, align, mask & 0x01);
+                    FloatBuffer dst1(count, align, mask & 0x02);
+                    FloatBuffer dst2(dst1);
+
+                    // Call functions
+                    func1(dst1, &src[1], pos, step, count);
+                    func2(dst2, &src[1], pos, step, count);
+
+                    UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+                    UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+                    UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+
+                    // Compare buffers
+                    if (!dst1.equals_adaptive(dst2, TOLERANCE))
+                    {
+                        src.dump("src");
+                        dst1.dump("dst1");
+                        dst2.dump("dst2");
+                        UTEST_FAIL_MSG("Output of functions for test '%s' differs at sample %d: %.6f vs %.6f",
+                                text, int(dst1.last_diff()), dst1.get_diff(), dst2.get_diff());
+                    }
+                }
+            }
+        }
+    }
+
+    UTEST_MAIN
+    {
+        #define CALL(native, func, align) \
+            call(#func, align, native, func)
+
+        // Do tests
+        IF_ARCH_X86(CALL(native::cubic_interpolate, sse::cubic_interpolate, 16));
+        IF_ARCH_X86(CALL(native::cubic_interpolate, avx::cubic_interpolate, 32));
+        IF_ARCH_ARM(CALL(native::cubic_interpolate, neon_d32::cubic_interpolate, 16));
+        IF_ARCH_AARCH64(CALL(native::cubic_interpolate, asimd::cubic_interpolate, 16));
+    }
+UTEST_END;
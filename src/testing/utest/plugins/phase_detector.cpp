@@ -0,0 +1,192 @@
+/*
+ * phase_detector.cpp
+ *
+ *  Created on: 18 окт. 2026 г.
+ *      Author: sadko
+ */
+
+#include <dsp/dsp.h>
+#include <test/utest.h>
+#include <core/sugar.h>
+#include <plugins/phase_detector.h>
+
+#include <stdlib.h>
+
+#define SAMPLE_RATE         48000
+#define TIME_INTERVAL       10.0f
+#define REACTIVITY          0.05f
+#define PASSES              8
+#define TOLERANCE           1e-3f
+
+using namespace lsp;
+
+namespace lsp
+{
+    // Gives access to internals of the phase detector
+    class test_phase_detector: public phase_detector
+    {
+        public:
+            void init(long sr, float interval, float reactivity)
+            {
+                fSampleRate         = sr;
+                fTimeInterval       = interval;
+                fReactivity         = reactivity;
+                update_sample_rate(sr);
+            }
+
+            inline size_t fft_thresh() const    { return nFftThresh;    }
+            inline size_t fft_block() const     { return nFftBlock;     }
+            inline size_t func_size() const     { return nFuncSize;     }
+            inline const float *function() const    { return vFunction;     }
+            inline const float *accumulated() const { return vAccumulated;  }
+            inline size_t pending() const       { return nGapSize - nGapOffset; }
+
+            // Process samples in the same way as the plugin does
+            inline void accumulate(const float *a, const float *b, size_t count)
+            {
+                phase_detector::correlate(a, b, count);
+            }
+
+            // Process samples, each correlation call takes at most block samples
+            void correlate(const float *a, const float *b, size_t count, size_t block, bool fft)
+            {
+                while (count > 0)
+                {
+                    size_t filled   = fillGap(a, b, count);
+                    a              += filled;
+                    b              += filled;
+                    count          -= filled;
+
+                    while (nGapOffset < nGapSize)
+                    {
+                        size_t n        = lsp_min(nGapSize - nGapOffset, block);
+                        if (fft)
+                            correlateFFT(lsp_min(n, nFftBlock));
+                        else
+                            correlateDirect(n);
+                    }
+                }
+            }
+    };
+}
+
+UTEST_BEGIN("plugins", phase_detector)
+
+    void check_block(const float *a, const float *b, size_t count, size_t block)
+    {
+        test_phase_detector direct, fft;
+        direct.init(SAMPLE_RATE, TIME_INTERVAL, REACTIVITY);
+        fft.init(SAMPLE_RATE, TIME_INTERVAL, REACTIVITY);
+
+        printf("Testing block size=%d (threshold=%d, fft block=%d)...\n",
+                int(block), int(fft.fft_thresh()), int(fft.fft_block()));
+
+        for (size_t i=0; i<PASSES; ++i)
+        {
+            direct.correlate(a, b, count, block, false);
+            fft.correlate(a, b, count, block, true);
+        }
+
+        size_t n        = direct.func_size();
+        float fmax      = dsp::abs_max(direct.function(), n);
+        float amax      = dsp::abs_max(direct.accumulated(), n);
+        UTEST_ASSERT((fmax > 0.0f) && (amax > 0.0f));
+
+        for (size_t i=0; i<n; ++i)
+        {
+            float df        = fabs(direct.function()[i] - fft.function()[i]);
+            float da        = fabs(direct.accumulated()[i] - fft.accumulated()[i]);
+            UTEST_ASSERT_MSG(df <= fmax * TOLERANCE,
+                    "vFunction[%d] differs: direct=%f, fft=%f",
+                    int(i), direct.function()[i], fft.function()[i]);
+            UTEST_ASSERT_MSG(da <= amax * TOLERANCE,
+                    "vAccumulated[%d] differs: direct=%f, fft=%f",
+                    int(i), direct.accumulated()[i], fft.accumulated()[i]);
+        }
+    }
+
+    void check_accumulate(const float *a, const float *b, size_t count, size_t block, float interval)
+    {
+        test_phase_detector direct, acc;
+        direct.init(SAMPLE_RATE, interval, REACTIVITY);
+        acc.init(SAMPLE_RATE, interval, REACTIVITY);
+
+        printf("Testing accumulation of host buffers size=%d, interval=%.1f ms (fft block=%d)...\n",
+                int(block), interval, int(acc.fft_block()));
+
+        // Small host buffers should be accumulated and processed by FFT blocks
+        size_t processed = 0;
+        for (size_t i=0; i<PASSES; ++i)
+        {
+            for (size_t off=0; off < count; )
+            {
+                size_t n        = lsp_min(block, count - off);
+                size_t pending  = acc.pending();
+                acc.accumulate(&a[off], &b[off], n);
+                UTEST_ASSERT(acc.pending() < lsp_max(acc.fft_block(), size_t(1)));
+
+                // Samples processed by the call are processed directly by the reference
+                size_t done     = pending + n - acc.pending();
+                for (size_t j=0; j<done; )
+                {
+                    size_t k        = (processed + j) % count;
+                    size_t m        = lsp_min(done - j, count - k);
+                    direct.correlate(&a[k], &b[k], m, m, false);
+                    j              += m;
+                }
+                processed      += done;
+                off            += n;
+            }
+        }
+        UTEST_ASSERT(processed > 0);
+
+        size_t n        = direct.func_size();
+        float fmax      = dsp::abs_max(direct.function(), n);
+        float amax      = dsp::abs_max(direct.accumulated(), n);
+        for (size_t i=0; i<n; ++i)
+        {
+            UTEST_ASSERT_MSG(fabs(direct.function()[i] - acc.function()[i]) <= fmax * TOLERANCE,
+                    "vFunction[%d] differs: direct=%f, accumulated=%f",
+                    int(i), direct.function()[i], acc.function()[i]);
+            UTEST_ASSERT_MSG(fabs(direct.accumulated()[i] - acc.accumulated()[i]) <= amax * TOLERANCE,
+                    "vAccumulated[%d] differs: direct=%f, accumulated=%f",
+                    int(i), direct.accumulated()[i], acc.accumulated()[i]);
+        }
+    }
+
+    UTEST_MAIN
+    {
+        test_phase_detector pd;
+        pd.init(SAMPLE_RATE, TIME_INTERVAL, REACTIVITY);
+        size_t thresh   = pd.fft_thresh();
+        size_t fblock   = pd.fft_block();
+        UTEST_ASSERT((thresh > 1) && (thresh <= fblock));
+
+        size_t count    = fblock * 3 + 17;
+        float *a        = new float[count];
+        float *b        = new float[count];
+        UTEST_ASSERT((a != NULL) && (b != NULL));
+
+        srand(0);
+        for (size_t i=0; i<count; ++i)
+        {
+            a[i]            = float(rand()) / RAND_MAX - 0.5f;
+            b[i]            = float(rand()) / RAND_MAX - 0.5f;
+        }
+
+        const size_t blocks[] = { 1, thresh / 2, thresh - 1, thresh, thresh + 1, fblock };
+        for (size_t i=0; i<sizeof(blocks)/sizeof(size_t); ++i)
+            check_block(a, b, count, lsp_max(blocks[i], size_t(1)));
+
+        // The longest interval has FFT block larger than the gap, the gap is processed when it's full
+        UTEST_FOREACH(block, 32, 64, 256, 1000)
+        {
+            check_accumulate(a, b, count, block, TIME_INTERVAL);
+            check_accumulate(a, b, count, block, phase_detector_metadata::DETECT_TIME_MAX);
+        }
+
+        delete [] a;
+        delete [] b;
+    }
+
+UTEST_END
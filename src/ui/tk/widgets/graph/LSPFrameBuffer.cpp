@@ -9,6 +9,9 @@
 #include <core/sugar.h>
 #include <dsp/dsp.h>
 
+#define PALETTE_SIZE        0x1000      /* Number of colors in palette lookup table */
+#define PALETTE_BLOCK       0x100       /* Number of palette colors computed at once */
+
 namespace lsp
 {
     namespace tk
@@ -23,6 +26,7 @@ namespace lsp
             nCurrRow    = 0;
             vData       = NULL;
             vTempRGBA   = NULL;
+            vPalette    = NULL;
             pData       = NULL;
 
             fTransparency    = 1.0f;
@@ -66,6 +70,7 @@ namespace lsp
                 pData = NULL;
             }
             vTempRGBA   = NULL;
+            vPalette    = NULL;
         }
 
         void LSPFrameBuffer::allocate_buffer()
@@ -75,8 +80,17 @@ namespace lsp
                 return;
 
             amount     += nCols * 4; // RGBA x number of columns for temporary buffer
+            amount     += PALETTE_SIZE; // Palette lookup table
             vData       = alloc_aligned<float>(pData, amount, ALIGN64);
+            if (vData == NULL)
+                return;
+
             vTempRGBA   = &vData[nRows * nCols];
+            vPalette    = reinterpret_cast<uint32_t *>(&vTempRGBA[nCols * 4]);
+
+            // Frame buffer is empty, the surface should be completely redrawn
+            dsp::fill_zero(vData, nRows * nCols);
+            bClear      = true;
         }
 
         float *LSPFrameBuffer::get_buffer()
@@ -323,6 +337,33 @@ namespace lsp
             dsp::hsla_to_rgba(rgba, rgba, n);
         }
 
+        void LSPFrameBuffer::build_palette()
+        {
+            // Palette functions convert each value independently, so the
+            // colors can be computed once for the whole range of values
+            float v[PALETTE_BLOCK];
+            float k         = 1.0f / (PALETTE_SIZE - 1);
+            size_t block    = lsp_min(nCols, size_t(PALETTE_BLOCK));
+
+            for (size_t i=0; i<PALETTE_SIZE; )
+            {
+                size_t n        = lsp_min(block, size_t(PALETTE_SIZE - i));
+                for (size_t j=0; j<n; ++j)
+                    v[j]            = (i + j) * k;
+                (this->*pCalcColor)(vTempRGBA, v, n);
+                dsp::rgba_to_bgra32(&vPalette[i], vTempRGBA, n);
+                i              += n;
+            }
+        }
+
+        void LSPFrameBuffer::colorize(uint32_t *dst, const float *v, size_t n)
+        {
+            // Values are limited to 0..1 range by append_data()
+            const float k   = PALETTE_SIZE - 1;
+            for (size_t i=0; i<n; ++i)
+                dst[i]          = vPalette[size_t(v[i] * k + 0.5f)];
+        }
+
         void LSPFrameBuffer::render(ISurface *s, bool force)
         {
             // Check size
@@ -351,23 +392,24 @@ namespace lsp
                 if (xp == NULL)
                     return;
 
-                // Do not draw more than can
-                if ((nChanges >= nRows) || (bClear))
+                // Update palette and do not draw more than can
+                if (bClear)
+                {
+                    build_palette();
+                    nChanges    = nRows;
+                }
+                else if (nChanges >= nRows)
                     nChanges    = nRows;
 
-                // Shift buffer
+                // The surface is a ring buffer: data row is stored at (nRows - 1 - row)
+                // surface row, so the surface does not need to be shifted
                 size_t stride = pp->stride();
-                ::memmove(&xp[stride * nChanges], xp, (nRows - nChanges) * stride);
-
-                // Draw dots
-                Color c(1.0f, 0.0f, 0.0f);
                 size_t row = (nCurrRow + nRows - 1) % nRows;
 
-                for (size_t i=0; i<nChanges; ++i, xp += stride)
+                for (size_t i=0; i<nChanges; ++i)
                 {
-                    const float *p = &vData[row * nCols];
-                    (this->*pCalcColor)(rgba, p, nCols);
-                    dsp::rgba_to_bgra32(xp, rgba, nCols);
+                    uint32_t *dst = reinterpret_cast<uint32_t *>(&xp[(nRows - 1 - row) * stride]);
+                    colorize(dst, &vData[row * nCols], nCols);
                     row = (row + nRows - 1) % nRows;
                 }
 
@@ -379,6 +421,7 @@ namespace lsp
 
             // Draw surface on the target
             float x, y, sx, sy;
+            float rx, ry, cx, cy;   // Direction of rows and columns on the target
             float ra = -0.5f * nAngle * M_PI;
 
             x = 0.5f * (fHPos + 1.0f) * s->width();
@@ -389,6 +432,8 @@ namespace lsp
                 case 0:
                     sx = fWidth * s->width() / nCols;
                     sy = fHeight * s->height() / nRows;
+                    cx = sx;    cy = 0.0f;
+                    rx = 0.0f;  ry = sy;
 
                     if (sx < 0.0f)
                         x       -= sx * nCols;
@@ -399,6 +444,8 @@ namespace lsp
                 case 1:
                     sx = fWidth * s->width() / nRows;
                     sy = fHeight * s->height() / nCols;
+                    cx = 0.0f;  cy = -sy;
+                    rx = sx;    ry = 0.0f;
 
                     if (sx < 0.0f)
                         x       -= sx * nRows;
@@ -409,6 +456,8 @@ namespace lsp
                 case 2:
                     sx = fWidth * s->width() / nCols;
                     sy = fHeight * s->height() / nRows;
+                    cx = -sx;   cy = 0.0f;
+                    rx = 0.0f;  ry = -sy;
 
                     if (sx > 0.0f)
                         x       += sx * nCols;
@@ -419,6 +468,8 @@ namespace lsp
                 case 3:
                     sx = fWidth * s->width() / nRows;
                     sy = fHeight * s->height() / nCols;
+                    cx = 0.0f;  cy = sy;
+                    rx = -sx;   ry = 0.0f;
 
                     if (sx > 0.0f)
                         x       += sx * nRows;
@@ -427,10 +478,25 @@ namespace lsp
                     break;
 
                 default:
-                    break;
+                    return;
+            }
+
+            // Surface row that contains the latest data
+            size_t head = nRows - 1 - (nCurrRow + nRows - 1) % nRows;
+            if (head == 0)
+            {
+                s->draw_rotate_alpha(pp, x, y, sx, sy, ra, fTransparency);
+                return;
             }
 
-            s->draw_rotate_alpha(pp, x, y, sx, sy, ra, fTransparency);
+            // Draw the ring buffer as two parts shifted along rows, clipped by the image area
+            float x1    = x + cx * nCols + rx * nRows;
+            float y1    = y + cy * nCols + ry * nRows;
+
+            s->clip_begin(lsp_min(x, x1), lsp_min(y, y1), fabs(x1 - x), fabs(y1 - y));
+            s->draw_rotate_alpha(pp, x - rx * head, y - ry * head, sx, sy, ra, fTransparency);
+            s->draw_rotate_alpha(pp, x + rx * (nRows - head), y + ry * (nRows - head), sx, sy, ra, fTransparency);
+            s->clip_end();
         }
     } /* namespace tk */
 } /* namespace lsp */